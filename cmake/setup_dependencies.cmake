@@ -90,6 +90,7 @@ superbuild_depend(glad_rapids)
 superbuild_depend(tensorrt)
 superbuild_depend(ajantv2_rapids)
 superbuild_depend(ucx)
+superbuild_depend(compression)
 
 # Testing dependencies
 if(HOLOSCAN_BUILD_TESTS)
@@ -0,0 +1,110 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ucx_coalescing_receiver.hpp"
+
+#include <utility>
+
+#include "ucx_message_batch.hpp"
+
+namespace nvidia {
+namespace gxf {
+
+gxf_result_t UcxCoalescingReceiver::deinitialize() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ready_.clear();
+  }
+  return UcxReceiver::deinitialize();
+}
+
+gxf_result_t UcxCoalescingReceiver::pop_abi(gxf_uid_t* uid) {
+  if (uid == nullptr) { return GXF_ARGUMENT_NULL; }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (ready_.empty()) {
+    gxf_result_t code = refill_locked();
+    if (code != GXF_SUCCESS) { return code; }
+    if (ready_.empty()) { return GXF_FAILURE; }
+  }
+
+  // The caller owns the returned reference.
+  const gxf_uid_t eid = ready_.front().eid();
+  const gxf_result_t code = GxfEntityRefCountInc(context(), eid);
+  if (code != GXF_SUCCESS) { return code; }
+  ready_.pop_front();
+  *uid = eid;
+  return GXF_SUCCESS;
+}
+
+gxf_result_t UcxCoalescingReceiver::receive_abi(gxf_uid_t* uid) {
+  return pop_abi(uid);
+}
+
+gxf_result_t UcxCoalescingReceiver::peek_abi(gxf_uid_t* uid, int32_t index) {
+  if (uid == nullptr) { return GXF_ARGUMENT_NULL; }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (index < 0) { return GXF_FAILURE; }
+  if (static_cast<size_t>(index) >= ready_.size()) {
+    gxf_result_t code = refill_locked();
+    if (code != GXF_SUCCESS) { return code; }
+    if (static_cast<size_t>(index) >= ready_.size()) { return GXF_FAILURE; }
+  }
+  *uid = ready_[index].eid();
+  return GXF_SUCCESS;
+}
+
+size_t UcxCoalescingReceiver::size_abi() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  // entities left in the UcxReceiver queue hold at least one message each
+  return ready_.size() + UcxReceiver::size_abi();
+}
+
+gxf_result_t UcxCoalescingReceiver::sync_abi() {
+  gxf_result_t code = UcxReceiver::sync_abi();
+  if (code != GXF_SUCCESS) { return code; }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  return refill_locked();
+}
+
+gxf_result_t UcxCoalescingReceiver::refill_locked() {
+  const size_t capacity = UcxReceiver::capacity_abi();
+  while (ready_.size() < capacity && UcxReceiver::size_abi() > 0) {
+    gxf_uid_t uid = kNullUid;
+    gxf_result_t code = UcxReceiver::pop_abi(&uid);
+    if (code != GXF_SUCCESS) { return code; }
+    auto entity = Entity::Own(context(), uid);
+    if (!entity) { return entity.error(); }
+
+    if (!IsMessageBatch(entity.value())) {
+      ready_.push_back(std::move(entity.value()));
+      continue;
+    }
+    auto messages = UnpackMessageBatch(context(), entity.value());
+    if (!messages) {
+      GXF_LOG_ERROR("Unable to unpack the message batch received by '%s'", name());
+      return messages.error();
+    }
+    for (auto& message : messages.value()) { ready_.push_back(std::move(message)); }
+  }
+  return GXF_SUCCESS;
+}
+
+}  // namespace gxf
+}  // namespace nvidia
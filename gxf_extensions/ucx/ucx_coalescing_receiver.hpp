@@ -0,0 +1,60 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NVIDIA_GXF_UCX_HOLOSCAN_UCX_COALESCING_RECEIVER_HPP_
+#define NVIDIA_GXF_UCX_HOLOSCAN_UCX_COALESCING_RECEIVER_HPP_
+
+#include <deque>
+#include <mutex>
+
+#include "gxf/core/entity.hpp"
+#include "gxf/ucx/ucx_receiver.hpp"
+
+namespace nvidia {
+namespace gxf {
+
+// UcxReceiver unpacking the message batches sent by a UcxCoalescingTransmitter.
+//
+// Entities received over UCX are moved to a local queue on sync, and when the operator pops a
+// message while the local queue is empty. Batches are split back into one entity per original
+// message, so that the operator sees the same sequence of messages as without coalescing. Entities
+// that are not batches are queued as they are. Entities are only moved while the local queue holds
+// fewer than 'capacity' messages, so it holds at most 'capacity' messages plus the rest of one
+// batch; the other entities stay in the UcxReceiver queue, where 'policy' applies.
+class UcxCoalescingReceiver : public UcxReceiver {
+ public:
+  gxf_result_t deinitialize() override;
+
+  gxf_result_t pop_abi(gxf_uid_t* uid) override;
+  gxf_result_t receive_abi(gxf_uid_t* uid) override;
+  gxf_result_t peek_abi(gxf_uid_t* uid, int32_t index) override;
+  size_t size_abi() override;
+  gxf_result_t sync_abi() override;
+
+ private:
+  // Moves entities from the UcxReceiver queue to the local queue, up to the capacity. mutex_ must
+  // be held.
+  gxf_result_t refill_locked();
+
+  std::mutex mutex_;
+  std::deque<Entity> ready_;
+};
+
+}  // namespace gxf
+}  // namespace nvidia
+
+#endif  // NVIDIA_GXF_UCX_HOLOSCAN_UCX_COALESCING_RECEIVER_HPP_
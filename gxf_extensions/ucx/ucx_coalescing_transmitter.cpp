@@ -0,0 +1,215 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ucx_coalescing_transmitter.hpp"
+
+#include <chrono>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "ucx_message_batch.hpp"
+
+namespace nvidia {
+namespace gxf {
+
+gxf_result_t UcxCoalescingTransmitter::registerInterface(Registrar* registrar) {
+  gxf_result_t code = UcxTransmitter::registerInterface(registrar);
+  if (code != GXF_SUCCESS) { return code; }
+
+  Expected<void> result;
+  result &= registrar->parameter(coalescing_window_us_,
+                                 "coalescing_window_us",
+                                 "Coalescing window",
+                                 "Maximum time (in microseconds) a message is kept to be coalesced "
+                                 "with the next ones",
+                                 static_cast<int64_t>(50));
+  result &= registrar->parameter(max_batch_size_,
+                                 "max_batch_size",
+                                 "Maximum batch size",
+                                 "Maximum number of messages coalesced into a single send",
+                                 static_cast<uint64_t>(64));
+  return ToResultCode(result);
+}
+
+gxf_result_t UcxCoalescingTransmitter::initialize() {
+  gxf_result_t code = UcxTransmitter::initialize();
+  if (code != GXF_SUCCESS) { return code; }
+
+  if (coalescing_window_us_.get() < 0 || max_batch_size_.get() == 0) {
+    GXF_LOG_ERROR("Invalid coalescing parameters (window: %ld us, max batch size: %lu)",
+                  coalescing_window_us_.get(),
+                  max_batch_size_.get());
+    return GXF_ARGUMENT_INVALID;
+  }
+
+  return GXF_SUCCESS;
+}
+
+gxf_result_t UcxCoalescingTransmitter::deinitialize() {
+  {
+    // send the messages queued since the last flush (e.g., after the last tick of a source)
+    std::lock_guard<std::mutex> lock(mutex_);
+    const size_t num_pending = pending_.size();
+    if (flush_locked() != GXF_SUCCESS) {
+      GXF_LOG_ERROR("Unable to send the %zu coalesced messages of transmitter '%s'",
+                    num_pending,
+                    name());
+      pending_.clear();
+    }
+  }
+  return UcxTransmitter::deinitialize();
+}
+
+gxf_result_t UcxCoalescingTransmitter::push_abi(gxf_uid_t other) {
+  auto entity = Entity::Shared(context(), other);
+  if (!entity) { return entity.error(); }
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (!IsCoalescableMessage(entity.value())) {
+    // keep the message order
+    gxf_result_t code = flush_locked();
+    if (code != GXF_SUCCESS) { return code; }
+    return UcxTransmitter::push_abi(other);
+  }
+
+  const bool was_empty = pending_.empty();
+  if (was_empty) { first_pending_time_ = std::chrono::steady_clock::now(); }
+  pending_.push_back(std::move(entity.value()));
+  if (pending_.size() >= max_batch_size_.get()) { return flush_locked(); }
+  // wake up the flush entity so that it waits for the new deadline
+  if (was_empty && flush_eid_ != kNullUid) { GxfEntityEventNotify(context(), flush_eid_); }
+  return GXF_SUCCESS;
+}
+
+gxf_result_t UcxCoalescingTransmitter::sync_abi() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  return UcxTransmitter::sync_abi();
+}
+
+gxf_result_t UcxCoalescingTransmitter::sync_io_abi() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  // Called at the end of each tick of the operator. Queued messages that are not due yet are sent
+  // by the flush entity at their deadline if the operator does not tick again before.
+  const auto deadline =
+      first_pending_time_ + std::chrono::microseconds(coalescing_window_us_.get());
+  if (!pending_.empty() && std::chrono::steady_clock::now() >= deadline) { return flush_locked(); }
+  return UcxTransmitter::sync_io_abi();
+}
+
+size_t UcxCoalescingTransmitter::back_size_abi() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  return UcxTransmitter::back_size_abi() + pending_.size();
+}
+
+std::optional<std::chrono::steady_clock::time_point> UcxCoalescingTransmitter::flush_deadline() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (pending_.empty()) { return std::nullopt; }
+  return first_pending_time_ + std::chrono::microseconds(coalescing_window_us_.get());
+}
+
+gxf_result_t UcxCoalescingTransmitter::flush_if_due() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  const auto deadline =
+      first_pending_time_ + std::chrono::microseconds(coalescing_window_us_.get());
+  if (pending_.empty() || std::chrono::steady_clock::now() < deadline) { return GXF_SUCCESS; }
+  return flush_locked();
+}
+
+void UcxCoalescingTransmitter::set_flush_entity(gxf_uid_t eid) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  flush_eid_ = eid;
+}
+
+gxf_result_t UcxCoalescingTransmitter::flush_locked() {
+  if (pending_.empty()) { return GXF_SUCCESS; }
+
+  std::vector<Entity> entities;
+  entities.swap(pending_);
+
+  gxf_result_t code = GXF_SUCCESS;
+  if (entities.size() == 1) {
+    // a single message is sent as is
+    code = UcxTransmitter::push_abi(entities[0].eid());
+  } else {
+    auto batch = PackMessageBatch(context(), entities);
+    if (!batch) {
+      GXF_LOG_ERROR("Unable to pack %zu messages for transmitter '%s'", entities.size(), name());
+      return batch.error();
+    }
+    code = UcxTransmitter::push_abi(batch->eid());
+  }
+  if (code != GXF_SUCCESS) { return code; }
+
+  // Send now so that the queue never holds more than one entity (the capacity is usually 1).
+  code = UcxTransmitter::sync_abi();
+  if (code != GXF_SUCCESS) { return code; }
+  return UcxTransmitter::sync_io_abi();
+}
+
+gxf_result_t UcxCoalescingFlushCodelet::registerInterface(Registrar* registrar) {
+  Expected<void> result;
+  result &= registrar->parameter(
+      transmitter_, "transmitter", "Transmitter", "The transmitter whose queue is flushed");
+  return ToResultCode(result);
+}
+
+gxf_result_t UcxCoalescingFlushCodelet::tick() {
+  return transmitter_.get()->flush_if_due();
+}
+
+gxf_result_t UcxCoalescingDeadlineSchedulingTerm::registerInterface(Registrar* registrar) {
+  Expected<void> result;
+  result &= registrar->parameter(
+      transmitter_, "transmitter", "Transmitter", "The transmitter whose queue is checked");
+  return ToResultCode(result);
+}
+
+gxf_result_t UcxCoalescingDeadlineSchedulingTerm::initialize() {
+  transmitter_.get()->set_flush_entity(eid());
+  return GXF_SUCCESS;
+}
+
+gxf_result_t UcxCoalescingDeadlineSchedulingTerm::check_abi(int64_t timestamp,
+                                                            SchedulingConditionType* type,
+                                                            int64_t* target_timestamp) const {
+  *target_timestamp = timestamp;
+  auto deadline = transmitter_.get()->flush_deadline();
+  if (!deadline) {
+    // notified by the transmitter when a message is queued
+    *type = SchedulingConditionType::WAIT;
+    return GXF_SUCCESS;
+  }
+  const int64_t remaining_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                   deadline.value() - std::chrono::steady_clock::now())
+                                   .count();
+  if (remaining_ns <= 0) {
+    *type = SchedulingConditionType::READY;
+  } else {
+    *type = SchedulingConditionType::WAIT_TIME;
+    *target_timestamp = timestamp + remaining_ns;
+  }
+  return GXF_SUCCESS;
+}
+
+gxf_result_t UcxCoalescingDeadlineSchedulingTerm::onExecute_abi(int64_t dt) {
+  (void)dt;
+  return GXF_SUCCESS;
+}
+
+}  // namespace gxf
+}  // namespace nvidia
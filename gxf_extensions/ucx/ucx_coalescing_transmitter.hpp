@@ -0,0 +1,110 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NVIDIA_GXF_UCX_HOLOSCAN_UCX_COALESCING_TRANSMITTER_HPP_
+#define NVIDIA_GXF_UCX_HOLOSCAN_UCX_COALESCING_TRANSMITTER_HPP_
+
+#include <chrono>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include "gxf/core/entity.hpp"
+#include "gxf/core/parameter_parser_std.hpp"
+#include "gxf/std/codelet.hpp"
+#include "gxf/std/scheduling_term.hpp"
+#include "gxf/ucx/ucx_transmitter.hpp"
+
+namespace nvidia {
+namespace gxf {
+
+// UcxTransmitter coalescing small messages into a single UCX send.
+//
+// Entities that only hold holoscan::Message components are queued instead of being sent right
+// away. The queued messages are packed into one batch entity (see ucx_message_batch.hpp) and sent
+// when 'max_batch_size' messages are queued, or once the oldest one has been queued for
+// 'coalescing_window_us' microseconds: at the end of a tick (sync_io_abi), or by the
+// UcxCoalescingFlushCodelet of a separate entity scheduled at that deadline
+// (UcxCoalescingDeadlineSchedulingTerm), so that the messages are sent even if the operator does
+// not tick again. Any other entity (e.g., with tensors) flushes the queue first so that the
+// message order is kept, and the remaining messages are sent when the transmitter is
+// deinitialized.
+//
+// The receiving side must be a UcxCoalescingReceiver.
+class UcxCoalescingTransmitter : public UcxTransmitter {
+ public:
+  gxf_result_t registerInterface(Registrar* registrar) override;
+  gxf_result_t initialize() override;
+  gxf_result_t deinitialize() override;
+
+  gxf_result_t push_abi(gxf_uid_t other) override;
+  gxf_result_t sync_abi() override;
+  gxf_result_t sync_io_abi() override;
+  size_t back_size_abi() override;
+
+  // Time at which the queued messages must be sent, if any.
+  std::optional<std::chrono::steady_clock::time_point> flush_deadline();
+  // Sends the queued messages if the oldest one has been queued for the coalescing window.
+  gxf_result_t flush_if_due();
+  // Sets the entity notified when the queue is no longer empty (see
+  // UcxCoalescingDeadlineSchedulingTerm).
+  void set_flush_entity(gxf_uid_t eid);
+
+ private:
+  // Sends the queued messages right away (as a batch if there are more than one). mutex_ must be
+  // held.
+  gxf_result_t flush_locked();
+
+  Parameter<int64_t> coalescing_window_us_;
+  Parameter<uint64_t> max_batch_size_;
+
+  // Guards the queue, which is also read by the scheduling terms (back_size_abi)
+  std::mutex mutex_;
+  std::vector<Entity> pending_;
+  std::chrono::steady_clock::time_point first_pending_time_;
+  gxf_uid_t flush_eid_ = kNullUid;
+};
+
+// Codelet sending the messages queued by a UcxCoalescingTransmitter once their deadline is reached.
+class UcxCoalescingFlushCodelet : public Codelet {
+ public:
+  gxf_result_t registerInterface(Registrar* registrar) override;
+  gxf_result_t tick() override;
+
+ private:
+  Parameter<Handle<UcxCoalescingTransmitter>> transmitter_;
+};
+
+// Scheduling term ready when the messages queued by a UcxCoalescingTransmitter must be sent. It
+// waits until the deadline of the oldest queued message, or for the transmitter to notify the
+// entity that a message was queued.
+class UcxCoalescingDeadlineSchedulingTerm : public SchedulingTerm {
+ public:
+  gxf_result_t registerInterface(Registrar* registrar) override;
+  gxf_result_t initialize() override;
+  gxf_result_t check_abi(int64_t timestamp, SchedulingConditionType* type,
+                         int64_t* target_timestamp) const override;
+  gxf_result_t onExecute_abi(int64_t dt) override;
+
+ private:
+  Parameter<Handle<UcxCoalescingTransmitter>> transmitter_;
+};
+
+}  // namespace gxf
+}  // namespace nvidia
+
+#endif  // NVIDIA_GXF_UCX_HOLOSCAN_UCX_COALESCING_TRANSMITTER_HPP_
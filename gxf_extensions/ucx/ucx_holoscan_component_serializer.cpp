@@ -17,10 +17,14 @@
 
 #include "ucx_holoscan_component_serializer.hpp"
 
+#include <algorithm>
 #include <cstring>
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
+
+#include "gxf/serialization/serialization_buffer.hpp"
 
 namespace nvidia {
 namespace gxf {
@@ -37,14 +41,123 @@ struct TensorHeader {
   int32_t dims[Shape::kMaxRank];      // Tensor dimensions
   uint64_t strides[Shape::kMaxRank];  // Tensor strides
 };
+// Describes how a tensor or message payload is sent (only if compression is enabled).
+// Uncompressed tensors are sent as a separate (zero-copy) segment, compressed payloads are copied
+// to the serialization buffer.
+struct PayloadHeader {
+  holoscan::CompressionAlgorithm algorithm;  // kNone if the payload is not compressed
+  uint64_t size;                             // size of the payload
+  uint64_t compressed_size;                  // size of the payload on the wire
+};
 #pragma pack(pop)
 
+// Encoding of the holoscan::Message data (only sent if compression is enabled)
+enum class MessageEncoding : uint8_t {
+  kDirect = 0,   // written by the codec to the endpoint
+  kPayload = 1,  // PayloadHeader followed by the (possibly compressed) data written by the codec
+};
+
+// Endpoint discarding the serialized data of a message, used to get its size without copying it.
+class SizeEndpoint : public Endpoint {
+ public:
+  gxf_result_t is_write_available_abi() override { return GXF_SUCCESS; }
+  gxf_result_t is_read_available_abi() override { return GXF_FAILURE; }
+  gxf_result_t write_abi(const void* data, size_t size, size_t* bytes_written) override {
+    if (data == nullptr || bytes_written == nullptr) { return GXF_ARGUMENT_NULL; }
+    *bytes_written = size;
+    return GXF_SUCCESS;
+  }
+  gxf_result_t read_abi(void*, size_t, size_t*) override { return GXF_NOT_IMPLEMENTED; }
+  gxf_result_t write_ptr_abi(const void*, size_t, MemoryStorageType) override {
+    return GXF_SUCCESS;
+  }
+};
+
+// Endpoint collecting the serialized data of a message in memory.
+class MemoryWriteEndpoint : public Endpoint {
+ public:
+  gxf_result_t is_write_available_abi() override { return GXF_SUCCESS; }
+  gxf_result_t is_read_available_abi() override { return GXF_FAILURE; }
+  gxf_result_t write_abi(const void* data, size_t size, size_t* bytes_written) override {
+    if (data == nullptr || bytes_written == nullptr) { return GXF_ARGUMENT_NULL; }
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    data_.insert(data_.end(), bytes, bytes + size);
+    *bytes_written = size;
+    return GXF_SUCCESS;
+  }
+  gxf_result_t read_abi(void*, size_t, size_t*) override { return GXF_NOT_IMPLEMENTED; }
+  // Borrowed segments are copied (see holoscan::Endpoint::write_borrowed).
+  gxf_result_t write_ptr_abi(const void*, size_t, MemoryStorageType) override {
+    return GXF_NOT_IMPLEMENTED;
+  }
+
+  std::vector<uint8_t>& data() { return data_; }
+
+ private:
+  std::vector<uint8_t> data_;
+};
+
+// Endpoint reading the serialized data of a message from memory.
+class MemoryReadEndpoint : public Endpoint {
+ public:
+  explicit MemoryReadEndpoint(const std::vector<uint8_t>& data) : data_(data) {}
+
+  gxf_result_t is_write_available_abi() override { return GXF_FAILURE; }
+  gxf_result_t is_read_available_abi() override {
+    return offset_ < data_.size() ? GXF_SUCCESS : GXF_FAILURE;
+  }
+  gxf_result_t write_abi(const void*, size_t, size_t*) override { return GXF_NOT_IMPLEMENTED; }
+  gxf_result_t read_abi(void* data, size_t size, size_t* bytes_read) override {
+    if (data == nullptr || bytes_read == nullptr) { return GXF_ARGUMENT_NULL; }
+    if (size > data_.size() - offset_) { return GXF_FAILURE; }
+    std::memcpy(data, data_.data() + offset_, size);
+    offset_ += size;
+    *bytes_read = size;
+    return GXF_SUCCESS;
+  }
+  // Borrowed segments are copied (see holoscan::Endpoint::read_borrowed).
+  gxf_result_t write_ptr_abi(const void*, size_t, MemoryStorageType) override {
+    return GXF_NOT_IMPLEMENTED;
+  }
+
+ private:
+  const std::vector<uint8_t>& data_;
+  size_t offset_ = 0;
+};
+
+// Returns the number of bytes that can still be written to the endpoint without resizing it.
+size_t AvailableBufferSize(Endpoint* endpoint) {
+  auto* buffer = dynamic_cast<SerializationBuffer*>(endpoint);
+  if (buffer == nullptr || buffer->capacity() < buffer->size()) { return 0; }
+  return buffer->capacity() - buffer->size();
+}
+
+bool IsHostStorage(MemoryStorageType storage_type) {
+  return storage_type == MemoryStorageType::kHost || storage_type == MemoryStorageType::kSystem;
+}
+
 }  // namespace
 
 gxf_result_t UcxHoloscanComponentSerializer::registerInterface(Registrar* registrar) {
   Expected<void> result;
   result &= registrar->parameter(
       allocator_, "allocator", "Memory allocator", "Memory allocator for tensor components");
+  result &= registrar->parameter(compression_,
+                                 "compression",
+                                 "Compression algorithm",
+                                 "Compression of host tensors and message data ('none', 'lz4' or "
+                                 "'zstd')",
+                                 std::string("none"));
+  result &= registrar->parameter(compression_level_,
+                                 "compression_level",
+                                 "Compression level",
+                                 "Compression level (0 for the default level of the algorithm)",
+                                 0);
+  result &= registrar->parameter(compression_min_size_,
+                                 "compression_min_size",
+                                 "Compression minimum size",
+                                 "Minimum size in bytes of the payloads that are compressed",
+                                 holoscan::PayloadCompression::kDefaultMinSize);
   return ToResultCode(result);
 }
 
@@ -55,6 +168,26 @@ gxf_result_t UcxHoloscanComponentSerializer::initialize() {
   //       "UcxHoloscanComponentSerializer currently only supports little-endian devices");
   //   return GXF_NOT_IMPLEMENTED;
   // }
+  auto algorithm = holoscan::PayloadCompression::from_string(compression_.get());
+  if (!algorithm) {
+    GXF_LOG_ERROR("%s", algorithm.error().what());
+    return GXF_ARGUMENT_INVALID;
+  }
+  compression_algorithm_ = algorithm.value();
+  if (!holoscan::PayloadCompression::is_available(compression_algorithm_)) {
+    GXF_LOG_WARNING("Compression algorithm '%s' is not available, payloads are not compressed",
+                    compression_.get().c_str());
+    compression_algorithm_ = holoscan::CompressionAlgorithm::kNone;
+  }
+  // The algorithms are negotiated before the fragments are initialized: cache the outcome instead
+  // of looking it up for every payload.
+  payload_framing_ = holoscan::PayloadCompression::is_enabled();
+  if (!holoscan::PayloadCompression::is_negotiated(compression_algorithm_)) {
+    GXF_LOG_WARNING(
+        "Compression algorithm '%s' is not enabled by all fragments, payloads are not compressed",
+        compression_.get().c_str());
+    compression_algorithm_ = holoscan::CompressionAlgorithm::kNone;
+  }
   return ToResultCode(configureSerializers() & configureDeserializers());
 }
 
@@ -96,11 +229,37 @@ Expected<size_t> UcxHoloscanComponentSerializer::serializeHoloscanGXFTensor(
     header.dims[i] = tensor.shape().dimension(i);
     header.strides[i] = tensor.stride(i);
   }
-  auto result = endpoint->write_ptr(tensor.pointer(), tensor.size(), tensor.storage_type());
-  if (!result) { return ForwardError(result); }
   auto size = endpoint->writeTrivialType<TensorHeader>(&header);
   if (!size) { return ForwardError(size); }
-  return sizeof(header);
+  if (!payload_framing_) {
+    auto result = endpoint->write_ptr(tensor.pointer(), tensor.size(), tensor.storage_type());
+    if (!result) { return ForwardError(result); }
+    return sizeof(header);
+  }
+
+  thread_local std::vector<uint8_t> compressed;
+  PayloadHeader payload_header;
+  payload_header.size = tensor.size();
+  payload_header.compressed_size = compressPayload(tensor.pointer(),
+                                                   tensor.size(),
+                                                   tensor.storage_type(),
+                                                   endpoint,
+                                                   sizeof(PayloadHeader),
+                                                   compressed);
+  payload_header.algorithm = payload_header.compressed_size > 0
+                                 ? compression_algorithm_
+                                 : holoscan::CompressionAlgorithm::kNone;
+  size = endpoint->writeTrivialType<PayloadHeader>(&payload_header);
+  if (!size) { return ForwardError(size); }
+
+  if (payload_header.algorithm == holoscan::CompressionAlgorithm::kNone) {
+    auto result = endpoint->write_ptr(tensor.pointer(), tensor.size(), tensor.storage_type());
+    if (!result) { return ForwardError(result); }
+    return sizeof(header) + sizeof(payload_header);
+  }
+  size = endpoint->write(compressed.data(), payload_header.compressed_size);
+  if (!size) { return ForwardError(size); }
+  return sizeof(header) + sizeof(payload_header) + payload_header.compressed_size;
 }
 
 Expected<holoscan::gxf::GXFTensor> UcxHoloscanComponentSerializer::deserializeHoloscanGXFTensor(
@@ -113,6 +272,11 @@ Expected<holoscan::gxf::GXFTensor> UcxHoloscanComponentSerializer::deserializeHo
   TensorHeader header;
   auto size = endpoint->readTrivialType<TensorHeader>(&header);
   if (!size) { return ForwardError(size); }
+  PayloadHeader payload_header{holoscan::CompressionAlgorithm::kNone, 0, 0};
+  if (payload_framing_) {
+    size = endpoint->readTrivialType<PayloadHeader>(&payload_header);
+    if (!size) { return ForwardError(size); }
+  }
 
   std::array<int32_t, Shape::kMaxRank> dims;
   std::memcpy(dims.data(), header.dims, sizeof(header.dims));
@@ -127,8 +291,30 @@ Expected<holoscan::gxf::GXFTensor> UcxHoloscanComponentSerializer::deserializeHo
                                      header.storage_type,
                                      allocator_);
   if (!result) { return ForwardError(result); }
-  result = endpoint->write_ptr(tensor.pointer(), tensor.size(), tensor.storage_type());
-  if (!result) { return ForwardError(result); }
+
+  if (payload_header.algorithm == holoscan::CompressionAlgorithm::kNone) {
+    result = endpoint->write_ptr(tensor.pointer(), tensor.size(), tensor.storage_type());
+    if (!result) { return ForwardError(result); }
+    return holoscan::gxf::GXFTensor(tensor);
+  }
+
+  if (!IsHostStorage(tensor.storage_type()) || payload_header.size != tensor.size()) {
+    GXF_LOG_ERROR("Invalid compressed tensor payload");
+    return Unexpected{GXF_FAILURE};
+  }
+  thread_local std::vector<uint8_t> compressed;
+  compressed.resize(payload_header.compressed_size);
+  auto read_size = endpoint->read(compressed.data(), compressed.size());
+  if (!read_size) { return ForwardError(read_size); }
+  auto decompressed = holoscan::PayloadCompression::decompress(payload_header.algorithm,
+                                                               compressed.data(),
+                                                               compressed.size(),
+                                                               tensor.pointer(),
+                                                               tensor.size());
+  if (!decompressed) {
+    GXF_LOG_ERROR("%s", decompressed.error().what());
+    return Unexpected{GXF_FAILURE};
+  }
   return holoscan::gxf::GXFTensor(tensor);
 }
 
@@ -136,9 +322,28 @@ Expected<size_t> UcxHoloscanComponentSerializer::serializeHoloscanMessage(
     const holoscan::Message& message, Endpoint* endpoint) {
   GXF_LOG_DEBUG("UcxHoloscanComponentSerializer::serializeHoloscanMessage");
 
-  // retrieve the name of the codec corresponding to the data in the Message
+  // Retrieve the id of the codec corresponding to the data in the Message. The id is only valid if
+  // the codec is part of the codec table negotiated by the app driver. Otherwise, the codec name is
+  // sent after the (invalid) id.
   auto index = std::type_index(message.value().type());
   auto& registry = holoscan::CodecRegistry::get_instance();
+  // the snapshot keeps the codec functions alive while the codec table is replaced
+  auto codec_table = registry.codec_table();
+  auto [codec_id, table_serialize_func] = codec_table->find_serializer(index);
+
+  size_t total_size = 0;
+  auto maybe_size = endpoint->writeTrivialType<holoscan::CodecRegistry::CodecId>(&codec_id);
+  if (!maybe_size) { return ForwardError(maybe_size); }
+  total_size += maybe_size.value();
+
+  if (codec_id != holoscan::CodecRegistry::kInvalidCodecId) {
+    // serialize the message contents
+    maybe_size = serializeMessageData(table_serialize_func, message, endpoint);
+    if (!maybe_size) { return ForwardError(maybe_size); }
+    total_size += maybe_size.value();
+    return total_size;
+  }
+
   auto maybe_name = registry.index_to_name(index);
   if (!maybe_name) {
     GXF_LOG_ERROR("No codec found for type_index with name: %s", index.name());
@@ -150,8 +355,7 @@ Expected<size_t> UcxHoloscanComponentSerializer::serializeHoloscanMessage(
   holoscan::ContiguousDataHeader header;
   header.size = codec_name.size();
   header.bytes_per_element = header.size > 0 ? sizeof(codec_name[0]) : 1;
-  size_t total_size = 0;
-  auto maybe_size = endpoint->writeTrivialType<holoscan::ContiguousDataHeader>(&header);
+  maybe_size = endpoint->writeTrivialType<holoscan::ContiguousDataHeader>(&header);
   if (!maybe_size) { return ForwardError(maybe_size); }
   total_size += maybe_size.value();
   maybe_size = endpoint->write(codec_name.data(), header.size * header.bytes_per_element);
@@ -159,8 +363,8 @@ Expected<size_t> UcxHoloscanComponentSerializer::serializeHoloscanMessage(
   total_size += maybe_size.value();
 
   // serialize the message contents
-  auto serialize_func = registry.get_serializer(codec_name);
-  maybe_size = serialize_func(message, endpoint);
+  auto& serialize_func = registry.get_serializer(codec_name);
+  maybe_size = serializeMessageData(serialize_func, message, endpoint);
   if (!maybe_size) { return ForwardError(maybe_size); }
   total_size += maybe_size.value();
   return total_size;
@@ -170,6 +374,18 @@ Expected<holoscan::Message> UcxHoloscanComponentSerializer::deserializeHoloscanM
     Endpoint* endpoint) {
   GXF_LOG_DEBUG("UcxHoloscanComponentSerializer::deserializeHoloscanMessage");
 
+  auto& registry = holoscan::CodecRegistry::get_instance();
+
+  // deserialize the id of the holoscan::Message codec to retrieve
+  holoscan::CodecRegistry::CodecId codec_id = holoscan::CodecRegistry::kInvalidCodecId;
+  auto id_size = endpoint->readTrivialType<holoscan::CodecRegistry::CodecId>(&codec_id);
+  if (!id_size) { return ForwardError(id_size); }
+  if (codec_id != holoscan::CodecRegistry::kInvalidCodecId) {
+    // deserialize the message contents (the snapshot keeps the function alive)
+    auto codec_table = registry.codec_table();
+    return deserializeMessageData(codec_table->find_deserializer(codec_id), endpoint);
+  }
+
   // deserialize the type_name of the holoscan::Message codec to retrieve
   holoscan::ContiguousDataHeader header;
   auto header_size = endpoint->readTrivialType<holoscan::ContiguousDataHeader>(&header);
@@ -180,9 +396,122 @@ Expected<holoscan::Message> UcxHoloscanComponentSerializer::deserializeHoloscanM
   if (!result) { return ForwardError(result); }
 
   // deserialize the message contents
-  auto& registry = holoscan::CodecRegistry::get_instance();
-  auto deserialize_func = registry.get_deserializer(codec_name);
-  return deserialize_func(endpoint);
+  auto& deserialize_func = registry.get_deserializer(codec_name);
+  return deserializeMessageData(deserialize_func, endpoint);
 }
+
+Expected<size_t> UcxHoloscanComponentSerializer::serializeMessageData(
+    const holoscan::CodecRegistry::SerializeFunc& serialize_func, const holoscan::Message& message,
+    Endpoint* endpoint) {
+  if (!payload_framing_) { return serialize_func(message, endpoint); }
+
+  thread_local std::vector<uint8_t> compressed;
+  PayloadHeader payload_header{compression_algorithm_, 0, 0};
+  if (compression_algorithm_ != holoscan::CompressionAlgorithm::kNone) {
+    // The serialized size is only known once serialized: get it without copying the data first,
+    // and only serialize to memory the payloads that are large enough to be compressed.
+    SizeEndpoint size_endpoint;
+    auto data_size = serialize_func(message, &size_endpoint);
+    if (!data_size) { return ForwardError(data_size); }
+    if (data_size.value() >= compression_min_size_.get()) {
+      MemoryWriteEndpoint memory_endpoint;
+      data_size = serialize_func(message, &memory_endpoint);
+      if (!data_size) { return ForwardError(data_size); }
+      const auto& data = memory_endpoint.data();
+      payload_header.size = data.size();
+      payload_header.compressed_size =
+          compressPayload(data.data(),
+                          data.size(),
+                          MemoryStorageType::kSystem,
+                          endpoint,
+                          sizeof(MessageEncoding) + sizeof(PayloadHeader),
+                          compressed);
+    }
+  }
+
+  // uncompressed payloads are written by the codec (large buffers as zero-copy segments)
+  MessageEncoding encoding =
+      payload_header.compressed_size > 0 ? MessageEncoding::kPayload : MessageEncoding::kDirect;
+  auto size = endpoint->writeTrivialType<MessageEncoding>(&encoding);
+  if (!size) { return ForwardError(size); }
+  size_t total_size = size.value();
+  if (encoding == MessageEncoding::kDirect) {
+    auto data_size = serialize_func(message, endpoint);
+    if (!data_size) { return ForwardError(data_size); }
+    return total_size + data_size.value();
+  }
+
+  size = endpoint->writeTrivialType<PayloadHeader>(&payload_header);
+  if (!size) { return ForwardError(size); }
+  total_size += size.value();
+  size = endpoint->write(compressed.data(), payload_header.compressed_size);
+  if (!size) { return ForwardError(size); }
+  return total_size + size.value();
+}
+
+Expected<holoscan::Message> UcxHoloscanComponentSerializer::deserializeMessageData(
+    const holoscan::CodecRegistry::DeserializeFunc& deserialize_func, Endpoint* endpoint) {
+  if (!payload_framing_) { return deserialize_func(endpoint); }
+
+  MessageEncoding encoding;
+  auto size = endpoint->readTrivialType<MessageEncoding>(&encoding);
+  if (!size) { return ForwardError(size); }
+  if (encoding == MessageEncoding::kDirect) { return deserialize_func(endpoint); }
+  if (encoding != MessageEncoding::kPayload) {
+    GXF_LOG_ERROR("Invalid message encoding: %u", static_cast<uint32_t>(encoding));
+    return Unexpected{GXF_FAILURE};
+  }
+
+  PayloadHeader payload_header;
+  size = endpoint->readTrivialType<PayloadHeader>(&payload_header);
+  if (!size) { return ForwardError(size); }
+  std::vector<uint8_t> payload(payload_header.compressed_size);
+  auto read_size = endpoint->read(payload.data(), payload.size());
+  if (!read_size) { return ForwardError(read_size); }
+
+  if (payload_header.algorithm == holoscan::CompressionAlgorithm::kNone) {
+    MemoryReadEndpoint memory_endpoint(payload);
+    return deserialize_func(&memory_endpoint);
+  }
+  std::vector<uint8_t> data(payload_header.size);
+  auto decompressed = holoscan::PayloadCompression::decompress(
+      payload_header.algorithm, payload.data(), payload.size(), data.data(), data.size());
+  if (!decompressed) {
+    GXF_LOG_ERROR("%s", decompressed.error().what());
+    return Unexpected{GXF_FAILURE};
+  }
+  MemoryReadEndpoint memory_endpoint(data);
+  return deserialize_func(&memory_endpoint);
+}
+
+size_t UcxHoloscanComponentSerializer::compressPayload(const void* data, size_t size,
+                                                       MemoryStorageType storage_type,
+                                                       Endpoint* endpoint, size_t reserved_size,
+                                                       std::vector<uint8_t>& compressed) {
+  if (compression_algorithm_ == holoscan::CompressionAlgorithm::kNone ||
+      size < compression_min_size_.get() || !IsHostStorage(storage_type)) {
+    return 0;
+  }
+  const size_t available_size = AvailableBufferSize(endpoint);
+  if (available_size <= reserved_size) { return 0; }
+
+  // Only worth it if smaller than the payload (sent as a zero-copy segment otherwise) and if it
+  // fits in the serialization buffer. The compression fails as soon as the output exceeds it.
+  const size_t max_size = std::min(size - 1, available_size - reserved_size);
+  compressed.resize(max_size);
+  auto compressed_size = holoscan::PayloadCompression::compress(compression_algorithm_,
+                                                                compression_level_.get(),
+                                                                data,
+                                                                size,
+                                                                compressed.data(),
+                                                                compressed.size());
+  if (!compressed_size) {
+    GXF_LOG_DEBUG("%s", compressed_size.error().what());
+    return 0;
+  }
+  if (compressed_size.value() > max_size) { return 0; }
+  return compressed_size.value();
+}
+
 }  // namespace gxf
 }  // namespace nvidia
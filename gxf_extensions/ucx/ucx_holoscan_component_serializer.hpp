@@ -18,7 +18,9 @@
 #ifndef NVIDIA_GXF_SERIALIZATION_UCX_HOLOSCAN_COMPONENT_SERIALIZER_HPP_
 #define NVIDIA_GXF_SERIALIZATION_UCX_HOLOSCAN_COMPONENT_SERIALIZER_HPP_
 
+#include <cstdint>
 #include <string>
+#include <vector>
 
 // #include "common/endian.hpp"
 #include "gxf/serialization/component_serializer.hpp"
@@ -27,6 +29,7 @@
 #include "holoscan/core/codec_registry.hpp"
 #include "holoscan/core/gxf/gxf_tensor.hpp"
 #include "holoscan/core/message.hpp"
+#include "holoscan/core/payload_compression.hpp"
 
 namespace nvidia {
 namespace gxf {
@@ -34,6 +37,13 @@ namespace gxf {
 // Serializer that supports serializaing Timestamps, Tensors, Video Buffer,
 // Audio Buffer and integer components
 // Valid for sharing data between devices with the same endianness
+//
+// Host tensors and message data of at least 'compression_min_size' bytes are compressed when a
+// compression algorithm is set (and negotiated with the other fragments, see
+// holoscan::PayloadCompression). Compressed payloads are copied to the serialization buffer, so
+// they are only compressed if the result fits in the remaining buffer space; otherwise they are
+// sent uncompressed. The payloads are sent without compression header if no algorithm was
+// negotiated.
 class UcxHoloscanComponentSerializer : public ComponentSerializer {
  public:
   gxf_result_t registerInterface(Registrar* registrar) override;
@@ -54,8 +64,28 @@ class UcxHoloscanComponentSerializer : public ComponentSerializer {
   Expected<size_t> serializeHoloscanMessage(const holoscan::Message& message, Endpoint* endpoint);
   // Deserializes a holoscan::Message
   Expected<holoscan::Message> deserializeHoloscanMessage(Endpoint* endpoint);
+  // Serializes the contents of a holoscan::Message (compressed if enabled)
+  Expected<size_t> serializeMessageData(
+      const holoscan::CodecRegistry::SerializeFunc& serialize_func,
+      const holoscan::Message& message, Endpoint* endpoint);
+  // Deserializes the contents of a holoscan::Message
+  Expected<holoscan::Message> deserializeMessageData(
+      const holoscan::CodecRegistry::DeserializeFunc& deserialize_func, Endpoint* endpoint);
+  // Compresses the payload to 'compressed' if enabled and worth it. Returns the compressed size,
+  // or 0 if the payload is to be sent uncompressed. 'reserved_size' is the number of bytes written
+  // to the endpoint before the compressed payload.
+  size_t compressPayload(const void* data, size_t size, MemoryStorageType storage_type,
+                         Endpoint* endpoint, size_t reserved_size,
+                         std::vector<uint8_t>& compressed);
 
   Parameter<Handle<Allocator>> allocator_;
+  Parameter<std::string> compression_;
+  Parameter<int32_t> compression_level_;
+  Parameter<uint64_t> compression_min_size_;
+
+  holoscan::CompressionAlgorithm compression_algorithm_ = holoscan::CompressionAlgorithm::kNone;
+  // Whether the payloads are sent with a compression header (holoscan::PayloadCompression)
+  bool payload_framing_ = true;
 };
 
 }  // namespace gxf
@@ -16,6 +16,8 @@
  */
 
 #include "gxf/std/extension_factory_helper.hpp"
+#include "ucx_coalescing_receiver.hpp"
+#include "ucx_coalescing_transmitter.hpp"
 #include "ucx_holoscan_component_serializer.hpp"
 
 GXF_EXT_FACTORY_BEGIN()
@@ -25,4 +27,17 @@ GXF_EXT_FACTORY_SET_INFO(0xe549f7ce9ecf4d53, 0x8156418727c176df, "UcxHoloscanExt
 GXF_EXT_FACTORY_ADD(0xb8de0c9d54c64a2d, 0x88b6b642ad1bb268,
                     nvidia::gxf::UcxHoloscanComponentSerializer, nvidia::gxf::ComponentSerializer,
                     "Holoscan component serializer for UCX.");
+GXF_EXT_FACTORY_ADD(0x4f6b1d2e8a3c4e71, 0x9d25c0b7e6f81a43,
+                    nvidia::gxf::UcxCoalescingTransmitter, nvidia::gxf::UcxTransmitter,
+                    "UCX transmitter coalescing small messages into a single send.");
+GXF_EXT_FACTORY_ADD(0x7a2e9c5b1d8f4b06, 0xa3c4e1f02b7d9e58,
+                    nvidia::gxf::UcxCoalescingReceiver, nvidia::gxf::UcxReceiver,
+                    "UCX receiver unpacking the message batches of a UcxCoalescingTransmitter.");
+GXF_EXT_FACTORY_ADD(0x1d6f3a8c52e94b27, 0x8e40b9d7c31a6f05,
+                    nvidia::gxf::UcxCoalescingFlushCodelet, nvidia::gxf::Codelet,
+                    "Codelet sending the messages queued by a UcxCoalescingTransmitter.");
+GXF_EXT_FACTORY_ADD(0x92c5e07b4a1d4f83, 0xb61a2d9e05c7f348,
+                    nvidia::gxf::UcxCoalescingDeadlineSchedulingTerm, nvidia::gxf::SchedulingTerm,
+                    "Scheduling term waiting for the deadline of the messages queued by a "
+                    "UcxCoalescingTransmitter.");
 GXF_EXT_FACTORY_END()
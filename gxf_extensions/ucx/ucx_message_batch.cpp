@@ -0,0 +1,113 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ucx_message_batch.hpp"
+
+#include <charconv>
+#include <cstdint>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include "holoscan/core/message.hpp"
+
+namespace nvidia {
+namespace gxf {
+
+bool IsCoalescableMessage(const Entity& entity) {
+  auto components = entity.findAll();
+  if (!components || components->size() == 0) { return false; }
+  auto messages = entity.findAll<holoscan::Message>();
+  if (!messages) { return false; }
+  return messages->size() == components->size();
+}
+
+Expected<Entity> PackMessageBatch(gxf_context_t context, const std::vector<Entity>& entities) {
+  auto batch = Entity::New(context);
+  if (!batch) { return ForwardError(batch); }
+
+  auto marker = batch->add<holoscan::Message>(kUcxMessageBatchComponentName);
+  if (!marker) { return ForwardError(marker); }
+  marker.value()->set_value(static_cast<uint32_t>(entities.size()));
+
+  for (size_t i = 0; i < entities.size(); ++i) {
+    auto messages = entities[i].findAll<holoscan::Message>();
+    if (!messages) { return ForwardError(messages); }
+    for (const auto& message : messages.value()) {
+      if (!message) { continue; }
+      const std::string name = std::to_string(i) + ":" + message->name();
+      auto packed = batch->add<holoscan::Message>(name.c_str());
+      if (!packed) { return ForwardError(packed); }
+      packed.value()->set_value(message.value()->value());
+    }
+  }
+  return batch;
+}
+
+bool IsMessageBatch(const Entity& entity) {
+  auto marker = entity.get<holoscan::Message>(kUcxMessageBatchComponentName);
+  return static_cast<bool>(marker);
+}
+
+Expected<std::vector<Entity>> UnpackMessageBatch(gxf_context_t context, const Entity& batch) {
+  auto marker = batch.get<holoscan::Message>(kUcxMessageBatchComponentName);
+  if (!marker) { return ForwardError(marker); }
+  const auto* count = std::any_cast<uint32_t>(&marker.value()->value());
+  if (count == nullptr) {
+    GXF_LOG_ERROR("Invalid message batch marker");
+    return Unexpected{GXF_FAILURE};
+  }
+
+  std::vector<Entity> entities;
+  entities.reserve(*count);
+  for (uint32_t i = 0; i < *count; ++i) {
+    auto entity = Entity::New(context);
+    if (!entity) { return ForwardError(entity); }
+    entities.push_back(std::move(entity.value()));
+  }
+
+  auto messages = batch.findAll<holoscan::Message>();
+  if (!messages) { return ForwardError(messages); }
+  for (const auto& message : messages.value()) {
+    if (!message) { continue; }
+    const std::string packed_name = message->name();
+    if (packed_name == kUcxMessageBatchComponentName) { continue; }
+
+    // "<index>:<name>"
+    const auto separator = packed_name.find(':');
+    if (separator == std::string::npos) {
+      GXF_LOG_ERROR("Invalid component name in message batch: %s", packed_name.c_str());
+      return Unexpected{GXF_FAILURE};
+    }
+    uint32_t index = 0;
+    const char* index_end = packed_name.data() + separator;
+    const auto [parse_end, parse_error] = std::from_chars(packed_name.data(), index_end, index);
+    if (parse_error != std::errc() || parse_end != index_end || index >= entities.size()) {
+      GXF_LOG_ERROR("Invalid message index in message batch: %s", packed_name.c_str());
+      return Unexpected{GXF_FAILURE};
+    }
+    const std::string name = packed_name.substr(separator + 1);
+    auto unpacked = entities[index].add<holoscan::Message>(name.empty() ? nullptr : name.c_str());
+    if (!unpacked) { return ForwardError(unpacked); }
+    unpacked.value()->set_value(message.value()->value());
+  }
+  return entities;
+}
+
+}  // namespace gxf
+}  // namespace nvidia
@@ -0,0 +1,50 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NVIDIA_GXF_UCX_HOLOSCAN_UCX_MESSAGE_BATCH_HPP_
+#define NVIDIA_GXF_UCX_HOLOSCAN_UCX_MESSAGE_BATCH_HPP_
+
+#include <vector>
+
+#include "gxf/core/entity.hpp"
+#include "gxf/core/expected.hpp"
+
+namespace nvidia {
+namespace gxf {
+
+// Name of the holoscan::Message component (holding the number of messages as uint32_t) that marks
+// an entity as a batch of coalesced messages.
+constexpr const char* kUcxMessageBatchComponentName = "__holoscan_ucx_message_batch__";
+
+// Returns true if the entity only holds holoscan::Message components (small control-plane
+// messages) and can therefore be coalesced with other messages.
+bool IsCoalescableMessage(const Entity& entity);
+
+// Packs the holoscan::Message components of the given entities into a single batch entity.
+// The components of the i-th entity are named "<i>:<name>" in the batch entity.
+Expected<Entity> PackMessageBatch(gxf_context_t context, const std::vector<Entity>& entities);
+
+// Returns true if the entity is a batch created by PackMessageBatch.
+bool IsMessageBatch(const Entity& entity);
+
+// Unpacks a batch entity into the original entities (in order).
+Expected<std::vector<Entity>> UnpackMessageBatch(gxf_context_t context, const Entity& batch);
+
+}  // namespace gxf
+}  // namespace nvidia
+
+#endif  // NVIDIA_GXF_UCX_HOLOSCAN_UCX_MESSAGE_BATCH_HPP_
@@ -20,6 +20,7 @@
 
 #include <future>
 #include <memory>
+#include <mutex>
 #include <queue>
 #include <string>
 #include <tuple>
@@ -63,25 +64,24 @@ class AppDriver {
    * @brief Retrieves a boolean value from an environment variable.
    *
    * This function fetches the value of a named environment variable and converts it to a boolean.
-   * The conversion is case-insensitive and accepts "true", "1", or "on" as true, any other values
-   * are considered false. If the environment variable is not set or its value is not recognized as
-   * 'true', the function returns a default value.
+   * The conversion is case-insensitive and accepts "true", "1", or "on" as true, and "false", "0",
+   * or "off" as false. If the environment variable is not set or its value is not recognized, the
+   * function returns a default value.
    *
    * This function uses std::getenv() to access environment variables. The environment variable
    * to look up is specified by the 'name' parameter. The value of the environment variable is
-   * converted to a lower-case string, and compared to the known 'true' strings.
+   * converted to a lower-case string, and compared to the known 'true' and 'false' strings.
    *
    * The function does not throw an exception if the environment variable is not found or if
-   * the value does not match any of the expected 'true' strings.
+   * the value does not match any of the expected strings.
    *
    * @param name The name of the environment variable to look up.
    * @param default_value The value to return if the environment variable is not set or its
-   *                      value does not match any of the known 'true' strings. The default is
+   *                      value does not match any of the known strings. The default is
    *                      'false'.
    *
    * @return true if the environment variable is set and its value is recognized as 'true',
-   *         and false otherwise. If the environment variable is not set, the function returns
-   *         'default_value'.
+   *         false if it is recognized as 'false', and 'default_value' otherwise.
    */
   static bool get_bool_env_var(const char* name, bool default_value = false);
 
@@ -172,6 +172,30 @@ class AppDriver {
 
   void submit_message(DriverMessage&& message);
 
+  /**
+   * @brief Store the names of the codecs registered in a worker.
+   *
+   * The codec names of all the workers participating in the schedule are used to build the codec
+   * table sent to the workers, so that messages can refer to their codec by id.
+   *
+   * @param worker_address The address of the worker.
+   * @param codec_names The codec names registered in the worker, in registration order.
+   */
+  void store_worker_codec_names(const std::string& worker_address,
+                                std::vector<std::string> codec_names);
+
+  /**
+   * @brief Store the names of the payload compression algorithms supported by a worker.
+   *
+   * Payloads are only compressed with the algorithms supported by all the workers participating
+   * in the schedule (see PayloadCompression).
+   *
+   * @param worker_address The address of the worker.
+   * @param algorithms The names of the compression algorithms supported by the worker.
+   */
+  void store_worker_compression_algorithms(const std::string& worker_address,
+                                           std::vector<std::string> algorithms);
+
   void process_message_queue();
 
  private:
@@ -183,8 +207,46 @@ class AppDriver {
                          std::shared_ptr<holoscan::FragmentEdgeDataElementType>& port_map);
 
   /// Collect fragment connections.
+  ///
+  /// If HOLOSCAN_UCX_COALESCING_WINDOW_US is set to a positive value, the UCX connections coalesce
+  /// small messages for (at most) that many microseconds.
   bool collect_connections(holoscan::FragmentGraph& fragment_graph);
 
+  /// Use shared memory connectors for the connections between fragments running on the same host.
+  /// `fragment_hosts` maps fragment names to the address of the host running them. The network
+  /// ports of the converted connections are released from `receiver_port_map_`,
+  /// `index_to_ip_map_` and `index_to_port_map_`.
+  /// Only enabled if HOLOSCAN_ENABLE_SHARED_MEMORY_TRANSPORT is true, as workers reporting the
+  /// same address are not necessarily on the same host (e.g., behind NAT). The connections keep
+  /// using UCX if POSIX shared memory cannot be used on the driver's host.
+  void use_shared_memory_for_colocated_fragments(
+      const std::unordered_map<std::string, std::string>& fragment_hosts);
+
+  /// Estimate the number of receiver ports of each fragment from the fragment graph.
+  ///
+  /// The estimate is available before the fragments are composed and is an upper bound of the
+  /// number of ports collected by `collect_connections()`.
+  std::unordered_map<std::string, std::size_t> estimate_receiver_port_counts(
+      holoscan::FragmentGraph& fragment_graph);
+
+  /// Request available network ports from the given workers.
+  ///
+  /// `worker_port_counts` maps worker addresses to the number of ports to request. Workers sharing
+  /// an IP address are queried one after another (the ports returned to a worker are appended to
+  /// `used_ports_map` to avoid conflicts), while workers on different IP addresses are queried
+  /// concurrently using the given launch policy.
+  std::unordered_map<std::string, std::vector<int32_t>> request_available_ports(
+      const std::unordered_map<std::string, std::size_t>& worker_port_counts,
+      std::unordered_map<std::string, std::vector<uint32_t>>& used_ports_map,
+      std::launch policy);
+
+  /// Build the codec table common to the driver and the given workers.
+  std::vector<std::string> negotiate_codec_table(const std::vector<std::string>& worker_ids);
+
+  /// Find the payload compression algorithms supported by the driver and the given workers.
+  std::vector<std::string> negotiate_compression_algorithms(
+      const std::vector<std::string>& worker_ids);
+
   /// Correct connection map.
   /// `connection_map_` is initialized with the default IP (0.0.0.0) and port (zero-based index).
   /// This function corrects the connection map by replacing the default IP and port with the
@@ -205,6 +267,10 @@ class AppDriver {
   void collect_resource_requirements(const Config& app_config,
                                      holoscan::FragmentGraph& fragment_graph);
 
+  /// Create the fragment allocation strategy selected in the 'resources' section of the
+  /// configuration ('allocationStrategy' and 'maxFragmentsPerWorker').
+  std::unique_ptr<FragmentAllocationStrategy> make_allocation_strategy(const Config& app_config);
+
   /// Parse the system resource requirement from the given YAML node.
   SystemResourceRequirement parse_resource_requirement(const YAML::Node& node);
 
@@ -220,6 +286,11 @@ class AppDriver {
       const std::string& fragment_name, const SystemResourceRequirement& base_requirement);
 
   /// Check the fragment schedule to ensure that all fragments are scheduled to run.
+  ///
+  /// Requests to the workers are issued concurrently, and the network ports are negotiated while
+  /// the fragments are composed. The duration of each startup phase is recorded by a
+  /// StartupProfiler and logged if HOLOSCAN_STARTUP_PROFILE is set to true.
+  /// Setting HOLOSCAN_PARALLEL_WORKER_REQUESTS to false sends the requests one after another.
   void check_fragment_schedule(const std::string& worker_address = "");
 
   /// Check if the all workers have finished execution.
@@ -261,11 +332,26 @@ class AppDriver {
   /// Maps port indices to real port numbers (initially set to -1).
   std::unordered_map<int32_t, int32_t> index_to_port_map_;
 
+  /// Maps port indices to the names of the source and target fragments of the connection.
+  std::unordered_map<int32_t, std::pair<std::string, std::string>> index_to_fragments_map_;
+
+  /// Maps port indices to the source and target connection items of the connection.
+  std::unordered_map<int32_t,
+                     std::pair<std::shared_ptr<ConnectionItem>, std::shared_ptr<ConnectionItem>>>
+      index_to_connection_items_map_;
+
   std::unique_ptr<service::AppDriverServer> driver_server_;
 
   std::unique_ptr<FragmentScheduler> fragment_scheduler_;
   std::mutex message_mutex_;                 ///< Mutex for the message queue.
   std::queue<DriverMessage> message_queue_;  ///< Queue of messages to be processed.
+
+  /// Mutex for the worker codec names and compression algorithms.
+  std::mutex worker_negotiation_mutex_;
+  /// Maps worker addresses to the names of the codecs registered in the worker.
+  std::unordered_map<std::string, std::vector<std::string>> worker_codec_names_;
+  /// Maps worker addresses to the names of the compression algorithms supported by the worker.
+  std::unordered_map<std::string, std::vector<std::string>> worker_compression_algorithms_;
 };
 
 }  // namespace holoscan
@@ -0,0 +1,322 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_CODEC_FIELDS_HPP
+#define HOLOSCAN_CORE_CODEC_FIELDS_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "./codec_registry.hpp"
+#include "./codecs.hpp"
+#include "./endpoint.hpp"
+#include "./errors.hpp"
+#include "./expected.hpp"
+
+namespace holoscan {
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// Codec type 6: structs described by a list of fields
+//
+// `CodecFields<T, &T::a, &T::b, ...>` serializes the listed data members in order. Each run of
+// adjacent trivially copyable fields is packed into a single `Endpoint::write()` (and read back
+// with a single `Endpoint::read()`), while the other fields use their own `codec<FieldT>`.
+//
+// The packed fields are written without padding, so the wire format is the same as the one of a
+// hand-written codec calling `serialize_trivial_type()` for each of these fields.
+//
+// Trivially copyable fields are always packed, even if a custom `codec<FieldT>` exists.
+
+template <typename T>
+struct CodecFieldsMemberTraits;
+
+template <typename ClassT, typename FieldT>
+struct CodecFieldsMemberTraits<FieldT ClassT::*> {
+  using class_type = ClassT;
+  using field_type = FieldT;
+};
+
+template <auto member>
+using codec_field_t =
+    typename CodecFieldsMemberTraits<std::decay_t<decltype(member)>>::field_type;
+
+template <auto member>
+using codec_field_class_t =
+    typename CodecFieldsMemberTraits<std::decay_t<decltype(member)>>::class_type;
+
+// Number of bytes of the packed run starting at each field (0 if the run starts earlier)
+template <size_t N>
+constexpr std::array<size_t, N> codec_fields_run_sizes(const std::array<bool, N>& packed,
+                                                       const std::array<size_t, N>& field_sizes) {
+  std::array<size_t, N> sizes{};
+  size_t run_size = 0;
+  for (size_t i = N; i-- > 0;) {
+    run_size = packed[i] ? run_size + field_sizes[i] : 0;
+    sizes[i] = (i == 0 || !packed[i - 1]) ? run_size : 0;
+  }
+  return sizes;
+}
+
+template <size_t N>
+constexpr size_t codec_fields_max(const std::array<size_t, N>& values) {
+  size_t result = 0;
+  for (size_t value : values) { result = value > result ? value : result; }
+  return result;
+}
+
+template <typename T, auto... members>
+struct CodecFields {
+  static_assert(sizeof...(members) > 0, "CodecFields requires at least one field");
+  static_assert(std::is_default_constructible_v<T>,
+                "CodecFields requires a default constructible type");
+
+  static expected<size_t, RuntimeError> serialize(const T& value, Endpoint* endpoint) {
+    return serialize_fields(value, endpoint, std::make_index_sequence<kNumFields>{});
+  }
+
+  static expected<T, RuntimeError> deserialize(Endpoint* endpoint) {
+    return deserialize_fields(endpoint, std::make_index_sequence<kNumFields>{});
+  }
+
+ private:
+  static constexpr size_t kNumFields = sizeof...(members);
+  static constexpr auto kMembers = std::make_tuple(members...);
+
+  template <size_t index>
+  using field_type = codec_field_t<std::get<index>(kMembers)>;
+
+  static_assert((std::is_base_of_v<codec_field_class_t<members>, T> && ...),
+                "CodecFields requires pointers to data members of T");
+  static_assert((!std::is_const_v<codec_field_t<members>> && ...),
+                "CodecFields does not support const fields");
+
+  static constexpr std::array<bool, kNumFields> kPacked = {
+      std::is_trivially_copyable_v<codec_field_t<members>>...};
+
+  static constexpr std::array<size_t, kNumFields> kRunSizes = codec_fields_run_sizes(
+      kPacked, {sizeof(codec_field_t<members>)...});
+  static constexpr size_t kMaxRunSize = codec_fields_max(kRunSizes);
+
+  static constexpr bool starts_run(size_t index) {
+    return kPacked[index] && (index == 0 || !kPacked[index - 1]);
+  }
+  static constexpr bool ends_run(size_t index) {
+    return kPacked[index] && (index + 1 == kNumFields || !kPacked[index + 1]);
+  }
+
+  // Staging buffer of the packed runs
+  struct Run {
+    std::array<uint8_t, kMaxRunSize> bytes;
+    size_t offset = 0;
+  };
+
+  template <size_t index>
+  static bool serialize_field(const T& value, Endpoint* endpoint, Run& run, size_t& total_size,
+                              expected<void, RuntimeError>& status) {
+    using FieldT = field_type<index>;
+    const FieldT& field = value.*std::get<index>(kMembers);
+    expected<size_t, RuntimeError> maybe_size;
+    if constexpr (!kPacked[index]) {
+      maybe_size = codec<FieldT>::serialize(field, endpoint);
+    } else if constexpr (starts_run(index) && ends_run(index)) {
+      maybe_size = endpoint->write(&field, sizeof(FieldT));
+    } else {
+      std::memcpy(run.bytes.data() + run.offset, &field, sizeof(FieldT));
+      run.offset += sizeof(FieldT);
+      if constexpr (!ends_run(index)) { return true; }
+      maybe_size = endpoint->write(run.bytes.data(), run.offset);
+      run.offset = 0;
+    }
+    if (!maybe_size) {
+      status = forward_error(maybe_size);
+      return false;
+    }
+    total_size += maybe_size.value();
+    return true;
+  }
+
+  template <size_t index>
+  static bool deserialize_field(T& value, Endpoint* endpoint, Run& run,
+                                expected<void, RuntimeError>& status) {
+    using FieldT = field_type<index>;
+    FieldT& field = value.*std::get<index>(kMembers);
+    if constexpr (!kPacked[index]) {
+      auto maybe_field = codec<FieldT>::deserialize(endpoint);
+      if (!maybe_field) {
+        status = forward_error(maybe_field);
+        return false;
+      }
+      field = std::move(maybe_field.value());
+      return true;
+    } else {
+      if constexpr (starts_run(index)) {
+        auto maybe_size = endpoint->read(run.bytes.data(), kRunSizes[index]);
+        if (!maybe_size) {
+          status = forward_error(maybe_size);
+          return false;
+        }
+        run.offset = 0;
+      }
+      std::memcpy(&field, run.bytes.data() + run.offset, sizeof(FieldT));
+      run.offset += sizeof(FieldT);
+      return true;
+    }
+  }
+
+  template <size_t... indices>
+  static expected<size_t, RuntimeError> serialize_fields(const T& value, Endpoint* endpoint,
+                                                         std::index_sequence<indices...>) {
+    Run run;
+    size_t total_size = 0;
+    expected<void, RuntimeError> status;
+    (serialize_field<indices>(value, endpoint, run, total_size, status) && ...);
+    if (!status) { return forward_error(status); }
+    return total_size;
+  }
+
+  template <size_t... indices>
+  static expected<T, RuntimeError> deserialize_fields(Endpoint* endpoint,
+                                                      std::index_sequence<indices...>) {
+    T value{};
+    Run run;
+    expected<void, RuntimeError> status;
+    (deserialize_field<indices>(value, endpoint, run, status) && ...);
+    if (!status) { return forward_error(status); }
+    return value;
+  }
+};
+
+/**
+ * @brief Add the codec of the type to the codec registry.
+ *
+ * Used by HOLOSCAN_CODEC_FIELDS to register the generated codec during static initialization.
+ *
+ * @tparam typeT The type of the codec.
+ * @param codec_name The name of the codec.
+ * @return true
+ */
+template <typename typeT>
+bool register_codec(const std::string& codec_name) {
+  CodecRegistry::get_instance().add_codec<typeT>(codec_name);
+  return true;
+}
+
+}  // namespace holoscan
+
+// Expands the field names given to HOLOSCAN_CODEC_FIELDS into pointers to data members of T.
+#define HOLOSCAN_CODEC_FIELDS_MEMBER(T, field) &T::field
+#define HOLOSCAN_CODEC_FIELDS_1(T, f) HOLOSCAN_CODEC_FIELDS_MEMBER(T, f)
+#define HOLOSCAN_CODEC_FIELDS_2(T, f, ...) \
+  HOLOSCAN_CODEC_FIELDS_MEMBER(T, f), HOLOSCAN_CODEC_FIELDS_1(T, __VA_ARGS__)
+#define HOLOSCAN_CODEC_FIELDS_3(T, f, ...) \
+  HOLOSCAN_CODEC_FIELDS_MEMBER(T, f), HOLOSCAN_CODEC_FIELDS_2(T, __VA_ARGS__)
+#define HOLOSCAN_CODEC_FIELDS_4(T, f, ...) \
+  HOLOSCAN_CODEC_FIELDS_MEMBER(T, f), HOLOSCAN_CODEC_FIELDS_3(T, __VA_ARGS__)
+#define HOLOSCAN_CODEC_FIELDS_5(T, f, ...) \
+  HOLOSCAN_CODEC_FIELDS_MEMBER(T, f), HOLOSCAN_CODEC_FIELDS_4(T, __VA_ARGS__)
+#define HOLOSCAN_CODEC_FIELDS_6(T, f, ...) \
+  HOLOSCAN_CODEC_FIELDS_MEMBER(T, f), HOLOSCAN_CODEC_FIELDS_5(T, __VA_ARGS__)
+#define HOLOSCAN_CODEC_FIELDS_7(T, f, ...) \
+  HOLOSCAN_CODEC_FIELDS_MEMBER(T, f), HOLOSCAN_CODEC_FIELDS_6(T, __VA_ARGS__)
+#define HOLOSCAN_CODEC_FIELDS_8(T, f, ...) \
+  HOLOSCAN_CODEC_FIELDS_MEMBER(T, f), HOLOSCAN_CODEC_FIELDS_7(T, __VA_ARGS__)
+#define HOLOSCAN_CODEC_FIELDS_9(T, f, ...) \
+  HOLOSCAN_CODEC_FIELDS_MEMBER(T, f), HOLOSCAN_CODEC_FIELDS_8(T, __VA_ARGS__)
+#define HOLOSCAN_CODEC_FIELDS_10(T, f, ...) \
+  HOLOSCAN_CODEC_FIELDS_MEMBER(T, f), HOLOSCAN_CODEC_FIELDS_9(T, __VA_ARGS__)
+#define HOLOSCAN_CODEC_FIELDS_11(T, f, ...) \
+  HOLOSCAN_CODEC_FIELDS_MEMBER(T, f), HOLOSCAN_CODEC_FIELDS_10(T, __VA_ARGS__)
+#define HOLOSCAN_CODEC_FIELDS_12(T, f, ...) \
+  HOLOSCAN_CODEC_FIELDS_MEMBER(T, f), HOLOSCAN_CODEC_FIELDS_11(T, __VA_ARGS__)
+#define HOLOSCAN_CODEC_FIELDS_13(T, f, ...) \
+  HOLOSCAN_CODEC_FIELDS_MEMBER(T, f), HOLOSCAN_CODEC_FIELDS_12(T, __VA_ARGS__)
+#define HOLOSCAN_CODEC_FIELDS_14(T, f, ...) \
+  HOLOSCAN_CODEC_FIELDS_MEMBER(T, f), HOLOSCAN_CODEC_FIELDS_13(T, __VA_ARGS__)
+#define HOLOSCAN_CODEC_FIELDS_15(T, f, ...) \
+  HOLOSCAN_CODEC_FIELDS_MEMBER(T, f), HOLOSCAN_CODEC_FIELDS_14(T, __VA_ARGS__)
+#define HOLOSCAN_CODEC_FIELDS_16(T, f, ...) \
+  HOLOSCAN_CODEC_FIELDS_MEMBER(T, f), HOLOSCAN_CODEC_FIELDS_15(T, __VA_ARGS__)
+#define HOLOSCAN_CODEC_FIELDS_SELECT(                                                    \
+    _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, NAME, ...) \
+  NAME
+#define HOLOSCAN_CODEC_FIELDS_MEMBERS(T, ...)            \
+  HOLOSCAN_CODEC_FIELDS_SELECT(__VA_ARGS__,              \
+                               HOLOSCAN_CODEC_FIELDS_16, \
+                               HOLOSCAN_CODEC_FIELDS_15, \
+                               HOLOSCAN_CODEC_FIELDS_14, \
+                               HOLOSCAN_CODEC_FIELDS_13, \
+                               HOLOSCAN_CODEC_FIELDS_12, \
+                               HOLOSCAN_CODEC_FIELDS_11, \
+                               HOLOSCAN_CODEC_FIELDS_10, \
+                               HOLOSCAN_CODEC_FIELDS_9,  \
+                               HOLOSCAN_CODEC_FIELDS_8,  \
+                               HOLOSCAN_CODEC_FIELDS_7,  \
+                               HOLOSCAN_CODEC_FIELDS_6,  \
+                               HOLOSCAN_CODEC_FIELDS_5,  \
+                               HOLOSCAN_CODEC_FIELDS_4,  \
+                               HOLOSCAN_CODEC_FIELDS_3,  \
+                               HOLOSCAN_CODEC_FIELDS_2,  \
+                               HOLOSCAN_CODEC_FIELDS_1)  \
+  (T, __VA_ARGS__)
+
+/**
+ * @brief Define and register the codec of a struct from the list of its fields.
+ *
+ * The generated `holoscan::codec<T>` serializes the given data members in order (see
+ * holoscan::CodecFields) and is added to the codec registry under the name `#T` during static
+ * initialization, so that `T` can be sent between fragments without calling
+ * `CodecRegistry::add_codec()`.
+ *
+ * The macro must be used at global namespace scope with the fully qualified type name, and `T`
+ * must be default constructible. Up to 16 fields are supported.
+ *
+ * Example:
+ *
+ * ```cpp
+ * namespace my_app {
+ * struct Detection {
+ *   float x, y, width, height;
+ *   int32_t label;
+ *   std::string text;
+ * };
+ * }  // namespace my_app
+ *
+ * HOLOSCAN_CODEC_FIELDS(my_app::Detection, x, y, width, height, label, text)
+ * ```
+ *
+ * Here `x`, `y`, `width`, `height` and `label` are sent with a single 20-byte write, followed by
+ * `codec<std::string>` for `text`.
+ *
+ * @param T The fully qualified name of the type.
+ * @param ... The names of the data members to serialize.
+ */
+#define HOLOSCAN_CODEC_FIELDS(T, ...)                                                      \
+  namespace holoscan {                                                                     \
+  template <>                                                                              \
+  struct codec<T>                                                                          \
+      : public ::holoscan::CodecFields<T, HOLOSCAN_CODEC_FIELDS_MEMBERS(T, __VA_ARGS__)> { \
+    static inline const bool registered = ::holoscan::register_codec<T>(#T);               \
+  };                                                                                       \
+  }
+
+#endif /* HOLOSCAN_CORE_CODEC_FIELDS_HPP */
@@ -19,8 +19,11 @@
 #define HOLOSCAN_CORE_CODEC_REGISTRY_HPP
 
 #include <complex>
+#include <cstdint>
 #include <functional>
+#include <limits>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <type_traits>
 #include <typeindex>
@@ -67,6 +70,19 @@ class CodecRegistry {
    */
   using Codec = std::pair<SerializeFunc, DeserializeFunc>;
 
+  /**
+   * @brief Integer identifier of a codec within the codec table.
+   *
+   * The codec table is shared by all the fragments of a distributed application so that messages
+   * can refer to their codec by id instead of by name.
+   */
+  using CodecId = uint16_t;
+
+  /**
+   * @brief Codec id of a codec that is not in the codec table (the codec name is used instead).
+   */
+  static constexpr CodecId kInvalidCodecId = std::numeric_limits<CodecId>::max();
+
   inline static SerializeFunc none_serialize =
       []([[maybe_unused]] const Message& message,
          [[maybe_unused]] GXFEndpoint* buffer) -> nvidia::gxf::Expected<size_t> {
@@ -248,6 +264,132 @@ class CodecRegistry {
     return loc->second;
   }
 
+  /**
+   * @brief Get the names of the registered codecs, in registration order.
+   *
+   * @return The vector of codec names.
+   */
+  const std::vector<std::string>& codec_names() const { return codec_names_; }
+
+  /**
+   * @brief Set the codec table.
+   *
+   * The id of a codec is its position in `codec_names`. Names that are not registered in this
+   * process keep their position in the table but are associated with `none_codec`. Codecs added
+   * after this call are associated with their id if their name is in the table.
+   *
+   * An empty vector clears the codec table so that all codecs are referred to by name.
+   *
+   * The codec table can be set while other threads look codecs up by id.
+   *
+   * @param codec_names The codec names, in codec id order.
+   */
+  void set_codec_table(const std::vector<std::string>& codec_names);
+
+  /**
+   * @brief Immutable codec table.
+   *
+   * A new table is published each time the codec table changes, so that a snapshot can be used
+   * without locking while it is replaced concurrently.
+   */
+  struct CodecTable {
+    /**
+     * @brief Get the codec id and the serializer function corresponding to a std::type_index.
+     *
+     * @param index The std::type_index corresponding to the parameter.
+     * @return The codec id and the serializer function, or kInvalidCodecId and `none_serialize`
+     * if the type has no codec in the codec table.
+     */
+    std::pair<CodecId, const SerializeFunc&> find_serializer(const std::type_index& index) const {
+      auto loc = index_to_codec_id_map.find(index);
+      if (loc == index_to_codec_id_map.end()) { return {kInvalidCodecId, none_serialize}; }
+      return {loc->second, codecs[loc->second].first};
+    }
+
+    /**
+     * @brief Get the deserializer function.
+     *
+     * @param id The codec id.
+     * @return The deserializer function, or `none_deserialize` if the id is not in the table.
+     */
+    const DeserializeFunc& find_deserializer(CodecId id) const {
+      if (id >= codecs.size()) {
+        HOLOSCAN_LOG_WARN("No deserializer for codec id '{}' exists", id);
+        return none_deserialize;
+      }
+      return codecs[id].second;
+    }
+
+    std::unordered_map<std::string, CodecId>
+        name_to_codec_id_map;  ///< Mapping from name to codec id
+    std::unordered_map<std::type_index, CodecId>
+        index_to_codec_id_map;  ///< Mapping from type_index to codec id
+    std::vector<Codec> codecs;  ///< Codec function pairs indexed by codec id
+  };
+
+  /**
+   * @brief Get a snapshot of the codec table.
+   *
+   * The functions of the snapshot stay valid while it is held, even if the codec table is replaced
+   * concurrently. Getting the snapshot does not lock.
+   *
+   * @return The current codec table.
+   */
+  std::shared_ptr<const CodecTable> codec_table() const { return std::atomic_load(&codec_table_); }
+
+  /**
+   * @brief Get the codec id corresponding to a std::type_index.
+   *
+   * @param index The std::type_index corresponding to the parameter.
+   * @return The codec id, or kInvalidCodecId if the type has no codec in the codec table.
+   */
+  CodecId codec_id(const std::type_index& index) const {
+    return codec_table()->find_serializer(index).first;
+  }
+
+  /**
+   * @brief Get the serializer function.
+   *
+   * A copy is returned as the codec table may be replaced concurrently (see `codec_table()` to
+   * avoid it).
+   *
+   * @param id The codec id (from the codec table).
+   * @return The Serializer function.
+   */
+  SerializeFunc get_serializer(CodecId id) const {
+    auto table = codec_table();
+    if (id >= table->codecs.size()) {
+      HOLOSCAN_LOG_WARN("No serializer for codec id '{}' exists", id);
+      return CodecRegistry::none_serialize;
+    }
+    return table->codecs[id].first;
+  }
+
+  /**
+   * @brief Get the deserializer function.
+   *
+   * A copy is returned as the codec table may be replaced concurrently (see `codec_table()` to
+   * avoid it).
+   *
+   * @param id The codec id (from the codec table).
+   * @return The Deserializer function.
+   */
+  DeserializeFunc get_deserializer(CodecId id) const {
+    return codec_table()->find_deserializer(id);
+  }
+
+  /**
+   * @brief Compute the codec table common to several codec name lists.
+   *
+   * The result contains the names present in all the lists, in the order of the first list, and
+   * is truncated to the number of valid codec ids.
+   *
+   * @param codec_name_lists The codec names of each participant (e.g., each fragment worker).
+   * @return The common codec names, in codec id order.
+   */
+  static std::vector<std::string> common_codec_table(
+      const std::vector<std::vector<std::string>>& codec_name_lists);
+
   /**
    * @brief Add a codec for the type.
    *
@@ -288,6 +430,7 @@ class CodecRegistry {
     name_to_index_map_.try_emplace(codec_name, index);
     index_to_name_map_.try_emplace(index, codec_name);
     codec_map_.try_emplace(codec_name, codec);
+    update_codec_table(index, codec_name);
   }
 
   /**
@@ -321,10 +464,11 @@ class CodecRegistry {
         std::make_pair(
             [](const Message& data, GXFEndpoint* gxf_endpoint) -> nvidia::gxf::Expected<size_t> {
               try {
-                const typeT& value = std::any_cast<typeT>(data.value());
+                // a reference to the value of the message, which outlives the send
+                const typeT& value = std::any_cast<const typeT&>(data.value());
                 Endpoint endpoint(gxf_endpoint);
 
-                auto result = codec<typeT>::serialize(value, &endpoint);
+                auto result = serialize_message_value<typeT>(value, &endpoint);
                 if (result) {
                   return result.value();
                 } else {
@@ -341,15 +485,17 @@ class CodecRegistry {
             },
             [](GXFEndpoint* gxf_endpoint) -> nvidia::gxf::Expected<Message> {
               Endpoint endpoint(gxf_endpoint);
-              auto maybe_value = codec<typeT>::deserialize(&endpoint);
+              auto maybe_value = deserialize_message_value<typeT>(&endpoint);
               if (maybe_value) {
-                return Message{maybe_value.value()};
+                // moved to keep the buffers registered with `read_borrowed()` in place
+                return Message{std::move(maybe_value.value())};
               } else {
                 HOLOSCAN_LOG_ERROR("Error happens in deserializing data of type '{}'",
                                    typeid(typeT).name());
                 return nvidia::gxf::Unexpected(GXF_FAILURE);
               }
             }));
+    update_codec_table(index, codec_name);
   }
 
  private:
@@ -464,6 +610,12 @@ class CodecRegistry {
         "std::shared_ptr<std::vector<std::vector<std::string>>>>"s);
   }
 
+  /// Record a new codec name and refresh its codec table entry, if any.
+  void update_codec_table(const std::type_index& index, const std::string& codec_name);
+  /// Refresh the codec table entry of a codec in a table being built, if any.
+  void update_codec_table_entry(CodecTable& table, const std::type_index& index,
+                                const std::string& codec_name) const;
+
   // define maps to and from type_index and string (since type_index may vary across platforms)
   std::unordered_map<std::type_index, std::string>
       index_to_name_map_;  ///< Mapping from type_index to name
@@ -472,6 +624,19 @@ class CodecRegistry {
 
   std::unordered_map<std::string, std::pair<SerializeFunc, DeserializeFunc>>
       codec_map_;  ///< Map of codec name to codec function pair
+
+  std::vector<std::string> codec_names_;  ///< Codec names in registration order
+
+  /// Mutex that keeps the registry copyable (a copy gets its own, unlocked mutex).
+  struct CodecTableMutex : std::mutex {
+    CodecTableMutex() = default;
+    CodecTableMutex(const CodecTableMutex&) : std::mutex() {}
+    CodecTableMutex& operator=(const CodecTableMutex&) { return *this; }
+  };
+
+  CodecTableMutex codec_table_mutex_;  ///< Serializes the updates of the codec table
+  /// Current codec table, only accessed with std::atomic_load/std::atomic_store
+  std::shared_ptr<const CodecTable> codec_table_ = std::make_shared<const CodecTable>();
 };
 
 }  // namespace holoscan
@@ -20,7 +20,9 @@
 
 #include <complex>
 #include <cstdint>
+#include <cstring>
 #include <functional>
+#include <limits>
 #include <memory>
 #include <string>
 #include <type_traits>
@@ -96,27 +98,38 @@ struct ContiguousDataHeader {
 };
 #pragma pack(pop)
 
+// If `borrow` is true, large blobs are sent as borrowed segments (see Endpoint::write_borrowed) so
+// `data` must outlive the send and the deserialized value must only be moved. This is only the
+// case for the value of a message (see has_borrowing_codec), so codecs of nested values keep the
+// default. The same `borrow` value must be used for serialization and deserialization.
 template <typename vectorT>
 static inline expected<size_t, RuntimeError> serialize_binary_blob(const vectorT& data,
-                                                                   Endpoint* endpoint) {
+                                                                   Endpoint* endpoint,
+                                                                   bool borrow = false) {
   ContiguousDataHeader header;
   header.size = data.size();
   header.bytes_per_element = header.size > 0 ? sizeof(data[0]) : 1;
   auto size = endpoint->write_trivial_type<ContiguousDataHeader>(&header);
   if (!size) { return forward_error(size); }
-  auto size2 = endpoint->write(data.data(), header.size * header.bytes_per_element);
+  const size_t data_size = header.size * header.bytes_per_element;
+  auto size2 = borrow ? endpoint->write_borrowed(data.data(), data_size)
+                      : endpoint->write(data.data(), data_size);
   if (!size2) { return forward_error(size2); }
   return size.value() + size2.value();
 }
 
 template <typename vectorT>
-static inline expected<vectorT, RuntimeError> deserialize_binary_blob(Endpoint* endpoint) {
+static inline expected<vectorT, RuntimeError> deserialize_binary_blob(Endpoint* endpoint,
+                                                                      bool borrow = false) {
   ContiguousDataHeader header;
   auto header_size = endpoint->read_trivial_type<ContiguousDataHeader>(&header);
   if (!header_size) { return forward_error(header_size); }
   vectorT data;
   data.resize(header.size);
-  auto result = endpoint->read(data.data(), header.size * header.bytes_per_element);
+  // borrowed segments may be filled after this returns, so `data` must only be moved from here on
+  const size_t data_size = header.size * header.bytes_per_element;
+  auto result = borrow ? endpoint->read_borrowed(data.data(), data_size)
+                       : endpoint->read(data.data(), data_size);
   if (!result) { return forward_error(result); }
   return data;
 }
@@ -125,22 +138,24 @@ static inline expected<vectorT, RuntimeError> deserialize_binary_blob(Endpoint*
 template <typename typeT>
 struct codec<std::vector<typeT>> {
   static expected<size_t, RuntimeError> serialize(const std::vector<typeT>& value,
-                                                  Endpoint* endpoint) {
-    return serialize_binary_blob<std::vector<typeT>>(value, endpoint);
+                                                  Endpoint* endpoint, bool borrow = false) {
+    return serialize_binary_blob<std::vector<typeT>>(value, endpoint, borrow);
   }
-  static expected<std::vector<typeT>, RuntimeError> deserialize(Endpoint* endpoint) {
-    return deserialize_binary_blob<std::vector<typeT>>(endpoint);
+  static expected<std::vector<typeT>, RuntimeError> deserialize(Endpoint* endpoint,
+                                                                bool borrow = false) {
+    return deserialize_binary_blob<std::vector<typeT>>(endpoint, borrow);
   }
 };
 
 // codec for std::string
 template <>
 struct codec<std::string> {
-  static expected<size_t, RuntimeError> serialize(const std::string& value, Endpoint* endpoint) {
-    return serialize_binary_blob<std::string>(value, endpoint);
+  static expected<size_t, RuntimeError> serialize(const std::string& value, Endpoint* endpoint,
+                                                  bool borrow = false) {
+    return serialize_binary_blob<std::string>(value, endpoint, borrow);
   }
-  static expected<std::string, RuntimeError> deserialize(Endpoint* endpoint) {
-    return deserialize_binary_blob<std::string>(endpoint);
+  static expected<std::string, RuntimeError> deserialize(Endpoint* endpoint, bool borrow = false) {
+    return deserialize_binary_blob<std::string>(endpoint, borrow);
   }
 };
 
@@ -194,6 +209,40 @@ struct codec<std::vector<bool>> {
 // Codec type 5: serialization of nested container types
 //               e.g. std::vector<std::vector<float>>,  std::vector<std::string>
 //
+// Two encodings are used:
+//
+// - The contiguous encoding (std::vector<std::string> and vectors of vectors of numeric types) is
+//   a ContiguousVectorsHeader, the end offset (in elements) of each vector and the data of all
+//   the vectors. The data of the vectors smaller than Endpoint::kBorrowedSegmentMinSize is
+//   gathered into a single write, while larger vectors are written separately (as borrowed
+//   segments if `borrow` is true, see serialize_binary_blob).
+// - The per-element encoding (other nested types) is the number of vectors followed by the
+//   codec<vectorT> of each vector.
+//
+// The contiguous encoding starts with kContiguousVectorsMarker in place of the number of vectors,
+// so that data sent with the per-element encoding by an older version can still be deserialized.
+
+// Marker written in place of the number of vectors of the per-element encoding
+constexpr size_t kContiguousVectorsMarker = std::numeric_limits<size_t>::max();
+// Version of the contiguous encoding
+constexpr uint8_t kContiguousVectorsVersion = 1;
+
+#pragma pack(push, 1)
+struct ContiguousVectorsHeader {
+  size_t marker;  // kContiguousVectorsMarker
+  uint8_t version;
+  size_t num_vectors;
+  uint8_t bytes_per_element;
+};
+#pragma pack(pop)
+
+// Element types of the vectors using the contiguous encoding
+template <typename typeT>
+struct is_contiguous_vector_element
+    : std::bool_constant<std::is_arithmetic_v<typeT> && !std::is_same_v<typeT, bool>> {};
+
+template <typename typeT>
+struct is_contiguous_vector_element<std::complex<typeT>> : is_contiguous_vector_element<typeT> {};
 
 template <typename typeT>
 static inline expected<size_t, RuntimeError> serialize_vector_of_vectors(const typeT& vectors,
@@ -218,11 +267,8 @@ static inline expected<size_t, RuntimeError> serialize_vector_of_vectors(const t
 }
 
 template <typename typeT>
-static inline expected<typeT, RuntimeError> deserialize_vector_of_vectors(Endpoint* endpoint) {
-  size_t num_vectors;
-  auto size = endpoint->read_trivial_type<size_t>(&num_vectors);
-  if (!size) { return forward_error(size); }
-
+static inline expected<typeT, RuntimeError> deserialize_vector_elements(Endpoint* endpoint,
+                                                                        size_t num_vectors) {
   using vectorT = typename typeT::value_type;
 
   std::vector<vectorT> data;
@@ -230,33 +276,230 @@ static inline expected<typeT, RuntimeError> deserialize_vector_of_vectors(Endpoi
   for (size_t i = 0; i < num_vectors; i++) {
     auto vec = codec<vectorT>::deserialize(endpoint);
     if (!vec) { return forward_error(vec); }
-    data.push_back(vec.value());
+    data.push_back(std::move(vec.value()));
   }
   return data;
 }
 
+template <typename typeT>
+static inline expected<typeT, RuntimeError> deserialize_vector_of_vectors(Endpoint* endpoint) {
+  size_t num_vectors;
+  auto size = endpoint->read_trivial_type<size_t>(&num_vectors);
+  if (!size) { return forward_error(size); }
+  return deserialize_vector_elements<typeT>(endpoint, num_vectors);
+}
+
+template <typename typeT>
+static inline expected<size_t, RuntimeError> serialize_contiguous_vectors(const typeT& vectors,
+                                                                          Endpoint* endpoint,
+                                                                          bool borrow) {
+  using elementT = typename typeT::value_type::value_type;
+  constexpr size_t kElementSize = sizeof(elementT);
+
+  ContiguousVectorsHeader header;
+  header.marker = kContiguousVectorsMarker;
+  header.version = kContiguousVectorsVersion;
+  header.num_vectors = vectors.size();
+  header.bytes_per_element = kElementSize;
+  auto size = endpoint->write_trivial_type<ContiguousVectorsHeader>(&header);
+  if (!size) { return forward_error(size); }
+  size_t total_size = size.value();
+  if (header.num_vectors == 0) { return total_size; }
+
+  std::vector<size_t> offsets;
+  offsets.reserve(header.num_vectors);
+  size_t offset = 0;
+  size_t gathered_size = 0;
+  for (const auto& vector : vectors) {
+    offset += vector.size();
+    offsets.push_back(offset);
+    const size_t data_size = vector.size() * kElementSize;
+    if (data_size < Endpoint::kBorrowedSegmentMinSize) { gathered_size += data_size; }
+  }
+  size = endpoint->write(offsets.data(), offsets.size() * sizeof(size_t));
+  if (!size) { return forward_error(size); }
+  total_size += size.value();
+
+  // the deserializer splits the data in the same way from the offsets
+  std::vector<uint8_t> gathered;
+  gathered.reserve(gathered_size);
+  auto flush = [&gathered, &total_size, endpoint]() -> expected<void, RuntimeError> {
+    if (gathered.empty()) { return {}; }
+    auto written = endpoint->write(gathered.data(), gathered.size());
+    if (!written) { return forward_error(written); }
+    total_size += written.value();
+    gathered.clear();
+    return {};
+  };
+  for (const auto& vector : vectors) {
+    const size_t data_size = vector.size() * kElementSize;
+    const auto* bytes = reinterpret_cast<const uint8_t*>(vector.data());
+    if (data_size < Endpoint::kBorrowedSegmentMinSize) {
+      gathered.insert(gathered.end(), bytes, bytes + data_size);
+      continue;
+    }
+    auto flushed = flush();
+    if (!flushed) { return forward_error(flushed); }
+    size = borrow ? endpoint->write_borrowed(bytes, data_size) : endpoint->write(bytes, data_size);
+    if (!size) { return forward_error(size); }
+    total_size += size.value();
+  }
+  auto flushed = flush();
+  if (!flushed) { return forward_error(flushed); }
+  return total_size;
+}
+
+template <typename typeT>
+static inline expected<typeT, RuntimeError> deserialize_contiguous_vectors(Endpoint* endpoint,
+                                                                          bool borrow) {
+  using elementT = typename typeT::value_type::value_type;
+  constexpr size_t kElementSize = sizeof(elementT);
+
+  ContiguousVectorsHeader header;
+  auto size = endpoint->read_trivial_type<size_t>(&header.marker);
+  if (!size) { return forward_error(size); }
+  if (header.marker != kContiguousVectorsMarker) {
+    // sent with the per-element encoding
+    return deserialize_vector_elements<typeT>(endpoint, header.marker);
+  }
+  size = endpoint->read(reinterpret_cast<uint8_t*>(&header) + sizeof(header.marker),
+                        sizeof(header) - sizeof(header.marker));
+  if (!size) { return forward_error(size); }
+  if (header.version != kContiguousVectorsVersion) {
+    return make_unexpected<RuntimeError>(RuntimeError(
+        ErrorCode::kCodecError,
+        fmt::format("Unsupported contiguous vectors encoding version {}", header.version)));
+  }
+  if (header.bytes_per_element != kElementSize) {
+    return make_unexpected<RuntimeError>(RuntimeError(
+        ErrorCode::kCodecError,
+        fmt::format("Expected {} bytes per element, got {}", kElementSize,
+                    header.bytes_per_element)));
+  }
+
+  typeT data(header.num_vectors);
+  if (header.num_vectors == 0) { return data; }
+
+  std::vector<size_t> offsets(header.num_vectors);
+  size = endpoint->read(offsets.data(), offsets.size() * sizeof(size_t));
+  if (!size) { return forward_error(size); }
+  size_t begin = 0;
+  for (size_t i = 0; i < header.num_vectors; i++) {
+    if (offsets[i] < begin) {
+      return make_unexpected<RuntimeError>(
+          RuntimeError(ErrorCode::kCodecError, "Invalid contiguous vectors offsets"));
+    }
+    data[i].resize(offsets[i] - begin);
+    begin = offsets[i];
+  }
+
+  // borrowed segments may be filled after this returns, so `data` must only be moved from here on
+  std::vector<uint8_t> gathered;
+  size_t first_gathered = 0;
+  size_t gathered_size = 0;
+  auto scatter = [&](size_t end) -> expected<void, RuntimeError> {
+    if (gathered_size == 0) { return {}; }
+    gathered.resize(gathered_size);
+    auto read_size = endpoint->read(gathered.data(), gathered_size);
+    if (!read_size) { return forward_error(read_size); }
+    size_t position = 0;
+    for (size_t i = first_gathered; i < end; i++) {
+      const size_t data_size = data[i].size() * kElementSize;
+      if (data_size >= Endpoint::kBorrowedSegmentMinSize) { continue; }
+      std::memcpy(data[i].data(), gathered.data() + position, data_size);
+      position += data_size;
+    }
+    gathered_size = 0;
+    return {};
+  };
+  for (size_t i = 0; i < header.num_vectors; i++) {
+    const size_t data_size = data[i].size() * kElementSize;
+    if (data_size < Endpoint::kBorrowedSegmentMinSize) {
+      if (gathered_size == 0) { first_gathered = i; }
+      gathered_size += data_size;
+      continue;
+    }
+    auto scattered = scatter(i);
+    if (!scattered) { return forward_error(scattered); }
+    size = borrow ? endpoint->read_borrowed(data[i].data(), data_size)
+                  : endpoint->read(data[i].data(), data_size);
+    if (!size) { return forward_error(size); }
+  }
+  auto scattered = scatter(header.num_vectors);
+  if (!scattered) { return forward_error(scattered); }
+  return data;
+}
+
 template <typename typeT>
 struct codec<std::vector<std::vector<typeT>>> {
   static expected<size_t, RuntimeError> serialize(const std::vector<std::vector<typeT>>& value,
-                                                  Endpoint* endpoint) {
-    return serialize_vector_of_vectors<std::vector<std::vector<typeT>>>(value, endpoint);
+                                                  Endpoint* endpoint, bool borrow = false) {
+    if constexpr (is_contiguous_vector_element<typeT>::value) {
+      return serialize_contiguous_vectors<std::vector<std::vector<typeT>>>(value, endpoint, borrow);
+    } else {
+      return serialize_vector_of_vectors<std::vector<std::vector<typeT>>>(value, endpoint);
+    }
   }
-  static expected<std::vector<std::vector<typeT>>, RuntimeError> deserialize(Endpoint* endpoint) {
-    return deserialize_vector_of_vectors<std::vector<std::vector<typeT>>>(endpoint);
+  static expected<std::vector<std::vector<typeT>>, RuntimeError> deserialize(
+      Endpoint* endpoint, bool borrow = false) {
+    if constexpr (is_contiguous_vector_element<typeT>::value) {
+      return deserialize_contiguous_vectors<std::vector<std::vector<typeT>>>(endpoint, borrow);
+    } else {
+      return deserialize_vector_of_vectors<std::vector<std::vector<typeT>>>(endpoint);
+    }
   }
 };
 
 template <>
 struct codec<std::vector<std::string>> {
   static expected<size_t, RuntimeError> serialize(const std::vector<std::string>& value,
-                                                  Endpoint* endpoint) {
-    return serialize_vector_of_vectors<std::vector<std::string>>(value, endpoint);
+                                                  Endpoint* endpoint, bool borrow = false) {
+    return serialize_contiguous_vectors<std::vector<std::string>>(value, endpoint, borrow);
   }
-  static expected<std::vector<std::string>, RuntimeError> deserialize(Endpoint* endpoint) {
-    return deserialize_vector_of_vectors<std::vector<std::string>>(endpoint);
+  static expected<std::vector<std::string>, RuntimeError> deserialize(Endpoint* endpoint,
+                                                                      bool borrow = false) {
+    return deserialize_contiguous_vectors<std::vector<std::string>>(endpoint, borrow);
   }
 };
 
+// Types whose codec takes a `borrow` argument (see serialize_binary_blob). The codec registry
+// opts in for the value of a message, which outlives the send and is moved on receive.
+template <typename typeT>
+struct has_borrowing_codec : std::false_type {};
+
+template <typename typeT>
+struct has_borrowing_codec<std::vector<typeT>> : is_contiguous_vector_element<typeT> {};
+
+template <typename typeT>
+struct has_borrowing_codec<std::vector<std::vector<typeT>>> : is_contiguous_vector_element<typeT> {
+};
+
+template <>
+struct has_borrowing_codec<std::string> : std::true_type {};
+
+template <>
+struct has_borrowing_codec<std::vector<std::string>> : std::true_type {};
+
+// Codec of the value of a message (used by CodecRegistry)
+template <typename typeT>
+static inline expected<size_t, RuntimeError> serialize_message_value(const typeT& value,
+                                                                     Endpoint* endpoint) {
+  if constexpr (has_borrowing_codec<typeT>::value) {
+    return codec<typeT>::serialize(value, endpoint, true);
+  } else {
+    return codec<typeT>::serialize(value, endpoint);
+  }
+}
+
+template <typename typeT>
+static inline expected<typeT, RuntimeError> deserialize_message_value(Endpoint* endpoint) {
+  if constexpr (has_borrowing_codec<typeT>::value) {
+    return codec<typeT>::deserialize(endpoint, true);
+  } else {
+    return codec<typeT>::deserialize(endpoint);
+  }
+}
+
 // codec for shared_ptr types
 // Serializes the contents of the shared_ptr. On deserialize, a new shared_ptr to the deserialized
 // value is returned.
@@ -269,7 +512,7 @@ struct codec<std::shared_ptr<typeT>> {
   static expected<std::shared_ptr<typeT>, RuntimeError> deserialize(Endpoint* endpoint) {
     auto value = codec<typeT>::deserialize(endpoint);
     if (!value) { return forward_error(value); }
-    return std::make_shared<typeT>(value.value());
+    return std::make_shared<typeT>(std::move(value.value()));
   }
 };
 }  // namespace holoscan
@@ -0,0 +1,67 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_CONDITIONS_GXF_MEMORY_AVAILABLE_HPP
+#define HOLOSCAN_CORE_CONDITIONS_GXF_MEMORY_AVAILABLE_HPP
+
+#include <memory>
+
+#include "../../gxf/gxf_condition.hpp"
+#include "../../resources/gxf/allocator.hpp"
+
+namespace holoscan {
+
+/**
+ * @brief Condition permitting execution only while an allocator can provide a buffer.
+ *
+ * Use it on a producer with the allocator its output buffers are drawn from (e.g., a
+ * BlockMemoryPool): the producer is not scheduled while the pool is exhausted and resumes once a
+ * downstream operator releases a buffer. As nothing notifies the scheduler of a free, the
+ * allocator is checked again every `poll_period_ns` nanoseconds (1 ms by default) while it is
+ * exhausted: a longer period costs less scheduler work for each blocked producer but delays its
+ * resumption.
+ */
+class MemoryAvailableCondition : public gxf::GXFCondition {
+ public:
+  HOLOSCAN_CONDITION_FORWARD_ARGS_SUPER(MemoryAvailableCondition, GXFCondition)
+  MemoryAvailableCondition() = default;
+  explicit MemoryAvailableCondition(uint64_t min_bytes) : min_bytes_(min_bytes) {}
+
+  const char* gxf_typename() const override {
+    return "holoscan::MemoryAvailableSchedulingTerm";
+  }
+
+  void setup(ComponentSpec& spec) override;
+
+  void allocator(std::shared_ptr<Allocator> allocator) { allocator_ = allocator; }
+  std::shared_ptr<Allocator> allocator() { return allocator_; }
+
+  void min_bytes(uint64_t min_bytes) { min_bytes_ = min_bytes; }
+  uint64_t min_bytes() { return min_bytes_; }
+
+  void poll_period_ns(int64_t poll_period_ns) { poll_period_ns_ = poll_period_ns; }
+  int64_t poll_period_ns() { return poll_period_ns_; }
+
+ private:
+  Parameter<std::shared_ptr<Allocator>> allocator_;
+  Parameter<uint64_t> min_bytes_;
+  Parameter<int64_t> poll_period_ns_;
+};
+
+}  // namespace holoscan
+
+#endif /* HOLOSCAN_CORE_CONDITIONS_GXF_MEMORY_AVAILABLE_HPP */
@@ -21,8 +21,11 @@
 #include <filesystem>
 #include <iostream>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
+#include "./arg.hpp"
 #include "./common.hpp"
 
 namespace holoscan {
@@ -70,12 +73,29 @@ class Config {
    */
   const std::vector<YAML::Node>& yaml_nodes() const { return yaml_nodes_; }
 
+  /**
+   * @brief Find the arguments of a dotted key (e.g. `"aja.width"`) in the key index.
+   *
+   * The index is built once when the configuration file is parsed and maps every dotted key of
+   * the YAML documents to the arguments returned by Fragment::from_config(). Keys that are not
+   * found in every YAML document and keys of sequences are not indexed.
+   *
+   * @param key The dotted key.
+   * @return The pointer to the arguments of the key, or nullptr if the key is not indexed.
+   */
+  const ArgList* find_args(const std::string& key) const;
+
  private:
   void parse_file(const std::string& config_file);
+  void build_key_index();
+  void index_map(const YAML::Node& yaml_map, const std::string& key_prefix);
 
   std::string config_file_;
   std::string prefix_;
   std::vector<YAML::Node> yaml_nodes_;
+
+  /// The arguments of each dotted key, and the number of YAML documents containing the key.
+  std::unordered_map<std::string, std::pair<ArgList, size_t>> key_index_;
 };
 
 }  // namespace holoscan
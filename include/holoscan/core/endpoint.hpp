@@ -52,6 +52,10 @@ class Endpoint : public Resource {
 
   using MemoryStorageType = nvidia::gxf::MemoryStorageType;
 
+  /// Minimum size (in bytes) of the buffers registered as separate segments by `write_borrowed()`
+  /// and `read_borrowed()`. Smaller buffers are copied.
+  static constexpr size_t kBorrowedSegmentMinSize = 16 * 1024;
+
   // C++ API wrappers
   virtual bool is_write_available() {
     if (!gxf_endpoint_) { throw std::runtime_error("GXF endpoint has not been set"); }
@@ -103,6 +107,67 @@ class Endpoint : public Resource {
     return expected<void, RuntimeError>();
   }
 
+  /**
+   * @brief Write a borrowed buffer segment.
+   *
+   * Buffers of at least kBorrowedSegmentMinSize bytes are registered with the GXF endpoint
+   * (`write_ptr()`) instead of being copied to it. UCX endpoints send registered buffers directly
+   * (scatter-gather), so the buffer must stay valid until the message is sent. Smaller buffers,
+   * and endpoints that do not implement `write_ptr()`, are written with `write()`.
+   *
+   * The receiving side must read the segment with `read_borrowed()`.
+   *
+   * @param data The buffer to send.
+   * @param size The size of the buffer in bytes.
+   * @param type The memory storage type of the buffer.
+   * @return The number of bytes written.
+   */
+  virtual expected<size_t, RuntimeError> write_borrowed(
+      const void* data, size_t size, MemoryStorageType type = MemoryStorageType::kSystem) {
+    if (size < kBorrowedSegmentMinSize) { return write(data, size); }
+    if (!gxf_endpoint_) {
+      return make_unexpected<RuntimeError>(
+          RuntimeError(ErrorCode::kCodecError, "GXF endpoint has not been set"));
+    }
+    auto maybe_void = gxf_endpoint_->write_ptr(data, size, type);
+    if (!maybe_void) {
+      if (maybe_void.error() == GXF_NOT_IMPLEMENTED) { return write(data, size); }
+      auto err_msg =
+          fmt::format("GXF endpoint write failure: {}", GxfResultStr(maybe_void.error()));
+      return make_unexpected<RuntimeError>(RuntimeError(ErrorCode::kCodecError, err_msg));
+    }
+    return size;
+  }
+
+  /**
+   * @brief Read a buffer segment written by `write_borrowed()`.
+   *
+   * Buffers of at least kBorrowedSegmentMinSize bytes are registered with the GXF endpoint
+   * (`write_ptr()`) as the destination of the segment. UCX endpoints fill registered buffers once
+   * the whole message has been deserialized, so the buffer must not be reallocated or copied
+   * (moving a std::vector or a heap-allocated std::string is fine) until then.
+   *
+   * @param data The destination buffer.
+   * @param size The size of the buffer in bytes.
+   * @param type The memory storage type of the buffer.
+   * @return The number of bytes read.
+   */
+  virtual expected<size_t, RuntimeError> read_borrowed(
+      void* data, size_t size, MemoryStorageType type = MemoryStorageType::kSystem) {
+    if (size < kBorrowedSegmentMinSize) { return read(data, size); }
+    if (!gxf_endpoint_) {
+      return make_unexpected<RuntimeError>(
+          RuntimeError(ErrorCode::kCodecError, "GXF endpoint has not been set"));
+    }
+    auto maybe_void = gxf_endpoint_->write_ptr(data, size, type);
+    if (!maybe_void) {
+      if (maybe_void.error() == GXF_NOT_IMPLEMENTED) { return read(data, size); }
+      auto err_msg = fmt::format("GXF endpoint read failure: {}", GxfResultStr(maybe_void.error()));
+      return make_unexpected<RuntimeError>(RuntimeError(ErrorCode::kCodecError, err_msg));
+    }
+    return size;
+  }
+
   // Note: in GXF, writeTrivialType and readTrivialType below are not on Endpoint itself, but on
   // SerializationBuffer and UcxSerializationBuffer
 
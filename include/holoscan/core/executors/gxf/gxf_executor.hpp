@@ -26,6 +26,7 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "../../app_driver.hpp"
@@ -35,6 +36,9 @@
 
 namespace holoscan::gxf {
 
+// Forward declarations
+class GXFWrapper;
+
 /**
  * @brief Executor for GXF.
  */
@@ -199,6 +203,25 @@ class GXFExecutor : public holoscan::Executor {
                                     std::shared_ptr<Operator> op);
 
   void register_extensions();
+
+  /// Load the default GXF extensions required by the graph (HOLOSCAN_LAZY_GXF_EXTENSIONS).
+  ///
+  /// The required extensions are found from the GXF type names of the operators, conditions,
+  /// resources, connectors, scheduler and network context, and from the extensions declared with
+  /// `OperatorSpec::require_gxf_extension()`. All the default extensions are loaded if the
+  /// configuration lists extensions or if a type name is not provided by the loaded extensions.
+  void load_required_extensions(OperatorGraph& graph);
+
+  /// Start the native operators concurrently (HOLOSCAN_PARALLEL_OPERATOR_START).
+  ///
+  /// Called once the GXF graph is activated. An operator is started once all of its upstream
+  /// operators are started, by a pool of at most std::thread::hardware_concurrency() threads, so
+  /// operators on independent branches are started in parallel. GXF then skips Operator::start()
+  /// for these operators (see GXFWrapper::start()).
+  /// If an operator fails to start, the operators already started are stopped and the graph is
+  /// deactivated before the first error is rethrown.
+  void start_operators_in_parallel();
+
   bool own_gxf_context_ = false;  ///< Whether this executor owns the GXF context.
   gxf_uid_t op_eid_ = 0;          ///< The GXF entity ID of the operator. Create new entity for
                                   ///< initializing a new operator if this is 0.
@@ -209,6 +232,9 @@ class GXFExecutor : public holoscan::Executor {
 
   /// The flag to indicate whether the extensions are loaded.
   bool is_extensions_loaded_ = false;
+  /// The flag to indicate whether the default GXF extensions are loaded when the graph is
+  /// initialized (only the ones required by the graph) instead of when the executor is created.
+  bool load_extensions_on_demand_ = false;
   /// The flag to indicate whether the GXF graph is initialized.
   bool is_gxf_graph_initialized_ = false;
   /// The flag to indicate whether the GXF graph is activated.
@@ -217,6 +243,9 @@ class GXFExecutor : public holoscan::Executor {
   /// The entity prefix for the fragment.
   std::string entity_prefix_;
 
+  /// The GXF codelets wrapping the native operators, indexed by operator.
+  std::unordered_map<Operator*, GXFWrapper*> gxf_wrappers_;
+
   /// The connection items for virtual operators.
   std::vector<std::shared_ptr<holoscan::ConnectionItem>> connection_items_;
 
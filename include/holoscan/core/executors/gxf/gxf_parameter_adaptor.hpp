@@ -256,7 +256,8 @@ class GXFParameterAdaptor {
 
                       gxf_resource->initialize();
                     }
-                    return GxfParameterSetHandle(context, uid, key, gxf_resource->gxf_cid());
+                    return GxfParameterSetHandle(
+                        context, uid, key, gxf_resource->gxf_handle_cid());
                   } else {
                     HOLOSCAN_LOG_TRACE("Resource is null for key '{}'. Not setting parameter.",
                                        key);
@@ -408,7 +409,7 @@ class GXFParameterAdaptor {
                     auto gxf_resource = std::dynamic_pointer_cast<GXFResource>(resource);
                     // Push back the resource's gxf_cname only if it is not null.
                     if (gxf_resource) {
-                      gxf_uid_t resource_cid = gxf_resource->gxf_cid();
+                      gxf_uid_t resource_cid = gxf_resource->gxf_handle_cid();
                       std::string full_resource_name =
                           gxf::get_full_component_name(context, resource_cid);
                       yaml_node.push_back(full_resource_name.c_str());
@@ -31,8 +31,10 @@
 #include "dataflow_tracker.hpp"
 #include "executor.hpp"
 #include "graph.hpp"
+#include "io_spec.hpp"
 #include "network_context.hpp"
 #include "scheduler.hpp"
+#include "startup_profiler.hpp"
 
 namespace holoscan {
 
@@ -554,6 +556,58 @@ class Fragment {
                         const std::shared_ptr<Operator>& downstream_op,
                         std::set<std::pair<std::string, std::string>> port_pairs);
 
+  /**
+   * @brief Add a flow between two operators using the given connector type.
+   *
+   * Same as `add_flow(upstream_op, downstream_op, port_pairs)`, but the output and input ports
+   * connected by this call use `connector_type`. The connector arguments are passed to the
+   * receiver (input port) only.
+   *
+   * An output port has a single transmitter, so if it is connected several times (or its
+   * connector was set in `setup()`), the first connector type given is kept and a warning is
+   * logged for conflicting types. Each input port uses the connector type of its own flow.
+   *
+   * For example, to let a visualizer only receive the newest frame:
+   *
+   *     add_flow(inference, visualizer, {{"", "receivers"}}, IOSpec::ConnectorType::kConflating);
+   *
+   * @param upstream_op The upstream operator.
+   * @param downstream_op The downstream operator.
+   * @param port_pairs The port pairs.
+   * @param connector_type The type of the connector.
+   * @param connector_args The arguments of the connector (receiver).
+   */
+  virtual void add_flow(const std::shared_ptr<Operator>& upstream_op,
+                        const std::shared_ptr<Operator>& downstream_op,
+                        std::set<std::pair<std::string, std::string>> port_pairs,
+                        IOSpec::ConnectorType connector_type,
+                        const ArgList& connector_args = ArgList());
+
+  /**
+   * @brief Add a flow between two operators using a connector described by arguments.
+   *
+   * The connector type is given by the `type` argument (`default`, `double_buffer`,
+   * `ring_buffer` or `conflating`) and the other arguments are passed to the receiver. This allows
+   * selecting the connector in the configuration file:
+   *
+   *     display_connector:
+   *       type: conflating
+   *       key_by_tensor_name: true
+   *
+   * and in the Application's `compose()` method:
+   *
+   *     add_flow(inference, visualizer, {{"", "receivers"}}, from_config("display_connector"));
+   *
+   * @param upstream_op The upstream operator.
+   * @param downstream_op The downstream operator.
+   * @param port_pairs The port pairs.
+   * @param connector_config The connector type (`type`) and arguments.
+   */
+  virtual void add_flow(const std::shared_ptr<Operator>& upstream_op,
+                        const std::shared_ptr<Operator>& downstream_op,
+                        std::set<std::pair<std::string, std::string>> port_pairs,
+                        const ArgList& connector_config);
+
   /**
    * @brief Compose a graph.
    *
@@ -601,6 +655,17 @@ class Fragment {
    */
   DataFlowTracker* data_flow_tracker() { return data_flow_tracker_.get(); }
 
+  /**
+   * @brief Get the StartupProfiler object for this fragment.
+   *
+   * The profiler holds the duration of the startup phases of the fragment (configuration,
+   * composition, GXF graph initialization and activation, and the initialize()/start() methods of
+   * the operators).
+   *
+   * @return The reference to the StartupProfiler object.
+   */
+  StartupProfiler& startup_profiler() { return *startup_profiler_; }
+
   /**
    * @brief Calls compose() if the graph is not composed yet.
    */
@@ -639,6 +704,8 @@ class Fragment {
   std::shared_ptr<NetworkContext> network_context_;  ///< The network_context used by the executor
   std::shared_ptr<DataFlowTracker> data_flow_tracker_;  ///< The DataFlowTracker for the fragment
   bool is_composed_ = false;                            ///< Whether the graph is composed or not.
+  /// The StartupProfiler for the fragment
+  std::shared_ptr<StartupProfiler> startup_profiler_ = std::make_shared<StartupProfiler>();
 };
 
 }  // namespace holoscan
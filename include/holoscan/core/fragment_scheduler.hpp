@@ -18,6 +18,7 @@
 #ifndef HOLOSCAN_CORE_FRAGMENT_SCHEDULER_HPP
 #define HOLOSCAN_CORE_FRAGMENT_SCHEDULER_HPP
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -55,6 +56,17 @@ struct AvailableSystemResource {
   bool has_enough_resources(const SystemResourceRequirement& resource_requirement) const;
 };
 
+/**
+ * @brief Expected amount of data sent between two fragments.
+ *
+ * Allocation strategies that are not communication-aware ignore this.
+ */
+struct FragmentConnectionRequirement {
+  std::string source_fragment;
+  std::string target_fragment;
+  uint64_t bandwidth = 0;  ///< Bytes per second
+};
+
 class FragmentAllocationStrategy {
  public:
   virtual ~FragmentAllocationStrategy() = default;
@@ -83,11 +95,25 @@ class FragmentAllocationStrategy {
    */
   void add_available_resource(AvailableSystemResource&& available_resource);
 
+  /**
+   * @brief Add the expected bandwidth of a connection between two fragments.
+   *
+   * Requirements for the same pair of fragments (in either direction) are accumulated.
+   *
+   * @param connection_requirement The connection requirement.
+   */
+  void add_connection_requirement(const FragmentConnectionRequirement& connection_requirement);
+
   virtual void on_add_resource_requirement(
       const SystemResourceRequirement& resource_requirement) = 0;
 
   virtual void on_add_available_resource(const AvailableSystemResource& available_resource) = 0;
 
+  virtual void on_add_connection_requirement(
+      const FragmentConnectionRequirement& connection_requirement) {
+    (void)connection_requirement;
+  }
+
   virtual holoscan::expected<std::unordered_map<std::string, std::string>, std::string>
   schedule() = 0;
 
@@ -96,8 +122,24 @@ class FragmentAllocationStrategy {
   std::unordered_map<std::string, SystemResourceRequirement> resource_requirements_;
   /// Available system resources (app worker name as server ip/port, available resource)
   std::unordered_map<std::string, AvailableSystemResource> available_resources_;
+  /// Connection requirements between fragments
+  std::vector<FragmentConnectionRequirement> connection_requirements_;
 };
 
+/**
+ * @brief Create a fragment allocation strategy by name.
+ *
+ * Available strategies are "greedy" (GreedyFragmentAllocationStrategy) and "communication_aware"
+ * (CommunicationAwareFragmentAllocationStrategy).
+ *
+ * @param name The name of the strategy.
+ * @param max_fragments_per_worker The maximum number of fragments scheduled on an app worker that
+ * does not specify target fragments (only used by the "communication_aware" strategy).
+ * @return The strategy, or an error message if the name is unknown.
+ */
+holoscan::expected<std::unique_ptr<FragmentAllocationStrategy>, std::string>
+make_fragment_allocation_strategy(const std::string& name, uint32_t max_fragments_per_worker = 1);
+
 /**
  * @brief The fragment scheduler class.
  *
@@ -135,6 +177,13 @@ class FragmentScheduler {
    */
   void add_available_resource(AvailableSystemResource&& available_resource);
 
+  /**
+   * @brief Add the expected bandwidth of a connection between two fragments.
+   *
+   * @param connection_requirement The connection requirement.
+   */
+  void add_connection_requirement(const FragmentConnectionRequirement& connection_requirement);
+
   /**
    * @brief Schedule the fragments.
    *
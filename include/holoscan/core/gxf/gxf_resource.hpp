@@ -36,6 +36,13 @@ class GXFResource : public holoscan::Resource, public gxf::GXFComponent {
   GXFResource(const std::string& name, nvidia::gxf::Component* component);
 
   void initialize() override;
+
+  /**
+   * @brief Get the GXF component ID that the handle parameters of other components refer to.
+   *
+   * @return gxf_cid() unless a subclass wraps its component (see Allocator::gxf_handle_cid()).
+   */
+  virtual gxf_uid_t gxf_handle_cid() const { return gxf_cid(); }
 };
 
 }  // namespace holoscan::gxf
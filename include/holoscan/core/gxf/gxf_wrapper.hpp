@@ -48,8 +48,19 @@ class GXFWrapper : public nvidia::gxf::Codelet {
    */
   void set_operator(Operator* op) { op_ = op; }
 
+  /**
+   * @brief Set whether the wrapped operator is already started.
+   *
+   * If true, start() does not call Operator::start() again. Used when the executor starts the
+   * operators itself (see GXFExecutor::start_operators_in_parallel()).
+   *
+   * @param started Whether Operator::start() was already called.
+   */
+  void operator_started(bool started) { is_operator_started_ = started; }
+
  private:
   Operator* op_ = nullptr;
+  bool is_operator_started_ = false;
 };
 
 }  // namespace holoscan::gxf
@@ -32,8 +32,13 @@
 #include "./conditions/gxf/downstream_affordable.hpp"
 #include "./conditions/gxf/periodic.hpp"
 #include "./conditions/gxf/message_available.hpp"
+#include "./resources/gxf/conflating_receiver.hpp"
 #include "./resources/gxf/double_buffer_receiver.hpp"
 #include "./resources/gxf/double_buffer_transmitter.hpp"
+#include "./resources/gxf/ring_buffer_receiver.hpp"
+#include "./resources/gxf/ring_buffer_transmitter.hpp"
+#include "./resources/gxf/shared_memory_receiver.hpp"
+#include "./resources/gxf/shared_memory_transmitter.hpp"
 #include "./resources/gxf/ucx_receiver.hpp"
 #include "./resources/gxf/ucx_transmitter.hpp"
 #include "./resource.hpp"
@@ -60,8 +65,26 @@ class IOSpec {
   /**
    * @brief Connector type. Determines the type of Receiver (when IOType is kInput) or Transmitter
    *        (when IOType is kOutput) class used.
+   *
+   * kRingBuffer uses a lock-free single-producer/single-consumer ring buffer and is only valid for
+   * point-to-point connections within a fragment. It falls back to kDoubleBuffer otherwise.
+   *
+   * kConflating keeps only the most recent message in the receiver (optionally one per tensor
+   * name) and never blocks the upstream operator. On an output, it uses a DoubleBufferTransmitter
+   * that drops the oldest message when full.
+   *
+   * kSharedMemory connects fragments running on the same host through a POSIX shared memory
+   * segment. If HOLOSCAN_ENABLE_SHARED_MEMORY_TRANSPORT is true, it is selected for the fragments
+   * of a distributed application whose workers report the same address.
    */
-  enum class ConnectorType { kDefault, kDoubleBuffer, kUCX };
+  enum class ConnectorType {
+    kDefault,
+    kDoubleBuffer,
+    kUCX,
+    kRingBuffer,
+    kConflating,
+    kSharedMemory
+  };
 
   /**
    * @brief Construct a new IOSpec object.
@@ -207,6 +230,10 @@ class IOSpec {
    * - ConnectorType::kDefault
    * - ConnectorType::kDoubleBuffer
    * - ConnectorType::kUCX
+   * - ConnectorType::kRingBuffer
+   * - ConnectorType::kConflating (on an output, the arguments of the DoubleBufferTransmitter,
+   *   whose capacity and policy default to 1 and 0)
+   * - ConnectorType::kSharedMemory
    *
    * @param type The type of the connector (receiver/transmitter).
    * @param args The arguments of the connector (receiver/transmitter).
@@ -234,6 +261,29 @@ class IOSpec {
           connector_ = std::make_shared<UcxTransmitter>(std::forward<ArgsT>(args)...);
         }
         break;
+      case ConnectorType::kRingBuffer:
+        if (io_type_ == IOType::kInput) {
+          connector_ = std::make_shared<RingBufferReceiver>(std::forward<ArgsT>(args)...);
+        } else {
+          connector_ = std::make_shared<RingBufferTransmitter>(std::forward<ArgsT>(args)...);
+        }
+        break;
+      case ConnectorType::kConflating:
+        if (io_type_ == IOType::kInput) {
+          connector_ = std::make_shared<ConflatingReceiver>(std::forward<ArgsT>(args)...);
+        } else {
+          // The arguments given after the defaults override them.
+          connector_ = std::make_shared<DoubleBufferTransmitter>(
+              Arg("capacity", 1UL), Arg("policy", 0UL), std::forward<ArgsT>(args)...);
+        }
+        break;
+      case ConnectorType::kSharedMemory:
+        if (io_type_ == IOType::kInput) {
+          connector_ = std::make_shared<SharedMemoryReceiver>(std::forward<ArgsT>(args)...);
+        } else {
+          connector_ = std::make_shared<SharedMemoryTransmitter>(std::forward<ArgsT>(args)...);
+        }
+        break;
       default:
         HOLOSCAN_LOG_ERROR("Unknown connector type {}", static_cast<int>(type));
         break;
@@ -68,7 +68,7 @@ class Message {
    *
    * @return The value wrapped by the message.
    */
-  std::any value() const { return value_; }
+  const std::any& value() const { return value_; }
 
   /**
    * @brief Get the value object as a specific type.
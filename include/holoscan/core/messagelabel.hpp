@@ -34,15 +34,13 @@ namespace holoscan {
 
 /**
  * @brief Return the current time in microseconds since the epoch.
-This function uses the C++11 standard library's chrono library.
+This function uses the C++11 standard library's chrono library, or the CPU cycle counter (see
+TscCounter) if the `HOLOSCAN_TSC_TIMESTAMPS` environment variable is set to true. It is defined
+in the core library (not inline), so code using this header must link against it.
  *
  * @return The current time in microseconds since epoch.
  */
-static inline int64_t get_current_time_us() {
-  return static_cast<int64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
-                                  std::chrono::system_clock::now().time_since_epoch())
-                                  .count());
-}
+int64_t get_current_time_us();
 
 /** @brief This struct represents a timestamp label for a Holoscan Operator.
  *
@@ -20,6 +20,7 @@
 
 #include <iostream>
 #include <memory>
+#include <set>
 #include <string>
 #include <typeinfo>
 #include <unordered_map>
@@ -262,6 +263,26 @@ class OperatorSpec : public ComponentSpec {
     param(parameter, key, headline, description, flag);
   }
 
+  /**
+   * @brief Declare a GXF extension used by this operator at runtime.
+   *
+   * GXF types that are only used by `compute()` (e.g., `nvidia::gxf::VideoBuffer`) cannot be
+   * found from the graph. When the GXF extensions are loaded on demand
+   * (HOLOSCAN_LAZY_GXF_EXTENSIONS), the declared extensions are loaded with the graph.
+   *
+   * @param file_name The file name of the extension (e.g. libgxf_multimedia.so).
+   */
+  void require_gxf_extension(const std::string& file_name) {
+    required_gxf_extensions_.insert(file_name);
+  }
+
+  /**
+   * @brief Get the GXF extensions declared with `require_gxf_extension()`.
+   *
+   * @return The file names of the extensions.
+   */
+  const std::set<std::string>& required_gxf_extensions() const { return required_gxf_extensions_; }
+
   /**
    * @brief Get a YAML representation of the operator spec.
    *
@@ -272,6 +293,7 @@ class OperatorSpec : public ComponentSpec {
  protected:
   std::unordered_map<std::string, std::unique_ptr<IOSpec>> inputs_;   ///< Input specs
   std::unordered_map<std::string, std::unique_ptr<IOSpec>> outputs_;  ///< Outputs specs
+  std::set<std::string> required_gxf_extensions_;  ///< GXF extensions used at runtime
 };
 
 }  // namespace holoscan
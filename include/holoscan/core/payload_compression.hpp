@@ -0,0 +1,140 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_PAYLOAD_COMPRESSION_HPP
+#define HOLOSCAN_CORE_PAYLOAD_COMPRESSION_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "./errors.hpp"
+#include "./expected.hpp"
+
+namespace holoscan {
+
+/**
+ * @brief Compression algorithm applied to the payloads sent between fragments.
+ *
+ * The values are sent over the wire and must not be changed.
+ */
+enum class CompressionAlgorithm : uint8_t {
+  kNone = 0,  ///< Payload not compressed
+  kLz4 = 1,   ///< LZ4 (block format)
+  kZstd = 2,  ///< Zstandard
+};
+
+/**
+ * @brief Compression of the payloads (tensors and message data) sent between fragments.
+ *
+ * The algorithms are only available if Holoscan SDK was built with the corresponding library
+ * (liblz4, libzstd).
+ *
+ * The algorithms that can be used by all the fragments of a distributed application are
+ * negotiated by the app driver when the workers register (see `set_negotiated_algorithms()`).
+ * Workers only offer algorithms if compression is requested with HOLOSCAN_UCX_COMPRESSION, so
+ * compression is only enabled if every worker requests it. Until the negotiation, every
+ * available algorithm can be used.
+ */
+class PayloadCompression {
+ public:
+  /// Default minimum size (in bytes) of the payloads that are compressed.
+  static constexpr uint64_t kDefaultMinSize = 64 * 1024;
+
+  /// @brief Whether the algorithm is supported by this build (kNone is always supported).
+  static bool is_available(CompressionAlgorithm algorithm);
+
+  /// @brief The names of the algorithms supported by this build (excluding "none").
+  static std::vector<std::string> available_algorithms();
+
+  /// @brief The name of the algorithm ("none", "lz4" or "zstd").
+  static const char* to_string(CompressionAlgorithm algorithm);
+
+  /**
+   * @brief Get the algorithm from its name.
+   *
+   * @param name The name of the algorithm ("none", "lz4" or "zstd", case-sensitive). An empty name
+   * is the same as "none".
+   * @return The algorithm, or an error with ErrorCode::kInvalidArgument for an unknown name.
+   */
+  static expected<CompressionAlgorithm, RuntimeError> from_string(const std::string& name);
+
+  /// @brief The maximum size of the compressed data for an input of `size` bytes.
+  static size_t max_compressed_size(CompressionAlgorithm algorithm, size_t size);
+
+  /**
+   * @brief Compress a buffer.
+   *
+   * @param algorithm The algorithm to use (must not be kNone).
+   * @param level The compression level (0 for the default level of the algorithm).
+   * @param src The data to compress.
+   * @param src_size The size of the data in bytes.
+   * @param dst The destination buffer.
+   * @param dst_capacity The size of the destination buffer (see `max_compressed_size()`).
+   * @return The size of the compressed data in bytes.
+   */
+  static expected<size_t, RuntimeError> compress(CompressionAlgorithm algorithm, int32_t level,
+                                                 const void* src, size_t src_size, void* dst,
+                                                 size_t dst_capacity);
+
+  /**
+   * @brief Decompress a buffer.
+   *
+   * @param algorithm The algorithm used to compress the data (must not be kNone).
+   * @param src The compressed data.
+   * @param src_size The size of the compressed data in bytes.
+   * @param dst The destination buffer.
+   * @param dst_size The size of the uncompressed data in bytes.
+   * @return The size of the uncompressed data in bytes (always `dst_size`).
+   */
+  static expected<size_t, RuntimeError> decompress(CompressionAlgorithm algorithm,
+                                                   const void* src, size_t src_size, void* dst,
+                                                   size_t dst_size);
+
+  /**
+   * @brief The algorithms offered by this process when the algorithms are negotiated.
+   *
+   * @return The available algorithms if HOLOSCAN_UCX_COMPRESSION names an algorithm, an empty
+   * list otherwise.
+   */
+  static std::vector<std::string> requested_algorithms();
+
+  /**
+   * @brief Set the algorithms supported by all the fragments of the application.
+   *
+   * Called by the app worker with the list negotiated by the app driver.
+   *
+   * @param names The names of the algorithms.
+   */
+  static void set_negotiated_algorithms(const std::vector<std::string>& names);
+
+  /// @brief Whether the algorithm can be used to send payloads to the other fragments.
+  static bool is_negotiated(CompressionAlgorithm algorithm);
+
+  /**
+   * @brief Whether payloads may be compressed between the fragments.
+   *
+   * False once an empty list of algorithms has been negotiated. The payloads are then sent
+   * without compression header.
+   */
+  static bool is_enabled();
+};
+
+}  // namespace holoscan
+
+#endif /* HOLOSCAN_CORE_PAYLOAD_COMPRESSION_HPP */
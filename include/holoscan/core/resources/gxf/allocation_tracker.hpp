@@ -0,0 +1,130 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_RESOURCES_GXF_ALLOCATION_TRACKER_HPP
+#define HOLOSCAN_CORE_RESOURCES_GXF_ALLOCATION_TRACKER_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace holoscan {
+
+/// Memory held by the allocations made by one operator.
+struct AllocationHolder {
+  std::string name;      ///< The name of the operator ("(unknown)" outside of native operators)
+  uint64_t buffers = 0;  ///< Number of buffers currently held
+  uint64_t bytes = 0;    ///< Number of bytes currently held
+};
+
+/// Statistics of an AllocationTracker.
+struct AllocationStats {
+  uint64_t allocations = 0;              ///< Number of successful allocations
+  uint64_t frees = 0;                    ///< Number of freed buffers
+  uint64_t failures = 0;                 ///< Number of failed allocations
+  uint64_t in_use_bytes = 0;             ///< Number of bytes currently allocated
+  uint64_t peak_bytes = 0;               ///< Maximum number of bytes allocated at the same time
+  double p99_allocate_latency_us = 0.0;  ///< 99th percentile of the recent allocation latencies
+  std::vector<AllocationHolder> holders;  ///< Current holders, by decreasing number of bytes
+};
+
+/**
+ * @brief Thread-safe record of the allocations made through an allocator.
+ *
+ * Each allocation is attributed to the operator running on the calling thread (see ScopedOwner),
+ * so that the memory currently held by each operator can be reported. The allocation latencies
+ * are kept for the last `kLatencyWindow` allocations.
+ *
+ * Used by holoscan::TrackingAllocator.
+ */
+class AllocationTracker {
+ public:
+  /// Number of recent allocation latencies used for the percentile.
+  static constexpr size_t kLatencyWindow = 4096;
+
+  /**
+   * @brief Helper class attributing the allocations made by the current thread to an operator,
+   * from its construction to its destruction.
+   */
+  class ScopedOwner {
+   public:
+    /// @param name The name of the operator. Must outlive the ScopedOwner object.
+    explicit ScopedOwner(const std::string& name);
+    ~ScopedOwner();
+
+    ScopedOwner(const ScopedOwner&) = delete;
+    ScopedOwner& operator=(const ScopedOwner&) = delete;
+
+   private:
+    const std::string* previous_owner_;
+  };
+
+  AllocationTracker() = default;
+
+  AllocationTracker(const AllocationTracker&) = delete;
+  AllocationTracker& operator=(const AllocationTracker&) = delete;
+
+  /// @brief Record a successful allocation.
+  void record_allocation(void* pointer, uint64_t size, std::chrono::nanoseconds latency);
+
+  /// @brief Record a failed allocation.
+  void record_failure(uint64_t size, std::chrono::nanoseconds latency);
+
+  /**
+   * @brief Record the release of a buffer.
+   *
+   * @return false if the buffer was not allocated through this tracker.
+   */
+  bool record_free(void* pointer);
+
+  AllocationStats stats() const;
+
+  /**
+   * @brief Format the statistics.
+   *
+   * @param name The name of the allocator.
+   * @return The statistics followed by one line per holder.
+   */
+  std::string report(const std::string& name) const;
+
+ private:
+  struct Allocation {
+    uint64_t size = 0;
+    const std::string* owner = nullptr;  ///< Interned in owners_ (nullptr if unknown)
+  };
+
+  void record_latency(std::chrono::nanoseconds latency);
+
+  mutable std::mutex mutex_;
+  std::unordered_map<void*, Allocation> allocations_;
+  std::unordered_set<std::string> owners_;
+  std::vector<int64_t> latencies_ns_;
+  size_t next_latency_index_ = 0;
+  uint64_t allocation_count_ = 0;
+  uint64_t free_count_ = 0;
+  uint64_t failure_count_ = 0;
+  uint64_t in_use_bytes_ = 0;
+  uint64_t peak_bytes_ = 0;
+};
+
+}  // namespace holoscan
+
+#endif /* HOLOSCAN_CORE_RESOURCES_GXF_ALLOCATION_TRACKER_HPP */
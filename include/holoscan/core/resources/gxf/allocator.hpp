@@ -19,19 +19,29 @@
 #define HOLOSCAN_CORE_RESOURCES_GXF_ALLOCATOR_HPP
 
 #include <string>
+#include <utility>
 
 #include <gxf/std/allocator.hpp>
 
 #include "../../gxf/gxf_resource.hpp"
+#include "./allocation_tracker.hpp"
 
 namespace holoscan {
 
+class TrackingAllocator;
+
 enum struct MemoryStorageType { kHost = 0, kDevice = 1, kSystem = 2 };
 
 /**
  * @brief Base class for all allocators.
  *
  * Allocators are used to allocate resources such as memory or CUDA threads.
+ *
+ * If the `HOLOSCAN_ALLOCATOR_STATS` environment variable is set to true, a
+ * holoscan::TrackingAllocator is added in front of each memory allocator when it is initialized.
+ * The operators then allocate through it (see gxf_handle_cid()), and the usage statistics (see
+ * allocation_stats()) are logged at DEBUG level when the graph is deinitialized. The allocations
+ * are attributed to the native operators making them.
  */
 class Allocator : public gxf::GXFResource {
  public:
@@ -41,12 +51,45 @@ class Allocator : public gxf::GXFResource {
 
   const char* gxf_typename() const override { return "nvidia::gxf::Allocator"; }
 
+  void initialize() override;
+
+  /**
+   * @brief Get the GXF component ID that the handle parameters of the operators refer to.
+   *
+   * @return The ID of the holoscan::TrackingAllocator wrapping this allocator if the allocations
+   * are tracked, gxf_cid() otherwise.
+   */
+  gxf_uid_t gxf_handle_cid() const override;
+
   virtual bool is_available(uint64_t size);
 
   // TODO(gbae): Introduce expected<> type
   virtual nvidia::byte* allocate(uint64_t size, MemoryStorageType type);
 
   virtual void free(nvidia::byte* pointer);
+
+  /**
+   * @brief Get the usage statistics of the allocator.
+   *
+   * @return The statistics, or empty statistics if the allocations are not tracked (see the
+   * `HOLOSCAN_ALLOCATOR_STATS` environment variable).
+   */
+  AllocationStats allocation_stats() const;
+
+ protected:
+  /// Get the statistics of the GXF component of the allocator (empty if not initialized).
+  template <typename ComponentT, typename StatsT = decltype(std::declval<ComponentT&>().stats())>
+  StatsT gxf_component_stats() const {
+    if (gxf_cptr_) { return static_cast<ComponentT*>(gxf_cptr_)->stats(); }
+    return StatsT{};
+  }
+
+ private:
+  /// The allocator used by allocate(), free() and is_available().
+  nvidia::gxf::Allocator* gxf_allocator() const;
+
+  TrackingAllocator* tracking_allocator_ = nullptr;
+  gxf_uid_t tracking_cid_ = 0;  ///< The component ID of the tracking allocator (0 if none).
 };
 
 }  // namespace holoscan
@@ -0,0 +1,84 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_RESOURCES_GXF_BACKPRESSURE_ALLOCATOR_HPP
+#define HOLOSCAN_CORE_RESOURCES_GXF_BACKPRESSURE_ALLOCATOR_HPP
+
+#include <memory>
+
+#include <gxf/std/allocator.hpp>
+#include <gxf/std/parameter_parser_std.hpp>
+#include <gxf/std/scheduling_term.hpp>
+
+#include "./memory_waiter.hpp"
+
+namespace holoscan {
+
+/**
+ * @brief GXF allocator waiting for another allocator to have free memory.
+ *
+ * Allocations failing in the wrapped allocator (e.g., an exhausted BlockMemoryPool) are retried
+ * by a MemoryWaiter until a buffer is freed through this allocator or `timeout_ms` expires,
+ * instead of failing immediately.
+ */
+class BackpressureAllocator : public nvidia::gxf::Allocator {
+ public:
+  BackpressureAllocator() = default;
+
+  gxf_result_t registerInterface(nvidia::gxf::Registrar* registrar) override;
+  gxf_result_t initialize() override;
+  gxf_result_t deinitialize() override;
+
+  gxf_result_t is_available_abi(uint64_t size) override;
+  gxf_result_t allocate_abi(uint64_t size, int32_t type, void** pointer) override;
+  gxf_result_t free_abi(void* pointer) override;
+
+  /// @brief The waiting statistics.
+  MemoryWaiterStats stats() const;
+
+  nvidia::gxf::Parameter<nvidia::gxf::Handle<nvidia::gxf::Allocator>> allocator_;
+  nvidia::gxf::Parameter<uint64_t> timeout_ms_;
+
+ private:
+  std::unique_ptr<MemoryWaiter> waiter_;
+};
+
+/**
+ * @brief GXF scheduling term permitting execution only while an allocator can provide a buffer.
+ *
+ * Keeps a producer from being ticked while the allocator it draws its buffers from is exhausted,
+ * so that it does not have to fail (or block in a BackpressureAllocator) inside `compute()`.
+ *
+ * A buffer freed by another entity does not trigger the scheduler, so while the allocator is
+ * exhausted the term waits for `poll_period_ns` (WAIT_TIME) and the scheduler checks it again.
+ */
+class MemoryAvailableSchedulingTerm : public nvidia::gxf::SchedulingTerm {
+ public:
+  gxf_result_t registerInterface(nvidia::gxf::Registrar* registrar) override;
+  gxf_result_t check_abi(int64_t timestamp, nvidia::gxf::SchedulingConditionType* type,
+                         int64_t* target_timestamp) const override;
+  gxf_result_t onExecute_abi(int64_t dt) override;
+
+ private:
+  nvidia::gxf::Parameter<nvidia::gxf::Handle<nvidia::gxf::Allocator>> allocator_;
+  nvidia::gxf::Parameter<uint64_t> min_bytes_;
+  nvidia::gxf::Parameter<int64_t> poll_period_ns_;
+};
+
+}  // namespace holoscan
+
+#endif /* HOLOSCAN_CORE_RESOURCES_GXF_BACKPRESSURE_ALLOCATOR_HPP */
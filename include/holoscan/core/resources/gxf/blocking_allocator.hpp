@@ -0,0 +1,65 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_RESOURCES_GXF_BLOCKING_ALLOCATOR_HPP
+#define HOLOSCAN_CORE_RESOURCES_GXF_BLOCKING_ALLOCATOR_HPP
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "./allocator.hpp"
+#include "./memory_waiter.hpp"
+
+namespace holoscan {
+
+// Forward declarations
+class BackpressureAllocator;
+
+/**
+ * @brief Blocking allocator.
+ *
+ * Allocator forwarding the requests to another allocator (e.g., a BlockMemoryPool) and, when it is
+ * exhausted, waiting up to `timeout_ms` milliseconds for a buffer to be freed instead of failing
+ * immediately. Transient load spikes then slow the producing operator down (backpressure) instead
+ * of making it fail. The buffers must be freed through this allocator, which is the case for the
+ * tensors allocated through it.
+ *
+ * To keep a producer from being scheduled at all while the pool is exhausted, use a
+ * MemoryAvailableCondition on the same allocator.
+ */
+class BlockingAllocator : public Allocator {
+ public:
+  HOLOSCAN_RESOURCE_FORWARD_ARGS_SUPER(BlockingAllocator, Allocator)
+  BlockingAllocator() = default;
+  BlockingAllocator(const std::string& name, BackpressureAllocator* component);
+
+  const char* gxf_typename() const override { return "holoscan::BackpressureAllocator"; }
+
+  void setup(ComponentSpec& spec) override;
+
+  /// @brief The waiting statistics (all zeros if the allocator is not initialized).
+  MemoryWaiterStats stats() const;
+
+ private:
+  Parameter<std::shared_ptr<Allocator>> allocator_;
+  Parameter<uint64_t> timeout_ms_;
+};
+
+}  // namespace holoscan
+
+#endif /* HOLOSCAN_CORE_RESOURCES_GXF_BLOCKING_ALLOCATOR_HPP */
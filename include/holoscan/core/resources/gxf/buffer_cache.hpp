@@ -0,0 +1,115 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_RESOURCES_GXF_BUFFER_CACHE_HPP
+#define HOLOSCAN_CORE_RESOURCES_GXF_BUFFER_CACHE_HPP
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace holoscan {
+
+/// Statistics of a BufferCache.
+struct BufferCacheStats {
+  uint64_t hits = 0;            ///< Number of allocations served from the cache
+  uint64_t misses = 0;          ///< Number of allocations forwarded to the underlying allocator
+  uint64_t recycled = 0;        ///< Number of freed buffers kept in the cache
+  uint64_t evicted = 0;         ///< Number of freed buffers released because the cache was full
+  uint64_t cached_buffers = 0;  ///< Number of buffers currently in the cache
+  uint64_t cached_bytes = 0;    ///< Number of bytes currently in the cache
+  uint64_t in_use_buffers = 0;  ///< Number of buffers currently handed out
+};
+
+/**
+ * @brief Thread-safe cache of released memory buffers, keyed by size and storage type.
+ *
+ * The cache doesn't allocate or free memory itself: `acquire()` returns a cached buffer (or
+ * nullptr, in which case the caller allocates one and registers it with `track()`), and `release()`
+ * tells the caller whether the buffer was kept or must be freed.
+ *
+ * Used by holoscan::BufferRecyclingAllocator.
+ */
+class BufferCache {
+ public:
+  /// Outcome of `release()`.
+  enum class ReleaseResult {
+    kCached,   ///< The buffer is kept in the cache.
+    kEvict,    ///< The cache is full: the caller must free the buffer.
+    kUnknown,  ///< The buffer was not handed out by this cache.
+  };
+
+  /**
+   * @brief Construct a new buffer cache.
+   *
+   * @param max_buffers_per_size The maximum number of cached buffers of a given size and type.
+   * @param max_cached_bytes The maximum number of bytes kept in the cache.
+   */
+  BufferCache(uint64_t max_buffers_per_size, uint64_t max_cached_bytes);
+
+  BufferCache(const BufferCache&) = delete;
+  BufferCache& operator=(const BufferCache&) = delete;
+
+  /**
+   * @brief Take a cached buffer of the given size and storage type.
+   *
+   * @return The buffer, or nullptr if there is none (the caller must then allocate one and call
+   * `track()`).
+   */
+  void* acquire(uint64_t size, int32_t storage_type);
+
+  /// @brief Register a buffer newly allocated by the caller as handed out.
+  void track(void* pointer, uint64_t size, int32_t storage_type);
+
+  /// @brief Return a handed out buffer to the cache.
+  ReleaseResult release(void* pointer);
+
+  /**
+   * @brief Remove the cached buffers of the given size (of any storage type).
+   *
+   * @return The removed buffers, which the caller must free.
+   */
+  std::vector<void*> evict(uint64_t size);
+
+  /**
+   * @brief Remove all cached buffers and stop caching: buffers released afterwards are evicted.
+   *
+   * @return The removed buffers, which the caller must free.
+   */
+  std::vector<void*> close();
+
+  BufferCacheStats stats() const;
+
+ private:
+  using Key = std::pair<uint64_t, int32_t>;  // (size, storage type)
+
+  const uint64_t max_buffers_per_size_;
+  const uint64_t max_cached_bytes_;
+
+  mutable std::mutex mutex_;
+  std::map<Key, std::vector<void*>> cached_;
+  std::unordered_map<void*, Key> in_use_;
+  BufferCacheStats stats_;
+  bool closed_ = false;
+};
+
+}  // namespace holoscan
+
+#endif /* HOLOSCAN_CORE_RESOURCES_GXF_BUFFER_CACHE_HPP */
@@ -0,0 +1,63 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_RESOURCES_GXF_BUFFER_RECYCLING_ALLOCATOR_HPP
+#define HOLOSCAN_CORE_RESOURCES_GXF_BUFFER_RECYCLING_ALLOCATOR_HPP
+
+#include <memory>
+
+#include <gxf/std/allocator.hpp>
+#include <gxf/std/parameter_parser_std.hpp>
+
+#include "./buffer_cache.hpp"
+
+namespace holoscan {
+
+/**
+ * @brief GXF allocator recycling the buffers of another allocator.
+ *
+ * Freed buffers are kept in a BufferCache and handed back by later allocations of the same size
+ * and storage type instead of being returned to the underlying allocator. This removes the
+ * allocation churn of streams of identically shaped tensors (e.g., the tensors deserialized by the
+ * UCX serializer for a video stream).
+ */
+class BufferRecyclingAllocator : public nvidia::gxf::Allocator {
+ public:
+  BufferRecyclingAllocator() = default;
+
+  gxf_result_t registerInterface(nvidia::gxf::Registrar* registrar) override;
+  gxf_result_t initialize() override;
+  gxf_result_t deinitialize() override;
+
+  gxf_result_t is_available_abi(uint64_t size) override;
+  gxf_result_t allocate_abi(uint64_t size, int32_t type, void** pointer) override;
+  gxf_result_t free_abi(void* pointer) override;
+
+  /// @brief The statistics of the buffer cache.
+  BufferCacheStats stats() const;
+
+  nvidia::gxf::Parameter<nvidia::gxf::Handle<nvidia::gxf::Allocator>> allocator_;
+  nvidia::gxf::Parameter<uint64_t> max_buffers_per_size_;
+  nvidia::gxf::Parameter<uint64_t> max_cached_bytes_;
+
+ private:
+  std::unique_ptr<BufferCache> cache_;
+};
+
+}  // namespace holoscan
+
+#endif /* HOLOSCAN_CORE_RESOURCES_GXF_BUFFER_RECYCLING_ALLOCATOR_HPP */
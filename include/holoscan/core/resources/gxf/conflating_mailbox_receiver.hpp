@@ -0,0 +1,97 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_RESOURCES_GXF_CONFLATING_MAILBOX_RECEIVER_HPP
+#define HOLOSCAN_CORE_RESOURCES_GXF_CONFLATING_MAILBOX_RECEIVER_HPP
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gxf/std/parameter_parser_std.hpp>
+#include <gxf/std/receiver.hpp>
+
+namespace holoscan {
+
+/**
+ * @brief GXF receiver keeping only the most recent message.
+ *
+ * A new message replaces the one stored in the mailbox, which is dropped, so that the consumer
+ * always gets the latest value and the producer is never blocked. The receiver reports one free
+ * slot at all times, so a DownstreamReceptiveSchedulingTerm on the upstream transmitter is always
+ * satisfied.
+ *
+ * By default the mailbox holds a single message. If 'key_by_tensor_name' is true, the latest
+ * message is kept per tensor name (the name of the first tensor of the message) and messages are
+ * received in the order their key was last updated.
+ *
+ * A message returned by peek_abi() may be replaced by a concurrent push_abi(), so the receiver
+ * holds a reference on it until the next sync_abi() (i.e., until the consumer's next tick).
+ */
+class ConflatingMailboxReceiver : public nvidia::gxf::Receiver {
+ public:
+  ConflatingMailboxReceiver() = default;
+
+  gxf_result_t registerInterface(nvidia::gxf::Registrar* registrar) override;
+  gxf_result_t deinitialize() override;
+
+  gxf_result_t pop_abi(gxf_uid_t* uid) override;
+  gxf_result_t push_abi(gxf_uid_t other) override;
+  gxf_result_t peek_abi(gxf_uid_t* uid, int32_t index) override;
+  gxf_result_t peek_back_abi(gxf_uid_t* uid, int32_t index) override;
+  size_t capacity_abi() override;
+  size_t size_abi() override;
+
+  gxf_result_t receive_abi(gxf_uid_t* uid) override;
+  size_t back_size_abi() override;
+  gxf_result_t sync_abi() override;
+
+  /// @brief The number of messages replaced before being received.
+  uint64_t dropped_count() const { return dropped_count_.load(std::memory_order_relaxed); }
+
+  nvidia::gxf::Parameter<bool> key_by_tensor_name_;
+
+ private:
+  /// Return the key of the message (name of its first tensor, or an empty string).
+  std::string message_key(gxf_uid_t uid);
+  /// Release the reference held on a dropped message.
+  void drop(gxf_uid_t uid);
+  /// Keep a reference on a peeked message until the next sync_abi().
+  gxf_result_t hold_peeked(gxf_uid_t uid);
+  /// Release the references held on the peeked messages.
+  void release_peeked();
+
+  /// Latest message when not keyed by tensor name (read without the lock by size_abi()).
+  std::mutex latest_mutex_;
+  std::atomic<gxf_uid_t> latest_{kNullUid};
+
+  /// Latest message per key, ordered by update time, when keyed by tensor name.
+  std::mutex keyed_mutex_;
+  std::vector<std::pair<std::string, gxf_uid_t>> keyed_latest_;
+
+  /// Messages returned by peek_abi() since the last sync_abi().
+  std::mutex peeked_mutex_;
+  std::vector<gxf_uid_t> peeked_;
+
+  std::atomic<uint64_t> dropped_count_{0};
+};
+
+}  // namespace holoscan
+
+#endif /* HOLOSCAN_CORE_RESOURCES_GXF_CONFLATING_MAILBOX_RECEIVER_HPP */
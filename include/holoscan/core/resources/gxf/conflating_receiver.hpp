@@ -0,0 +1,57 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_RESOURCES_GXF_CONFLATING_RECEIVER_HPP
+#define HOLOSCAN_CORE_RESOURCES_GXF_CONFLATING_RECEIVER_HPP
+
+#include <cstdint>
+#include <string>
+
+#include "./receiver.hpp"
+
+namespace holoscan {
+
+// Forward declarations
+class ConflatingMailboxReceiver;
+
+/**
+ * @brief Conflating receiver class.
+ *
+ * The ConflatingReceiver class keeps only the most recent message sent by the upstream operator
+ * (optionally one per tensor name). Older messages that were not received yet are dropped and the
+ * upstream operator is never blocked, which suits display and UI branches that only care about the
+ * newest frame.
+ */
+class ConflatingReceiver : public Receiver {
+ public:
+  HOLOSCAN_RESOURCE_FORWARD_ARGS_SUPER(ConflatingReceiver, Receiver)
+  ConflatingReceiver() = default;
+  ConflatingReceiver(const std::string& name, ConflatingMailboxReceiver* component);
+
+  const char* gxf_typename() const override { return "holoscan::ConflatingMailboxReceiver"; }
+
+  void setup(ComponentSpec& spec) override;
+
+  /// @brief The number of messages replaced before being received (0 if not initialized).
+  uint64_t dropped_count();
+
+  Parameter<bool> key_by_tensor_name_;
+};
+
+}  // namespace holoscan
+
+#endif /* HOLOSCAN_CORE_RESOURCES_GXF_CONFLATING_RECEIVER_HPP */
@@ -48,6 +48,8 @@ class CudaStreamPool : public Allocator {
 
   void setup(ComponentSpec& spec) override;
 
+  void initialize() override;
+
  private:
   Parameter<int32_t> dev_id_;
   Parameter<uint32_t> stream_flags_;
@@ -0,0 +1,95 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_RESOURCES_GXF_FAN_OUT_TRANSMITTER_HPP
+#define HOLOSCAN_CORE_RESOURCES_GXF_FAN_OUT_TRANSMITTER_HPP
+
+#include <vector>
+
+#include <gxf/std/parameter_parser_std.hpp>
+#include <gxf/std/receiver.hpp>
+#include <gxf/std/scheduling_term.hpp>
+#include <gxf/std/transmitter.hpp>
+
+namespace holoscan {
+
+/**
+ * @brief GXF transmitter publishing each message directly to several receivers.
+ *
+ * The transmitter has no queue of its own: `publish_abi()` pushes a reference to the published
+ * entity into every subscribed receiver, so that an output port connected to multiple input ports
+ * does not need an intermediate Broadcast entity. Receivers are subscribed with `add_receiver()`
+ * while the graph is being composed and are not connected through GXF Connection components.
+ *
+ * When a receiver is full, the 'policy' parameter decides what happens to the message: with 'pop'
+ * the message is pushed anyway (each receiver applies its own policy), with 'reject' the message is
+ * dropped for all receivers and with 'fault' an error is returned.
+ *
+ * Back pressure is provided by holoscan::FanOutReceptiveSchedulingTerm.
+ */
+class FanOutTransmitter : public nvidia::gxf::Transmitter {
+ public:
+  FanOutTransmitter() = default;
+
+  gxf_result_t registerInterface(nvidia::gxf::Registrar* registrar) override;
+  gxf_result_t initialize() override;
+
+  gxf_result_t pop_abi(gxf_uid_t* uid) override;
+  gxf_result_t push_abi(gxf_uid_t other) override;
+  gxf_result_t peek_abi(gxf_uid_t* uid, int32_t index) override;
+  size_t capacity_abi() override;
+  size_t size_abi() override;
+
+  gxf_result_t publish_abi(gxf_uid_t uid) override;
+  size_t back_size_abi() override;
+  gxf_result_t sync_abi() override;
+
+  /// @brief Subscribe a receiver. Must be called before the graph is activated.
+  void add_receiver(nvidia::gxf::Receiver* receiver);
+
+  /// @brief The subscribed receivers.
+  const std::vector<nvidia::gxf::Receiver*>& receivers() const { return receivers_; }
+
+  /// @brief Whether every subscribed receiver can accept at least `min_size` more messages.
+  bool is_receptive(size_t min_size) const;
+
+  nvidia::gxf::Parameter<uint64_t> policy_;
+
+ private:
+  std::vector<nvidia::gxf::Receiver*> receivers_;
+};
+
+/**
+ * @brief Scheduling term waiting until all receivers of a FanOutTransmitter have free space.
+ *
+ * Counterpart of nvidia::gxf::DownstreamReceptiveSchedulingTerm for holoscan::FanOutTransmitter.
+ */
+class FanOutReceptiveSchedulingTerm : public nvidia::gxf::SchedulingTerm {
+ public:
+  gxf_result_t registerInterface(nvidia::gxf::Registrar* registrar) override;
+  gxf_result_t check_abi(int64_t timestamp, nvidia::gxf::SchedulingConditionType* type,
+                         int64_t* target_timestamp) const override;
+  gxf_result_t onExecute_abi(int64_t dt) override;
+
+ private:
+  nvidia::gxf::Parameter<nvidia::gxf::Handle<FanOutTransmitter>> transmitter_;
+  nvidia::gxf::Parameter<uint64_t> min_size_;
+};
+
+}  // namespace holoscan
+
+#endif /* HOLOSCAN_CORE_RESOURCES_GXF_FAN_OUT_TRANSMITTER_HPP */
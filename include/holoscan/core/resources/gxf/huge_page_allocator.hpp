@@ -0,0 +1,66 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_RESOURCES_GXF_HUGE_PAGE_ALLOCATOR_HPP
+#define HOLOSCAN_CORE_RESOURCES_GXF_HUGE_PAGE_ALLOCATOR_HPP
+
+#include <memory>
+
+#include <gxf/std/allocator.hpp>
+#include <gxf/std/parameter_parser_std.hpp>
+
+#include "./huge_page_pool.hpp"
+
+namespace holoscan {
+
+/**
+ * @brief GXF allocator serving fixed-size host blocks from a region reserved up front.
+ *
+ * The blocks are served by a HugePagePool: the region is backed by huge pages when possible,
+ * pre-faulted on initialization and optionally locked in memory, so that steady-state allocations
+ * never page-fault. With the kHost storage type, the region is also registered with CUDA
+ * (`cudaHostRegister`) so that it can be used for asynchronous copies.
+ */
+class HugePageAllocator : public nvidia::gxf::Allocator {
+ public:
+  HugePageAllocator() = default;
+
+  gxf_result_t registerInterface(nvidia::gxf::Registrar* registrar) override;
+  gxf_result_t initialize() override;
+  gxf_result_t deinitialize() override;
+
+  gxf_result_t is_available_abi(uint64_t size) override;
+  gxf_result_t allocate_abi(uint64_t size, int32_t type, void** pointer) override;
+  gxf_result_t free_abi(void* pointer) override;
+
+  /// @brief The statistics of the pool.
+  HugePagePoolStats stats() const;
+
+  nvidia::gxf::Parameter<int32_t> storage_type_;
+  nvidia::gxf::Parameter<uint64_t> block_size_;
+  nvidia::gxf::Parameter<uint64_t> num_blocks_;
+  nvidia::gxf::Parameter<bool> huge_pages_;
+  nvidia::gxf::Parameter<bool> lock_memory_;
+
+ private:
+  std::unique_ptr<HugePagePool> pool_;
+  bool is_registered_ = false;
+};
+
+}  // namespace holoscan
+
+#endif /* HOLOSCAN_CORE_RESOURCES_GXF_HUGE_PAGE_ALLOCATOR_HPP */
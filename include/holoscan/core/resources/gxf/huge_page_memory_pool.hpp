@@ -0,0 +1,66 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_RESOURCES_GXF_HUGE_PAGE_MEMORY_POOL_HPP
+#define HOLOSCAN_CORE_RESOURCES_GXF_HUGE_PAGE_MEMORY_POOL_HPP
+
+#include <cstdint>
+#include <string>
+
+#include "./allocator.hpp"
+#include "./huge_page_pool.hpp"
+
+namespace holoscan {
+
+// Forward declarations
+class HugePageAllocator;
+
+/**
+ * @brief Huge-page memory pool allocator.
+ *
+ * Host memory pool providing `num_blocks` blocks of `block_size` bytes, like BlockMemoryPool, but
+ * reserved up front in a single region. The region is backed by huge pages when `huge_pages` is
+ * true (explicit huge pages, then transparent huge pages, falling back to regular pages), every
+ * page is touched on initialization, and the region is locked in memory when `lock_memory` is
+ * true. Large frames handed out by the pool therefore never page-fault and need fewer TLB entries.
+ *
+ * Only the kHost (pinned, registered with CUDA) and kSystem storage types are supported.
+ */
+class HugePageMemoryPool : public Allocator {
+ public:
+  HOLOSCAN_RESOURCE_FORWARD_ARGS_SUPER(HugePageMemoryPool, Allocator)
+  HugePageMemoryPool() = default;
+  HugePageMemoryPool(const std::string& name, HugePageAllocator* component);
+
+  const char* gxf_typename() const override { return "holoscan::HugePageAllocator"; }
+
+  void setup(ComponentSpec& spec) override;
+
+  /// @brief The pool statistics (all zeros if the allocator is not initialized).
+  HugePagePoolStats stats() const;
+
+ private:
+  Parameter<int32_t> storage_type_;
+  Parameter<uint64_t> block_size_;
+  Parameter<uint64_t> num_blocks_;
+  Parameter<bool> huge_pages_;
+  Parameter<bool> lock_memory_;
+};
+
+}  // namespace holoscan
+
+#endif /* HOLOSCAN_CORE_RESOURCES_GXF_HUGE_PAGE_MEMORY_POOL_HPP */
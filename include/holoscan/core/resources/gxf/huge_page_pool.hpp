@@ -0,0 +1,131 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_RESOURCES_GXF_HUGE_PAGE_POOL_HPP
+#define HOLOSCAN_CORE_RESOURCES_GXF_HUGE_PAGE_POOL_HPP
+
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace holoscan {
+
+/// Statistics of a HugePagePool.
+struct HugePagePoolStats {
+  uint64_t allocations = 0;         ///< Number of blocks handed out
+  uint64_t failed_allocations = 0;  ///< Number of requests that couldn't be fulfilled
+  uint64_t in_use_blocks = 0;       ///< Number of blocks currently handed out
+  uint64_t reserved_bytes = 0;      ///< Size of the memory region
+  uint64_t page_size = 0;           ///< Size of the pages backing the region
+};
+
+/**
+ * @brief Thread-safe pool of equally sized host memory blocks carved out of a single region
+ * reserved up front.
+ *
+ * The region is mapped with `mmap`. If huge pages are requested, explicit huge pages
+ * (`MAP_HUGETLB`) are tried first, then transparent huge pages (`madvise(MADV_HUGEPAGE)`), and
+ * regular pages are used if neither is available. Every page of the region is touched on
+ * construction so that handing out a block never page-faults, and the region can optionally be
+ * locked in memory (`mlock`) so that it is never swapped out.
+ *
+ * Used by holoscan::HugePageAllocator.
+ */
+class HugePagePool {
+ public:
+  /// Kind of pages backing the region.
+  enum class Backing {
+    kNone,                  ///< The region couldn't be mapped
+    kHugeTLB,               ///< Explicit huge pages (`MAP_HUGETLB`)
+    kTransparentHugePages,  ///< Regular mapping advised to use transparent huge pages
+    kRegularPages,          ///< Regular pages
+  };
+
+  /// Alignment of the blocks: the block size is rounded up to a multiple of it.
+  static constexpr uint64_t kBlockAlignment = 256;
+
+  /**
+   * @brief Construct a new pool and reserve its memory.
+   *
+   * @param block_size The size of the blocks (rounded up to kBlockAlignment).
+   * @param num_blocks The number of blocks.
+   * @param use_huge_pages Whether to back the region with huge pages if possible.
+   * @param lock_memory Whether to lock the region in memory.
+   */
+  HugePagePool(uint64_t block_size, uint64_t num_blocks, bool use_huge_pages, bool lock_memory);
+  ~HugePagePool();
+
+  HugePagePool(const HugePagePool&) = delete;
+  HugePagePool& operator=(const HugePagePool&) = delete;
+
+  /// @brief The size of the default explicit huge pages (from /proc/meminfo, 2 MiB by default).
+  static uint64_t default_huge_page_size();
+
+  /// @brief The kind of pages backing the region.
+  Backing backing() const { return backing_; }
+
+  /// @brief Whether the region is locked in memory.
+  bool is_locked() const { return is_locked_; }
+
+  /// @brief The start of the region (nullptr if it couldn't be mapped).
+  void* data() const { return region_; }
+
+  /// @brief The size of the region in bytes.
+  uint64_t size() const { return region_size_; }
+
+  /// @brief The (rounded up) size of the blocks.
+  uint64_t block_size() const { return block_size_; }
+
+  /**
+   * @brief Get a block.
+   *
+   * @param size The requested size.
+   * @return A block, or nullptr if `size` is larger than the block size or all the blocks are in
+   * use.
+   */
+  void* allocate(uint64_t size);
+
+  /**
+   * @brief Return a block to the pool.
+   *
+   * @return false if the pointer isn't a block handed out by the pool.
+   */
+  bool free(void* pointer);
+
+  /// @brief Whether a request of the given size can be served.
+  bool is_available(uint64_t size) const;
+
+  HugePagePoolStats stats() const;
+
+ private:
+  void* region_ = nullptr;
+  uint64_t region_size_ = 0;
+  uint64_t page_size_ = 0;
+  uint64_t block_size_ = 0;
+  Backing backing_ = Backing::kNone;
+  bool is_locked_ = false;
+
+  mutable std::mutex mutex_;
+  std::vector<uint64_t> free_blocks_;  ///< Indices of the free blocks (used as a stack)
+  std::vector<bool> in_use_;
+  uint64_t allocations_ = 0;
+  uint64_t failed_allocations_ = 0;
+};
+
+}  // namespace holoscan
+
+#endif /* HOLOSCAN_CORE_RESOURCES_GXF_HUGE_PAGE_POOL_HPP */
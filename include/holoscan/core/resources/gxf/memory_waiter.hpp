@@ -0,0 +1,90 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_RESOURCES_GXF_MEMORY_WAITER_HPP
+#define HOLOSCAN_CORE_RESOURCES_GXF_MEMORY_WAITER_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+
+namespace holoscan {
+
+/// Statistics of a MemoryWaiter.
+struct MemoryWaiterStats {
+  uint64_t allocations = 0;    ///< Number of successful allocations
+  uint64_t waits = 0;          ///< Number of allocations that had to wait for a free
+  uint64_t timeouts = 0;       ///< Number of failed allocations (after waiting up to the timeout)
+  uint64_t errors = 0;         ///< Number of failed allocations that waiting can't help
+  double max_wait_ms = 0.0;    ///< Longest wait of an allocation
+  double total_wait_ms = 0.0;  ///< Total time spent waiting
+};
+
+/**
+ * @brief Thread-safe helper retrying failed allocations until memory is freed or a timeout
+ * expires.
+ *
+ * When an allocation fails, the caller is blocked until another thread frees memory (see
+ * notify_free()) and the allocation is retried. The allocation is also retried every
+ * `kPollInterval` in case memory is released without notification.
+ *
+ * Used by holoscan::BackpressureAllocator.
+ */
+class MemoryWaiter {
+ public:
+  /**
+   * Function trying to allocate memory. Sets `pointer` to nullptr on failure and returns false if
+   * waiting can't help (e.g., invalid request).
+   */
+  using TryAllocateFunction = std::function<bool(void** pointer)>;
+
+  /// Maximum time between two attempts while waiting.
+  static constexpr std::chrono::milliseconds kPollInterval{1};
+
+  /// @param timeout The maximum waiting time of an allocation (0 to never wait).
+  explicit MemoryWaiter(std::chrono::nanoseconds timeout) : timeout_(timeout) {}
+
+  MemoryWaiter(const MemoryWaiter&) = delete;
+  MemoryWaiter& operator=(const MemoryWaiter&) = delete;
+
+  /**
+   * @brief Allocate memory, waiting for memory to be freed if needed.
+   *
+   * @param try_allocate The function trying to allocate the memory.
+   * @return The allocation, or nullptr if the timeout expired or the request is invalid.
+   */
+  void* allocate(const TryAllocateFunction& try_allocate);
+
+  /// @brief Wake up the waiting allocations after memory was freed.
+  void notify_free();
+
+  MemoryWaiterStats stats() const;
+
+ private:
+  const std::chrono::nanoseconds timeout_;
+
+  mutable std::mutex mutex_;
+  std::condition_variable freed_;
+  uint64_t free_count_ = 0;
+  MemoryWaiterStats stats_;
+};
+
+}  // namespace holoscan
+
+#endif /* HOLOSCAN_CORE_RESOURCES_GXF_MEMORY_WAITER_HPP */
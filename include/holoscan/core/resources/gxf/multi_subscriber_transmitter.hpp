@@ -0,0 +1,53 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_RESOURCES_GXF_MULTI_SUBSCRIBER_TRANSMITTER_HPP
+#define HOLOSCAN_CORE_RESOURCES_GXF_MULTI_SUBSCRIBER_TRANSMITTER_HPP
+
+#include <string>
+
+#include "./transmitter.hpp"
+
+namespace holoscan {
+
+// Forward declarations
+class FanOutTransmitter;
+
+/**
+ * @brief Multi-subscriber transmitter class.
+ *
+ * The MultiSubscriberTransmitter class publishes each message directly to all the input ports
+ * connected to an output port, sharing the same entity reference instead of going through an
+ * intermediate Broadcast entity. It is selected by the executor for output ports connected to
+ * several input ports of the same fragment.
+ */
+class MultiSubscriberTransmitter : public Transmitter {
+ public:
+  HOLOSCAN_RESOURCE_FORWARD_ARGS_SUPER(MultiSubscriberTransmitter, Transmitter)
+  MultiSubscriberTransmitter() = default;
+  MultiSubscriberTransmitter(const std::string& name, FanOutTransmitter* component);
+
+  const char* gxf_typename() const override { return "holoscan::FanOutTransmitter"; }
+
+  void setup(ComponentSpec& spec) override;
+
+  Parameter<uint64_t> policy_;
+};
+
+}  // namespace holoscan
+
+#endif /* HOLOSCAN_CORE_RESOURCES_GXF_MULTI_SUBSCRIBER_TRANSMITTER_HPP */
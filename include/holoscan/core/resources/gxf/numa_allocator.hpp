@@ -0,0 +1,64 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_RESOURCES_GXF_NUMA_ALLOCATOR_HPP
+#define HOLOSCAN_CORE_RESOURCES_GXF_NUMA_ALLOCATOR_HPP
+
+#include <cstdint>
+#include <string>
+
+#include "./allocator.hpp"
+#include "./numa_host_memory.hpp"
+
+namespace holoscan {
+
+// Forward declarations
+class NumaBindingAllocator;
+
+/**
+ * @brief NUMA-aware host memory allocator.
+ *
+ * Host memory allocator binding each allocation to a NUMA node, using the system topology (see
+ * holoscan::Topology). If `numa_node` is -1 (the default), the memory is bound to the node of the
+ * CPU the allocating thread is running on, so that an operator pinned to a socket writes to local
+ * memory. Otherwise, all the allocations are bound to the given node (e.g., the node of the
+ * consuming operator or of the NIC/GPU).
+ *
+ * The locality of the allocations and frees is reported by stats(). Only the kHost (registered
+ * with CUDA on each allocation) and kSystem storage types are supported.
+ */
+class NumaAllocator : public Allocator {
+ public:
+  HOLOSCAN_RESOURCE_FORWARD_ARGS_SUPER(NumaAllocator, Allocator)
+  NumaAllocator() = default;
+  NumaAllocator(const std::string& name, NumaBindingAllocator* component);
+
+  const char* gxf_typename() const override { return "holoscan::NumaBindingAllocator"; }
+
+  void setup(ComponentSpec& spec) override;
+
+  /// @brief The locality statistics (all zeros if the allocator is not initialized).
+  NumaHostMemoryStats stats() const;
+
+ private:
+  Parameter<int32_t> storage_type_;
+  Parameter<int32_t> numa_node_;
+};
+
+}  // namespace holoscan
+
+#endif /* HOLOSCAN_CORE_RESOURCES_GXF_NUMA_ALLOCATOR_HPP */
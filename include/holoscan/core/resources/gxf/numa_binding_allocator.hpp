@@ -0,0 +1,62 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_RESOURCES_GXF_NUMA_BINDING_ALLOCATOR_HPP
+#define HOLOSCAN_CORE_RESOURCES_GXF_NUMA_BINDING_ALLOCATOR_HPP
+
+#include <memory>
+
+#include <gxf/std/allocator.hpp>
+#include <gxf/std/parameter_parser_std.hpp>
+
+#include "./numa_host_memory.hpp"
+
+namespace holoscan {
+
+/**
+ * @brief GXF allocator binding host memory to a NUMA node.
+ *
+ * The allocations are made by a NumaHostMemory, on the configured `numa_node` or, if it is -1,
+ * on the node of the calling thread. With the kHost storage type, each allocation is also
+ * registered with CUDA (`cudaHostRegister`), which is costly: combine it with a
+ * RecyclingAllocator for streams of buffers.
+ */
+class NumaBindingAllocator : public nvidia::gxf::Allocator {
+ public:
+  NumaBindingAllocator() = default;
+
+  gxf_result_t registerInterface(nvidia::gxf::Registrar* registrar) override;
+  gxf_result_t initialize() override;
+  gxf_result_t deinitialize() override;
+
+  gxf_result_t is_available_abi(uint64_t size) override;
+  gxf_result_t allocate_abi(uint64_t size, int32_t type, void** pointer) override;
+  gxf_result_t free_abi(void* pointer) override;
+
+  /// @brief The locality statistics of the allocations.
+  NumaHostMemoryStats stats() const;
+
+  nvidia::gxf::Parameter<int32_t> storage_type_;
+  nvidia::gxf::Parameter<int32_t> numa_node_;
+
+ private:
+  std::unique_ptr<NumaHostMemory> memory_;
+};
+
+}  // namespace holoscan
+
+#endif /* HOLOSCAN_CORE_RESOURCES_GXF_NUMA_BINDING_ALLOCATOR_HPP */
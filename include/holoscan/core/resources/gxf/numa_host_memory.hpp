@@ -0,0 +1,113 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_RESOURCES_GXF_NUMA_HOST_MEMORY_HPP
+#define HOLOSCAN_CORE_RESOURCES_GXF_NUMA_HOST_MEMORY_HPP
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "../../system/topology.hpp"
+
+namespace holoscan {
+
+/// Statistics of a NumaHostMemory.
+struct NumaHostMemoryStats {
+  uint64_t allocations = 0;         ///< Number of successful allocations
+  uint64_t failed_allocations = 0;  ///< Number of requests that couldn't be fulfilled
+  uint64_t local_allocations = 0;   ///< Allocations on the node of the allocating thread
+  uint64_t remote_allocations = 0;  ///< Allocations on another node (or not bound to a node)
+  uint64_t remote_frees = 0;        ///< Frees from a thread running on another node
+  uint64_t in_use_bytes = 0;        ///< Number of bytes currently allocated
+  /// Bytes currently allocated on each node (kUnboundNode for the allocations not bound to a node)
+  std::map<int, uint64_t> in_use_bytes_per_node;
+};
+
+/**
+ * @brief Thread-safe host memory allocations bound to NUMA nodes.
+ *
+ * Each allocation is bound to a fixed NUMA node or, if no node is configured, to the node of the
+ * CPU the calling thread is running on, so that the memory written by an operator is local to
+ * it. If the node of the calling thread is unknown, the memory is allocated without binding and
+ * counted as remote. The locality of the allocations and of the frees is recorded: a remote free
+ * usually means that the buffer was consumed by an operator running on another socket.
+ *
+ * Used by holoscan::NumaBindingAllocator.
+ */
+class NumaHostMemory {
+ public:
+  /// Value of `numa_node` binding the allocations to the node of the calling thread.
+  static constexpr int kCallingThreadNode = -1;
+  /// Node of the allocations not bound to a NUMA node (in NumaHostMemoryStats).
+  static constexpr int kUnboundNode = -1;
+
+  /**
+   * @brief Construct a new NUMA host memory allocator.
+   *
+   * @param numa_node The OS index of the NUMA node of the allocations, or kCallingThreadNode.
+   */
+  explicit NumaHostMemory(int numa_node = kCallingThreadNode);
+
+  NumaHostMemory(const NumaHostMemory&) = delete;
+  NumaHostMemory& operator=(const NumaHostMemory&) = delete;
+
+  /// @brief The OS indices of the NUMA nodes of the system.
+  const std::vector<int>& numa_nodes() const { return numa_nodes_; }
+
+  /// @brief The NUMA node of the CPU the calling thread is running on (-1 if unknown).
+  int current_numa_node() const;
+
+  /**
+   * @brief Allocate memory.
+   *
+   * @param size The size of the allocation in bytes.
+   * @return The page-aligned allocation, or nullptr on failure (e.g., unknown configured NUMA
+   * node).
+   */
+  void* allocate(uint64_t size);
+
+  /**
+   * @brief Free an allocation.
+   *
+   * @return false if the pointer wasn't allocated by this object.
+   */
+  bool free(void* pointer);
+
+  NumaHostMemoryStats stats() const;
+
+ private:
+  struct Allocation {
+    uint64_t size = 0;
+    int numa_node = -1;
+  };
+
+  Topology topology_;
+  int numa_node_ = kCallingThreadNode;
+  std::vector<int> numa_nodes_;
+  std::vector<int> numa_node_by_cpu_;
+
+  mutable std::mutex mutex_;
+  std::unordered_map<void*, Allocation> allocations_;
+  NumaHostMemoryStats stats_;
+};
+
+}  // namespace holoscan
+
+#endif /* HOLOSCAN_CORE_RESOURCES_GXF_NUMA_HOST_MEMORY_HPP */
@@ -0,0 +1,67 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_RESOURCES_GXF_RECYCLING_ALLOCATOR_HPP
+#define HOLOSCAN_CORE_RESOURCES_GXF_RECYCLING_ALLOCATOR_HPP
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "./allocator.hpp"
+#include "./buffer_cache.hpp"
+
+namespace holoscan {
+
+// Forward declarations
+class BufferRecyclingAllocator;
+
+/**
+ * @brief Recycling allocator.
+ *
+ * Allocator keeping freed buffers for later allocations of the same size and storage type instead
+ * of returning them to the underlying allocator. It is used by default by the
+ * UcxHoloscanComponentSerializer for the received tensors.
+ *
+ * At most `max_buffers_per_size` buffers of a given size and type, and `max_cached_bytes` bytes in
+ * total, are kept. `stats()` reports the number of allocations served from the cache (hits) and
+ * forwarded to the underlying allocator (misses).
+ */
+class RecyclingAllocator : public Allocator {
+ public:
+  HOLOSCAN_RESOURCE_FORWARD_ARGS_SUPER(RecyclingAllocator, Allocator)
+  RecyclingAllocator() = default;
+  RecyclingAllocator(const std::string& name, BufferRecyclingAllocator* component);
+
+  const char* gxf_typename() const override { return "holoscan::BufferRecyclingAllocator"; }
+
+  void setup(ComponentSpec& spec) override;
+
+  void initialize() override;
+
+  /// @brief The cache statistics (all zeros if the allocator is not initialized).
+  BufferCacheStats stats() const;
+
+ private:
+  Parameter<std::shared_ptr<Allocator>> allocator_;
+  Parameter<uint64_t> max_buffers_per_size_;
+  Parameter<uint64_t> max_cached_bytes_;
+};
+
+}  // namespace holoscan
+
+#endif /* HOLOSCAN_CORE_RESOURCES_GXF_RECYCLING_ALLOCATOR_HPP */
@@ -0,0 +1,54 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_RESOURCES_GXF_RING_BUFFER_TRANSMITTER_HPP
+#define HOLOSCAN_CORE_RESOURCES_GXF_RING_BUFFER_TRANSMITTER_HPP
+
+#include <string>
+
+#include "./transmitter.hpp"
+
+namespace holoscan {
+
+// Forward declarations
+class SpscRingBufferTransmitter;
+
+/**
+ * @brief Ring buffer transmitter class.
+ *
+ * The RingBufferTransmitter class is used to send messages to another operator within a fragment
+ * through a lock-free single-producer/single-consumer ring buffer. It has the same capacity and
+ * policy semantics as the DoubleBufferTransmitter, without the double buffering, and can only be
+ * used for point-to-point connections.
+ */
+class RingBufferTransmitter : public Transmitter {
+ public:
+  HOLOSCAN_RESOURCE_FORWARD_ARGS_SUPER(RingBufferTransmitter, Transmitter)
+  RingBufferTransmitter() = default;
+  RingBufferTransmitter(const std::string& name, SpscRingBufferTransmitter* component);
+
+  const char* gxf_typename() const override { return "holoscan::SpscRingBufferTransmitter"; }
+
+  void setup(ComponentSpec& spec) override;
+
+  Parameter<uint64_t> capacity_;
+  Parameter<uint64_t> policy_;
+};
+
+}  // namespace holoscan
+
+#endif /* HOLOSCAN_CORE_RESOURCES_GXF_RING_BUFFER_TRANSMITTER_HPP */
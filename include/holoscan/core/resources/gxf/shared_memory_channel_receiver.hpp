@@ -0,0 +1,74 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_RESOURCES_GXF_SHARED_MEMORY_CHANNEL_RECEIVER_HPP
+#define HOLOSCAN_CORE_RESOURCES_GXF_SHARED_MEMORY_CHANNEL_RECEIVER_HPP
+
+#include <memory>
+#include <string>
+
+#include <gxf/serialization/entity_serializer.hpp>
+#include <gxf/std/parameter_parser_std.hpp>
+#include <gxf/std/receiver.hpp>
+
+#include "./shared_memory_endpoint.hpp"
+#include "./shared_memory_segment.hpp"
+
+namespace holoscan {
+
+/**
+ * @brief GXF receiver getting messages from a SharedMemoryChannelTransmitter on the same host.
+ *
+ * The receiver creates the shared memory segment on initialization and removes it on
+ * deinitialization. `size_abi()` reports the number of slots published by the transmitter, so a
+ * MessageAvailableSchedulingTerm sees new messages without any notification, and `pop_abi()`
+ * deserializes the oldest slot into a new entity before releasing the slot.
+ *
+ * The receiver cannot be connected to a transmitter of the same fragment.
+ */
+class SharedMemoryChannelReceiver : public nvidia::gxf::Receiver {
+ public:
+  SharedMemoryChannelReceiver() = default;
+
+  gxf_result_t registerInterface(nvidia::gxf::Registrar* registrar) override;
+  gxf_result_t initialize() override;
+  gxf_result_t deinitialize() override;
+
+  gxf_result_t pop_abi(gxf_uid_t* uid) override;
+  gxf_result_t push_abi(gxf_uid_t other) override;
+  gxf_result_t peek_abi(gxf_uid_t* uid, int32_t index) override;
+  gxf_result_t peek_back_abi(gxf_uid_t* uid, int32_t index) override;
+  size_t capacity_abi() override;
+  size_t size_abi() override;
+
+  gxf_result_t receive_abi(gxf_uid_t* uid) override;
+  size_t back_size_abi() override;
+  gxf_result_t sync_abi() override;
+
+  nvidia::gxf::Parameter<std::string> segment_name_;
+  nvidia::gxf::Parameter<uint64_t> capacity_;
+  nvidia::gxf::Parameter<uint64_t> slot_size_;
+  nvidia::gxf::Parameter<nvidia::gxf::Handle<nvidia::gxf::EntitySerializer>> serializer_;
+
+ private:
+  std::unique_ptr<SharedMemorySegment> segment_;
+  SharedMemorySlotEndpoint endpoint_;
+};
+
+}  // namespace holoscan
+
+#endif /* HOLOSCAN_CORE_RESOURCES_GXF_SHARED_MEMORY_CHANNEL_RECEIVER_HPP */
@@ -0,0 +1,134 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_RESOURCES_GXF_SHARED_MEMORY_CHANNEL_TRANSMITTER_HPP
+#define HOLOSCAN_CORE_RESOURCES_GXF_SHARED_MEMORY_CHANNEL_TRANSMITTER_HPP
+
+#include <chrono>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+
+#include <gxf/serialization/entity_serializer.hpp>
+#include <gxf/std/parameter_parser_std.hpp>
+#include <gxf/std/scheduling_term.hpp>
+#include <gxf/std/transmitter.hpp>
+
+#include "./shared_memory_endpoint.hpp"
+#include "./shared_memory_segment.hpp"
+
+namespace holoscan {
+
+/**
+ * @brief GXF transmitter sending messages to a SharedMemoryChannelReceiver on the same host.
+ *
+ * Published messages are kept until `sync_abi()`, which serializes each of them directly into a
+ * free slot of the shared memory segment created by the receiver and publishes the slot. Back
+ * pressure is provided by holoscan::SharedMemoryReceptiveSchedulingTerm, which keeps the upstream
+ * operator waiting while all the slots are in use, so `sync_abi()` normally finds a free slot.
+ * Otherwise (more messages than free slots, or no scheduling term), `sync_abi()` waits up to
+ * 'send_timeout' for the receiver to release one. On timeout, the message is dropped (policies
+ * 'pop' and 'reject') or an error is returned ('fault'). If the receiver closes the segment or its
+ * process exits, the messages are dropped.
+ *
+ * The receiver has up to 'connection_timeout', counted from the first connection attempt, to
+ * create the segment. Once this timeout expired, sends fail without waiting.
+ */
+class SharedMemoryChannelTransmitter : public nvidia::gxf::Transmitter {
+ public:
+  SharedMemoryChannelTransmitter() = default;
+
+  gxf_result_t registerInterface(nvidia::gxf::Registrar* registrar) override;
+  gxf_result_t deinitialize() override;
+
+  gxf_result_t pop_abi(gxf_uid_t* uid) override;
+  gxf_result_t push_abi(gxf_uid_t other) override;
+  gxf_result_t peek_abi(gxf_uid_t* uid, int32_t index) override;
+  size_t capacity_abi() override;
+  size_t size_abi() override;
+
+  gxf_result_t publish_abi(gxf_uid_t uid) override;
+  size_t back_size_abi() override;
+  gxf_result_t sync_abi() override;
+
+  /**
+   * @brief Whether the receiver can accept at least `min_size` more messages without waiting.
+   *
+   * Never blocks: the segment is opened if the receiver created it. Also true once sending is
+   * bound to fail or drop the messages (connection timeout, receiver closed), so that the upstream
+   * operator is not kept waiting forever.
+   */
+  bool is_receptive(size_t min_size);
+
+  nvidia::gxf::Parameter<std::string> segment_name_;
+  nvidia::gxf::Parameter<uint64_t> capacity_;
+  nvidia::gxf::Parameter<uint64_t> policy_;
+  nvidia::gxf::Parameter<int64_t> connection_timeout_;
+  nvidia::gxf::Parameter<int64_t> send_timeout_;
+  nvidia::gxf::Parameter<nvidia::gxf::Handle<nvidia::gxf::EntitySerializer>> serializer_;
+
+ private:
+  /// Open the segment, waiting (if `wait`) until 'connection_timeout' for the receiver to create
+  /// it. Requires `segment_mutex_`.
+  bool connect(bool wait);
+  /// Whether the receiver closed the segment or exited. Requires `segment_mutex_`.
+  bool is_consumer_lost();
+  /// Serialize a message into the next free slot.
+  gxf_result_t send(gxf_uid_t uid);
+
+  std::mutex mutex_;
+  std::deque<gxf_uid_t> pending_;
+  /// Guards the segment and the connection state, shared with the scheduling term.
+  std::mutex segment_mutex_;
+  std::unique_ptr<SharedMemorySegment> segment_;
+  SharedMemorySlotEndpoint endpoint_;
+  /// Time of the first connection attempt ('connection_timeout' is counted from it).
+  std::optional<std::chrono::steady_clock::time_point> connect_start_;
+  /// Whether the receiver did not create the segment within 'connection_timeout'.
+  bool connect_timed_out_ = false;
+  /// Whether the receiver closed the segment or exited.
+  bool consumer_lost_ = false;
+  /// Time of the next check of the receiver process while the segment is full.
+  std::chrono::steady_clock::time_point next_liveness_check_{};
+};
+
+/**
+ * @brief Scheduling term waiting until a SharedMemoryChannelTransmitter has free slots.
+ *
+ * Counterpart of nvidia::gxf::DownstreamReceptiveSchedulingTerm for
+ * holoscan::SharedMemoryChannelTransmitter. The receiver runs in another process and cannot
+ * notify the scheduler when it releases a slot, so the segment is checked again after
+ * 'poll_period' while it is full (or not created yet).
+ */
+class SharedMemoryReceptiveSchedulingTerm : public nvidia::gxf::SchedulingTerm {
+ public:
+  gxf_result_t registerInterface(nvidia::gxf::Registrar* registrar) override;
+  gxf_result_t check_abi(int64_t timestamp, nvidia::gxf::SchedulingConditionType* type,
+                         int64_t* target_timestamp) const override;
+  gxf_result_t onExecute_abi(int64_t dt) override;
+
+ private:
+  nvidia::gxf::Parameter<nvidia::gxf::Handle<SharedMemoryChannelTransmitter>> transmitter_;
+  nvidia::gxf::Parameter<uint64_t> min_size_;
+  nvidia::gxf::Parameter<int64_t> poll_period_;
+};
+
+}  // namespace holoscan
+
+#endif /* HOLOSCAN_CORE_RESOURCES_GXF_SHARED_MEMORY_CHANNEL_TRANSMITTER_HPP */
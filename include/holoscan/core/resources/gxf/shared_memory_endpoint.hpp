@@ -0,0 +1,78 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_RESOURCES_GXF_SHARED_MEMORY_ENDPOINT_HPP
+#define HOLOSCAN_CORE_RESOURCES_GXF_SHARED_MEMORY_ENDPOINT_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include <gxf/serialization/endpoint.hpp>
+#include <gxf/std/allocator.hpp>
+
+namespace holoscan {
+
+/**
+ * @brief Serialization endpoint reading and writing a message directly in a shared memory slot.
+ *
+ * It follows the protocol of the UCX serializers: headers are written with `write()` and are
+ * stored inline from the beginning of the slot, while tensor payloads are given with
+ * `write_ptr()` and are copied to (or, when deserializing, from) the end of the slot. Payloads in
+ * device memory are copied with cudaMemcpy.
+ *
+ * The endpoint is not registered with GXF. It is owned by the SharedMemoryChannelTransmitter or
+ * SharedMemoryChannelReceiver using it.
+ */
+class SharedMemorySlotEndpoint : public nvidia::gxf::Endpoint {
+ public:
+  /// @brief Start serializing a message to the given slot.
+  void begin_write(uint8_t* slot, size_t slot_size);
+
+  /// @brief Start deserializing the message stored in the given slot.
+  void begin_read(const uint8_t* slot, size_t slot_size, size_t inline_size, size_t payload_size);
+
+  /// @brief The number of inline bytes written or read so far.
+  size_t inline_size() const { return inline_end_; }
+  /// @brief The number of payload bytes (including alignment padding) written or read so far.
+  size_t payload_size() const { return payload_end_; }
+  /// @brief Whether the last message did not fit in the slot.
+  bool overflowed() const { return overflowed_; }
+
+  gxf_result_t is_write_available_abi() override;
+  gxf_result_t is_read_available_abi() override;
+  gxf_result_t write_abi(const void* data, size_t size, size_t* bytes_written) override;
+  gxf_result_t read_abi(void* data, size_t size, size_t* bytes_read) override;
+  gxf_result_t write_ptr_abi(const void* pointer, size_t size,
+                             nvidia::gxf::MemoryStorageType type) override;
+
+ private:
+  /// Reserve the space of the next payload and return its offset, or -1 if it does not fit.
+  int64_t next_payload_offset(size_t size);
+
+  uint8_t* write_slot_ = nullptr;
+  const uint8_t* read_slot_ = nullptr;
+  size_t slot_size_ = 0;
+  size_t inline_end_ = 0;
+  size_t inline_limit_ = 0;
+  size_t payload_end_ = 0;
+  size_t payload_limit_ = 0;
+  bool overflowed_ = false;
+};
+
+}  // namespace holoscan
+
+#endif /* HOLOSCAN_CORE_RESOURCES_GXF_SHARED_MEMORY_ENDPOINT_HPP */
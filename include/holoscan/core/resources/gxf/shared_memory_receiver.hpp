@@ -0,0 +1,64 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_RESOURCES_GXF_SHARED_MEMORY_RECEIVER_HPP
+#define HOLOSCAN_CORE_RESOURCES_GXF_SHARED_MEMORY_RECEIVER_HPP
+
+#include <memory>
+#include <string>
+
+#include "./receiver.hpp"
+#include "./ucx_entity_serializer.hpp"
+
+namespace holoscan {
+
+// Forward declarations
+class SharedMemoryChannelReceiver;
+
+/**
+ * @brief Shared memory receiver class.
+ *
+ * The SharedMemoryReceiver class is used to receive messages from an operator within another
+ * fragment running on the same host. It owns a POSIX shared memory segment ('segment_name') of
+ * 'capacity' slots of 'slot_size' bytes each, into which the SharedMemoryTransmitter serializes
+ * the messages. A serialized message (including its tensor payloads) must fit in a slot.
+ */
+class SharedMemoryReceiver : public Receiver {
+ public:
+  HOLOSCAN_RESOURCE_FORWARD_ARGS_SUPER(SharedMemoryReceiver, Receiver)
+  SharedMemoryReceiver() = default;
+  SharedMemoryReceiver(const std::string& name, SharedMemoryChannelReceiver* component);
+
+  const char* gxf_typename() const override { return "holoscan::SharedMemoryChannelReceiver"; }
+
+  void setup(ComponentSpec& spec) override;
+  void initialize() override;
+
+  /// @brief The name of the shared memory segment.
+  std::string segment_name();
+
+  Parameter<uint64_t> capacity_;
+  Parameter<uint64_t> slot_size_;
+
+ private:
+  Parameter<std::string> segment_name_;
+  Parameter<std::shared_ptr<UcxEntitySerializer>> serializer_;
+};
+
+}  // namespace holoscan
+
+#endif /* HOLOSCAN_CORE_RESOURCES_GXF_SHARED_MEMORY_RECEIVER_HPP */
@@ -0,0 +1,164 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_RESOURCES_GXF_SHARED_MEMORY_SEGMENT_HPP
+#define HOLOSCAN_CORE_RESOURCES_GXF_SHARED_MEMORY_SEGMENT_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace holoscan {
+
+/// Default number of slots of a shared memory connection.
+constexpr uint64_t kDefaultSharedMemorySlotCount = 2;
+/// Default slot size of a shared memory connection (only the used pages are backed by memory).
+constexpr uint64_t kDefaultSharedMemorySlotSize = 64UL << 20;
+
+/**
+ * @brief POSIX shared-memory segment holding a single-producer/single-consumer ring of slots.
+ *
+ * The segment is created by the consumer (receiver) and opened by the producer (transmitter),
+ * possibly from another process on the same host. Each slot stores one serialized message: the
+ * inline (header) bytes grow from the beginning of the slot and the payloads (tensor data) are
+ * placed from the end of the slot, so that only the slot index and the two sizes (the message
+ * descriptor) are exchanged through the ring indices.
+ *
+ * `begin_write()`/`commit_write()` must only be called by the producer, and
+ * `begin_read()`/`end_read()` by the consumer. `size()` can be called from any thread of either
+ * process.
+ */
+class SharedMemorySegment {
+ public:
+  /// Alignment of the payloads within a slot.
+  static constexpr size_t kPayloadAlignment = 256;
+
+  ~SharedMemorySegment();
+
+  SharedMemorySegment(const SharedMemorySegment&) = delete;
+  SharedMemorySegment& operator=(const SharedMemorySegment&) = delete;
+
+  /**
+   * @brief Create a new segment (consumer side).
+   *
+   * A stale segment with the same name (e.g. left by a crashed process) is replaced. The segment
+   * is unlinked when the returned object is destroyed.
+   *
+   * @param name The name of the segment (see shm_open(3)).
+   * @param slot_count The number of slots. Must be greater than 0.
+   * @param slot_size The size of a slot in bytes. Pages are only backed by memory once used.
+   * @return The segment, or nullptr on error.
+   */
+  static std::unique_ptr<SharedMemorySegment> create(const std::string& name, size_t slot_count,
+                                                     size_t slot_size);
+
+  /**
+   * @brief Open a segment created by `create()` (producer side).
+   *
+   * @param name The name of the segment.
+   * @return The segment, or nullptr if it does not exist (yet) or is not initialized.
+   */
+  static std::unique_ptr<SharedMemorySegment> open(const std::string& name);
+
+  /// @brief Normalize a segment name so that it is a valid shm_open(3) name.
+  static std::string segment_name(const std::string& name);
+
+  const std::string& name() const { return name_; }
+  size_t slot_count() const { return slot_count_; }
+  size_t slot_size() const { return slot_size_; }
+
+  /// @brief The number of messages written and not yet released by the consumer.
+  size_t size() const;
+
+  /// @brief Whether the consumer still owns the segment.
+  bool is_consumer_open() const;
+
+  /**
+   * @brief Whether the consumer still owns the segment and its process is running.
+   *
+   * The consumer holds a shared lock on the segment for as long as it is open. The lock is
+   * released by the kernel when the consumer process exits, so a crashed consumer (which could not
+   * clear the open flag) is detected from any process sharing the segment, even across PID
+   * namespaces.
+   */
+  bool is_consumer_alive() const;
+
+  /**
+   * @brief Get the next free slot (producer only).
+   *
+   * @return The slot memory (`slot_size()` bytes), or nullptr if all the slots are in use.
+   */
+  uint8_t* begin_write();
+
+  /// @brief Publish the slot returned by `begin_write()` (producer only).
+  void commit_write(size_t inline_size, size_t payload_size);
+
+  /**
+   * @brief Get the oldest written slot (consumer only).
+   *
+   * @param inline_size The number of inline bytes at the beginning of the slot.
+   * @param payload_size The number of payload bytes at the end of the slot.
+   * @return The slot memory, or nullptr if there is no message.
+   */
+  const uint8_t* begin_read(size_t* inline_size, size_t* payload_size);
+
+  /// @brief Release the slot returned by `begin_read()` to the producer (consumer only).
+  void end_read();
+
+ private:
+  struct Header;
+  struct SlotDescriptor;
+
+  SharedMemorySegment(std::string name, int fd, void* address, size_t mapped_size,
+                      bool is_owner);
+
+  SlotDescriptor* descriptor(uint64_t index) const;
+  uint8_t* slot(uint64_t index) const;
+
+  std::string name_;
+  /// Kept open for the consumer lock (see `is_consumer_alive()`).
+  int fd_ = -1;
+  void* address_ = nullptr;
+  size_t mapped_size_ = 0;
+  bool is_owner_ = false;
+  Header* header_ = nullptr;
+  size_t slot_count_ = 0;
+  size_t slot_size_ = 0;
+};
+
+/**
+ * @brief Offset of a payload within a slot.
+ *
+ * Payloads are stacked from the end of the slot in the order they are written, so the producer
+ * and the consumer compute the same offsets from the payload sizes only.
+ *
+ * @param slot_size The size of the slot.
+ * @param payload_end The number of payload bytes already placed (including alignment padding).
+ * @param size The size of the new payload.
+ * @return The offset of the payload, or `slot_size` if it does not fit.
+ */
+inline size_t shared_memory_payload_offset(size_t slot_size, size_t payload_end, size_t size) {
+  if (payload_end + size > slot_size) { return slot_size; }
+  size_t offset = slot_size - payload_end - size;
+  return offset - offset % SharedMemorySegment::kPayloadAlignment;
+}
+
+}  // namespace holoscan
+
+#endif /* HOLOSCAN_CORE_RESOURCES_GXF_SHARED_MEMORY_SEGMENT_HPP */
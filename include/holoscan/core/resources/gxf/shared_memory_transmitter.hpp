@@ -0,0 +1,66 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_RESOURCES_GXF_SHARED_MEMORY_TRANSMITTER_HPP
+#define HOLOSCAN_CORE_RESOURCES_GXF_SHARED_MEMORY_TRANSMITTER_HPP
+
+#include <memory>
+#include <string>
+
+#include "./transmitter.hpp"
+#include "./ucx_entity_serializer.hpp"
+
+namespace holoscan {
+
+// Forward declarations
+class SharedMemoryChannelTransmitter;
+
+/**
+ * @brief Shared memory transmitter class.
+ *
+ * The SharedMemoryTransmitter class is used to emit messages to an operator within another
+ * fragment running on the same host. Messages are serialized directly into the shared memory
+ * segment created by the corresponding SharedMemoryReceiver ('segment_name'), so that tensor
+ * payloads are copied once instead of going through a serialization buffer and a socket.
+ */
+class SharedMemoryTransmitter : public Transmitter {
+ public:
+  HOLOSCAN_RESOURCE_FORWARD_ARGS_SUPER(SharedMemoryTransmitter, Transmitter)
+  SharedMemoryTransmitter() = default;
+  SharedMemoryTransmitter(const std::string& name, SharedMemoryChannelTransmitter* component);
+
+  const char* gxf_typename() const override { return "holoscan::SharedMemoryChannelTransmitter"; }
+
+  void setup(ComponentSpec& spec) override;
+  void initialize() override;
+
+  /// @brief The name of the shared memory segment.
+  std::string segment_name();
+
+  Parameter<uint64_t> capacity_;
+  Parameter<uint64_t> policy_;
+
+ private:
+  Parameter<std::string> segment_name_;
+  Parameter<int64_t> connection_timeout_;
+  Parameter<int64_t> send_timeout_;
+  Parameter<std::shared_ptr<UcxEntitySerializer>> serializer_;
+};
+
+}  // namespace holoscan
+
+#endif /* HOLOSCAN_CORE_RESOURCES_GXF_SHARED_MEMORY_TRANSMITTER_HPP */
@@ -0,0 +1,68 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_RESOURCES_GXF_SLAB_ALLOCATOR_HPP
+#define HOLOSCAN_CORE_RESOURCES_GXF_SLAB_ALLOCATOR_HPP
+
+#include <memory>
+#include <vector>
+
+#include <gxf/std/allocator.hpp>
+#include <gxf/std/parameter_parser_std.hpp>
+
+#include "./slab_pool.hpp"
+
+namespace holoscan {
+
+/**
+ * @brief GXF allocator serving requests of mixed sizes from size classes.
+ *
+ * Requests are served by a SlabPool: a block of the smallest size class fitting the request is
+ * taken from the free list of the class, and the slabs holding the blocks are allocated on demand
+ * with the storage type of the allocator. The size classes are either given explicitly
+ * (`size_classes`) or the powers of two from `min_block_size` to `max_block_size`.
+ */
+class SlabAllocator : public nvidia::gxf::Allocator {
+ public:
+  SlabAllocator() = default;
+
+  gxf_result_t registerInterface(nvidia::gxf::Registrar* registrar) override;
+  gxf_result_t initialize() override;
+  gxf_result_t deinitialize() override;
+
+  gxf_result_t is_available_abi(uint64_t size) override;
+  gxf_result_t allocate_abi(uint64_t size, int32_t type, void** pointer) override;
+  gxf_result_t free_abi(void* pointer) override;
+
+  /// @brief The statistics of the pool.
+  SlabPoolStats stats() const;
+
+  nvidia::gxf::Parameter<int32_t> storage_type_;
+  nvidia::gxf::Parameter<std::vector<uint64_t>> size_classes_;
+  nvidia::gxf::Parameter<uint64_t> min_block_size_;
+  nvidia::gxf::Parameter<uint64_t> max_block_size_;
+  nvidia::gxf::Parameter<uint64_t> slab_size_;
+  nvidia::gxf::Parameter<uint64_t> max_bytes_;
+  nvidia::gxf::Parameter<uint64_t> thread_cache_size_;
+
+ private:
+  std::unique_ptr<SlabPool> pool_;
+};
+
+}  // namespace holoscan
+
+#endif /* HOLOSCAN_CORE_RESOURCES_GXF_SLAB_ALLOCATOR_HPP */
@@ -0,0 +1,71 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_RESOURCES_GXF_SLAB_MEMORY_POOL_HPP
+#define HOLOSCAN_CORE_RESOURCES_GXF_SLAB_MEMORY_POOL_HPP
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "./allocator.hpp"
+#include "./slab_pool.hpp"
+
+namespace holoscan {
+
+// Forward declarations
+class SlabAllocator;
+
+/**
+ * @brief Slab memory pool allocator.
+ *
+ * Memory pool serving requests of mixed sizes from several size classes, each with its own free
+ * list of blocks. Unlike BlockMemoryPool, which only provides blocks of a single size, a request is
+ * served by a block of the smallest size class that fits it. The blocks are carved out of slabs
+ * of `slab_size` bytes allocated on demand, and requests larger than the largest size class are
+ * allocated directly.
+ *
+ * The size classes are either given by `size_classes` or are the powers of two from
+ * `min_block_size` to `max_block_size`. If `thread_cache_size` is not zero, each thread keeps up
+ * to that many freed blocks per size class to avoid taking the lock of the size class.
+ */
+class SlabMemoryPool : public Allocator {
+ public:
+  HOLOSCAN_RESOURCE_FORWARD_ARGS_SUPER(SlabMemoryPool, Allocator)
+  SlabMemoryPool() = default;
+  SlabMemoryPool(const std::string& name, SlabAllocator* component);
+
+  const char* gxf_typename() const override { return "holoscan::SlabAllocator"; }
+
+  void setup(ComponentSpec& spec) override;
+
+  /// @brief The pool statistics (all zeros if the allocator is not initialized).
+  SlabPoolStats stats() const;
+
+ private:
+  Parameter<int32_t> storage_type_;
+  Parameter<std::vector<uint64_t>> size_classes_;
+  Parameter<uint64_t> min_block_size_;
+  Parameter<uint64_t> max_block_size_;
+  Parameter<uint64_t> slab_size_;
+  Parameter<uint64_t> max_bytes_;
+  Parameter<uint64_t> thread_cache_size_;
+};
+
+}  // namespace holoscan
+
+#endif /* HOLOSCAN_CORE_RESOURCES_GXF_SLAB_MEMORY_POOL_HPP */
@@ -0,0 +1,183 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_RESOURCES_GXF_SLAB_POOL_HPP
+#define HOLOSCAN_CORE_RESOURCES_GXF_SLAB_POOL_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <vector>
+
+namespace holoscan {
+
+/// Statistics of a SlabPool.
+struct SlabPoolStats {
+  uint64_t allocations = 0;         ///< Number of blocks handed out from the size classes
+  uint64_t large_allocations = 0;   ///< Number of requests larger than the largest size class
+  uint64_t thread_cache_hits = 0;   ///< Number of blocks handed out from a thread-local cache
+  uint64_t failed_allocations = 0;  ///< Number of requests that couldn't be fulfilled
+  uint64_t slabs = 0;               ///< Number of slabs currently allocated
+  uint64_t reserved_bytes = 0;      ///< Number of bytes of the slabs and the large allocations
+  uint64_t in_use_blocks = 0;       ///< Number of blocks and large allocations handed out
+  uint64_t in_use_bytes = 0;        ///< Number of bytes handed out (rounded up to the blocks)
+};
+
+/**
+ * @brief Thread-safe pool of memory blocks grouped in size classes.
+ *
+ * A request is served by a block of the smallest size class that fits it. The blocks of a size
+ * class are carved out of slabs of (about) `slab_size` bytes that are allocated on demand, and
+ * freed blocks go back to the free list of their size class. Slabs are only released when the
+ * pool is destroyed. Requests larger than the largest size class are forwarded to the
+ * underlying memory functions.
+ *
+ * If `thread_cache_size` is not zero, each thread keeps up to that many freed blocks per size
+ * class and moves blocks from and to the shared free lists in batches, so that most allocations
+ * don't take the lock of the size class. The blocks cached by a thread are moved back to the
+ * shared free lists when the thread exits.
+ *
+ * The pool tracks whether each block is handed out (one bit per block) and rejects the blocks
+ * freed twice.
+ *
+ * The pool doesn't access the memory it hands out, so it can manage any kind of memory (host,
+ * pinned or device). Used by holoscan::SlabAllocator.
+ */
+class SlabPool {
+ public:
+  /// Function allocating `size` bytes of memory (returns nullptr on failure).
+  using AllocateFunction = std::function<void*(uint64_t size)>;
+  /// Function freeing memory returned by an AllocateFunction.
+  using FreeFunction = std::function<void(void* pointer, uint64_t size)>;
+
+  /// Alignment of the blocks: the size classes are rounded up to a multiple of it.
+  static constexpr uint64_t kBlockAlignment = 256;
+
+  /**
+   * @brief Construct a new slab pool.
+   *
+   * @param size_classes The block sizes of the size classes (rounded up to kBlockAlignment).
+   * @param slab_size The size of the slabs. A slab holds at least one block.
+   * @param max_bytes The maximum number of bytes reserved by the pool (0 for no limit).
+   * @param thread_cache_size The maximum number of blocks per size class cached by each thread
+   * (0 to disable the thread-local caches).
+   * @param allocate The function allocating the slabs and the large allocations.
+   * @param free The function freeing the slabs and the large allocations.
+   */
+  SlabPool(std::vector<uint64_t> size_classes, uint64_t slab_size, uint64_t max_bytes,
+           uint64_t thread_cache_size, AllocateFunction allocate, FreeFunction free);
+  ~SlabPool();
+
+  SlabPool(const SlabPool&) = delete;
+  SlabPool& operator=(const SlabPool&) = delete;
+
+  /**
+   * @brief Get power-of-two size classes.
+   *
+   * @param min_block_size The smallest block size (rounded up to a power of two).
+   * @param max_block_size The largest block size.
+   * @return The size classes from `min_block_size` to `max_block_size`.
+   */
+  static std::vector<uint64_t> power_of_two_size_classes(uint64_t min_block_size,
+                                                         uint64_t max_block_size);
+
+  /// @brief The block sizes of the size classes, in increasing order.
+  std::vector<uint64_t> size_classes() const;
+
+  /**
+   * @brief Allocate a block of at least `size` bytes.
+   *
+   * @return The block, or nullptr if the memory couldn't be allocated or `max_bytes` is reached.
+   */
+  void* allocate(uint64_t size);
+
+  /**
+   * @brief Return a block to the pool.
+   *
+   * @return false if the block was not allocated by this pool or if it is already free.
+   */
+  bool free(void* pointer);
+
+  /**
+   * @brief Whether a request of `size` bytes can be fulfilled without exceeding `max_bytes`.
+   *
+   * Free blocks in the shared free lists and in the cache of the calling thread are counted.
+   */
+  bool is_available(uint64_t size) const;
+
+  SlabPoolStats stats() const;
+
+ private:
+  struct SizeClass {
+    uint64_t block_size = 0;
+    uint64_t blocks_per_slab = 0;
+    std::mutex mutex;
+    std::vector<void*> free_blocks;
+  };
+
+  /// A slab or a large allocation, indexed by its address.
+  struct Chunk {
+    uint64_t size = 0;
+    size_t class_index = 0;  ///< kLargeAllocation for large allocations
+    /// One bit per block of a slab, set while the block is handed out (owned by blocks_in_use_).
+    std::atomic<uint64_t>* blocks_in_use = nullptr;
+  };
+  static constexpr size_t kLargeAllocation = static_cast<size_t>(-1);
+
+  /// Find the chunk containing `address` (returns its address, or 0 if there is none).
+  uintptr_t find_chunk(uintptr_t address, Chunk& chunk) const;
+  size_t find_size_class(uint64_t size) const;
+  bool reserve(uint64_t size);
+  /// Allocate a slab for the size class (its mutex must be held).
+  bool grow(SizeClass& size_class, size_t class_index);
+  void* allocate_large(uint64_t size);
+  std::vector<void*>* thread_cache(size_t class_index);
+  /// The cache of the calling thread, or nullptr if it has not cached blocks of this pool yet.
+  std::vector<void*>* find_thread_cache(size_t class_index) const;
+  /// Mark a block of a slab as handed out or free (returns false if it already is).
+  bool set_block_in_use(void* pointer, bool in_use);
+  /// Same as above for the block at `offset` bytes from the start of its slab.
+  bool set_block_in_use(const Chunk& chunk, uint64_t offset, bool in_use);
+
+  const uint64_t id_;
+  const uint64_t max_bytes_;
+  const uint64_t thread_cache_size_;
+  AllocateFunction allocate_;
+  FreeFunction free_;
+  std::vector<std::unique_ptr<SizeClass>> size_classes_;
+
+  mutable std::shared_mutex chunks_mutex_;
+  std::map<uintptr_t, Chunk> chunks_;
+  std::vector<std::unique_ptr<std::atomic<uint64_t>[]>> blocks_in_use_;  ///< Per slab
+
+  std::atomic<uint64_t> allocations_{0};
+  std::atomic<uint64_t> large_allocations_{0};
+  std::atomic<uint64_t> thread_cache_hits_{0};
+  std::atomic<uint64_t> failed_allocations_{0};
+  std::atomic<uint64_t> slabs_{0};
+  std::atomic<uint64_t> reserved_bytes_{0};
+  std::atomic<uint64_t> in_use_blocks_{0};
+  std::atomic<uint64_t> in_use_bytes_{0};
+};
+
+}  // namespace holoscan
+
+#endif /* HOLOSCAN_CORE_RESOURCES_GXF_SLAB_POOL_HPP */
@@ -0,0 +1,235 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_RESOURCES_GXF_SPSC_RING_BUFFER_HPP
+#define HOLOSCAN_CORE_RESOURCES_GXF_SPSC_RING_BUFFER_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include <gxf/core/gxf.h>
+
+namespace holoscan {
+
+/// Size of a cache line, used to keep the producer and the consumer indices on separate lines.
+constexpr size_t kCacheLineSize = 64;
+
+/**
+ * @brief Bounded lock-free single-producer/single-consumer ring buffer.
+ *
+ * `push()` and `evict()` must only be called by the producer thread, while `pop()` and `peek()`
+ * must only be called by the consumer thread. `size()` can be called from any thread.
+ *
+ * The head (consumer) and tail (producer) indices live on their own cache lines, and each side
+ * keeps a cached copy of the other side's index so that the shared lines are only touched when
+ * the buffer looks full (producer) or empty (consumer).
+ *
+ * Advancing the head is done with a compare-and-swap so that the producer can drop the oldest
+ * element (`evict()`) while the consumer is popping it. Exactly one of them takes ownership of the
+ * element.
+ *
+ * @tparam T The element type. Must be lock-free as a `std::atomic<T>`.
+ */
+template <typename T>
+class SpscRingBuffer {
+ public:
+  static_assert(std::atomic<T>::is_always_lock_free, "T must be lock-free as std::atomic<T>");
+
+  /**
+   * @brief Construct a new ring buffer.
+   *
+   * @param capacity The maximum number of elements stored in the buffer. Must be greater than 0.
+   */
+  explicit SpscRingBuffer(size_t capacity)
+      : capacity_(capacity),
+        mask_(round_up_to_power_of_two(capacity) - 1),
+        slots_(std::make_unique<std::atomic<T>[]>(mask_ + 1)) {}
+
+  SpscRingBuffer(const SpscRingBuffer&) = delete;
+  SpscRingBuffer& operator=(const SpscRingBuffer&) = delete;
+
+  /// @brief The maximum number of elements stored in the buffer.
+  size_t capacity() const { return capacity_; }
+
+  /// @brief The number of elements currently stored in the buffer.
+  size_t size() const {
+    // Load the head first: the tail can only move forward, so tail >= head holds.
+    const uint64_t head = head_.load(std::memory_order_acquire);
+    const uint64_t tail = tail_.load(std::memory_order_acquire);
+    const uint64_t count = tail - head;
+    return count > capacity_ ? capacity_ : static_cast<size_t>(count);
+  }
+
+  /// @brief Whether the buffer is empty.
+  bool empty() const { return size() == 0; }
+
+  /**
+   * @brief Append an element (producer only).
+   *
+   * @param value The element to append.
+   * @return false if the buffer is full.
+   */
+  bool push(T value) {
+    const uint64_t tail = tail_.load(std::memory_order_relaxed);
+    if (tail - head_cache_ >= capacity_) {
+      head_cache_ = head_.load(std::memory_order_acquire);
+      if (tail - head_cache_ >= capacity_) { return false; }
+    }
+    slots_[tail & mask_].store(value, std::memory_order_relaxed);
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * @brief Remove the oldest element (consumer only).
+   *
+   * @param value The removed element, if any.
+   * @return false if the buffer is empty.
+   */
+  bool pop(T& value) {
+    uint64_t head = head_.load(std::memory_order_relaxed);
+    while (true) {
+      // The head may have been moved past the cached tail by the producer (eviction).
+      if (head >= tail_cache_) {
+        tail_cache_ = tail_.load(std::memory_order_acquire);
+        if (head >= tail_cache_) { return false; }
+      }
+      value = slots_[head & mask_].load(std::memory_order_relaxed);
+      if (head_.compare_exchange_weak(
+              head, head + 1, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+        return true;
+      }
+    }
+  }
+
+  /**
+   * @brief Remove the oldest element from the producer side.
+   *
+   * Used to implement the 'pop' overflow policy. If the consumer pops the same element
+   * concurrently, only one of the two calls returns it.
+   *
+   * @param value The removed element, if any.
+   * @return false if the buffer is empty.
+   */
+  bool evict(T& value) {
+    const uint64_t tail = tail_.load(std::memory_order_relaxed);
+    uint64_t head = head_.load(std::memory_order_acquire);
+    while (head != tail) {
+      value = slots_[head & mask_].load(std::memory_order_relaxed);
+      if (head_.compare_exchange_weak(
+              head, head + 1, std::memory_order_acq_rel, std::memory_order_acquire)) {
+        head_cache_ = head + 1;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /**
+   * @brief Read the element at the given position from the head without removing it (consumer
+   * only).
+   *
+   * When the producer evicts elements concurrently, the returned element may have been dropped
+   * already.
+   *
+   * @param index The position from the oldest element.
+   * @param value The element, if any.
+   * @return false if there are not enough elements in the buffer.
+   */
+  bool peek(size_t index, T& value) {
+    const uint64_t head = head_.load(std::memory_order_acquire);
+    if (head + index >= tail_cache_) {
+      tail_cache_ = tail_.load(std::memory_order_acquire);
+      if (head + index >= tail_cache_) { return false; }
+    }
+    value = slots_[(head + index) & mask_].load(std::memory_order_relaxed);
+    return true;
+  }
+
+ private:
+  static size_t round_up_to_power_of_two(size_t value) {
+    size_t result = 1;
+    while (result < value) { result <<= 1; }
+    return result;
+  }
+
+  const size_t capacity_;
+  const uint64_t mask_;
+  std::unique_ptr<std::atomic<T>[]> slots_;
+
+  /// Index of the oldest element, advanced by the consumer (and by the producer on eviction).
+  alignas(kCacheLineSize) std::atomic<uint64_t> head_{0};
+  /// Producer-local copy of `head_`.
+  alignas(kCacheLineSize) uint64_t head_cache_ = 0;
+  /// Index of the next free slot, advanced by the producer.
+  alignas(kCacheLineSize) std::atomic<uint64_t> tail_{0};
+  /// Consumer-local copy of `tail_`.
+  alignas(kCacheLineSize) uint64_t tail_cache_ = 0;
+};
+
+/**
+ * @brief SPSC ring buffer of GXF entities with the overflow policy of GXF's double buffer queues.
+ *
+ * The buffer holds a reference on each stored entity. `push()` acquires it, `pop()` hands it over
+ * to the caller and the remaining references are released on destruction.
+ *
+ * Used by holoscan::SpscRingBufferReceiver and holoscan::SpscRingBufferTransmitter.
+ */
+class SpscEntityRingBuffer {
+ public:
+  /// Behavior when an entity is pushed to a full buffer (same values as the 'policy' parameter).
+  enum class OverflowPolicy : uint64_t {
+    kPop = 0,     ///< Drop the oldest entity.
+    kReject = 1,  ///< Drop the new entity.
+    kFault = 2,   ///< Drop the new entity and return an error.
+  };
+
+  SpscEntityRingBuffer(gxf_context_t context, size_t capacity, uint64_t policy);
+  ~SpscEntityRingBuffer();
+
+  SpscEntityRingBuffer(const SpscEntityRingBuffer&) = delete;
+  SpscEntityRingBuffer& operator=(const SpscEntityRingBuffer&) = delete;
+
+  /**
+   * @brief Append an entity (producer only).
+   *
+   * @param uid The entity to append.
+   * @param name The name of the owning component, used for logging.
+   * @return GXF_EXCEEDING_PREALLOCATED_SIZE if the buffer is full and the policy is 'fault'.
+   */
+  gxf_result_t push(gxf_uid_t uid, const char* name);
+
+  /// @brief Remove the oldest entity (consumer only). The caller owns the returned reference.
+  gxf_result_t pop(gxf_uid_t* uid);
+
+  /// @brief Read the entity at the given position without removing it (consumer only).
+  gxf_result_t peek(gxf_uid_t* uid, int32_t index);
+
+  size_t capacity() const { return buffer_.capacity(); }
+  size_t size() const { return buffer_.size(); }
+
+ private:
+  gxf_context_t context_ = nullptr;
+  OverflowPolicy policy_ = OverflowPolicy::kFault;
+  SpscRingBuffer<gxf_uid_t> buffer_;
+};
+
+}  // namespace holoscan
+
+#endif /* HOLOSCAN_CORE_RESOURCES_GXF_SPSC_RING_BUFFER_HPP */
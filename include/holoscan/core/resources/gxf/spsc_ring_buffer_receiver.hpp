@@ -0,0 +1,65 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_RESOURCES_GXF_SPSC_RING_BUFFER_RECEIVER_HPP
+#define HOLOSCAN_CORE_RESOURCES_GXF_SPSC_RING_BUFFER_RECEIVER_HPP
+
+#include <memory>
+
+#include <gxf/std/parameter_parser_std.hpp>
+#include <gxf/std/receiver.hpp>
+
+#include "./spsc_ring_buffer.hpp"
+
+namespace holoscan {
+
+/**
+ * @brief GXF receiver backed by a lock-free single-producer/single-consumer ring buffer.
+ *
+ * Unlike nvidia::gxf::DoubleBufferReceiver, there is no back stage: messages pushed by the router
+ * are immediately visible to the consumer, and `sync_abi()` is a no-op. The receiver must be
+ * connected to exactly one transmitter.
+ */
+class SpscRingBufferReceiver : public nvidia::gxf::Receiver {
+ public:
+  SpscRingBufferReceiver() = default;
+
+  gxf_result_t registerInterface(nvidia::gxf::Registrar* registrar) override;
+  gxf_result_t initialize() override;
+  gxf_result_t deinitialize() override;
+
+  gxf_result_t pop_abi(gxf_uid_t* uid) override;
+  gxf_result_t push_abi(gxf_uid_t other) override;
+  gxf_result_t peek_abi(gxf_uid_t* uid, int32_t index) override;
+  size_t capacity_abi() override;
+  size_t size_abi() override;
+
+  gxf_result_t receive_abi(gxf_uid_t* uid) override;
+  size_t back_size_abi() override;
+  gxf_result_t peek_back_abi(gxf_uid_t* uid, int32_t index) override;
+  gxf_result_t sync_abi() override;
+
+  nvidia::gxf::Parameter<uint64_t> capacity_;
+  nvidia::gxf::Parameter<uint64_t> policy_;
+
+ private:
+  std::unique_ptr<SpscEntityRingBuffer> queue_;
+};
+
+}  // namespace holoscan
+
+#endif /* HOLOSCAN_CORE_RESOURCES_GXF_SPSC_RING_BUFFER_RECEIVER_HPP */
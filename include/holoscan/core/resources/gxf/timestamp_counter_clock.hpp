@@ -0,0 +1,54 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_RESOURCES_GXF_TIMESTAMP_COUNTER_CLOCK_HPP
+#define HOLOSCAN_CORE_RESOURCES_GXF_TIMESTAMP_COUNTER_CLOCK_HPP
+
+#include <gxf/std/clock.hpp>
+
+namespace holoscan {
+
+class TscCounter;
+
+/**
+ * @brief GXF clock reading its timestamps from the CPU cycle counter.
+ *
+ * Timestamps are nanoseconds in the CLOCK_MONOTONIC time base, read from TscCounter::instance()
+ * (CLOCK_MONOTONIC itself if the counter is not invariant). Sleeping uses
+ * `clock_nanosleep(CLOCK_MONOTONIC)`.
+ */
+class TimestampCounterClock : public nvidia::gxf::Clock {
+ public:
+  TimestampCounterClock();
+
+  gxf_result_t initialize() override;
+
+  double time() const override;
+  int64_t timestamp() const override;
+  nvidia::gxf::Expected<void> sleepFor(int64_t duration_ns) override;
+  nvidia::gxf::Expected<void> sleepUntil(int64_t target_time_ns) override;
+
+  /// @brief The counter the timestamps are read from.
+  const TscCounter& counter() const { return *counter_; }
+
+ private:
+  const TscCounter* counter_ = nullptr;
+};
+
+}  // namespace holoscan
+
+#endif /* HOLOSCAN_CORE_RESOURCES_GXF_TIMESTAMP_COUNTER_CLOCK_HPP */
@@ -0,0 +1,60 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_RESOURCES_GXF_TRACKING_ALLOCATOR_HPP
+#define HOLOSCAN_CORE_RESOURCES_GXF_TRACKING_ALLOCATOR_HPP
+
+#include <gxf/std/allocator.hpp>
+#include <gxf/std/parameter_parser_std.hpp>
+
+#include "./allocation_tracker.hpp"
+
+namespace holoscan {
+
+/**
+ * @brief GXF allocator recording the allocations made through another allocator.
+ *
+ * All the calls are forwarded to the wrapped allocator and recorded by an AllocationTracker
+ * (bytes in use, peak, allocation latency and current holders). The statistics are logged at
+ * DEBUG level when the component is deinitialized.
+ *
+ * Added in front of the holoscan::Allocator resources when the `HOLOSCAN_ALLOCATOR_STATS`
+ * environment variable is set to true.
+ */
+class TrackingAllocator : public nvidia::gxf::Allocator {
+ public:
+  TrackingAllocator() = default;
+
+  gxf_result_t registerInterface(nvidia::gxf::Registrar* registrar) override;
+  gxf_result_t deinitialize() override;
+
+  gxf_result_t is_available_abi(uint64_t size) override;
+  gxf_result_t allocate_abi(uint64_t size, int32_t type, void** pointer) override;
+  gxf_result_t free_abi(void* pointer) override;
+
+  /// @brief The statistics of the wrapped allocator.
+  AllocationStats stats() const { return tracker_.stats(); }
+
+  nvidia::gxf::Parameter<nvidia::gxf::Handle<nvidia::gxf::Allocator>> allocator_;
+
+ private:
+  AllocationTracker tracker_;
+};
+
+}  // namespace holoscan
+
+#endif /* HOLOSCAN_CORE_RESOURCES_GXF_TRACKING_ALLOCATOR_HPP */
@@ -0,0 +1,71 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_RESOURCES_GXF_TSC_CLOCK_HPP
+#define HOLOSCAN_CORE_RESOURCES_GXF_TSC_CLOCK_HPP
+
+#include <string>
+
+#include "./clock.hpp"
+
+namespace holoscan {
+
+// Forward declarations
+class TimestampCounterClock;
+
+/**
+ * @brief TSC clock class.
+ *
+ * Real-time clock reading its timestamps from the CPU cycle counter (the TSC on x86, the generic
+ * timer on aarch64), calibrated against CLOCK_MONOTONIC at startup. Reading the time does not
+ * involve a system call, which makes it suitable for fine-grained profiling. If the counter does
+ * not run at a constant rate, CLOCK_MONOTONIC is used instead (see `source()`).
+ *
+ * Timestamps are nanoseconds in the CLOCK_MONOTONIC time base. It can be used as the clock of a
+ * scheduler in place of RealtimeClock (without time scaling).
+ */
+class TscClock : public Clock {
+ public:
+  HOLOSCAN_RESOURCE_FORWARD_ARGS_SUPER(TscClock, Clock)
+  TscClock() = default;
+  TscClock(const std::string& name, TimestampCounterClock* component);
+
+  /// @brief The underlying GXF component's name.
+  const char* gxf_typename() const override { return "holoscan::TimestampCounterClock"; }
+
+  /// @brief The current time of the clock. Time is measured in seconds.
+  double time() const override;
+
+  /// @brief The current timestamp of the clock. Timestamps are measured in nanoseconds.
+  int64_t timestamp() const override;
+
+  /// @brief Waits until the given duration has elapsed on the clock
+  void sleep_for(int64_t duration_ns) override;
+
+  /// @brief Waits until the given target time
+  void sleep_until(int64_t target_time_ns) override;
+
+  /// @brief The source of the timestamps ("tsc", "cntvct" or "clock_monotonic").
+  std::string source() const;
+
+  /// @brief The calibrated counter frequency in Hz.
+  double frequency_hz() const;
+};
+
+}  // namespace holoscan
+
+#endif /* HOLOSCAN_CORE_RESOURCES_GXF_TSC_CLOCK_HPP */
@@ -0,0 +1,45 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_RESOURCES_GXF_UCX_COALESCING_RECEIVER_HPP
+#define HOLOSCAN_CORE_RESOURCES_GXF_UCX_COALESCING_RECEIVER_HPP
+
+#include <string>
+
+#include "holoscan/core/resources/gxf/ucx_receiver.hpp"
+
+namespace holoscan {
+
+/**
+ * @brief UCX receiver splitting the batches sent by a UcxCoalescingTransmitter.
+ *
+ * Each coalesced message is delivered to the operator as a separate message, in the order it was
+ * emitted.
+ */
+class UcxCoalescingReceiver : public UcxReceiver {
+ public:
+  HOLOSCAN_RESOURCE_FORWARD_ARGS_SUPER(UcxCoalescingReceiver, UcxReceiver)
+  UcxCoalescingReceiver() = default;
+  UcxCoalescingReceiver(const std::string& name, nvidia::gxf::Receiver* component)
+      : UcxReceiver(name, component) {}
+
+  const char* gxf_typename() const override { return "nvidia::gxf::UcxCoalescingReceiver"; }
+};
+
+}  // namespace holoscan
+
+#endif /* HOLOSCAN_CORE_RESOURCES_GXF_UCX_COALESCING_RECEIVER_HPP */
@@ -0,0 +1,69 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_RESOURCES_GXF_UCX_COALESCING_TRANSMITTER_HPP
+#define HOLOSCAN_CORE_RESOURCES_GXF_UCX_COALESCING_TRANSMITTER_HPP
+
+#include <string>
+
+#include "holoscan/core/resources/gxf/ucx_transmitter.hpp"
+
+namespace holoscan {
+
+/// Name of the connection argument enabling message coalescing for a UCX connection.
+constexpr const char* kUcxCoalescingWindowArgName = "coalescing_window_us";
+/// Default coalescing window (in microseconds) of UcxCoalescingTransmitter.
+constexpr int64_t kDefaultUcxCoalescingWindowUs = 50;
+/// Default maximum number of messages coalesced by UcxCoalescingTransmitter.
+constexpr uint64_t kDefaultUcxMaxBatchSize = 64;
+
+/**
+ * @brief UCX transmitter coalescing small messages.
+ *
+ * Messages that only carry holoscan::Message components (i.e., data emitted by value) are queued
+ * and sent as a single batch once `max_batch_size` messages are queued, or once the oldest queued
+ * message has waited for `coalescing_window_us` microseconds. The executor adds an entity that is
+ * scheduled at this deadline, so the messages are sent even if the operator does not call
+ * `compute()` again. Messages carrying tensors are sent right away, after the queued messages.
+ * The remaining messages are sent when the transmitter is deinitialized.
+ *
+ * Must be connected to a UcxCoalescingReceiver.
+ */
+class UcxCoalescingTransmitter : public UcxTransmitter {
+ public:
+  HOLOSCAN_RESOURCE_FORWARD_ARGS_SUPER(UcxCoalescingTransmitter, UcxTransmitter)
+  UcxCoalescingTransmitter() = default;
+  UcxCoalescingTransmitter(const std::string& name, nvidia::gxf::Transmitter* component);
+
+  const char* gxf_typename() const override { return "nvidia::gxf::UcxCoalescingTransmitter"; }
+
+  void setup(ComponentSpec& spec) override;
+
+  /// @brief The maximum time (in microseconds) a message is queued before being sent.
+  int64_t coalescing_window_us();
+
+  /// @brief The maximum number of messages sent as a single batch.
+  uint64_t max_batch_size();
+
+ private:
+  Parameter<int64_t> coalescing_window_us_;
+  Parameter<uint64_t> max_batch_size_;
+};
+
+}  // namespace holoscan
+
+#endif /* HOLOSCAN_CORE_RESOURCES_GXF_UCX_COALESCING_TRANSMITTER_HPP */
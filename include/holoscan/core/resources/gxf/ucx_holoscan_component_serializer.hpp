@@ -18,7 +18,9 @@
 #ifndef HOLOSCAN_CORE_RESOURCES_GXF_UCX_HOLOSCAN_COMPONENT_SERIALIZER_HPP
 #define HOLOSCAN_CORE_RESOURCES_GXF_UCX_HOLOSCAN_COMPONENT_SERIALIZER_HPP
 
+#include <cstdint>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "../../gxf/gxf_resource.hpp"
@@ -26,12 +28,27 @@
 
 namespace holoscan {
 
+/// Default number of recycled receive buffers per size (HOLOSCAN_UCX_RECEIVE_BUFFER_POOL_SIZE).
+constexpr uint64_t kDefaultUcxReceiveBufferPoolSize = 4;
+
 /**
  * @brief UCX-based Holoscan component serializer.
  *
  * Used by UcxEntitySerializer to serialize and deserialize Holoscan SDK classes
  * holoscan::Message and holoscan::Tensor (via holoscan::gxf::GXFTensor). See the
  * CodecRegistry class for adding serialization codecs for additional holoscan::Message types.
+ *
+ * Host tensors and message data can be compressed (see PayloadCompression). The default values of
+ * the compression parameters can be set with the environment variables HOLOSCAN_UCX_COMPRESSION
+ * ("none", "lz4" or "zstd"), HOLOSCAN_UCX_COMPRESSION_LEVEL and HOLOSCAN_UCX_COMPRESSION_MIN_SIZE.
+ * Compressed payloads are copied to the serialization buffer, so its size
+ * (HOLOSCAN_UCX_SERIALIZATION_BUFFER_SIZE) must be large enough for them. Payloads that don't fit
+ * are sent uncompressed. Compression is only enabled if HOLOSCAN_UCX_COMPRESSION selects an
+ * algorithm in every fragment of the application.
+ *
+ * If no allocator is provided, the received tensors are allocated through a RecyclingAllocator
+ * keeping up to HOLOSCAN_UCX_RECEIVE_BUFFER_POOL_SIZE (default: 4) released buffers of each size
+ * for the next messages. Setting it to 0 disables the recycling.
  */
 class UcxHoloscanComponentSerializer : public gxf::GXFResource {
  public:
@@ -48,6 +65,9 @@ class UcxHoloscanComponentSerializer : public gxf::GXFResource {
 
  private:
   Parameter<std::shared_ptr<holoscan::Allocator>> allocator_;
+  Parameter<std::string> compression_;
+  Parameter<int32_t> compression_level_;
+  Parameter<uint64_t> compression_min_size_;
 };
 
 }  // namespace holoscan
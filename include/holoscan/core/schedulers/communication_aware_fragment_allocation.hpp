@@ -0,0 +1,83 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_SCHEDULERS_COMMUNICATION_AWARE_FRAGMENT_ALLOCATION_HPP
+#define HOLOSCAN_CORE_SCHEDULERS_COMMUNICATION_AWARE_FRAGMENT_ALLOCATION_HPP
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "../fragment_scheduler.hpp"
+#include "./greedy_fragment_allocation.hpp"
+
+namespace holoscan {
+
+/**
+ * @brief Fragment allocation strategy minimizing the traffic between app workers.
+ *
+ * App workers with target fragments are handled as in GreedyFragmentAllocationStrategy. The other
+ * fragments are placed one at a time, starting with the fragments exchanging the most data with
+ * the already placed ones, on the app worker minimizing the bandwidth of their connections to
+ * other workers. Swaps and moves between workers are then applied while they reduce the traffic.
+ *
+ * A connection between two workers on the same host (same IP address in the app worker id) costs
+ * kSameHostCostFactor times a connection between hosts, as it can go through shared memory.
+ *
+ * Up to `max_fragments_per_worker` fragments can be co-located on an app worker without target
+ * fragments, in which case the sum of their CPU and memory requirements must fit in the worker's
+ * resources.
+ *
+ * The greedy schedule is used instead if it is not worse, so this strategy behaves like the
+ * greedy one when no connection requirement is given.
+ */
+class CommunicationAwareFragmentAllocationStrategy : public FragmentAllocationStrategy {
+ public:
+  /// Relative cost of a connection between two app workers on the same host
+  static constexpr double kSameHostCostFactor = 0.1;
+
+  explicit CommunicationAwareFragmentAllocationStrategy(uint32_t max_fragments_per_worker = 1);
+
+  void on_add_available_resource(const AvailableSystemResource& available_resource) override;
+  void on_add_resource_requirement(const SystemResourceRequirement& resource_requirement) override;
+  holoscan::expected<std::unordered_map<std::string, std::string>, std::string> schedule() override;
+
+  /**
+   * @brief Get the cost of the traffic between app workers for a schedule.
+   *
+   * @param schedule The mapping from fragment name to app worker id.
+   * @return The sum of the bandwidths (bytes per second) of the connections between fragments on
+   * different workers, weighted by kSameHostCostFactor for workers on the same host.
+   */
+  double communication_cost(const std::unordered_map<std::string, std::string>& schedule) const;
+
+  uint32_t max_fragments_per_worker() const { return max_fragments_per_worker_; }
+
+ private:
+  using Bandwidths = std::unordered_map<std::string, std::unordered_map<std::string, double>>;
+
+  /// Symmetric bandwidth between fragments
+  Bandwidths bandwidths() const;
+
+  uint32_t max_fragments_per_worker_ = 1;
+  GreedyFragmentAllocationStrategy greedy_strategy_;
+};
+
+}  // namespace holoscan
+
+#endif /* HOLOSCAN_CORE_SCHEDULERS_COMMUNICATION_AWARE_FRAGMENT_ALLOCATION_HPP */
@@ -74,6 +74,8 @@ class AppDriverServer {
 
   /// Map of worker addresses to worker clients.
   std::unordered_map<std::string, std::unique_ptr<AppWorkerClient>> worker_clients_;
+  /// Mutex for worker_clients_ (the driver queries workers from several threads).
+  mutable std::mutex worker_clients_mutex_;
 };
 
 }  // namespace holoscan::service
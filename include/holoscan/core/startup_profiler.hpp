@@ -0,0 +1,185 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_STARTUP_PROFILER_HPP
+#define HOLOSCAN_CORE_STARTUP_PROFILER_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace holoscan {
+
+/**
+ * @brief Class to record the duration of the startup phases of a fragment or of the app driver.
+ *
+ * Each fragment owns a startup profiler (see Fragment::startup_profiler()). The following phases
+ * are recorded:
+ *
+ * - `config`: parsing the YAML configuration.
+ * - `compose`: calling Fragment::compose().
+ * - `extension_loading`: loading the GXF extensions.
+ * - `initialize_gxf_graph`: creating the GXF entities of the graph (including the
+ *   `initialize_fragment` and `operator_initialize` phases).
+ * - `initialize_fragment`: initializing the operators and their connections.
+ * - `operator_initialize`: calling Operator::initialize() (one record per operator).
+ * - `activate_gxf_graph`: activating the GXF graph.
+ * - `operator_start`: calling Operator::start() (one record per native operator).
+ *
+ * The app driver of a distributed application owns another profiler recording the following
+ * phases (the component is the number of workers):
+ *
+ * - `schedule`: assigning the fragments to the workers.
+ * - `compose`: composing the fragments run by the driver.
+ * - `port_negotiation`: reserving the ports of the workers (overlapped with `compose`).
+ * - `launch`: sending the fragments to run to the workers.
+ *
+ * The records are always collected. If the `HOLOSCAN_STARTUP_PROFILE` environment variable is
+ * set to true, a breakdown is logged at INFO level once all the native operators are started (or
+ * when the graph execution ends).
+ */
+class StartupProfiler {
+ public:
+  static constexpr const char* kConfig = "config";
+  static constexpr const char* kCompose = "compose";
+  static constexpr const char* kExtensionLoading = "extension_loading";
+  static constexpr const char* kInitializeGXFGraph = "initialize_gxf_graph";
+  static constexpr const char* kInitializeFragment = "initialize_fragment";
+  static constexpr const char* kOperatorInitialize = "operator_initialize";
+  static constexpr const char* kActivateGXFGraph = "activate_gxf_graph";
+  static constexpr const char* kOperatorStart = "operator_start";
+  static constexpr const char* kSchedule = "schedule";
+  static constexpr const char* kPortNegotiation = "port_negotiation";
+  static constexpr const char* kLaunch = "launch";
+
+  using Clock = std::chrono::steady_clock;
+
+  /// Duration of a startup phase.
+  struct PhaseRecord {
+    std::string phase;         ///< The name of the phase.
+    std::string component;     ///< The operator name for per-operator phases, empty otherwise.
+    double duration_ms = 0.0;  ///< The duration of the phase in milliseconds.
+  };
+
+  /**
+   * @brief Helper class recording the duration of a phase from its construction to its
+   * destruction.
+   */
+  class ScopedPhase {
+   public:
+    ScopedPhase(StartupProfiler& profiler, const char* phase, std::string component = "");
+    ~ScopedPhase();
+
+    ScopedPhase(const ScopedPhase&) = delete;
+    ScopedPhase& operator=(const ScopedPhase&) = delete;
+
+   private:
+    StartupProfiler& profiler_;
+    const char* phase_;
+    std::string component_;
+    Clock::time_point start_;
+  };
+
+  /**
+   * @brief Construct a new StartupProfiler object.
+   *
+   * @param subject The kind of the profiled object ("fragment" or "driver"), used in the
+   * header of the breakdown.
+   */
+  explicit StartupProfiler(std::string subject = "fragment") : subject_(std::move(subject)) {}
+
+  /**
+   * @brief Whether the startup breakdown should be logged.
+   *
+   * @return true if the `HOLOSCAN_STARTUP_PROFILE` environment variable is set to true.
+   */
+  static bool is_report_enabled();
+
+  /**
+   * @brief Record the duration of a phase.
+   *
+   * This method is thread-safe.
+   *
+   * @param phase The name of the phase.
+   * @param duration_ms The duration of the phase in milliseconds.
+   * @param component The operator name for per-operator phases.
+   */
+  void record(const std::string& phase, double duration_ms, const std::string& component = "");
+
+  /**
+   * @brief Get the recorded phases, in the order they were recorded.
+   *
+   * @return The copy of the records.
+   */
+  std::vector<PhaseRecord> records() const;
+
+  /**
+   * @brief Get the total duration of a phase.
+   *
+   * @param phase The name of the phase.
+   * @return The sum of the durations of the records of the phase in milliseconds.
+   */
+  double total_duration_ms(const std::string& phase) const;
+
+  /**
+   * @brief Set the number of `operator_start` records to wait for before the startup is
+   * considered complete.
+   *
+   * @param count The number of operators started by the executor.
+   */
+  void expect_operator_starts(size_t count);
+
+  /**
+   * @brief Whether all the expected `operator_start` records are recorded.
+   */
+  bool is_startup_complete() const;
+
+  /**
+   * @brief Log the breakdown at INFO level if it is enabled (see is_report_enabled()).
+   *
+   * The breakdown is logged only once.
+   *
+   * @param name The name of the profiled fragment (or application for the driver).
+   */
+  void log_report(const std::string& name);
+
+  /**
+   * @brief Format the breakdown of the startup phases.
+   *
+   * @param name The name of the profiled fragment (or application for the driver).
+   * @return The breakdown with one line per record.
+   */
+  std::string report(const std::string& name) const;
+
+  /// Remove all the records.
+  void clear();
+
+ private:
+  std::string subject_;
+  mutable std::mutex mutex_;
+  std::vector<PhaseRecord> records_;
+  size_t expected_operator_starts_ = 0;
+  size_t operator_starts_ = 0;
+  bool is_reported_ = false;
+};
+
+}  // namespace holoscan
+
+#endif /* HOLOSCAN_CORE_STARTUP_PROFILER_HPP */
@@ -0,0 +1,36 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_SYSTEM_ENV_UTILS_HPP
+#define HOLOSCAN_CORE_SYSTEM_ENV_UTILS_HPP
+
+namespace holoscan {
+
+/**
+ * @brief Retrieve a boolean value from an environment variable.
+ *
+ * "true", "1" and "on" are true, "false", "0" and "off" are false (case-insensitive).
+ *
+ * @param name The name of the environment variable.
+ * @param default_value The value returned if the variable is not set or not a boolean.
+ * @return The value of the environment variable.
+ */
+bool get_bool_env_var(const char* name, bool default_value = false);
+
+}  // namespace holoscan
+
+#endif /* HOLOSCAN_CORE_SYSTEM_ENV_UTILS_HPP */
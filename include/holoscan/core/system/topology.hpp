@@ -18,7 +18,9 @@
 #ifndef HOLOSCAN_CORE_SYSTEM_TOPOLOGY_HPP
 #define HOLOSCAN_CORE_SYSTEM_TOPOLOGY_HPP
 
+#include <cstddef>
 #include <memory>
+#include <vector>
 
 namespace holoscan {
 
@@ -47,6 +49,65 @@ class Topology {
    */
   void* context() const;
 
+  /**
+   * @brief Get the NUMA nodes of the system
+   *
+   * The topology must be loaded.
+   *
+   * @return The OS indices of the NUMA nodes
+   */
+  std::vector<int> numa_nodes() const;
+
+  /**
+   * @brief Get the NUMA node of each CPU
+   *
+   * The topology must be loaded.
+   *
+   * @return The OS index of the NUMA node of each CPU (indexed by the OS index of the CPU, -1 if
+   * the CPU has no NUMA node)
+   */
+  std::vector<int> numa_node_by_cpu() const;
+
+  /**
+   * @brief Get the NUMA node of the CPU the calling thread is running on
+   *
+   * The topology must be loaded.
+   *
+   * @return The OS index of the NUMA node, or -1 if it is unknown
+   */
+  int current_numa_node() const;
+
+  /**
+   * @brief Allocate memory bound to a NUMA node
+   *
+   * The pages are allocated on the node when they are first touched. The topology must be
+   * loaded.
+   *
+   * @param size The size of the allocation in bytes
+   * @param numa_node The OS index of the NUMA node
+   * @return The page-aligned allocation, or nullptr if the node doesn't exist or the allocation
+   * failed
+   */
+  void* allocate_on_numa_node(size_t size, int numa_node) const;
+
+  /**
+   * @brief Allocate memory not bound to a NUMA node
+   *
+   * The pages are placed by the default memory policy of the operating system.
+   *
+   * @param size The size of the allocation in bytes
+   * @return The page-aligned allocation, or nullptr if the allocation failed
+   */
+  void* allocate_memory(size_t size) const;
+
+  /**
+   * @brief Free memory allocated by allocate_on_numa_node() or allocate_memory()
+   *
+   * @param pointer The allocation
+   * @param size The size of the allocation in bytes
+   */
+  void free_memory(void* pointer, size_t size) const;
+
  protected:
   void* context_ = nullptr;  ///< The pointer to the topology object
 };
@@ -0,0 +1,122 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_SYSTEM_TSC_COUNTER_HPP
+#define HOLOSCAN_CORE_SYSTEM_TSC_COUNTER_HPP
+
+#include <time.h>
+
+#include <chrono>
+#include <cstdint>
+
+namespace holoscan {
+
+/**
+ * @brief Cheap monotonic timestamps read from the CPU cycle counter.
+ *
+ * On x86 the time stamp counter (TSC) is used if it is invariant (constant rate across frequency
+ * and power state changes, as reported by CPUID) and the kernel still trusts it as a clock source.
+ * On aarch64 the generic timer virtual counter (CNTVCT_EL0), which runs at a constant rate by
+ * definition, is used. Otherwise `clock_gettime(CLOCK_MONOTONIC)` is used.
+ *
+ * The counter frequency is calibrated against CLOCK_MONOTONIC when the object is constructed, so
+ * that now_ns() returns nanoseconds in the CLOCK_MONOTONIC time base (up to the calibration drift)
+ * without a system call. instance() returns a process-wide counter calibrated on first use.
+ */
+class TscCounter {
+ public:
+  /// The source of the timestamps.
+  enum class Source {
+    kTsc,        ///< x86 time stamp counter (RDTSC).
+    kCntvct,     ///< aarch64 generic timer virtual counter.
+    kMonotonic,  ///< clock_gettime(CLOCK_MONOTONIC) (fallback).
+  };
+
+  static constexpr std::chrono::nanoseconds kDefaultCalibrationPeriod =
+      std::chrono::milliseconds(20);
+
+  /**
+   * @brief Construct and calibrate a counter.
+   *
+   * @param calibration_period The time spent measuring the counter frequency.
+   * @param allow_counter If false, always use the CLOCK_MONOTONIC fallback.
+   */
+  explicit TscCounter(std::chrono::nanoseconds calibration_period = kDefaultCalibrationPeriod,
+                      bool allow_counter = true);
+
+  /// @brief The process-wide counter (calibrated on first use).
+  static const TscCounter& instance();
+
+  /**
+   * @brief Whether the CPU cycle counter can be used as a clock.
+   *
+   * @return true if the counter runs at a constant rate and is not marked unstable by the kernel.
+   */
+  static bool has_invariant_counter();
+
+  /**
+   * @brief Whether the message flow tracking timestamps are read from instance().
+   *
+   * @return true if the `HOLOSCAN_TSC_TIMESTAMPS` environment variable is set to true.
+   */
+  static bool is_timestamp_source_enabled();
+
+  Source source() const { return source_; }
+
+  /// @brief The name of the source ("tsc", "cntvct" or "clock_monotonic").
+  const char* source_name() const;
+
+  /// @brief The calibrated counter frequency in Hz (1e9 for the CLOCK_MONOTONIC fallback).
+  double frequency_hz() const { return frequency_hz_; }
+
+  /// @brief The current time in nanoseconds in the CLOCK_MONOTONIC time base.
+  int64_t now_ns() const;
+
+  /// @brief The current time in nanoseconds since the epoch (CLOCK_REALTIME at calibration).
+  int64_t epoch_ns() const { return now_ns() + epoch_offset_ns_; }
+
+  /// @brief The raw counter value (nanoseconds for the CLOCK_MONOTONIC fallback).
+  uint64_t ticks() const;
+
+  /// @brief Convert a raw counter value to nanoseconds in the CLOCK_MONOTONIC time base.
+  int64_t ticks_to_ns(uint64_t ticks) const;
+
+  static int64_t monotonic_ns() {
+    timespec ts{};
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<int64_t>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+  }
+
+ private:
+  static constexpr int kFixedPointShift = 32;
+
+  /// Read the CPU cycle counter (CLOCK_MONOTONIC if there is none).
+  static uint64_t read_counter();
+
+  void calibrate(std::chrono::nanoseconds calibration_period);
+
+  Source source_ = Source::kMonotonic;
+  double frequency_hz_ = 1e9;
+  uint64_t base_ticks_ = 0;
+  int64_t base_ns_ = 0;
+  int64_t ns_per_tick_fixed_ = int64_t{1} << kFixedPointShift;  ///< 32.32 fixed point
+  int64_t epoch_offset_ns_ = 0;
+};
+
+}  // namespace holoscan
+
+#endif /* HOLOSCAN_CORE_SYSTEM_TSC_COUNTER_HPP */
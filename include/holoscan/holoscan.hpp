@@ -35,6 +35,7 @@
 #include "./core/operator.hpp"
 #include "./core/resource.hpp"
 #include "./core/scheduler.hpp"
+#include "./core/startup_profiler.hpp"
 
 // Domain objects
 #include "./core/gxf/entity.hpp"
@@ -44,6 +45,7 @@
 #include "./core/conditions/gxf/boolean.hpp"
 #include "./core/conditions/gxf/count.hpp"
 #include "./core/conditions/gxf/downstream_affordable.hpp"
+#include "./core/conditions/gxf/memory_available.hpp"
 #include "./core/conditions/gxf/periodic.hpp"
 #include "./core/conditions/gxf/message_available.hpp"
 
@@ -53,14 +55,28 @@
 // Resources
 #include "./core/resources/gxf/clock.hpp"
 #include "./core/resources/gxf/block_memory_pool.hpp"
+#include "./core/resources/gxf/blocking_allocator.hpp"
+#include "./core/resources/gxf/conflating_receiver.hpp"
 #include "./core/resources/gxf/manual_clock.hpp"
 #include "./core/resources/gxf/double_buffer_receiver.hpp"
 #include "./core/resources/gxf/double_buffer_transmitter.hpp"
+#include "./core/resources/gxf/huge_page_memory_pool.hpp"
+#include "./core/resources/gxf/multi_subscriber_transmitter.hpp"
+#include "./core/resources/gxf/numa_allocator.hpp"
 #include "./core/resources/gxf/realtime_clock.hpp"
+#include "./core/resources/gxf/recycling_allocator.hpp"
+#include "./core/resources/gxf/ring_buffer_receiver.hpp"
+#include "./core/resources/gxf/ring_buffer_transmitter.hpp"
 #include "./core/resources/gxf/cuda_stream_pool.hpp"
 #include "./core/resources/gxf/serialization_buffer.hpp"
+#include "./core/resources/gxf/shared_memory_receiver.hpp"
+#include "./core/resources/gxf/shared_memory_transmitter.hpp"
+#include "./core/resources/gxf/slab_memory_pool.hpp"
 #include "./core/resources/gxf/std_component_serializer.hpp"
+#include "./core/resources/gxf/tsc_clock.hpp"
 #include "./core/resources/gxf/unbounded_allocator.hpp"
+#include "./core/resources/gxf/ucx_coalescing_receiver.hpp"
+#include "./core/resources/gxf/ucx_coalescing_transmitter.hpp"
 #include "./core/resources/gxf/ucx_component_serializer.hpp"
 #include "./core/resources/gxf/ucx_entity_serializer.hpp"
 #include "./core/resources/gxf/ucx_holoscan_component_serializer.hpp"
@@ -17,6 +17,7 @@
 
 #include <array>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "./holoviz.hpp"
@@ -35,24 +36,24 @@ struct codec<ops::HolovizOp::InputSpec::View> {
                                                   Endpoint* endpoint) {
     size_t total_size = 0;
     auto maybe_size = serialize_trivial_type<float>(view.offset_x_, endpoint);
-    if (!maybe_size) { forward_error(maybe_size); }
+    if (!maybe_size) { return forward_error(maybe_size); }
     total_size += maybe_size.value();
 
     maybe_size = serialize_trivial_type<float>(view.offset_y_, endpoint);
-    if (!maybe_size) { forward_error(maybe_size); }
+    if (!maybe_size) { return forward_error(maybe_size); }
     total_size += maybe_size.value();
 
     maybe_size = serialize_trivial_type<float>(view.width_, endpoint);
-    if (!maybe_size) { forward_error(maybe_size); }
+    if (!maybe_size) { return forward_error(maybe_size); }
     total_size += maybe_size.value();
 
     maybe_size = serialize_trivial_type<float>(view.height_, endpoint);
-    if (!maybe_size) { forward_error(maybe_size); }
+    if (!maybe_size) { return forward_error(maybe_size); }
     total_size += maybe_size.value();
 
     bool has_matrix = view.matrix_.has_value();
     maybe_size = serialize_trivial_type<bool>(has_matrix, endpoint);
-    if (!maybe_size) { forward_error(maybe_size); }
+    if (!maybe_size) { return forward_error(maybe_size); }
     total_size += maybe_size.value();
 
     if (has_matrix) {
@@ -74,23 +75,23 @@ struct codec<ops::HolovizOp::InputSpec::View> {
   static expected<ops::HolovizOp::InputSpec::View, RuntimeError> deserialize(Endpoint* endpoint) {
     ops::HolovizOp::InputSpec::View out;
     auto offset_x = deserialize_trivial_type<float>(endpoint);
-    if (!offset_x) { forward_error(offset_x); }
+    if (!offset_x) { return forward_error(offset_x); }
     out.offset_x_ = offset_x.value();
 
     auto offset_y = deserialize_trivial_type<float>(endpoint);
-    if (!offset_y) { forward_error(offset_y); }
+    if (!offset_y) { return forward_error(offset_y); }
     out.offset_y_ = offset_y.value();
 
     auto width = deserialize_trivial_type<float>(endpoint);
-    if (!width) { forward_error(width); }
+    if (!width) { return forward_error(width); }
     out.width_ = width.value();
 
     auto height = deserialize_trivial_type<float>(endpoint);
-    if (!height) { forward_error(height); }
+    if (!height) { return forward_error(height); }
     out.height_ = height.value();
 
     auto maybe_has_matrix = deserialize_trivial_type<bool>(endpoint);
-    if (!maybe_has_matrix) { forward_error(maybe_has_matrix); }
+    if (!maybe_has_matrix) { return forward_error(maybe_has_matrix); }
     bool has_matrix = maybe_has_matrix.value();
 
     if (has_matrix) {
@@ -140,7 +141,7 @@ struct codec<std::vector<ops::HolovizOp::InputSpec::View>> {
     for (size_t i = 0; i < num_views; i++) {
       auto view = codec<ops::HolovizOp::InputSpec::View>::deserialize(endpoint);
       if (!view) { return forward_error(view); }
-      data.push_back(view.value());
+      data.push_back(std::move(view.value()));
     }
     return data;
   }
@@ -154,45 +155,45 @@ struct codec<ops::HolovizOp::InputSpec> {
                                                   Endpoint* endpoint) {
     size_t total_size = 0;
     auto maybe_size = codec<std::string>::serialize(spec.tensor_name_, endpoint);
-    if (!maybe_size) { forward_error(maybe_size); }
+    if (!maybe_size) { return forward_error(maybe_size); }
     total_size += maybe_size.value();
 
     maybe_size = serialize_trivial_type<ops::HolovizOp::InputType>(spec.type_, endpoint);
-    if (!maybe_size) { forward_error(maybe_size); }
+    if (!maybe_size) { return forward_error(maybe_size); }
     total_size += maybe_size.value();
 
     maybe_size = serialize_trivial_type<float>(spec.opacity_, endpoint);
-    if (!maybe_size) { forward_error(maybe_size); }
+    if (!maybe_size) { return forward_error(maybe_size); }
     total_size += maybe_size.value();
 
     maybe_size = serialize_trivial_type<int32_t>(spec.priority_, endpoint);
-    if (!maybe_size) { forward_error(maybe_size); }
+    if (!maybe_size) { return forward_error(maybe_size); }
     total_size += maybe_size.value();
 
     maybe_size = codec<std::vector<float>>::serialize(spec.color_, endpoint);
-    if (!maybe_size) { forward_error(maybe_size); }
+    if (!maybe_size) { return forward_error(maybe_size); }
     total_size += maybe_size.value();
 
     maybe_size = serialize_trivial_type<float>(spec.line_width_, endpoint);
-    if (!maybe_size) { forward_error(maybe_size); }
+    if (!maybe_size) { return forward_error(maybe_size); }
     total_size += maybe_size.value();
 
     maybe_size = serialize_trivial_type<float>(spec.point_size_, endpoint);
-    if (!maybe_size) { forward_error(maybe_size); }
+    if (!maybe_size) { return forward_error(maybe_size); }
     total_size += maybe_size.value();
 
     maybe_size = codec<std::vector<std::string>>::serialize(spec.text_, endpoint);
-    if (!maybe_size) { forward_error(maybe_size); }
+    if (!maybe_size) { return forward_error(maybe_size); }
     total_size += maybe_size.value();
 
     maybe_size = serialize_trivial_type<ops::HolovizOp::DepthMapRenderMode>(
         spec.depth_map_render_mode_, endpoint);
-    if (!maybe_size) { forward_error(maybe_size); }
+    if (!maybe_size) { return forward_error(maybe_size); }
     total_size += maybe_size.value();
 
     maybe_size =
         codec<std::vector<ops::HolovizOp::InputSpec::View>>::serialize(spec.views_, endpoint);
-    if (!maybe_size) { forward_error(maybe_size); }
+    if (!maybe_size) { return forward_error(maybe_size); }
     total_size += maybe_size.value();
 
     return total_size;
@@ -201,45 +202,45 @@ struct codec<ops::HolovizOp::InputSpec> {
     ops::HolovizOp::InputSpec out;
 
     auto tensor_name = codec<std::string>::deserialize(endpoint);
-    if (!tensor_name) { forward_error(tensor_name); }
-    out.tensor_name_ = tensor_name.value();
+    if (!tensor_name) { return forward_error(tensor_name); }
+    out.tensor_name_ = std::move(tensor_name.value());
 
     auto type = deserialize_trivial_type<ops::HolovizOp::InputType>(endpoint);
-    if (!type) { forward_error(type); }
+    if (!type) { return forward_error(type); }
     out.type_ = type.value();
 
     auto opacity = deserialize_trivial_type<float>(endpoint);
-    if (!opacity) { forward_error(opacity); }
+    if (!opacity) { return forward_error(opacity); }
     out.opacity_ = opacity.value();
 
     auto priority = deserialize_trivial_type<int32_t>(endpoint);
-    if (!priority) { forward_error(priority); }
+    if (!priority) { return forward_error(priority); }
     out.priority_ = priority.value();
 
     auto color = codec<std::vector<float>>::deserialize(endpoint);
-    if (!color) { forward_error(color); }
-    out.color_ = color.value();
+    if (!color) { return forward_error(color); }
+    out.color_ = std::move(color.value());
 
     auto line_width = deserialize_trivial_type<float>(endpoint);
-    if (!line_width) { forward_error(line_width); }
+    if (!line_width) { return forward_error(line_width); }
     out.line_width_ = line_width.value();
 
     auto point_size = deserialize_trivial_type<float>(endpoint);
-    if (!point_size) { forward_error(point_size); }
+    if (!point_size) { return forward_error(point_size); }
     out.point_size_ = point_size.value();
 
     auto text = codec<std::vector<std::string>>::deserialize(endpoint);
-    if (!text) { forward_error(text); }
-    out.text_ = text.value();
+    if (!text) { return forward_error(text); }
+    out.text_ = std::move(text.value());
 
     auto depth_map_render_mode =
         deserialize_trivial_type<ops::HolovizOp::DepthMapRenderMode>(endpoint);
-    if (!depth_map_render_mode) { forward_error(depth_map_render_mode); }
+    if (!depth_map_render_mode) { return forward_error(depth_map_render_mode); }
     out.depth_map_render_mode_ = depth_map_render_mode.value();
 
     auto views = codec<std::vector<ops::HolovizOp::InputSpec::View>>::deserialize(endpoint);
-    if (!views) { forward_error(views); }
-    out.views_ = views.value();
+    if (!views) { return forward_error(views); }
+    out.views_ = std::move(views.value());
 
     return out;
   }
@@ -278,7 +279,7 @@ struct codec<std::vector<ops::HolovizOp::InputSpec>> {
     for (size_t i = 0; i < num_specs; i++) {
       auto spec = codec<ops::HolovizOp::InputSpec>::deserialize(endpoint);
       if (!spec) { return forward_error(spec); }
-      data.push_back(spec.value());
+      data.push_back(std::move(spec.value()));
     }
     return data;
   }
@@ -19,6 +19,7 @@
     holoscan.conditions.BooleanCondition
     holoscan.conditions.CountCondition
     holoscan.conditions.DownstreamMessageAffordableCondition
+    holoscan.conditions.MemoryAvailableCondition
     holoscan.conditions.MessageAvailableCondition
     holoscan.conditions.PeriodicCondition
 """
@@ -27,6 +28,7 @@ from ._conditions import (
     BooleanCondition,
     CountCondition,
     DownstreamMessageAffordableCondition,
+    MemoryAvailableCondition,
     MessageAvailableCondition,
     PeriodicCondition,
 )
@@ -35,6 +37,7 @@ __all__ = [
     "BooleanCondition",
     "CountCondition",
     "DownstreamMessageAffordableCondition",
+    "MemoryAvailableCondition",
     "MessageAvailableCondition",
     "PeriodicCondition",
 ]
@@ -28,10 +28,12 @@
 #include "holoscan/core/conditions/gxf/boolean.hpp"
 #include "holoscan/core/conditions/gxf/count.hpp"
 #include "holoscan/core/conditions/gxf/downstream_affordable.hpp"
+#include "holoscan/core/conditions/gxf/memory_available.hpp"
 #include "holoscan/core/conditions/gxf/message_available.hpp"
 #include "holoscan/core/conditions/gxf/periodic.hpp"
 #include "holoscan/core/fragment.hpp"
 #include "holoscan/core/gxf/gxf_resource.hpp"
+#include "holoscan/core/resources/gxf/allocator.hpp"
 
 using std::string_literals::operator""s;
 using pybind11::literals::operator""_a;
@@ -105,6 +107,25 @@ class PyDownstreamMessageAffordableCondition : public DownstreamMessageAffordabl
   }
 };
 
+class PyMemoryAvailableCondition : public MemoryAvailableCondition {
+ public:
+  /* Inherit the constructors */
+  using MemoryAvailableCondition::MemoryAvailableCondition;
+
+  // Define a constructor that fully initializes the object.
+  PyMemoryAvailableCondition(Fragment* fragment, std::shared_ptr<Allocator> allocator,
+                             uint64_t min_bytes = 1UL, int64_t poll_period_ns = 1'000'000L,
+                             const std::string& name = "noname_memory_available_condition")
+      : MemoryAvailableCondition(ArgList{Arg{"allocator", allocator},
+                                         Arg{"min_bytes", min_bytes},
+                                         Arg{"poll_period_ns", poll_period_ns}}) {
+    name_ = name;
+    fragment_ = fragment;
+    spec_ = std::make_shared<ComponentSpec>(fragment);
+    setup(*spec_.get());
+  }
+};
+
 class PyMessageAvailableCondition : public MessageAvailableCondition {
  public:
   /* Inherit the constructors */
@@ -270,6 +291,43 @@ PYBIND11_MODULE(_conditions, m) {
                         &DownstreamMessageAffordableCondition::transmitter),
                     doc::DownstreamMessageAffordableCondition::doc_transmitter);
 
+  py::class_<MemoryAvailableCondition,
+             PyMemoryAvailableCondition,
+             gxf::GXFCondition,
+             std::shared_ptr<MemoryAvailableCondition>>(
+      m, "MemoryAvailableCondition", doc::MemoryAvailableCondition::doc_MemoryAvailableCondition)
+      .def(py::init<Fragment*,
+                    std::shared_ptr<Allocator>,
+                    uint64_t,
+                    int64_t,
+                    const std::string&>(),
+           "fragment"_a,
+           "allocator"_a,
+           "min_bytes"_a = 1UL,
+           "poll_period_ns"_a = 1'000'000L,
+           "name"_a = "noname_memory_available_condition"s,
+           doc::MemoryAvailableCondition::doc_MemoryAvailableCondition_python)
+      .def_property_readonly("gxf_typename",
+                             &MemoryAvailableCondition::gxf_typename,
+                             doc::MemoryAvailableCondition::doc_gxf_typename)
+      .def("setup",
+           &MemoryAvailableCondition::setup,
+           "spec"_a,
+           doc::MemoryAvailableCondition::doc_setup)
+      .def_property("min_bytes",
+                    py::overload_cast<>(&MemoryAvailableCondition::min_bytes),
+                    py::overload_cast<uint64_t>(&MemoryAvailableCondition::min_bytes),
+                    doc::MemoryAvailableCondition::doc_min_bytes)
+      .def_property("poll_period_ns",
+                    py::overload_cast<>(&MemoryAvailableCondition::poll_period_ns),
+                    py::overload_cast<int64_t>(&MemoryAvailableCondition::poll_period_ns),
+                    doc::MemoryAvailableCondition::doc_poll_period_ns)
+      .def_property("allocator",
+                    py::overload_cast<>(&MemoryAvailableCondition::allocator),
+                    py::overload_cast<std::shared_ptr<Allocator>>(
+                        &MemoryAvailableCondition::allocator),
+                    doc::MemoryAvailableCondition::doc_allocator);
+
   py::class_<MessageAvailableCondition,
              PyMessageAvailableCondition,
              gxf::GXFCondition,
@@ -178,6 +178,65 @@ time, and uses a light-weight initialization.
 
 }  // namespace DownstreamMessageAffordableCondition
 
+namespace MemoryAvailableCondition {
+
+PYDOC(MemoryAvailableCondition, R"doc(
+Condition that permits execution when an allocator can provide a buffer.
+)doc")
+
+// PyMemoryAvailableCondition Constructor
+PYDOC(MemoryAvailableCondition_python, R"doc(
+Condition that permits execution when an allocator can provide a buffer.
+
+Use it on a producer with the allocator its output buffers are drawn from (e.g., a
+``BlockMemoryPool``): the producer is not scheduled while the pool is exhausted.
+
+Parameters
+----------
+fragment : holoscan.core.Fragment
+    The fragment the condition will be associated with
+allocator : holoscan.resources.Allocator
+    The allocator whose free memory is checked.
+min_bytes : int
+    The size in bytes of the allocation which must be possible.
+poll_period_ns : int, optional
+    The period in nanoseconds after which an exhausted allocator is checked again.
+name : str, optional
+    The name of the condition.
+)doc")
+
+PYDOC(gxf_typename, R"doc(
+The GXF type name of the condition.
+
+Returns
+-------
+str
+    The GXF type name of the condition
+)doc")
+
+PYDOC(setup, R"doc(
+Define the component specification.
+
+Parameters
+----------
+spec : holoscan.core.ComponentSpec
+    Component specification associated with the condition.
+)doc")
+
+PYDOC(allocator, R"doc(
+The allocator associated with the condition.
+)doc")
+
+PYDOC(min_bytes, R"doc(
+The size in bytes of the allocation which must be possible.
+)doc")
+
+PYDOC(poll_period_ns, R"doc(
+The period in nanoseconds after which an exhausted allocator is checked again.
+)doc")
+
+}  // namespace MemoryAvailableCondition
+
 namespace MessageAvailableCondition {
 
 PYDOC(MessageAvailableCondition, R"doc(
@@ -68,43 +68,101 @@ namespace py = pybind11;
 
 namespace holoscan {
 
+/// Header of a serialized PyPickledObject
+struct PyPickledObjectHeader {
+  uint8_t kind;           // PyPickledObject::Kind
+  uint32_t num_segments;  // number of segments (their sizes follow the shape)
+  uint32_t format_size;   // size of the memoryview format (follows the header)
+  uint32_t ndim;          // number of memoryview dimensions (follow the format)
+};
+
 template <>
-struct codec<std::shared_ptr<GILGuardedPyObject>> {
-  static expected<size_t, RuntimeError> serialize(std::shared_ptr<GILGuardedPyObject> value,
+struct codec<std::shared_ptr<PyPickledObject>> {
+  // Only the segments are accessed, so the GIL is not needed.
+  static expected<size_t, RuntimeError> serialize(std::shared_ptr<PyPickledObject> value,
                                                   Endpoint* endpoint) {
-    std::string obj_str;
-    {
-      // py::gil_scoped_acquire scope_guard;
-
-      py::module_ cloudpickle = py::module_::import("cloudpickle");
-      py::object obj = value->obj();  // get the py::object stored in GILGuardedPyObject
-      py::bytes serialized = cloudpickle.attr("dumps")(obj);
-      obj_str = serialized.cast<std::string>();
+    PyPickledObjectHeader header;
+    header.kind = static_cast<uint8_t>(value->kind);
+    header.num_segments = static_cast<uint32_t>(value->segments.size());
+    header.format_size = static_cast<uint32_t>(value->format.size());
+    header.ndim = static_cast<uint32_t>(value->shape.size());
+    auto maybe_size = endpoint->write_trivial_type<PyPickledObjectHeader>(&header);
+    if (!maybe_size) { return forward_error(maybe_size); }
+    size_t total_size = maybe_size.value();
+
+    if (!value->format.empty()) {
+      maybe_size = endpoint->write(value->format.data(), value->format.size());
+      if (!maybe_size) { return forward_error(maybe_size); }
+      total_size += maybe_size.value();
+    }
+    if (!value->shape.empty()) {
+      maybe_size = endpoint->write(value->shape.data(), value->shape.size() * sizeof(int64_t));
+      if (!maybe_size) { return forward_error(maybe_size); }
+      total_size += maybe_size.value();
     }
-    return codec<std::string>::serialize(obj_str, endpoint);
+    std::vector<uint64_t> sizes;
+    sizes.reserve(value->segments.size());
+    for (const auto& segment : value->segments) { sizes.push_back(segment.size); }
+    maybe_size = endpoint->write(sizes.data(), sizes.size() * sizeof(uint64_t));
+    if (!maybe_size) { return forward_error(maybe_size); }
+    total_size += maybe_size.value();
+
+    // The segments stay valid until the message is sent: the emitted value owns them.
+    for (const auto& segment : value->segments) {
+      maybe_size = endpoint->write_borrowed(segment.data, segment.size);
+      if (!maybe_size) { return forward_error(maybe_size); }
+      total_size += maybe_size.value();
+    }
+    return total_size;
   }
-  static expected<std::shared_ptr<GILGuardedPyObject>, RuntimeError> deserialize(
-      Endpoint* endpoint) {
-    auto maybe_str = codec<std::string>::deserialize(endpoint);
-    if (!maybe_str) { return forward_error(maybe_str); }
-    std::string obj_str = maybe_str.value();
-    // py::gil_scoped_acquire scope_guard;
 
-    py::bytes bytes = py::bytes(obj_str);
+  static expected<std::shared_ptr<PyPickledObject>, RuntimeError> deserialize(
+      Endpoint* endpoint) {
+    PyPickledObjectHeader header;
+    auto maybe_size = endpoint->read_trivial_type<PyPickledObjectHeader>(&header);
+    if (!maybe_size) { return forward_error(maybe_size); }
+    if (header.kind > static_cast<uint8_t>(PyPickledObject::Kind::kMemoryView) ||
+        header.num_segments == 0) {
+      return make_unexpected<RuntimeError>(
+          RuntimeError(ErrorCode::kCodecError, "Invalid serialized Python object"));
+    }
 
-    py::module_ cloudpickle = py::module_::import("cloudpickle");
-    py::object obj = cloudpickle.attr("loads")(bytes);
-    return std::make_shared<GILGuardedPyObject>(obj);
+    auto value = std::make_shared<PyPickledObject>();
+    value->kind = static_cast<PyPickledObject::Kind>(header.kind);
+    value->format.resize(header.format_size);
+    value->shape.resize(header.ndim);
+    std::vector<uint64_t> sizes(header.num_segments);
+    if (header.format_size > 0) {
+      maybe_size = endpoint->read(value->format.data(), value->format.size());
+      if (!maybe_size) { return forward_error(maybe_size); }
+    }
+    if (header.ndim > 0) {
+      maybe_size = endpoint->read(value->shape.data(), value->shape.size() * sizeof(int64_t));
+      if (!maybe_size) { return forward_error(maybe_size); }
+    }
+    maybe_size = endpoint->read(sizes.data(), sizes.size() * sizeof(uint64_t));
+    if (!maybe_size) { return forward_error(maybe_size); }
+
+    // Large segments are filled in place once the whole message is deserialized.
+    value->storage.reserve(sizes.size());
+    value->segments.reserve(sizes.size());
+    for (uint64_t size : sizes) {
+      auto buffer = std::make_shared<std::vector<uint8_t>>(size);
+      maybe_size = endpoint->read_borrowed(buffer->data(), size);
+      if (!maybe_size) { return forward_error(maybe_size); }
+      value->segments.push_back({buffer->data(), buffer->size()});
+      value->storage.push_back(std::move(buffer));
+    }
+    return value;
   }
 };
 
 static void register_py_object_codec() {
   auto& codec_registry = CodecRegistry::get_instance();
-  // TODO: This codec does not work (program hangs)
-  //     Instead, I modified py_emit / py_receive to do the serialization when
-  //     emitting on a UCX port.
-  // codec_registry.add_codec<std::shared_ptr<GILGuardedPyObject>>(
-  //     "std::shared_ptr<GILGuardedPyObject>"s);
+  // Python objects sent to other fragments are serialized by PyOutputContext::py_emit() (with the
+  // GIL held), so the codec is registered for the serialized form only.
+  codec_registry.add_codec<std::shared_ptr<PyPickledObject>>(
+      "std::shared_ptr<holoscan::PyPickledObject>"s);
 }
 
 template <typename typeT>
@@ -443,7 +501,10 @@ PYBIND11_MODULE(_core, m) {
   py::enum_<IOSpec::ConnectorType>(iospec, "ConnectorType", doc::ConnectorType::doc_ConnectorType)
       .value("DEFAULT", IOSpec::ConnectorType::kDefault)
       .value("DOUBLE_BUFFER", IOSpec::ConnectorType::kDoubleBuffer)
-      .value("UCX", IOSpec::ConnectorType::kUCX);
+      .value("UCX", IOSpec::ConnectorType::kUCX)
+      .value("RING_BUFFER", IOSpec::ConnectorType::kRingBuffer)
+      .value("CONFLATING", IOSpec::ConnectorType::kConflating)
+      .value("SHARED_MEMORY", IOSpec::ConnectorType::kSharedMemory);
 
   iospec
       .def(py::init<OperatorSpec*, const std::string&, IOSpec::IOType>(),
@@ -550,6 +611,17 @@ PYBIND11_MODULE(_core, m) {
       m, "PyOutputContext", R"doc(Output context class.)doc")
       .def("emit", &PyOutputContext::py_emit);
 
+  // Buffer received from another fragment (out-of-band pickle buffers, memoryviews)
+  py::class_<PyReceivedBuffer>(m, "_ReceivedBuffer", py::buffer_protocol())
+      .def_buffer([](PyReceivedBuffer& buffer) {
+        return py::buffer_info(buffer.data->data(),
+                               sizeof(uint8_t),
+                               py::format_descriptor<uint8_t>::format(),
+                               1,
+                               {buffer.data->size()},
+                               {sizeof(uint8_t)});
+      });
+
   py::class_<PyExecutionContext, ExecutionContext, std::shared_ptr<PyExecutionContext>>(
       m, "PyExecutionContext", R"doc(Execution context class.)doc")
       .def_property_readonly("input", &PyExecutionContext::py_input)
@@ -692,6 +764,24 @@ PYBIND11_MODULE(_core, m) {
           "downstream_op"_a,
           "port_pairs"_a,
           doc::Fragment::doc_add_flow_pair)
+      .def(
+          "add_flow",
+          [](Fragment& self,
+             const std::shared_ptr<Operator>& upstream_op,
+             const std::shared_ptr<Operator>& downstream_op,
+             std::set<std::pair<std::string, std::string>> port_pairs,
+             IOSpec::ConnectorType connector_type,
+             const py::kwargs& kwargs) {
+            self.add_flow(upstream_op,
+                          downstream_op,
+                          std::move(port_pairs),
+                          connector_type,
+                          kwargs_to_arglist(kwargs));
+          },
+          "upstream_op"_a,
+          "downstream_op"_a,
+          "port_pairs"_a,
+          "connector_type"_a)
       .def("compose", &Fragment::compose, doc::Fragment::doc_compose)  // note: virtual function
       .def("scheduler",
            py::overload_cast<const std::shared_ptr<Scheduler>&>(&Fragment::scheduler),
@@ -776,6 +866,24 @@ PYBIND11_MODULE(_core, m) {
           "downstream_op"_a,
           "port_pairs"_a,
           doc::Fragment::doc_add_flow_pair)
+      .def(
+          "add_flow",
+          [](Application& self,
+             const std::shared_ptr<Operator>& upstream_op,
+             const std::shared_ptr<Operator>& downstream_op,
+             std::set<std::pair<std::string, std::string>> port_pairs,
+             IOSpec::ConnectorType connector_type,
+             const py::kwargs& kwargs) {
+            self.add_flow(upstream_op,
+                          downstream_op,
+                          std::move(port_pairs),
+                          connector_type,
+                          kwargs_to_arglist(kwargs));
+          },
+          "upstream_op"_a,
+          "downstream_op"_a,
+          "port_pairs"_a,
+          "connector_type"_a)
       .def(  // note: virtual function
           "add_flow",
           py::overload_cast<const std::shared_ptr<Fragment>&,
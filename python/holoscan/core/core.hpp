@@ -72,6 +72,9 @@ static const std::unordered_map<IOSpec::ConnectorType, const char*> connector_ty
     {IOSpec::ConnectorType::kDefault, "DEFAULT"},
     {IOSpec::ConnectorType::kDoubleBuffer, "DOUBLE_BUFFER"},
     {IOSpec::ConnectorType::kUCX, "UCX"},
+    {IOSpec::ConnectorType::kRingBuffer, "RING_BUFFER"},
+    {IOSpec::ConnectorType::kConflating, "CONFLATING"},
+    {IOSpec::ConnectorType::kSharedMemory, "SHARED_MEMORY"},
 };
 
 static const std::unordered_map<DLDataTypeCode, const char*> dldatatypecode_namemap{
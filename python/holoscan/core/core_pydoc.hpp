@@ -652,6 +652,9 @@ The following ConditionTypes are supported:
 - `IOSpec.ConnectorType.DEFAULT`
 - `IOSpec.ConnectorType.DOUBLE_BUFFER`
 - `IOSpec.ConnectorType.UCX`
+- `IOSpec.ConnectorType.RING_BUFFER`
+- `IOSpec.ConnectorType.CONFLATING`
+- `IOSpec.ConnectorType.SHARED_MEMORY`
 
 If this method is not been called, the IOSpec's `connector_type` will be
 `ConnectorType.DEFAULT` which will result in a DoubleBuffered receiver or
@@ -1076,6 +1079,11 @@ multi-fragment applications.
 2.) There are also variants that omit the `port_pairs` argument that are applicable when there is
 only a single output on the upstream operator/fragment and a single input on the downstream
 operator/fragment.
+3.) For operators, there is a variant taking a `connector_type`
+(`holoscan.core.IOSpec.ConnectorType`) after `port_pairs`, and optional keyword arguments for the
+receiver, to select the connector used by the connected ports (e.g.,
+`IOSpec.ConnectorType.CONFLATING` to only keep the latest message). An output port keeps the
+first connector type it was given.
 
 )doc")
 
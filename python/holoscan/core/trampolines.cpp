@@ -16,6 +16,7 @@
  */
 #include "trampolines.hpp"
 #include <pybind11/stl.h>  // needed for py::cast to work with std::vector types
+#include <cstring>
 #include <memory>
 #include <string>
 #include <vector>
@@ -26,8 +27,107 @@
 #include "holoscan/core/gxf/gxf_tensor.hpp"
 #include "holoscan/operators/holoviz/holoviz.hpp"
 
+using pybind11::literals::operator""_a;
+
 namespace holoscan {
 
+namespace {
+
+// Whether a memoryview can be sent as is and rebuilt with memoryview.cast(format, shape)
+bool is_castable_memoryview(const Py_buffer* view) {
+  if (view->ndim < 1 || !PyBuffer_IsContiguous(view, 'C')) { return false; }
+  // memoryview.cast() only accepts single-character native formats
+  const char* format = view->format ? view->format : "B";
+  if (format[0] == '@') { format++; }
+  return std::strlen(format) == 1;
+}
+
+}  // namespace
+
+std::shared_ptr<PyPickledObject> PyPickledObject::from_object(const py::object& obj) {
+  auto pickled = std::make_shared<PyPickledObject>();
+  PyObject* ptr = obj.ptr();
+
+  // Bytes-like objects are sent without pickling. The object must not be modified until it is
+  // sent.
+  if (PyBytes_Check(ptr)) {
+    pickled->kind = Kind::kBytes;
+    pickled->segments.push_back({reinterpret_cast<const uint8_t*>(PyBytes_AS_STRING(ptr)),
+                                 static_cast<size_t>(PyBytes_GET_SIZE(ptr))});
+    pickled->owner = std::make_shared<GILGuardedPyObject>(obj);
+    return pickled;
+  }
+  if (PyByteArray_Check(ptr)) {
+    pickled->kind = Kind::kByteArray;
+    pickled->segments.push_back({reinterpret_cast<const uint8_t*>(PyByteArray_AS_STRING(ptr)),
+                                 static_cast<size_t>(PyByteArray_GET_SIZE(ptr))});
+    pickled->owner = std::make_shared<GILGuardedPyObject>(obj);
+    return pickled;
+  }
+  if (PyMemoryView_Check(ptr) && is_castable_memoryview(PyMemoryView_GET_BUFFER(ptr))) {
+    const Py_buffer* view = PyMemoryView_GET_BUFFER(ptr);
+    pickled->kind = Kind::kMemoryView;
+    pickled->format = view->format ? view->format : "B";
+    pickled->shape.assign(view->shape, view->shape + view->ndim);
+    pickled->segments.push_back(
+        {static_cast<const uint8_t*>(view->buf), static_cast<size_t>(view->len)});
+    pickled->owner = std::make_shared<GILGuardedPyObject>(obj);
+    return pickled;
+  }
+
+  // Collect the out-of-band buffers. Buffers that are not contiguous are pickled in-band.
+  py::list buffers;
+  py::cpp_function buffer_callback([buffers](py::object buffer) mutable -> bool {
+    try {
+      buffers.append(buffer.attr("raw")());
+    } catch (py::error_already_set&) { return true; }
+    return false;
+  });
+  py::module_ cloudpickle = py::module_::import("cloudpickle");
+  py::bytes stream =
+      cloudpickle.attr("dumps")(obj, "protocol"_a = 5, "buffer_callback"_a = buffer_callback);
+
+  pickled->kind = Kind::kPickle;
+  pickled->segments.reserve(1 + buffers.size());
+  pickled->segments.push_back({reinterpret_cast<const uint8_t*>(PyBytes_AS_STRING(stream.ptr())),
+                               static_cast<size_t>(PyBytes_GET_SIZE(stream.ptr()))});
+  for (auto buffer : buffers) {
+    const Py_buffer* view = PyMemoryView_GET_BUFFER(buffer.ptr());
+    pickled->segments.push_back(
+        {static_cast<const uint8_t*>(view->buf), static_cast<size_t>(view->len)});
+  }
+  pickled->owner = std::make_shared<GILGuardedPyObject>(py::make_tuple(stream, buffers));
+  return pickled;
+}
+
+py::object PyPickledObject::to_object() const {
+  if (storage.size() != segments.size() || segments.empty()) {
+    throw std::runtime_error("PyPickledObject: the object has not been received");
+  }
+  // memoryview sharing the received buffer
+  auto segment_view = [this](size_t index) {
+    return py::memoryview(py::cast(PyReceivedBuffer{storage[index]}));
+  };
+
+  const Segment& first = segments[0];
+  switch (kind) {
+    case Kind::kBytes:
+      return py::bytes(reinterpret_cast<const char*>(first.data), first.size);
+    case Kind::kByteArray:
+      return py::reinterpret_steal<py::object>(
+          PyByteArray_FromStringAndSize(reinterpret_cast<const char*>(first.data), first.size));
+    case Kind::kMemoryView:
+      return segment_view(0).attr("cast")(format, py::cast(shape));
+    case Kind::kPickle:
+    default:
+      break;
+  }
+  py::list buffers;
+  for (size_t index = 1; index < segments.size(); ++index) { buffers.append(segment_view(index)); }
+  py::module_ cloudpickle = py::module_::import("cloudpickle");
+  return cloudpickle.attr("loads")(segment_view(0), "buffers"_a = buffers);
+}
+
 py::tuple vector2pytuple(const std::vector<std::shared_ptr<GILGuardedPyObject>>& vec) {
   py::tuple result(vec.size());
   int counter = 0;
@@ -201,20 +301,16 @@ py::object PyInputContext::py_receive(const std::string& name) {
       }
       py::tuple result_tuple = vector2pytuple(result);
       return result_tuple;
-    } else if (element_type == typeid(std::string)) {
+    } else if (element_type == typeid(std::shared_ptr<PyPickledObject>)) {
       std::vector<std::shared_ptr<GILGuardedPyObject>> result;
       try {
         for (auto& any_item : any_result) {
-          std::string obj_str = std::any_cast<std::string>(any_item);
-
-          py::module_ cloudpickle = py::module_::import("cloudpickle");
-          py::object deserialized = cloudpickle.attr("loads")(py::bytes(obj_str));
-
-          result.push_back(std::make_shared<GILGuardedPyObject>(deserialized));
+          auto pickled = std::any_cast<std::shared_ptr<PyPickledObject>>(any_item);
+          result.push_back(std::make_shared<GILGuardedPyObject>(pickled->to_object()));
         }
       } catch (const std::bad_any_cast& e) {
         HOLOSCAN_LOG_ERROR(
-            "Unable to receive input (std::vector<std::str>) with name "
+            "Unable to receive input (std::vector<std::shared_ptr<PyPickledObject>>) with name "
             "'{}' ({})",
             name,
             e.what());
@@ -262,14 +358,10 @@ py::object PyInputContext::py_receive(const std::string& name) {
       HOLOSCAN_LOG_DEBUG("py_receive: Python object case");
       auto in_message = std::any_cast<std::shared_ptr<GILGuardedPyObject>>(result);
       return in_message->obj();
-    } else if (result_type == typeid(std::string)) {
-      HOLOSCAN_LOG_DEBUG("py_receive: cloudpickle string case");
-      std::string obj_str = std::any_cast<std::string>(result);
-
-      py::module_ cloudpickle = py::module_::import("cloudpickle");
-      py::object deserialized = cloudpickle.attr("loads")(py::bytes(obj_str));
-
-      return deserialized;
+    } else if (result_type == typeid(std::shared_ptr<PyPickledObject>)) {
+      HOLOSCAN_LOG_DEBUG("py_receive: pickled Python object case");
+      auto pickled = std::any_cast<std::shared_ptr<PyPickledObject>>(result);
+      return pickled->to_object();
     } else if (result_type == typeid(std::vector<holoscan::ops::HolovizOp::InputSpec>)) {
       HOLOSCAN_LOG_DEBUG("py_receive: HolovizOp::InputSpec case");
       // can directly return vector<InputSpec>
@@ -345,12 +437,14 @@ void PyOutputContext::py_emit(py::object& data, const std::string& name) {
     }
   }
 
-  bool is_ucx_connector = false;
+  // Messages sent to another fragment (through UCX or shared memory) must be serialized
+  bool is_inter_fragment_connector = false;
   if (outputs_.find(name) != outputs_.end()) {
     auto connector_type = outputs_.at(name)->connector_type();
-    is_ucx_connector = connector_type == IOSpec::ConnectorType::kUCX;
+    is_inter_fragment_connector = connector_type == IOSpec::ConnectorType::kUCX ||
+                                  connector_type == IOSpec::ConnectorType::kSharedMemory;
   }
-  if (is_ucx_connector) {
+  if (is_inter_fragment_connector) {
     // TensorMap case was already handled above
     if (is_tensor_like(data)) {
       // For tensor-like data, we should create an entity and transmit using the holoscan::Tensor
@@ -379,10 +473,8 @@ void PyOutputContext::py_emit(py::object& data, const std::string& name) {
       emit<holoscan::gxf::Entity>(py_entity, name.c_str());
       return;
     }
-    // use cloudpickle to serialize as a string
-    py::module_ cloudpickle = py::module_::import("cloudpickle");
-    py::bytes serialized = cloudpickle.attr("dumps")(data);
-    emit<std::string>(serialized.cast<std::string>(), name.c_str());
+    // Pickle everything else (out-of-band buffers are sent without copy)
+    emit<std::shared_ptr<PyPickledObject>>(PyPickledObject::from_object(data), name.c_str());
     return;
   }
   // Emit everything else as a Python object.
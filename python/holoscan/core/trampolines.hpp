@@ -20,6 +20,7 @@
 
 #include <pybind11/pybind11.h>
 
+#include <cstdint>
 #include <list>
 #include <memory>
 #include <set>
@@ -398,6 +399,63 @@ class GILGuardedPyObject {
   py::object obj_;
 };
 
+/**
+ * @brief A Python object serialized for another fragment.
+ *
+ * Objects are pickled with pickle protocol 5 (cloudpickle): the pickle stream is the first
+ * segment and the out-of-band buffers (e.g., the data of NumPy arrays nested in the object) are
+ * the following segments. `bytes`, `bytearray` and C-contiguous `memoryview` objects are not
+ * pickled: their buffer is the only segment.
+ *
+ * The codec writes each segment as a borrowed endpoint segment, so the object data is neither
+ * copied into an intermediate string nor into the serialization buffer. On the sending side, the
+ * segments point into the Python objects kept alive by `owner`. On the receiving side, they point
+ * into `storage`, and out-of-band buffers are handed to `pickle.loads()` without copy.
+ *
+ * Creating or converting the object requires the GIL, but the codec only touches the segments.
+ */
+class PyPickledObject {
+ public:
+  /// How the object is encoded.
+  enum class Kind : uint8_t {
+    kPickle = 0,      ///< pickle stream followed by out-of-band buffers
+    kBytes = 1,       ///< contents of a `bytes` object
+    kByteArray = 2,   ///< contents of a `bytearray` object
+    kMemoryView = 3,  ///< contents of a C-contiguous `memoryview` (see `format` and `shape`)
+  };
+
+  struct Segment {
+    const uint8_t* data = nullptr;
+    size_t size = 0;
+  };
+
+  /// Serialize a Python object (requires the GIL).
+  static std::shared_ptr<PyPickledObject> from_object(const py::object& obj);
+
+  /// Rebuild the Python object (requires the GIL).
+  py::object to_object() const;
+
+  Kind kind = Kind::kPickle;
+  /// Item format and shape of a `memoryview` (Kind::kMemoryView only).
+  std::string format;
+  std::vector<int64_t> shape;
+  std::vector<Segment> segments;
+
+  /// Python objects owning the segments (sending side).
+  std::shared_ptr<GILGuardedPyObject> owner;
+  /// Buffers owning the segments (receiving side).
+  std::vector<std::shared_ptr<std::vector<uint8_t>>> storage;
+};
+
+/**
+ * @brief A buffer received from another fragment, exposed to Python through the buffer protocol.
+ *
+ * Memoryviews of this object share the received data, which stays alive as long as they do.
+ */
+struct PyReceivedBuffer {
+  std::shared_ptr<std::vector<uint8_t>> data;
+};
+
 class PyInputContext : public gxf::GXFInputContext {
  public:
   /* Inherit the constructors */
@@ -18,17 +18,26 @@
 
     holoscan.resources.Allocator
     holoscan.resources.BlockMemoryPool
+    holoscan.resources.BlockingAllocator
     holoscan.resources.Clock
+    holoscan.resources.ConflatingReceiver
     holoscan.resources.CudaStreamPool
     holoscan.resources.DoubleBufferReceiver
     holoscan.resources.DoubleBufferTransmitter
+    holoscan.resources.HugePageMemoryPool
     holoscan.resources.ManualClock
     holoscan.resources.MemoryStorageType
+    holoscan.resources.NumaAllocator
     holoscan.resources.RealtimeClock
     holoscan.resources.Receiver
+    holoscan.resources.RecyclingAllocator
+    holoscan.resources.RingBufferReceiver
+    holoscan.resources.RingBufferTransmitter
     holoscan.resources.SerializationBuffer
+    holoscan.resources.SlabMemoryPool
     holoscan.resources.StdComponentSerializer
     holoscan.resources.Transmitter
+    holoscan.resources.TscClock
     holoscan.resources.UnboundedAllocator
     holoscan.resources.UcxComponentSerializer
     holoscan.resources.UcxEntitySerializer
@@ -42,17 +51,26 @@
 from ._resources import (
     Allocator,
     BlockMemoryPool,
+    BlockingAllocator,
     Clock,
+    ConflatingReceiver,
     CudaStreamPool,
     DoubleBufferReceiver,
     DoubleBufferTransmitter,
+    HugePageMemoryPool,
     ManualClock,
     MemoryStorageType,
+    NumaAllocator,
     RealtimeClock,
     Receiver,
+    RecyclingAllocator,
+    RingBufferReceiver,
+    RingBufferTransmitter,
     SerializationBuffer,
+    SlabMemoryPool,
     StdComponentSerializer,
     Transmitter,
+    TscClock,
     UcxComponentSerializer,
     UcxEntitySerializer,
     UcxHoloscanComponentSerializer,
@@ -66,17 +84,26 @@ from ._resources import (
 __all__ = [
     "Allocator",
     "BlockMemoryPool",
+    "BlockingAllocator",
     "Clock",
+    "ConflatingReceiver",
     "CudaStreamPool",
     "DoubleBufferReceiver",
     "DoubleBufferTransmitter",
+    "HugePageMemoryPool",
     "ManualClock",
     "MemoryStorageType",
+    "NumaAllocator",
     "RealtimeClock",
     "Receiver",
+    "RecyclingAllocator",
+    "RingBufferReceiver",
+    "RingBufferTransmitter",
     "SerializationBuffer",
+    "SlabMemoryPool",
     "StdComponentSerializer",
     "Transmitter",
+    "TscClock",
     "UcxComponentSerializer",
     "UcxEntitySerializer",
     "UcxHoloscanComponentSerializer",
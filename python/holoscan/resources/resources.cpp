@@ -17,10 +17,12 @@
 
 #include <pybind11/chrono.h>  // will include timedelta.h for us
 #include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
 
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "./resources_pydoc.hpp"
 #include "holoscan/core/component_spec.hpp"
@@ -28,15 +30,24 @@
 #include "holoscan/core/gxf/gxf_resource.hpp"
 #include "holoscan/core/resources/gxf/allocator.hpp"
 #include "holoscan/core/resources/gxf/block_memory_pool.hpp"
+#include "holoscan/core/resources/gxf/blocking_allocator.hpp"
 #include "holoscan/core/resources/gxf/clock.hpp"
+#include "holoscan/core/resources/gxf/conflating_receiver.hpp"
 #include "holoscan/core/resources/gxf/cuda_stream_pool.hpp"
 #include "holoscan/core/resources/gxf/double_buffer_receiver.hpp"
 #include "holoscan/core/resources/gxf/double_buffer_transmitter.hpp"
+#include "holoscan/core/resources/gxf/huge_page_memory_pool.hpp"
 #include "holoscan/core/resources/gxf/manual_clock.hpp"
+#include "holoscan/core/resources/gxf/numa_allocator.hpp"
 #include "holoscan/core/resources/gxf/realtime_clock.hpp"
 #include "holoscan/core/resources/gxf/receiver.hpp"
+#include "holoscan/core/resources/gxf/recycling_allocator.hpp"
+#include "holoscan/core/resources/gxf/ring_buffer_receiver.hpp"
+#include "holoscan/core/resources/gxf/ring_buffer_transmitter.hpp"
 #include "holoscan/core/resources/gxf/serialization_buffer.hpp"
+#include "holoscan/core/resources/gxf/slab_memory_pool.hpp"
 #include "holoscan/core/resources/gxf/std_component_serializer.hpp"
+#include "holoscan/core/resources/gxf/tsc_clock.hpp"
 #include "holoscan/core/resources/gxf/transmitter.hpp"
 #include "holoscan/core/resources/gxf/ucx_component_serializer.hpp"
 #include "holoscan/core/resources/gxf/ucx_entity_serializer.hpp"
@@ -233,6 +244,114 @@ class PyUcxComponentSerializer : public UcxComponentSerializer {
   }
 };
 
+class PyBlockingAllocator : public BlockingAllocator {
+ public:
+  /* Inherit the constructors */
+  using BlockingAllocator::BlockingAllocator;
+
+  // Define a constructor that fully initializes the object.
+  PyBlockingAllocator(Fragment* fragment, std::shared_ptr<holoscan::Allocator> allocator,
+                      uint64_t timeout_ms = 100UL, const std::string& name = "blocking_allocator")
+      : BlockingAllocator(ArgList{Arg{"allocator", allocator}, Arg{"timeout_ms", timeout_ms}}) {
+    name_ = name;
+    fragment_ = fragment;
+    spec_ = std::make_shared<ComponentSpec>(fragment);
+    setup(*spec_.get());
+    initialize();
+  }
+};
+
+class PyRecyclingAllocator : public RecyclingAllocator {
+ public:
+  /* Inherit the constructors */
+  using RecyclingAllocator::RecyclingAllocator;
+
+  // Define a constructor that fully initializes the object.
+  explicit PyRecyclingAllocator(Fragment* fragment,
+                                std::shared_ptr<holoscan::Allocator> allocator = nullptr,
+                                uint64_t max_buffers_per_size = 4UL,
+                                uint64_t max_cached_bytes = 256UL * 1024 * 1024,
+                                const std::string& name = "recycling_allocator")
+      : RecyclingAllocator(ArgList{Arg{"max_buffers_per_size", max_buffers_per_size},
+                                   Arg{"max_cached_bytes", max_cached_bytes}}) {
+    if (allocator) { this->add_arg(Arg{"allocator", allocator}); }
+    name_ = name;
+    fragment_ = fragment;
+    spec_ = std::make_shared<ComponentSpec>(fragment);
+    setup(*spec_.get());
+    initialize();
+  }
+};
+
+class PySlabMemoryPool : public SlabMemoryPool {
+ public:
+  /* Inherit the constructors */
+  using SlabMemoryPool::SlabMemoryPool;
+
+  // Define a constructor that fully initializes the object.
+  explicit PySlabMemoryPool(Fragment* fragment, int32_t storage_type = 0,
+                            const std::vector<uint64_t>& size_classes = {},
+                            uint64_t min_block_size = 256UL,
+                            uint64_t max_block_size = 16UL * 1024 * 1024,
+                            uint64_t slab_size = 16UL * 1024 * 1024, uint64_t max_bytes = 0UL,
+                            uint64_t thread_cache_size = 0UL,
+                            const std::string& name = "slab_memory_pool")
+      : SlabMemoryPool(ArgList{Arg{"storage_type", storage_type},
+                               Arg{"size_classes", size_classes},
+                               Arg{"min_block_size", min_block_size},
+                               Arg{"max_block_size", max_block_size},
+                               Arg{"slab_size", slab_size},
+                               Arg{"max_bytes", max_bytes},
+                               Arg{"thread_cache_size", thread_cache_size}}) {
+    name_ = name;
+    fragment_ = fragment;
+    spec_ = std::make_shared<ComponentSpec>(fragment);
+    setup(*spec_.get());
+    initialize();
+  }
+};
+
+class PyHugePageMemoryPool : public HugePageMemoryPool {
+ public:
+  /* Inherit the constructors */
+  using HugePageMemoryPool::HugePageMemoryPool;
+
+  // Define a constructor that fully initializes the object.
+  explicit PyHugePageMemoryPool(Fragment* fragment, int32_t storage_type, uint64_t block_size,
+                                uint64_t num_blocks, bool huge_pages = true,
+                                bool lock_memory = false,
+                                const std::string& name = "huge_page_memory_pool")
+      : HugePageMemoryPool(ArgList{Arg{"storage_type", storage_type},
+                                   Arg{"block_size", block_size},
+                                   Arg{"num_blocks", num_blocks},
+                                   Arg{"huge_pages", huge_pages},
+                                   Arg{"lock_memory", lock_memory}}) {
+    name_ = name;
+    fragment_ = fragment;
+    spec_ = std::make_shared<ComponentSpec>(fragment);
+    setup(*spec_.get());
+    initialize();
+  }
+};
+
+class PyNumaAllocator : public NumaAllocator {
+ public:
+  /* Inherit the constructors */
+  using NumaAllocator::NumaAllocator;
+
+  // Define a constructor that fully initializes the object.
+  explicit PyNumaAllocator(Fragment* fragment, int32_t storage_type = 2, int32_t numa_node = -1,
+                           const std::string& name = "numa_allocator")
+      : NumaAllocator(
+            ArgList{Arg{"storage_type", storage_type}, Arg{"numa_node", numa_node}}) {
+    name_ = name;
+    fragment_ = fragment;
+    spec_ = std::make_shared<ComponentSpec>(fragment);
+    setup(*spec_.get());
+    initialize();
+  }
+};
+
 class PyUcxHoloscanComponentSerializer : public UcxHoloscanComponentSerializer {
  public:
   /* Inherit the constructors */
@@ -309,6 +428,57 @@ class PyDoubleBufferTransmitter : public DoubleBufferTransmitter {
   }
 };
 
+class PyConflatingReceiver : public ConflatingReceiver {
+ public:
+  /* Inherit the constructors */
+  using ConflatingReceiver::ConflatingReceiver;
+
+  // Define a constructor that fully initializes the object.
+  PyConflatingReceiver(Fragment* fragment, bool key_by_tensor_name = false,
+                       const std::string& name = "conflating_receiver")
+      : ConflatingReceiver(ArgList{Arg{"key_by_tensor_name", key_by_tensor_name}}) {
+    name_ = name;
+    fragment_ = fragment;
+    spec_ = std::make_shared<ComponentSpec>(fragment);
+    setup(*spec_.get());
+    initialize();
+  }
+};
+
+class PyRingBufferReceiver : public RingBufferReceiver {
+ public:
+  /* Inherit the constructors */
+  using RingBufferReceiver::RingBufferReceiver;
+
+  // Define a constructor that fully initializes the object.
+  PyRingBufferReceiver(Fragment* fragment, uint64_t capacity = 1UL, uint64_t policy = 2UL,
+                       const std::string& name = "ring_buffer_receiver")
+      : RingBufferReceiver(ArgList{Arg{"capacity", capacity}, Arg{"policy", policy}}) {
+    name_ = name;
+    fragment_ = fragment;
+    spec_ = std::make_shared<ComponentSpec>(fragment);
+    setup(*spec_.get());
+    initialize();
+  }
+};
+
+class PyRingBufferTransmitter : public RingBufferTransmitter {
+ public:
+  /* Inherit the constructors */
+  using RingBufferTransmitter::RingBufferTransmitter;
+
+  // Define a constructor that fully initializes the object.
+  PyRingBufferTransmitter(Fragment* fragment, uint64_t capacity = 1UL, uint64_t policy = 2UL,
+                          const std::string& name = "ring_buffer_transmitter")
+      : RingBufferTransmitter(ArgList{Arg{"capacity", capacity}, Arg{"policy", policy}}) {
+    name_ = name;
+    fragment_ = fragment;
+    spec_ = std::make_shared<ComponentSpec>(fragment);
+    setup(*spec_.get());
+    initialize();
+  }
+};
+
 class PyUcxReceiver : public UcxReceiver {
  public:
   /* Inherit the constructors */
@@ -464,6 +634,39 @@ class PyManualClock : public ManualClock {
   }
 };
 
+class PyTscClock : public TscClock {
+ public:
+  /* Inherit the constructors */
+  using TscClock::TscClock;
+
+  // Define a constructor that fully initializes the object.
+  explicit PyTscClock(Fragment* fragment, const std::string& name = "tsc_clock") : TscClock() {
+    name_ = name;
+    fragment_ = fragment;
+    spec_ = std::make_shared<ComponentSpec>(fragment);
+    setup(*spec_.get());
+    initialize();
+  }
+
+  /* Trampolines (need one for each virtual function) */
+  double time() const override {
+    /* <Return type>, <Parent Class>, <Name of C++ function>, <Argument(s)> */
+    PYBIND11_OVERRIDE(double, TscClock, time);
+  }
+  int64_t timestamp() const override {
+    /* <Return type>, <Parent Class>, <Name of C++ function>, <Argument(s)> */
+    PYBIND11_OVERRIDE(int64_t, TscClock, timestamp);
+  }
+  void sleep_for(int64_t duration_ns) override {
+    /* <Return type>, <Parent Class>, <Name of C++ function>, <Argument(s)> */
+    PYBIND11_OVERRIDE(void, TscClock, sleep_for, duration_ns);
+  }
+  void sleep_until(int64_t target_time_ns) override {
+    /* <Return type>, <Parent Class>, <Name of C++ function>, <Argument(s)> */
+    PYBIND11_OVERRIDE(void, TscClock, sleep_until, target_time_ns);
+  }
+};
+
 PYBIND11_MODULE(_resources, m) {
   m.doc() = R"pbdoc(
         Holoscan SDK Python Bindings
@@ -493,7 +696,24 @@ PYBIND11_MODULE(_resources, m) {
           "gxf_typename", &Allocator::gxf_typename, doc::Allocator::doc_gxf_typename)
       .def("is_available", &Allocator::is_available, "size"_a, doc::Allocator::doc_is_available)
       .def("allocate", &Allocator::allocate, "size"_a, "type"_a, doc::Allocator::doc_allocate)
-      .def("free", &Allocator::free, "pointer"_a, doc::Allocator::doc_free);
+      .def("free", &Allocator::free, "pointer"_a, doc::Allocator::doc_free)
+      .def(
+          "allocation_stats",
+          [](Allocator& allocator) {
+            auto stats = allocator.allocation_stats();
+            py::list holders;
+            for (const auto& holder : stats.holders) {
+              holders.append(py::make_tuple(holder.name, holder.buffers, holder.bytes));
+            }
+            return py::dict("allocations"_a = stats.allocations,
+                            "frees"_a = stats.frees,
+                            "failures"_a = stats.failures,
+                            "in_use_bytes"_a = stats.in_use_bytes,
+                            "peak_bytes"_a = stats.peak_bytes,
+                            "p99_allocate_latency_us"_a = stats.p99_allocate_latency_us,
+                            "holders"_a = holders);
+          },
+          doc::Allocator::doc_allocation_stats);
   // TODO(grelee): for allocate / free how does std::byte* get cast to/from Python?
 
   py::class_<BlockMemoryPool, PyBlockMemoryPool, Allocator, std::shared_ptr<BlockMemoryPool>>(
@@ -509,6 +729,165 @@ PYBIND11_MODULE(_resources, m) {
           "gxf_typename", &BlockMemoryPool::gxf_typename, doc::BlockMemoryPool::doc_gxf_typename)
       .def("setup", &BlockMemoryPool::setup, "spec"_a, doc::BlockMemoryPool::doc_setup);
 
+  py::class_<BlockingAllocator,
+             PyBlockingAllocator,
+             Allocator,
+             std::shared_ptr<BlockingAllocator>>(
+      m, "BlockingAllocator", doc::BlockingAllocator::doc_BlockingAllocator)
+      .def(py::init<Fragment*,
+                    std::shared_ptr<holoscan::Allocator>,
+                    uint64_t,
+                    const std::string&>(),
+           "fragment"_a,
+           "allocator"_a,
+           "timeout_ms"_a = 100UL,
+           "name"_a = "blocking_allocator"s,
+           doc::BlockingAllocator::doc_BlockingAllocator_python)
+      .def_property_readonly("gxf_typename",
+                             &BlockingAllocator::gxf_typename,
+                             doc::BlockingAllocator::doc_gxf_typename)
+      .def("setup", &BlockingAllocator::setup, "spec"_a, doc::BlockingAllocator::doc_setup)
+      .def(
+          "stats",
+          [](BlockingAllocator& allocator) {
+            auto stats = allocator.stats();
+            return py::dict("allocations"_a = stats.allocations,
+                            "waits"_a = stats.waits,
+                            "timeouts"_a = stats.timeouts,
+                            "errors"_a = stats.errors,
+                            "max_wait_ms"_a = stats.max_wait_ms,
+                            "total_wait_ms"_a = stats.total_wait_ms);
+          },
+          doc::BlockingAllocator::doc_stats);
+
+  py::class_<RecyclingAllocator,
+             PyRecyclingAllocator,
+             Allocator,
+             std::shared_ptr<RecyclingAllocator>>(
+      m, "RecyclingAllocator", doc::RecyclingAllocator::doc_RecyclingAllocator)
+      .def(py::init<Fragment*,
+                    std::shared_ptr<holoscan::Allocator>,
+                    uint64_t,
+                    uint64_t,
+                    const std::string&>(),
+           "fragment"_a,
+           "allocator"_a = py::none(),
+           "max_buffers_per_size"_a = 4UL,
+           "max_cached_bytes"_a = 256UL * 1024 * 1024,
+           "name"_a = "recycling_allocator"s,
+           doc::RecyclingAllocator::doc_RecyclingAllocator_python)
+      .def_property_readonly("gxf_typename",
+                             &RecyclingAllocator::gxf_typename,
+                             doc::RecyclingAllocator::doc_gxf_typename)
+      .def("setup", &RecyclingAllocator::setup, "spec"_a, doc::RecyclingAllocator::doc_setup)
+      .def(
+          "stats",
+          [](RecyclingAllocator& allocator) {
+            auto stats = allocator.stats();
+            return py::dict("hits"_a = stats.hits,
+                            "misses"_a = stats.misses,
+                            "recycled"_a = stats.recycled,
+                            "evicted"_a = stats.evicted,
+                            "cached_buffers"_a = stats.cached_buffers,
+                            "cached_bytes"_a = stats.cached_bytes,
+                            "in_use_buffers"_a = stats.in_use_buffers);
+          },
+          doc::RecyclingAllocator::doc_stats);
+
+  py::class_<SlabMemoryPool, PySlabMemoryPool, Allocator, std::shared_ptr<SlabMemoryPool>>(
+      m, "SlabMemoryPool", doc::SlabMemoryPool::doc_SlabMemoryPool)
+      .def(py::init<Fragment*,
+                    int32_t,
+                    const std::vector<uint64_t>&,
+                    uint64_t,
+                    uint64_t,
+                    uint64_t,
+                    uint64_t,
+                    uint64_t,
+                    const std::string&>(),
+           "fragment"_a,
+           "storage_type"_a = 0,
+           "size_classes"_a = std::vector<uint64_t>{},
+           "min_block_size"_a = 256UL,
+           "max_block_size"_a = 16UL * 1024 * 1024,
+           "slab_size"_a = 16UL * 1024 * 1024,
+           "max_bytes"_a = 0UL,
+           "thread_cache_size"_a = 0UL,
+           "name"_a = "slab_memory_pool"s,
+           doc::SlabMemoryPool::doc_SlabMemoryPool_python)
+      .def_property_readonly(
+          "gxf_typename", &SlabMemoryPool::gxf_typename, doc::SlabMemoryPool::doc_gxf_typename)
+      .def("setup", &SlabMemoryPool::setup, "spec"_a, doc::SlabMemoryPool::doc_setup)
+      .def(
+          "stats",
+          [](SlabMemoryPool& pool) {
+            auto stats = pool.stats();
+            return py::dict("allocations"_a = stats.allocations,
+                            "large_allocations"_a = stats.large_allocations,
+                            "thread_cache_hits"_a = stats.thread_cache_hits,
+                            "failed_allocations"_a = stats.failed_allocations,
+                            "slabs"_a = stats.slabs,
+                            "reserved_bytes"_a = stats.reserved_bytes,
+                            "in_use_blocks"_a = stats.in_use_blocks,
+                            "in_use_bytes"_a = stats.in_use_bytes);
+          },
+          doc::SlabMemoryPool::doc_stats);
+
+  py::class_<HugePageMemoryPool,
+             PyHugePageMemoryPool,
+             Allocator,
+             std::shared_ptr<HugePageMemoryPool>>(
+      m, "HugePageMemoryPool", doc::HugePageMemoryPool::doc_HugePageMemoryPool)
+      .def(py::init<Fragment*, int32_t, uint64_t, uint64_t, bool, bool, const std::string&>(),
+           "fragment"_a,
+           "storage_type"_a,
+           "block_size"_a,
+           "num_blocks"_a,
+           "huge_pages"_a = true,
+           "lock_memory"_a = false,
+           "name"_a = "huge_page_memory_pool"s,
+           doc::HugePageMemoryPool::doc_HugePageMemoryPool_python)
+      .def_property_readonly("gxf_typename",
+                             &HugePageMemoryPool::gxf_typename,
+                             doc::HugePageMemoryPool::doc_gxf_typename)
+      .def("setup", &HugePageMemoryPool::setup, "spec"_a, doc::HugePageMemoryPool::doc_setup)
+      .def(
+          "stats",
+          [](HugePageMemoryPool& pool) {
+            auto stats = pool.stats();
+            return py::dict("allocations"_a = stats.allocations,
+                            "failed_allocations"_a = stats.failed_allocations,
+                            "in_use_blocks"_a = stats.in_use_blocks,
+                            "reserved_bytes"_a = stats.reserved_bytes,
+                            "page_size"_a = stats.page_size);
+          },
+          doc::HugePageMemoryPool::doc_stats);
+
+  py::class_<NumaAllocator, PyNumaAllocator, Allocator, std::shared_ptr<NumaAllocator>>(
+      m, "NumaAllocator", doc::NumaAllocator::doc_NumaAllocator)
+      .def(py::init<Fragment*, int32_t, int32_t, const std::string&>(),
+           "fragment"_a,
+           "storage_type"_a = 2,
+           "numa_node"_a = -1,
+           "name"_a = "numa_allocator"s,
+           doc::NumaAllocator::doc_NumaAllocator_python)
+      .def_property_readonly(
+          "gxf_typename", &NumaAllocator::gxf_typename, doc::NumaAllocator::doc_gxf_typename)
+      .def("setup", &NumaAllocator::setup, "spec"_a, doc::NumaAllocator::doc_setup)
+      .def(
+          "stats",
+          [](NumaAllocator& allocator) {
+            auto stats = allocator.stats();
+            return py::dict("allocations"_a = stats.allocations,
+                            "failed_allocations"_a = stats.failed_allocations,
+                            "local_allocations"_a = stats.local_allocations,
+                            "remote_allocations"_a = stats.remote_allocations,
+                            "remote_frees"_a = stats.remote_frees,
+                            "in_use_bytes"_a = stats.in_use_bytes,
+                            "in_use_bytes_per_node"_a = stats.in_use_bytes_per_node);
+          },
+          doc::NumaAllocator::doc_stats);
+
   py::class_<CudaStreamPool, PyCudaStreamPool, Allocator, std::shared_ptr<CudaStreamPool>>(
       m, "CudaStreamPool", doc::CudaStreamPool::doc_CudaStreamPool)
       .def(
@@ -653,6 +1032,37 @@ PYBIND11_MODULE(_resources, m) {
                              doc::DoubleBufferReceiver::doc_gxf_typename)
       .def("setup", &DoubleBufferReceiver::setup, "spec"_a, doc::DoubleBufferReceiver::doc_setup);
 
+  py::class_<ConflatingReceiver,
+             PyConflatingReceiver,
+             Receiver,
+             std::shared_ptr<ConflatingReceiver>>(
+      m, "ConflatingReceiver", doc::ConflatingReceiver::doc_ConflatingReceiver)
+      .def(py::init<Fragment*, bool, const std::string&>(),
+           "fragment"_a,
+           "key_by_tensor_name"_a = false,
+           "name"_a = "conflating_receiver"s,
+           doc::ConflatingReceiver::doc_ConflatingReceiver_python)
+      .def_property_readonly("gxf_typename",
+                             &ConflatingReceiver::gxf_typename,
+                             doc::ConflatingReceiver::doc_gxf_typename)
+      .def("setup", &ConflatingReceiver::setup, "spec"_a, doc::ConflatingReceiver::doc_setup);
+
+  py::class_<RingBufferReceiver,
+             PyRingBufferReceiver,
+             Receiver,
+             std::shared_ptr<RingBufferReceiver>>(
+      m, "RingBufferReceiver", doc::RingBufferReceiver::doc_RingBufferReceiver)
+      .def(py::init<Fragment*, uint64_t, uint64_t, const std::string&>(),
+           "fragment"_a,
+           "capacity"_a = 1UL,
+           "policy"_a = 2UL,
+           "name"_a = "ring_buffer_receiver"s,
+           doc::RingBufferReceiver::doc_RingBufferReceiver_python)
+      .def_property_readonly("gxf_typename",
+                             &RingBufferReceiver::gxf_typename,
+                             doc::RingBufferReceiver::doc_gxf_typename)
+      .def("setup", &RingBufferReceiver::setup, "spec"_a, doc::RingBufferReceiver::doc_setup);
+
   py::class_<UcxReceiver, PyUcxReceiver, Receiver, std::shared_ptr<UcxReceiver>>(
       m, "UcxReceiver", doc::UcxReceiver::doc_UcxReceiver)
       .def(py::init<Fragment*,
@@ -699,6 +1109,22 @@ PYBIND11_MODULE(_resources, m) {
            "spec"_a,
            doc::DoubleBufferTransmitter::doc_setup);
 
+  py::class_<RingBufferTransmitter,
+             PyRingBufferTransmitter,
+             Transmitter,
+             std::shared_ptr<RingBufferTransmitter>>(
+      m, "RingBufferTransmitter", doc::RingBufferTransmitter::doc_RingBufferTransmitter)
+      .def(py::init<Fragment*, uint64_t, uint64_t, const std::string&>(),
+           "fragment"_a,
+           "capacity"_a = 1UL,
+           "policy"_a = 2UL,
+           "name"_a = "ring_buffer_transmitter"s,
+           doc::RingBufferTransmitter::doc_RingBufferTransmitter_python)
+      .def_property_readonly("gxf_typename",
+                             &RingBufferTransmitter::gxf_typename,
+                             doc::RingBufferTransmitter::doc_gxf_typename)
+      .def("setup", &RingBufferTransmitter::setup, "spec"_a, doc::RingBufferTransmitter::doc_setup);
+
   py::class_<UcxTransmitter, PyUcxTransmitter, Transmitter, std::shared_ptr<UcxTransmitter>>(
       m, "UcxTransmitter", doc::UcxTransmitter::doc_UcxTransmitter)
       .def(py::init<Fragment*,
@@ -814,5 +1240,31 @@ PYBIND11_MODULE(_resources, m) {
            &ManualClock::sleep_until,
            "target_time_ns"_a,
            doc::Clock::doc_sleep_until);
+
+  py::class_<TscClock, PyTscClock, Clock, std::shared_ptr<TscClock>>(
+      m, "TscClock", doc::TscClock::doc_TscClock)
+      .def(py::init<Fragment*, const std::string&>(),
+           "fragment"_a,
+           "name"_a = "tsc_clock"s,
+           doc::TscClock::doc_TscClock_python)
+      .def_property_readonly(
+          "gxf_typename", &TscClock::gxf_typename, doc::TscClock::doc_gxf_typename)
+      .def_property_readonly("source", &TscClock::source, doc::TscClock::doc_source)
+      .def_property_readonly(
+          "frequency_hz", &TscClock::frequency_hz, doc::TscClock::doc_frequency_hz)
+      .def("time", &TscClock::time, doc::Clock::doc_time)
+      .def("timestamp", &TscClock::timestamp, doc::Clock::doc_timestamp)
+      // define a version of sleep_for that can take either int or datetime.timedelta
+      .def(
+          "sleep_for",
+          [](TscClock& clk, const py::object& duration) {
+            clk.sleep_for(holoscan::get_duration_ns(duration));
+          },
+          py::call_guard<py::gil_scoped_release>(),
+          doc::Clock::doc_sleep_for)
+      .def("sleep_until",
+           &TscClock::sleep_until,
+           "target_time_ns"_a,
+           doc::Clock::doc_sleep_until);
 }  // PYBIND11_MODULE
 }  // namespace holoscan
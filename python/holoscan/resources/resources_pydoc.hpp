@@ -73,6 +73,21 @@ pointer : PyCapsule
     memory.
 )doc")
 
+PYDOC(allocation_stats, R"doc(
+The usage statistics of the allocator.
+
+The allocations are only tracked if the ``HOLOSCAN_ALLOCATOR_STATS`` environment variable is set
+to true when the allocator is initialized. Otherwise, all the values are zero.
+
+Returns
+-------
+dict
+    The number of ``allocations``, ``frees`` and ``failures``, the bytes currently allocated
+    (``in_use_bytes``) and their maximum (``peak_bytes``), the 99th percentile of the recent
+    allocation latencies in microseconds (``p99_allocate_latency_us``) and the current ``holders``
+    as a list of ``(operator name, buffers, bytes)`` tuples.
+)doc")
+
 }  // namespace Allocator
 
 namespace BlockMemoryPool {
@@ -123,6 +138,327 @@ spec : holoscan.core.ComponentSpec
 
 }  // namespace BlockMemoryPool
 
+namespace BlockingAllocator {
+
+PYDOC(BlockingAllocator, R"doc(
+Blocking allocator.
+
+Forwards the requests to another allocator and, when it is exhausted, waits for a buffer to be
+freed instead of failing immediately.
+)doc")
+
+// Constructor
+PYDOC(BlockingAllocator_python, R"doc(
+Blocking allocator.
+
+Forwards the requests to another allocator (e.g., a ``BlockMemoryPool``) and, when it is
+exhausted, waits up to `timeout_ms` milliseconds for a buffer to be freed through this allocator
+instead of failing immediately.
+
+Parameters
+----------
+fragment : holoscan.core.Fragment
+    The fragment to assign the resource to.
+allocator : holoscan.resource.Allocator
+    The allocator providing the buffers.
+timeout_ms : int, optional
+    The maximum time in milliseconds an allocation waits for a buffer to be freed (0 to fail
+    immediately).
+name : str, optional
+    The name of the allocator.
+)doc")
+
+PYDOC(gxf_typename, R"doc(
+The GXF type name of the resource.
+
+Returns
+-------
+str
+    The GXF type name of the resource
+)doc")
+
+PYDOC(setup, R"doc(
+Define the component specification.
+
+Parameters
+----------
+spec : holoscan.core.ComponentSpec
+    Component specification associated with the resource.
+)doc")
+
+PYDOC(stats, R"doc(
+The waiting statistics.
+
+Returns
+-------
+dict
+    The number of successful ``allocations``, of allocations which had to wait (``waits``), of
+    allocations which failed after waiting (``timeouts``) and of invalid requests which failed
+    without waiting (``errors``), with the ``max_wait_ms`` and ``total_wait_ms`` wait times.
+)doc")
+
+}  // namespace BlockingAllocator
+
+namespace RecyclingAllocator {
+
+PYDOC(RecyclingAllocator, R"doc(
+Recycling allocator.
+
+Keeps freed buffers for later allocations of the same size and storage type instead of returning
+them to the underlying allocator.
+)doc")
+
+// Constructor
+PYDOC(RecyclingAllocator_python, R"doc(
+Recycling allocator.
+
+Keeps freed buffers for later allocations of the same size and storage type instead of returning
+them to the underlying allocator.
+
+Parameters
+----------
+fragment : holoscan.core.Fragment
+    The fragment to assign the resource to.
+allocator : holoscan.resource.Allocator, optional
+    The allocator providing the recycled buffers. An ``UnboundedAllocator`` is used if not
+    provided.
+max_buffers_per_size : int, optional
+    The maximum number of cached buffers of a given size and storage type.
+max_cached_bytes : int, optional
+    The maximum number of bytes kept in the cache.
+name : str, optional
+    The name of the allocator.
+)doc")
+
+PYDOC(gxf_typename, R"doc(
+The GXF type name of the resource.
+
+Returns
+-------
+str
+    The GXF type name of the resource
+)doc")
+
+PYDOC(setup, R"doc(
+Define the component specification.
+
+Parameters
+----------
+spec : holoscan.core.ComponentSpec
+    Component specification associated with the resource.
+)doc")
+
+PYDOC(stats, R"doc(
+The cache statistics.
+
+Returns
+-------
+dict
+    The number of allocations served from the cache (``hits``) or forwarded to the underlying
+    allocator (``misses``), the number of freed buffers kept (``recycled``) or released
+    (``evicted``), and the current ``cached_buffers``, ``cached_bytes`` and ``in_use_buffers``.
+)doc")
+
+}  // namespace RecyclingAllocator
+
+namespace SlabMemoryPool {
+
+PYDOC(SlabMemoryPool, R"doc(
+Slab memory pool.
+
+Memory pool serving requests of mixed sizes from several size classes, each with its own free
+list of blocks.
+)doc")
+
+// Constructor
+PYDOC(SlabMemoryPool_python, R"doc(
+Slab memory pool.
+
+Memory pool serving requests of mixed sizes from several size classes, each with its own free
+list of blocks. A request is served by a block of the smallest size class that fits it, and
+requests larger than the largest size class are allocated directly.
+
+Parameters
+----------
+fragment : holoscan.core.Fragment
+    The fragment to assign the resource to.
+storage_type : int or holoscan.resources.MemoryStorageType, optional
+    The storage type (0=Host, 1=Device, 2=System).
+size_classes : list of int, optional
+    The block sizes of the size classes in bytes. If empty, the powers of two from
+    `min_block_size` to `max_block_size` are used.
+min_block_size : int, optional
+    The block size of the smallest power-of-two size class.
+max_block_size : int, optional
+    The block size of the largest power-of-two size class.
+slab_size : int, optional
+    The size of the chunks of memory divided into the blocks of a size class.
+max_bytes : int, optional
+    The maximum number of bytes allocated by the pool (0 for no limit).
+thread_cache_size : int, optional
+    The maximum number of freed blocks per size class kept by each thread (0 to disable the
+    thread-local caches).
+name : str, optional
+    The name of the memory pool.
+)doc")
+
+PYDOC(gxf_typename, R"doc(
+The GXF type name of the resource.
+
+Returns
+-------
+str
+    The GXF type name of the resource
+)doc")
+
+PYDOC(setup, R"doc(
+Define the component specification.
+
+Parameters
+----------
+spec : holoscan.core.ComponentSpec
+    Component specification associated with the resource.
+)doc")
+
+PYDOC(stats, R"doc(
+The pool statistics.
+
+Returns
+-------
+dict
+    The number of blocks handed out (``allocations``, of which ``thread_cache_hits`` came from a
+    thread-local cache), of requests larger than the largest size class (``large_allocations``)
+    and of failed requests (``failed_allocations``), and the current ``slabs``,
+    ``reserved_bytes``, ``in_use_blocks`` and ``in_use_bytes``.
+)doc")
+
+}  // namespace SlabMemoryPool
+
+namespace HugePageMemoryPool {
+
+PYDOC(HugePageMemoryPool, R"doc(
+Huge-page memory pool.
+
+Host memory pool of equally sized blocks reserved up front, backed by huge pages when possible and
+pre-faulted so that the blocks never page-fault.
+)doc")
+
+// Constructor
+PYDOC(HugePageMemoryPool_python, R"doc(
+Huge-page memory pool.
+
+Host memory pool of equally sized blocks reserved up front in a single region. The region is
+backed by huge pages when possible (explicit huge pages, then transparent huge pages, falling back
+to regular pages), every page is touched on initialization and the region can be locked in memory.
+
+Parameters
+----------
+fragment : holoscan.core.Fragment
+    The fragment to assign the resource to.
+storage_type : int or holoscan.resources.MemoryStorageType
+    The storage type (0=Host, 2=System). Device memory is not supported.
+block_size : int
+    The size of the blocks in bytes.
+num_blocks : int
+    The number of blocks reserved up front.
+huge_pages : bool, optional
+    Whether to back the pool with huge pages if available.
+lock_memory : bool, optional
+    Whether to lock the pool in memory (``mlock``) so that it is never swapped out.
+name : str, optional
+    The name of the memory pool.
+)doc")
+
+PYDOC(gxf_typename, R"doc(
+The GXF type name of the resource.
+
+Returns
+-------
+str
+    The GXF type name of the resource
+)doc")
+
+PYDOC(setup, R"doc(
+Define the component specification.
+
+Parameters
+----------
+spec : holoscan.core.ComponentSpec
+    Component specification associated with the resource.
+)doc")
+
+PYDOC(stats, R"doc(
+The pool statistics.
+
+Returns
+-------
+dict
+    The number of blocks handed out (``allocations``) and of failed requests
+    (``failed_allocations``), the current ``in_use_blocks``, the size of the reserved region
+    (``reserved_bytes``) and the size of the pages backing it (``page_size``).
+)doc")
+
+}  // namespace HugePageMemoryPool
+
+namespace NumaAllocator {
+
+PYDOC(NumaAllocator, R"doc(
+NUMA-aware host memory allocator.
+
+Host memory allocator binding each allocation to a NUMA node.
+)doc")
+
+// Constructor
+PYDOC(NumaAllocator_python, R"doc(
+NUMA-aware host memory allocator.
+
+Host memory allocator binding each allocation to a NUMA node: either a fixed node, or the node of
+the CPU the allocating thread is running on.
+
+Parameters
+----------
+fragment : holoscan.core.Fragment
+    The fragment to assign the resource to.
+storage_type : int or holoscan.resources.MemoryStorageType, optional
+    The storage type (0=Host, 2=System). Device memory is not supported.
+numa_node : int, optional
+    The OS index of the NUMA node of the allocations, or -1 for the node of the calling thread.
+name : str, optional
+    The name of the allocator.
+)doc")
+
+PYDOC(gxf_typename, R"doc(
+The GXF type name of the resource.
+
+Returns
+-------
+str
+    The GXF type name of the resource
+)doc")
+
+PYDOC(setup, R"doc(
+Define the component specification.
+
+Parameters
+----------
+spec : holoscan.core.ComponentSpec
+    Component specification associated with the resource.
+)doc")
+
+PYDOC(stats, R"doc(
+The locality statistics.
+
+Returns
+-------
+dict
+    The number of ``allocations`` (``local_allocations`` on the node of the allocating thread and
+    ``remote_allocations`` on another node), of ``failed_allocations`` and of frees from a thread
+    running on another node (``remote_frees``), the ``in_use_bytes`` and the bytes in use on each
+    node (``in_use_bytes_per_node``).
+)doc")
+
+}  // namespace NumaAllocator
+
 namespace CudaStreamPool {
 
 PYDOC(CudaStreamPool, R"doc(
@@ -469,6 +805,148 @@ spec : holoscan.core.ComponentSpec
 
 }  // namespace DoubleBufferTransmitter
 
+namespace ConflatingReceiver {
+
+PYDOC(ConflatingReceiver, R"doc(
+Receiver keeping only the most recent message.
+
+A new message replaces the one that was not received yet, so the upstream operator is never
+blocked. Suited for display and UI branches that only care about the newest frame.
+)doc")
+
+// Constructor
+PYDOC(ConflatingReceiver_python, R"doc(
+Receiver keeping only the most recent message.
+
+A new message replaces the one that was not received yet, so the upstream operator is never
+blocked. Suited for display and UI branches that only care about the newest frame.
+
+Parameters
+----------
+fragment : holoscan.core.Fragment
+    The fragment to assign the resource to.
+key_by_tensor_name : bool, optional
+    Keep the latest message per tensor name instead of a single message.
+name : str, optional
+    The name of the receiver.
+)doc")
+
+PYDOC(gxf_typename, R"doc(
+The GXF type name of the resource.
+
+Returns
+-------
+str
+    The GXF type name of the resource
+)doc")
+
+PYDOC(setup, R"doc(
+Define the component specification.
+
+Parameters
+----------
+spec : holoscan.core.ComponentSpec
+    Component specification associated with the resource.
+)doc")
+
+}  // namespace ConflatingReceiver
+
+namespace RingBufferReceiver {
+
+PYDOC(RingBufferReceiver, R"doc(
+Receiver using a lock-free single-producer/single-consumer ring buffer.
+
+New messages are immediately available to the consumer, without a back stage.
+It can only be used for point-to-point connections.
+)doc")
+
+// Constructor
+PYDOC(RingBufferReceiver_python, R"doc(
+Receiver using a lock-free single-producer/single-consumer ring buffer.
+
+New messages are immediately available to the consumer, without a back stage.
+It can only be used for point-to-point connections.
+
+Parameters
+----------
+fragment : holoscan.core.Fragment
+    The fragment to assign the resource to.
+capacity : int, optional
+    The capacity of the receiver.
+policy : int, optional
+    The policy to use (0=pop, 1=reject, 2=fault).
+name : str, optional
+    The name of the receiver.
+)doc")
+
+PYDOC(gxf_typename, R"doc(
+The GXF type name of the resource.
+
+Returns
+-------
+str
+    The GXF type name of the resource
+)doc")
+
+PYDOC(setup, R"doc(
+Define the component specification.
+
+Parameters
+----------
+spec : holoscan.core.ComponentSpec
+    Component specification associated with the resource.
+)doc")
+
+}  // namespace RingBufferReceiver
+
+namespace RingBufferTransmitter {
+
+PYDOC(RingBufferTransmitter, R"doc(
+Transmitter using a lock-free single-producer/single-consumer ring buffer.
+
+Published messages are immediately available to the router, without a back stage.
+It can only be used for point-to-point connections.
+)doc")
+
+// Constructor
+PYDOC(RingBufferTransmitter_python, R"doc(
+Transmitter using a lock-free single-producer/single-consumer ring buffer.
+
+Published messages are immediately available to the router, without a back stage.
+It can only be used for point-to-point connections.
+
+Parameters
+----------
+fragment : holoscan.core.Fragment
+    The fragment to assign the resource to.
+capacity : int, optional
+    The capacity of the transmitter.
+policy : int, optional
+    The policy to use (0=pop, 1=reject, 2=fault).
+name : str, optional
+    The name of the transmitter.
+)doc")
+
+PYDOC(gxf_typename, R"doc(
+The GXF type name of the resource.
+
+Returns
+-------
+str
+    The GXF type name of the resource
+)doc")
+
+PYDOC(setup, R"doc(
+Define the component specification.
+
+Parameters
+----------
+spec : holoscan.core.ComponentSpec
+    Component specification associated with the resource.
+)doc")
+
+}  // namespace RingBufferTransmitter
+
 namespace UcxReceiver {
 
 PYDOC(UcxReceiver, R"doc(
@@ -880,6 +1358,48 @@ spec : holoscan.core.ComponentSpec
 
 }  // namespace ManualClock
 
+namespace TscClock {
+
+PYDOC(TscClock, R"doc(
+TSC clock class.
+)doc")
+
+// Constructor
+PYDOC(TscClock_python, R"doc(
+TSC clock.
+
+Real-time clock reading its timestamps from the CPU cycle counter (the TSC on x86, the generic
+timer on aarch64), calibrated against ``CLOCK_MONOTONIC`` at startup. ``CLOCK_MONOTONIC`` is used
+instead if the counter does not run at a constant rate. Timestamps are nanoseconds in the
+``CLOCK_MONOTONIC`` time base.
+
+Parameters
+----------
+fragment : holoscan.core.Fragment
+    The fragment to assign the resource to.
+name : str, optional
+    The name of the clock.
+)doc")
+
+PYDOC(gxf_typename, R"doc(
+The GXF type name of the resource.
+
+Returns
+-------
+str
+    The GXF type name of the resource
+)doc")
+
+PYDOC(source, R"doc(
+The source of the timestamps (``"tsc"``, ``"cntvct"`` or ``"clock_monotonic"``).
+)doc")
+
+PYDOC(frequency_hz, R"doc(
+The calibrated counter frequency in Hz.
+)doc")
+
+}  // namespace TscClock
+
 }  // namespace holoscan::doc
 
 #endif  // PYHOLOSCAN_RESOURCES_PYDOC_HPP
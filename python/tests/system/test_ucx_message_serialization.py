@@ -13,6 +13,8 @@
 # See the License for the specific language governing permissions and
 # limitations under the License.
 
+import array
+
 import pytest
 
 from holoscan.conditions import CountCondition
@@ -66,6 +68,12 @@ class PingMessageTxOp(Operator):
         elif self.value == "cupy":
             z = cp.zeros((16, 8, 4), dtype=cp.float32)
             op_output.emit(z, "out")
+        elif self.value == "numpy-mixed":
+            # pickled with the array data as an out-of-band buffer
+            mixed = dict(mask=np.arange(100000, dtype=np.uint8), label="mask", scale=0.5)
+            op_output.emit(mixed, "out")
+        elif self.value == "memoryview":
+            op_output.emit(memoryview(array.array("i", range(10000))), "out")
         else:
             op_output.emit(self.value, "out")
 
@@ -96,6 +104,20 @@ def _check_value(value, expected_value):
         # object with __cuda_array_attribute__ is deserialized as a CuPy array
         assert isinstance(value, cp.ndarray)
         assert value.shape == (16, 8, 4)
+    elif expected_value == "numpy-mixed":
+        assert isinstance(value, dict)
+        assert isinstance(value["mask"], np.ndarray)
+        assert value["mask"].shape == (100000,)
+        assert (value["mask"] == np.arange(100000, dtype=np.uint8)).all()
+        assert value["label"] == "mask"
+        assert value["scale"] == 0.5
+    elif expected_value == "memoryview":
+        assert isinstance(value, memoryview)
+        assert value.format == "i"
+        assert value.tolist() == list(range(10000))
+    elif isinstance(expected_value, (bytes, bytearray)):
+        assert type(value) is type(expected_value)
+        assert value == expected_value
     elif isinstance(expected_value, list) and isinstance(expected_value[0], HolovizOp.InputSpec):
         assert isinstance(value, list)
         assert len(value) == 2
@@ -173,11 +195,15 @@ class MultiFragmentPyObjectPingApp(Application):
         "numpy",  # single numpy array
         "cupy",  # single cupy array
         "input_specs",  # list of HolovizOp.InputSpec
+        "numpy-mixed",  # dict of a numpy array and other objects
+        b"\x01\x02" * 16384,  # bytes (sent without pickling)
+        bytearray(b"\x03\x04" * 16384),  # bytearray (sent without pickling)
+        "memoryview",  # memoryview (sent without pickling)
     ],
 )
 def test_ucx_object_serialization_app(ping_config_file, value, capfd):
     """Testing UCX-based serialization of PyObject, tensors, etc."""
-    if value == "numpy":
+    if value in ("numpy", "numpy-mixed"):
         pytest.importorskip("numpy")
     elif value == "cupy":
         pytest.importorskip("cupy")
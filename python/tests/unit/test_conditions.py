@@ -20,11 +20,13 @@ from holoscan.conditions import (
     BooleanCondition,
     CountCondition,
     DownstreamMessageAffordableCondition,
+    MemoryAvailableCondition,
     MessageAvailableCondition,
     PeriodicCondition,
 )
 from holoscan.core import Application, Condition, ConditionType, Operator
 from holoscan.gxf import Entity, GXFCondition
+from holoscan.resources import UnboundedAllocator
 
 
 class TestBooleanCondition:
@@ -99,6 +101,30 @@ class TestDownstreamMessageAffordableCondition:
         DownstreamMessageAffordableCondition(app, 4, "affordable")
 
 
+class TestMemoryAvailableCondition:
+    def test_kwarg_based_initialization(self, app, capfd):
+        cond = MemoryAvailableCondition(
+            fragment=app,
+            allocator=UnboundedAllocator(app, name="unbounded"),
+            min_bytes=1024,
+            poll_period_ns=5_000_000,
+            name="memory_available",
+        )
+        assert isinstance(cond, GXFCondition)
+        assert isinstance(cond, Condition)
+        assert cond.gxf_typename == "holoscan::MemoryAvailableSchedulingTerm"
+        assert cond.min_bytes == 1024
+        assert cond.poll_period_ns == 5_000_000
+
+        # assert no warnings or errors logged
+        captured = capfd.readouterr()
+        assert "error" not in captured.err
+        assert "warning" not in captured.err
+
+    def test_positional_initialization(self, app):
+        MemoryAvailableCondition(app, UnboundedAllocator(app), 4096, 1_000_000, "memory_available")
+
+
 class TestMessageAvailableCondition:
     def test_kwarg_based_initialization(self, app, capfd):
         cond = MessageAvailableCondition(
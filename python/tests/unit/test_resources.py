@@ -18,17 +18,23 @@ from holoscan.gxf import GXFResource
 from holoscan.resources import (
     Allocator,
     BlockMemoryPool,
+    BlockingAllocator,
     Clock,
     CudaStreamPool,
     DoubleBufferReceiver,
     DoubleBufferTransmitter,
+    HugePageMemoryPool,
     ManualClock,
     MemoryStorageType,
+    NumaAllocator,
     RealtimeClock,
     Receiver,
+    RecyclingAllocator,
     SerializationBuffer,
+    SlabMemoryPool,
     StdComponentSerializer,
     Transmitter,
+    TscClock,
     UcxComponentSerializer,
     UcxEntitySerializer,
     UcxHoloscanComponentSerializer,
@@ -111,6 +117,132 @@ class TestUnboundedAllocator:
         UnboundedAllocator(app)
 
 
+class TestBlockingAllocator:
+    def test_kwarg_based_initialization(self, app, capfd):
+        alloc = BlockingAllocator(
+            fragment=app,
+            allocator=UnboundedAllocator(app, name="unbounded"),
+            timeout_ms=50,
+            name="blocking_allocator",
+        )
+        assert isinstance(alloc, Allocator)
+        assert isinstance(alloc, GXFResource)
+        assert isinstance(alloc, Resource)
+        assert alloc.id != -1
+        assert alloc.gxf_typename == "holoscan::BackpressureAllocator"
+        assert alloc.stats()["timeouts"] == 0
+        assert alloc.stats()["errors"] == 0
+
+        # assert no warnings or errors logged
+        captured = capfd.readouterr()
+        assert "error" not in captured.err
+        assert "warning" not in captured.err
+
+
+class TestRecyclingAllocator:
+    def test_kwarg_based_initialization(self, app, capfd):
+        alloc = RecyclingAllocator(
+            fragment=app,
+            allocator=UnboundedAllocator(app, name="unbounded"),
+            max_buffers_per_size=2,
+            name="recycling_allocator",
+        )
+        assert isinstance(alloc, Allocator)
+        assert isinstance(alloc, GXFResource)
+        assert isinstance(alloc, Resource)
+        assert alloc.id != -1
+        assert alloc.gxf_typename == "holoscan::BufferRecyclingAllocator"
+        assert alloc.stats()["hits"] == 0
+
+        # assert no warnings or errors logged
+        captured = capfd.readouterr()
+        assert "error" not in captured.err
+        assert "warning" not in captured.err
+
+    def test_default_initialization(self, app):
+        RecyclingAllocator(app)
+
+
+class TestSlabMemoryPool:
+    def test_kwarg_based_initialization(self, app, capfd):
+        pool = SlabMemoryPool(
+            fragment=app,
+            storage_type=MemoryStorageType.SYSTEM,
+            size_classes=[1024, 65536, 1048576],
+            thread_cache_size=8,
+            name="slab_pool",
+        )
+        assert isinstance(pool, Allocator)
+        assert isinstance(pool, GXFResource)
+        assert isinstance(pool, Resource)
+        assert pool.id != -1
+        assert pool.gxf_typename == "holoscan::SlabAllocator"
+        assert pool.stats()["allocations"] == 0
+        # allocations are not tracked unless HOLOSCAN_ALLOCATOR_STATS is set
+        assert pool.allocation_stats()["allocations"] == 0
+        assert pool.allocation_stats()["holders"] == []
+
+        # assert no warnings or errors logged
+        captured = capfd.readouterr()
+        assert "error" not in captured.err
+        assert "warning" not in captured.err
+
+    def test_default_initialization(self, app):
+        SlabMemoryPool(app)
+
+
+class TestHugePageMemoryPool:
+    def test_kwarg_based_initialization(self, app, capfd):
+        # huge pages are disabled as they may not be available (a warning is logged on fallback)
+        pool = HugePageMemoryPool(
+            fragment=app,
+            storage_type=MemoryStorageType.SYSTEM,
+            block_size=1024 * 1024,
+            num_blocks=4,
+            huge_pages=False,
+            name="huge_page_pool",
+        )
+        assert isinstance(pool, Allocator)
+        assert isinstance(pool, GXFResource)
+        assert isinstance(pool, Resource)
+        assert pool.id != -1
+        assert pool.gxf_typename == "holoscan::HugePageAllocator"
+        stats = pool.stats()
+        assert stats["allocations"] == 0
+        assert stats["reserved_bytes"] >= 4 * 1024 * 1024
+
+        # assert no warnings or errors logged
+        captured = capfd.readouterr()
+        assert "error" not in captured.err
+        assert "warning" not in captured.err
+
+
+class TestNumaAllocator:
+    def test_kwarg_based_initialization(self, app, capfd):
+        allocator = NumaAllocator(
+            fragment=app,
+            storage_type=MemoryStorageType.SYSTEM,
+            numa_node=-1,
+            name="numa_allocator",
+        )
+        assert isinstance(allocator, Allocator)
+        assert isinstance(allocator, GXFResource)
+        assert isinstance(allocator, Resource)
+        assert allocator.id != -1
+        assert allocator.gxf_typename == "holoscan::NumaBindingAllocator"
+        stats = allocator.stats()
+        assert stats["allocations"] == 0
+        assert stats["in_use_bytes_per_node"] == {}
+
+        # assert no warnings or errors logged
+        captured = capfd.readouterr()
+        assert "error" not in captured.err
+        assert "warning" not in captured.err
+
+    def test_default_initialization(self, app):
+        NumaAllocator(app)
+
+
 class TestStdDoubleBufferReceiver:
     def test_kwarg_based_initialization(self, app, capfd):
         r = DoubleBufferReceiver(
@@ -243,6 +375,30 @@ class TestRealtimeClock:
         RealtimeClock(app, 10.0, 2.0, True, "realtime")
 
 
+class TestTscClock:
+    def test_kwarg_based_initialization(self, app, capfd):
+        clk = TscClock(fragment=app, name="tsc")
+        assert isinstance(clk, Clock)
+        assert isinstance(clk, GXFResource)
+        assert isinstance(clk, Resource)
+        assert clk.id != -1
+        assert clk.gxf_typename == "holoscan::TimestampCounterClock"
+        assert clk.source in ("tsc", "cntvct", "clock_monotonic")
+        assert clk.frequency_hz > 0
+
+        start = clk.timestamp()
+        clk.sleep_for(1_000_000)
+        assert clk.timestamp() - start >= 1_000_000
+
+        # assert no warnings or errors logged
+        captured = capfd.readouterr()
+        assert "error" not in captured.err
+        assert "warning" not in captured.err
+
+    def test_positional_initialization(self, app):
+        TscClock(app, "tsc")
+
+
 class TestSerializationBuffer:
     def test_kwarg_based_initialization(self, app, capfd):
         res = SerializationBuffer(
@@ -18,12 +18,15 @@
 #include "holoscan/core/app_driver.hpp"
 
 #include <stdlib.h>  // POSIX setenv
+#include <unistd.h>  // getpid
 
 #include <algorithm>
 #include <chrono>
 #include <cstdlib>
 #include <deque>
+#include <future>
 #include <memory>
+#include <random>
 #include <string>
 #include <thread>
 #include <unordered_map>
@@ -35,11 +38,15 @@
 #include "holoscan/core/app_worker.hpp"
 #include "holoscan/core/application.hpp"
 #include "holoscan/core/cli_options.hpp"
+#include "holoscan/core/codec_registry.hpp"
 #include "holoscan/core/executors/gxf/gxf_executor.hpp"
 #include "holoscan/core/fragment.hpp"
 #include "holoscan/core/graph.hpp"  // for FragmentNodeType
 #include "holoscan/core/gxf/gxf_resource.hpp"
 #include "holoscan/core/network_contexts/gxf/ucx_context.hpp"
+#include "holoscan/core/payload_compression.hpp"
+#include "holoscan/core/resources/gxf/shared_memory_segment.hpp"
+#include "holoscan/core/resources/gxf/ucx_coalescing_transmitter.hpp"
 #include "holoscan/core/schedulers/greedy_fragment_allocation.hpp"
 #include "holoscan/core/schedulers/gxf/greedy_scheduler.hpp"
 #include "holoscan/core/schedulers/gxf/multithread_scheduler.hpp"
@@ -47,6 +54,8 @@
 #include "holoscan/core/services/app_worker/server.hpp"
 #include "holoscan/core/services/common/network_constants.hpp"
 #include "holoscan/core/signal_handler.hpp"
+#include "holoscan/core/startup_profiler.hpp"
+#include "holoscan/core/system/env_utils.hpp"
 #include "holoscan/core/system/network_utils.hpp"
 #include <holoscan/core/system/system_resource_manager.hpp>
 #include "services/app_worker/client.hpp"
@@ -55,18 +64,24 @@
 
 namespace holoscan {
 
-bool AppDriver::get_bool_env_var(const char* name, bool default_value) {
-  const char* env_value = std::getenv(name);
+namespace {
 
-  if (env_value) {
-    std::string value(env_value);
-    std::transform(
-        value.begin(), value.end(), value.begin(), [](unsigned char c) { return std::tolower(c); });
+using StartupClock = std::chrono::steady_clock;
 
-    if (value == "true" || value == "1" || value == "on") { return true; }
-  }
+double elapsed_ms(StartupClock::time_point start) {
+  return std::chrono::duration<double, std::milli>(StartupClock::now() - start).count();
+}
 
-  return default_value;
+/// Check that POSIX shared memory (/dev/shm) can be used by creating a small segment.
+bool is_shared_memory_available() {
+  const std::string probe_name = fmt::format("/holoscan_probe_{}", getpid());
+  return SharedMemorySegment::create(probe_name, 1, 1) != nullptr;
+}
+
+}  // namespace
+
+bool AppDriver::get_bool_env_var(const char* name, bool default_value) {
+  return holoscan::get_bool_env_var(name, default_value);
 }
 
 int64_t AppDriver::get_int_env_var(const char* name, int64_t default_value) {
@@ -338,6 +353,18 @@ void AppDriver::submit_message(DriverMessage&& message) {
   driver_server_->notify();
 }
 
+void AppDriver::store_worker_codec_names(const std::string& worker_address,
+                                         std::vector<std::string> codec_names) {
+  std::lock_guard<std::mutex> lock(worker_negotiation_mutex_);
+  worker_codec_names_[worker_address] = std::move(codec_names);
+}
+
+void AppDriver::store_worker_compression_algorithms(const std::string& worker_address,
+                                                    std::vector<std::string> algorithms) {
+  std::lock_guard<std::mutex> lock(worker_negotiation_mutex_);
+  worker_compression_algorithms_[worker_address] = std::move(algorithms);
+}
+
 void AppDriver::process_message_queue() {
   std::lock_guard<std::mutex> lock(message_mutex_);
 
@@ -553,6 +580,10 @@ bool AppDriver::collect_connections(holoscan::FragmentGraph& fragment_graph) {
   int32_t port_index = 0;
   std::string ucx_rx_ip{"0.0.0.0"};
 
+  // Coalesce small messages sent over UCX if a coalescing window (in microseconds) is set.
+  const auto coalescing_window_us =
+      static_cast<int32_t>(get_int_env_var("HOLOSCAN_UCX_COALESCING_WINDOW_US", 0));
+
   while (true) {
     if (worklist.empty()) {
       // If the worklist is empty, we check if we have visited all nodes.
@@ -624,6 +655,14 @@ bool AppDriver::collect_connections(holoscan::FragmentGraph& fragment_graph) {
               IOSpec::ConnectorType::kUCX,
               ArgList({Arg("address", ucx_rx_ip), Arg("port", static_cast<int32_t>(port_index))}));
 
+          // Both sides need to know about coalescing (the receiver unpacks the batches).
+          if (coalescing_window_us > 0) {
+            source_connection_item->args.add(
+                Arg(kUcxCoalescingWindowArgName, coalescing_window_us));
+            target_connection_item->args.add(
+                Arg(kUcxCoalescingWindowArgName, coalescing_window_us));
+          }
+
           // Initialize map for the port index
           if (receiver_port_map_.find(frag_name) == receiver_port_map_.end()) {
             receiver_port_map_[frag_name] =
@@ -635,6 +674,9 @@ bool AppDriver::collect_connections(holoscan::FragmentGraph& fragment_graph) {
           }
           index_to_port_map_[port_index] = -1;
           index_to_ip_map_[port_index] = frag_name;
+          index_to_fragments_map_[port_index] = {prev_frag_name, frag_name};
+          index_to_connection_items_map_[port_index] = {source_connection_item,
+                                                        target_connection_item};
 
           // Add the connection item to the connection map
           connection_map_[prev_frag].push_back(source_connection_item);
@@ -650,6 +692,57 @@ bool AppDriver::collect_connections(holoscan::FragmentGraph& fragment_graph) {
   return true;
 }
 
+void AppDriver::use_shared_memory_for_colocated_fragments(
+    const std::unordered_map<std::string, std::string>& fragment_hosts) {
+  if (!get_bool_env_var("HOLOSCAN_ENABLE_SHARED_MEMORY_TRANSPORT", false)) { return; }
+  if (!is_shared_memory_available()) {
+    HOLOSCAN_LOG_WARN(
+        "HOLOSCAN_ENABLE_SHARED_MEMORY_TRANSPORT is set but POSIX shared memory is not available "
+        "on this host. Using UCX between the fragments.");
+    return;
+  }
+
+  // Segment names must be unique on the host, and stale segments of a previous run are replaced.
+  const std::string segment_prefix =
+      fmt::format("/holoscan_{}_{:08x}", getpid(), std::random_device{}());
+
+  for (const auto& [port_index, fragment_names] : index_to_fragments_map_) {
+    const auto& [source_name, target_name] = fragment_names;
+    auto source_host = fragment_hosts.find(source_name);
+    auto target_host = fragment_hosts.find(target_name);
+    if (source_host == fragment_hosts.end() || target_host == fragment_hosts.end() ||
+        source_host->second != target_host->second) {
+      continue;
+    }
+
+    auto& [source_item, target_item] = index_to_connection_items_map_[port_index];
+    const std::string segment_name = fmt::format("{}_{}", segment_prefix, port_index);
+    source_item->connector_type = IOSpec::ConnectorType::kSharedMemory;
+    source_item->args = ArgList({Arg("segment_name", segment_name)});
+    target_item->connector_type = IOSpec::ConnectorType::kSharedMemory;
+    target_item->args = ArgList({Arg("segment_name", segment_name)});
+
+    // No network port is needed for this connection.
+    index_to_ip_map_.erase(port_index);
+    index_to_port_map_.erase(port_index);
+    auto& receiver_ports = receiver_port_map_[target_name];
+    receiver_ports.erase(std::remove_if(receiver_ports.begin(),
+                                        receiver_ports.end(),
+                                        [index = port_index](const auto& port) {
+                                          return port.first == index;
+                                        }),
+                         receiver_ports.end());
+
+    HOLOSCAN_LOG_INFO("Connecting fragment '{}' ({}) to fragment '{}' ({}) through shared memory "
+                      "segment '{}'",
+                      source_name,
+                      source_item->name,
+                      target_name,
+                      target_item->name,
+                      segment_name);
+  }
+}
+
 void AppDriver::correct_connection_map() {
   for (auto& [fragment, connections] : connection_map_) {
     for (auto& connection : connections) {
@@ -774,6 +867,32 @@ void AppDriver::collect_resource_requirements(const Config& app_config,
             }
           }
         }
+
+        // Expected bandwidth of the connections between fragments, used by the
+        // 'communication_aware' allocation strategy.
+        auto connections_node = resources["connections"];
+        if (connections_node.IsSequence()) {
+          for (const auto& connection_node : connections_node) {
+            FragmentConnectionRequirement connection_requirement;
+            connection_requirement.source_fragment =
+                connection_node["source"].as<std::string>("");
+            connection_requirement.target_fragment =
+                connection_node["target"].as<std::string>("");
+            if (!fragment_graph.find_node(connection_requirement.source_fragment) ||
+                !fragment_graph.find_node(connection_requirement.target_fragment)) {
+              HOLOSCAN_LOG_WARN("Ignoring the connection requirement from '{}' to '{}' (unknown "
+                                "fragment)",
+                                connection_requirement.source_fragment,
+                                connection_requirement.target_fragment);
+              continue;
+            }
+            if (connection_node["bandwidth"]) {
+              connection_requirement.bandwidth =
+                  parse_memory_size(connection_node["bandwidth"].as<std::string>());
+            }
+            fragment_scheduler_->add_connection_requirement(connection_requirement);
+          }
+        }
       }
     } catch (std::exception& e) {}
   }
@@ -786,6 +905,33 @@ void AppDriver::collect_resource_requirements(const Config& app_config,
   }
 }
 
+std::unique_ptr<FragmentAllocationStrategy> AppDriver::make_allocation_strategy(
+    const Config& app_config) {
+  std::string strategy_name;
+  uint32_t max_fragments_per_worker = 1;
+  for (const auto& yaml_node : app_config.yaml_nodes()) {
+    try {
+      auto resources = yaml_node["resources"];
+      if (resources.IsMap()) {
+        strategy_name = resources["allocationStrategy"].as<std::string>(strategy_name);
+        max_fragments_per_worker =
+            resources["maxFragmentsPerWorker"].as<uint32_t>(max_fragments_per_worker);
+      }
+    } catch (std::exception& e) {
+      HOLOSCAN_LOG_ERROR("Unable to parse the fragment allocation strategy: {}", e.what());
+    }
+  }
+
+  auto strategy = make_fragment_allocation_strategy(strategy_name, max_fragments_per_worker);
+  if (!strategy) {
+    HOLOSCAN_LOG_ERROR("{}. Using the 'greedy' strategy.", strategy.error());
+    return std::make_unique<GreedyFragmentAllocationStrategy>();
+  }
+  HOLOSCAN_LOG_DEBUG("Fragment allocation strategy: '{}'",
+                     strategy_name.empty() ? "greedy" : strategy_name);
+  return std::move(strategy.value());
+}
+
 SystemResourceRequirement AppDriver::parse_resource_requirement(const YAML::Node& node) {
   SystemResourceRequirement req{};
   return parse_resource_requirement("", node, req);
@@ -826,14 +972,138 @@ SystemResourceRequirement AppDriver::parse_resource_requirement(
   return req;
 }
 
+std::vector<std::string> AppDriver::negotiate_codec_table(
+    const std::vector<std::string>& worker_ids) {
+  // The driver's codec names come first so that the codec ids follow its registration order.
+  std::vector<std::vector<std::string>> codec_name_lists{
+      CodecRegistry::get_instance().codec_names()};
+  {
+    std::lock_guard<std::mutex> lock(worker_negotiation_mutex_);
+    for (const auto& worker_id : worker_ids) {
+      auto loc = worker_codec_names_.find(worker_id);
+      if (loc == worker_codec_names_.end()) {
+        // Workers that did not report their codecs only understand codec names.
+        HOLOSCAN_LOG_DEBUG("Worker '{}' did not report its codecs", worker_id);
+        return {};
+      }
+      codec_name_lists.push_back(loc->second);
+    }
+  }
+
+  auto codec_table = CodecRegistry::common_codec_table(codec_name_lists);
+  HOLOSCAN_LOG_DEBUG("Codec table: {} codecs shared by the driver and {} workers",
+                     codec_table.size(),
+                     worker_ids.size());
+  return codec_table;
+}
+
+std::vector<std::string> AppDriver::negotiate_compression_algorithms(
+    const std::vector<std::string>& worker_ids) {
+  std::vector<std::string> algorithms = PayloadCompression::available_algorithms();
+  {
+    std::lock_guard<std::mutex> lock(worker_negotiation_mutex_);
+    for (const auto& worker_id : worker_ids) {
+      auto loc = worker_compression_algorithms_.find(worker_id);
+      if (loc == worker_compression_algorithms_.end()) {
+        // Workers that did not report their algorithms cannot decompress payloads.
+        HOLOSCAN_LOG_DEBUG("Worker '{}' did not report its compression algorithms", worker_id);
+        return {};
+      }
+      const auto& worker_algorithms = loc->second;
+      algorithms.erase(std::remove_if(algorithms.begin(),
+                                      algorithms.end(),
+                                      [&worker_algorithms](const std::string& algorithm) {
+                                        return std::find(worker_algorithms.begin(),
+                                                         worker_algorithms.end(),
+                                                         algorithm) == worker_algorithms.end();
+                                      }),
+                       algorithms.end());
+    }
+  }
+
+  HOLOSCAN_LOG_DEBUG("Compression algorithms supported by the driver and {} workers: [{}]",
+                     worker_ids.size(),
+                     fmt::join(algorithms, ", "));
+  return algorithms;
+}
+
+std::unordered_map<std::string, std::size_t> AppDriver::estimate_receiver_port_counts(
+    holoscan::FragmentGraph& fragment_graph) {
+  std::unordered_map<std::string, std::size_t> port_counts;
+  for (auto& frag : fragment_graph.get_nodes()) {
+    for (auto& prev_frag : fragment_graph.get_previous_nodes(frag)) {
+      auto port_map = fragment_graph.get_port_map(prev_frag, frag);
+      if (!port_map.has_value()) { continue; }
+      // Port names are only corrected (not added) once the fragments are composed.
+      for (const auto& [source_op_port, target_op_ports] : *port_map.value()) {
+        port_counts[frag->name()] += target_op_ports.size();
+      }
+    }
+  }
+  return port_counts;
+}
+
+std::unordered_map<std::string, std::vector<int32_t>> AppDriver::request_available_ports(
+    const std::unordered_map<std::string, std::size_t>& worker_port_counts,
+    std::unordered_map<std::string, std::vector<uint32_t>>& used_ports_map, std::launch policy) {
+  // Group the workers by IP address. Clients are looked up here so that the tasks below do not
+  // access the worker connections of the driver server.
+  std::unordered_map<std::string, std::vector<std::pair<std::string, service::AppWorkerClient*>>>
+      ip_workers;
+  for (const auto& [worker_id, port_count] : worker_port_counts) {
+    auto& worker_client = driver_server_->connect_to_worker(worker_id);
+    ip_workers[worker_client->ip_address()].emplace_back(worker_id, worker_client.get());
+  }
+  for (const auto& [ip_address, workers] : ip_workers) { used_ports_map[ip_address]; }
+
+  using WorkerPorts = std::vector<std::pair<std::string, std::vector<int32_t>>>;
+  std::vector<std::future<WorkerPorts>> futures;
+  futures.reserve(ip_workers.size());
+  for (auto& ip_entry : ip_workers) {
+    // Structured bindings cannot be captured by the lambda (C++17)
+    const auto& workers = ip_entry.second;
+    auto& used_ports = used_ports_map[ip_entry.first];
+    futures.push_back(std::async(policy, [&workers, &used_ports, &worker_port_counts]() {
+      WorkerPorts worker_ports;
+      for (const auto& [worker_id, worker_client] : workers) {
+        auto port_count = worker_port_counts.at(worker_id);
+        if (port_count == 0) {
+          worker_ports.emplace_back(worker_id, std::vector<int32_t>());
+          continue;
+        }
+        auto available_ports = worker_client->available_ports(
+            port_count, service::kMinNetworkPort, service::kMaxNetworkPort, used_ports);
+        used_ports.insert(used_ports.end(), available_ports.begin(), available_ports.end());
+        worker_ports.emplace_back(worker_id, std::move(available_ports));
+      }
+      return worker_ports;
+    }));
+  }
+
+  std::unordered_map<std::string, std::vector<int32_t>> result;
+  for (auto& future : futures) {
+    for (auto& [worker_id, ports] : future.get()) { result[worker_id] = std::move(ports); }
+  }
+  return result;
+}
+
 void AppDriver::check_fragment_schedule(const std::string& worker_address) {
   // Create a client to communicate with the worker
   if (!worker_address.empty() && worker_address != "") {
     driver_server_->connect_to_worker(worker_address);
   }
 
+  StartupProfiler startup_profiler("driver");
+  const auto schedule_start = StartupClock::now();
   auto schedule_result = fragment_scheduler_->schedule();
   if (schedule_result) {
+    startup_profiler.record(StartupProfiler::kSchedule, elapsed_ms(schedule_start));
+
+    // Deferred tasks run one after another on this thread when their results are requested.
+    const std::launch request_policy = get_bool_env_var("HOLOSCAN_PARALLEL_WORKER_REQUESTS", true)
+                                           ? std::launch::async
+                                           : std::launch::deferred;
+
     // Keep the used ports for the IP address to avoid port conflicts
     std::unordered_map<std::string, std::vector<uint32_t>> used_ports_map;
 
@@ -848,22 +1118,65 @@ void AppDriver::check_fragment_schedule(const std::string& worker_address) {
     std::unordered_set<std::string> not_participated_workers(worker_addresses.begin(),
                                                              worker_addresses.end());
     for (auto& [fragment_name, worker_id] : schedule) { not_participated_workers.erase(worker_id); }
+    std::vector<std::future<bool>> termination_futures;
+    termination_futures.reserve(not_participated_workers.size());
     for (const auto& worker_address : not_participated_workers) {
       HOLOSCAN_LOG_INFO("{}' does not participate in the schedule", worker_address);
-      auto& worker_client = driver_server_->connect_to_worker(worker_address);
-      worker_client->terminate_worker(AppWorkerTerminationCode::kCancelled);
+      auto* worker_client = driver_server_->connect_to_worker(worker_address).get();
+      termination_futures.push_back(std::async(request_policy, [worker_client]() {
+        return worker_client->terminate_worker(AppWorkerTerminationCode::kCancelled);
+      }));
+    }
+    for (auto& future : termination_futures) { future.wait(); }
+    for (const auto& worker_address : not_participated_workers) {
       driver_server_->close_worker_connection(worker_address);
     }
 
     auto& fragment_graph = app_->fragment_graph();
     auto target_fragments = fragment_graph.get_nodes();
 
+    // Construct worker_id to the vector of fragment name map
+    std::unordered_map<std::string, std::vector<std::string>> worker_fragment_map;
+    for (const auto& [fragment_name, worker_id] : schedule) {
+      worker_fragment_map[worker_id].push_back(fragment_name);
+    }
+
+    // Request the ports of the workers while the fragment graphs are composed. The number of
+    // ports is estimated from the fragment graph as the connections are not collected yet.
+    auto estimated_port_counts = estimate_receiver_port_counts(fragment_graph);
+    std::unordered_map<std::string, std::size_t> estimated_worker_port_counts;
+    for (const auto& [worker_id, fragment_names] : worker_fragment_map) {
+      auto& port_count = estimated_worker_port_counts[worker_id];
+      for (const auto& fragment_name : fragment_names) {
+        port_count += estimated_port_counts[fragment_name];
+      }
+      HOLOSCAN_LOG_DEBUG("Worker {} has {} fragments and needs at most {} ports",
+                         worker_id,
+                         fragment_names.size(),
+                         port_count);
+    }
+    auto reserved_ports_future = std::async(request_policy, [&]() {
+      StartupProfiler::ScopedPhase phase(startup_profiler, StartupProfiler::kPortNegotiation);
+      return request_available_ports(estimated_worker_port_counts, used_ports_map, request_policy);
+    });
+
     // Compose fragment graphs
-    for (auto& fragment : target_fragments) { fragment->compose_graph(); }
+    {
+      StartupProfiler::ScopedPhase phase(startup_profiler, StartupProfiler::kCompose);
+      for (auto& fragment : target_fragments) { fragment->compose_graph(); }
+    }
 
     // Collect connections
     if (!collect_connections(fragment_graph)) { HOLOSCAN_LOG_ERROR("Cannot collect connections"); }
 
+    // Connect fragments assigned to workers on the same host through shared memory
+    std::unordered_map<std::string, std::string> fragment_hosts;
+    for (const auto& [fragment_name, worker_id] : schedule) {
+      auto& worker_client = driver_server_->connect_to_worker(worker_id);
+      fragment_hosts[fragment_name] = worker_client->ip_address();
+    }
+    use_shared_memory_for_colocated_fragments(fragment_hosts);
+
     // Collect # of connectors for each fragment
     std::unordered_map<std::string, int> fragment_connector_count;
     for (const auto& fragment : target_fragments) {
@@ -881,32 +1194,38 @@ void AppDriver::check_fragment_schedule(const std::string& worker_address) {
       fragment_name = worker_client->ip_address();
     }
 
-    // Construct worker_id to the vector of fragment name map
-    std::unordered_map<std::string, std::vector<std::string>> worker_fragment_map;
-    for (const auto& [fragment_name, worker_id] : schedule) {
-      worker_fragment_map[worker_id].push_back(fragment_name);
-    }
-
+    std::unordered_map<std::string, std::size_t> worker_port_counts;
     for (const auto& [worker_id, fragment_names] : worker_fragment_map) {
-      HOLOSCAN_LOG_DEBUG("Worker {} has {} fragments", worker_id, fragment_names.size());
-      std::size_t total_port_count = 0;
+      auto& port_count = worker_port_counts[worker_id];
       for (const auto& fragment_name : fragment_names) {
-        total_port_count += fragment_connector_count[fragment_name];
+        port_count += fragment_connector_count[fragment_name];
       }
-      HOLOSCAN_LOG_DEBUG("Worker {} needs {} ports", worker_id, total_port_count);
-
-      auto& worker_client = driver_server_->connect_to_worker(worker_id);
+      HOLOSCAN_LOG_DEBUG("Worker {} needs {} ports", worker_id, port_count);
+    }
 
-      // Check available ports
-      auto& ip_address = worker_client->ip_address();
-      if (used_ports_map.find(ip_address) == used_ports_map.end()) {
-        used_ports_map.emplace(ip_address, std::vector<uint32_t>());
+    // Request the missing ports if the estimate was too low (should not happen)
+    auto worker_ports = reserved_ports_future.get();
+    std::unordered_map<std::string, std::size_t> missing_port_counts;
+    for (const auto& [worker_id, port_count] : worker_port_counts) {
+      const auto reserved_port_count = worker_ports[worker_id].size();
+      if (reserved_port_count < port_count) {
+        missing_port_counts[worker_id] = port_count - reserved_port_count;
+      }
+    }
+    if (!missing_port_counts.empty()) {
+      HOLOSCAN_LOG_DEBUG("Requesting missing ports for {} workers", missing_port_counts.size());
+      for (auto& [worker_id, ports] :
+           request_available_ports(missing_port_counts, used_ports_map, request_policy)) {
+        auto& reserved_ports = worker_ports[worker_id];
+        reserved_ports.insert(reserved_ports.end(), ports.begin(), ports.end());
       }
-      auto& used_ports = used_ports_map[ip_address];
-      auto available_ports = worker_client->available_ports(
-          total_port_count, service::kMinNetworkPort, service::kMaxNetworkPort, used_ports);
+    }
+
+    for (const auto& [worker_id, fragment_names] : worker_fragment_map) {
+      auto total_port_count = worker_port_counts[worker_id];
+      auto& available_ports = worker_ports[worker_id];
 
-      if (available_ports.size() != total_port_count) {
+      if (available_ports.size() < total_port_count) {
         HOLOSCAN_LOG_ERROR("Worker {} does not have enough ports (required: {}, available: {})",
                            worker_id,
                            total_port_count,
@@ -914,7 +1233,6 @@ void AppDriver::check_fragment_schedule(const std::string& worker_address) {
         // TODO(gbae): Handle this error (remove the worker and client from the schedule)
         return;
       }
-      used_ports.insert(used_ports.end(), available_ports.begin(), available_ports.end());
 
       // Assign receiver_port_map_ and index_to_port_map_ with the real port number.
       int32_t worker_port_index = 0;
@@ -932,7 +1250,19 @@ void AppDriver::check_fragment_schedule(const std::string& worker_address) {
     // Update connection_map_ with the real address and port numbers
     correct_connection_map();
 
-    // Request worker to launch fragments
+    // Build the codec table shared by all the participating workers
+    std::vector<std::string> worker_ids;
+    worker_ids.reserve(worker_fragment_map.size());
+    for (const auto& [worker_id, fragment_names] : worker_fragment_map) {
+      worker_ids.push_back(worker_id);
+    }
+    auto codec_table = negotiate_codec_table(worker_ids);
+    auto compression_algorithms = negotiate_compression_algorithms(worker_ids);
+
+    // Request workers to launch fragments
+    const auto launch_start = StartupClock::now();
+    std::vector<std::pair<std::string, std::future<bool>>> launch_futures;
+    launch_futures.reserve(worker_fragment_map.size());
     for (const auto& [worker_id, fragment_names] : worker_fragment_map) {
       std::vector<std::shared_ptr<Fragment>> fragment_vector;
       fragment_vector.reserve(fragment_names.size());
@@ -942,23 +1272,43 @@ void AppDriver::check_fragment_schedule(const std::string& worker_address) {
         fragment_vector.push_back(fragment);
       }
 
-      auto& worker_client = driver_server_->connect_to_worker(worker_id);
-      bool result = worker_client->fragment_execution(fragment_vector, connection_map_);
-      if (!result) {
-        HOLOSCAN_LOG_ERROR("Cannot launch fragments on worker {}", worker_id);
+      auto* worker_client = driver_server_->connect_to_worker(worker_id).get();
+      launch_futures.emplace_back(
+          worker_id,
+          std::async(request_policy,
+                     [this,
+                      worker_client,
+                      fragment_vector = std::move(fragment_vector),
+                      &codec_table,
+                      &compression_algorithms]() {
+                       return worker_client->fragment_execution(
+                           fragment_vector, connection_map_, codec_table, compression_algorithms);
+                     }));
+    }
 
-        // Terminate all worker and close all worker connections
-        terminate_all_workers(AppWorkerTerminationCode::kFailure);
+    bool is_launched = true;
+    for (auto& [worker_id, future] : launch_futures) {
+      if (!future.get()) {
+        HOLOSCAN_LOG_ERROR("Cannot launch fragments on worker {}", worker_id);
+        is_launched = false;
+      }
+    }
+    if (!is_launched) {
+      // Terminate all worker and close all worker connections
+      terminate_all_workers(AppWorkerTerminationCode::kFailure);
 
-        // Set app status to error
-        app_status_ = AppStatus::kError;
+      // Set app status to error
+      app_status_ = AppStatus::kError;
 
-        // Stop the driver server
-        driver_server_->stop();
-        // Do not call 'driver_server_->wait()' as current thread is the driver server thread
-        return;
-      }
+      // Stop the driver server
+      driver_server_->stop();
+      // Do not call 'driver_server_->wait()' as current thread is the driver server thread
+      return;
     }
+    startup_profiler.record(StartupProfiler::kLaunch,
+                            elapsed_ms(launch_start),
+                            fmt::format("{} workers", worker_fragment_map.size()));
+    startup_profiler.log_report(app_->name());
 
     // Update app status
     app_status_ = AppStatus::kRunning;
@@ -1024,14 +1374,15 @@ void AppDriver::launch_app_driver() {
   if (need_driver_ || need_health_check_) {
     HOLOSCAN_LOG_INFO("Launching the driver/health checking service");
 
+    // Get the system resource requirements for each fragment
+    const auto& app_config = app_->config();
+
     // Initialize fragment scheduler
     if (!fragment_scheduler_) {
       fragment_scheduler_ =
-          std::make_unique<FragmentScheduler>(std::make_unique<GreedyFragmentAllocationStrategy>());
+          std::make_unique<FragmentScheduler>(make_allocation_strategy(app_config));
     }
 
-    // Get the system resource requirements for each fragment
-    const auto& app_config = app_->config();
     auto& fragment_graph = app_->fragment_graph();
     collect_resource_requirements(app_config, fragment_graph);
 
@@ -1063,14 +1414,20 @@ std::future<void> AppDriver::launch_fragments_async(
     HOLOSCAN_LOG_ERROR("Cannot collect connections");
     return std::async(std::launch::async, []() {});
   }
+  // All the fragments run in this process, so they can be connected through shared memory
+  std::unordered_map<std::string, std::string> fragment_hosts;
+  for (const auto& fragment : target_fragments) { fragment_hosts[fragment->name()] = "0.0.0.0"; }
+  use_shared_memory_for_colocated_fragments(fragment_hosts);
+
   // Correct connection_map_ with the real address and port numbers
   int32_t required_port_count = index_to_ip_map_.size();
   auto unused_ports = get_unused_network_ports(
       required_port_count, service::kMinNetworkPort, service::kMaxNetworkPort);
 
-  for (int port_index = 0; port_index < required_port_count; ++port_index) {
-    index_to_ip_map_[port_index] = "0.0.0.0";
-    index_to_port_map_[port_index] = unused_ports[port_index];
+  int32_t unused_port_index = 0;
+  for (auto& [port_index, ip_address] : index_to_ip_map_) {
+    ip_address = "0.0.0.0";
+    index_to_port_map_[port_index] = unused_ports[unused_port_index++];
   }
   correct_connection_map();
 
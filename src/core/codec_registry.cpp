@@ -17,6 +17,14 @@
 
 #include "holoscan/core/codec_registry.hpp"
 
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
 namespace holoscan {
 
 CodecRegistry& CodecRegistry::get_instance() {
@@ -24,4 +32,78 @@ CodecRegistry& CodecRegistry::get_instance() {
   return instance;
 }
 
+void CodecRegistry::set_codec_table(const std::vector<std::string>& codec_names) {
+  std::lock_guard<std::mutex> lock(codec_table_mutex_);
+  auto table = std::make_shared<CodecTable>();
+
+  // the last id is reserved for codecs sent by name
+  const size_t table_size = std::min(codec_names.size(), static_cast<size_t>(kInvalidCodecId));
+  if (table_size < codec_names.size()) {
+    HOLOSCAN_LOG_WARN("Codec table truncated to {} entries (requested: {})",
+                      table_size,
+                      codec_names.size());
+  }
+  table->codecs.resize(table_size, none_codec);
+  for (size_t id = 0; id < table_size; ++id) {
+    const auto& codec_name = codec_names[id];
+    table->name_to_codec_id_map.try_emplace(codec_name, static_cast<CodecId>(id));
+    auto index_loc = name_to_index_map_.find(codec_name);
+    if (index_loc != name_to_index_map_.end()) {
+      update_codec_table_entry(*table, index_loc->second, codec_name);
+    } else {
+      HOLOSCAN_LOG_DEBUG("No codec for name '{}' (codec id: {}) exists", codec_name, id);
+    }
+  }
+  std::atomic_store(&codec_table_, std::shared_ptr<const CodecTable>(std::move(table)));
+}
+
+std::vector<std::string> CodecRegistry::common_codec_table(
+    const std::vector<std::vector<std::string>>& codec_name_lists) {
+  if (codec_name_lists.empty()) { return {}; }
+
+  std::vector<std::unordered_set<std::string>> name_sets;
+  name_sets.reserve(codec_name_lists.size() - 1);
+  for (size_t i = 1; i < codec_name_lists.size(); ++i) {
+    name_sets.emplace_back(codec_name_lists[i].begin(), codec_name_lists[i].end());
+  }
+
+  std::vector<std::string> codec_table;
+  std::unordered_set<std::string> added_names;
+  for (const auto& codec_name : codec_name_lists[0]) {
+    if (codec_table.size() >= kInvalidCodecId) { break; }
+    bool is_common = std::all_of(name_sets.begin(), name_sets.end(), [&codec_name](auto& names) {
+      return names.count(codec_name) > 0;
+    });
+    if (is_common && added_names.insert(codec_name).second) { codec_table.push_back(codec_name); }
+  }
+  return codec_table;
+}
+
+void CodecRegistry::update_codec_table(const std::type_index& index,
+                                       const std::string& codec_name) {
+  if (std::find(codec_names_.begin(), codec_names_.end(), codec_name) == codec_names_.end()) {
+    codec_names_.push_back(codec_name);
+  }
+
+  std::lock_guard<std::mutex> lock(codec_table_mutex_);
+  auto current_table = std::atomic_load(&codec_table_);
+  if (current_table->name_to_codec_id_map.count(codec_name) == 0) { return; }
+  // copy on write: readers may still use the current table
+  auto table = std::make_shared<CodecTable>(*current_table);
+  update_codec_table_entry(*table, index, codec_name);
+  std::atomic_store(&codec_table_, std::shared_ptr<const CodecTable>(std::move(table)));
+}
+
+void CodecRegistry::update_codec_table_entry(CodecTable& table, const std::type_index& index,
+                                             const std::string& codec_name) const {
+  auto id_loc = table.name_to_codec_id_map.find(codec_name);
+  if (id_loc == table.name_to_codec_id_map.end()) { return; }
+  auto codec_loc = codec_map_.find(codec_name);
+  if (codec_loc == codec_map_.end()) { return; }
+
+  const CodecId id = id_loc->second;
+  table.codecs[id] = codec_loc->second;
+  table.index_to_codec_id_map[index] = id;
+}
+
 }  // namespace holoscan
@@ -0,0 +1,42 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "holoscan/core/conditions/gxf/memory_available.hpp"
+
+#include "holoscan/core/component_spec.hpp"
+
+namespace holoscan {
+
+void MemoryAvailableCondition::setup(ComponentSpec& spec) {
+  spec.param(allocator_,
+             "allocator",
+             "Allocator",
+             "The term permits execution if this allocator can allocate `min_bytes` bytes.");
+  spec.param(min_bytes_,
+             "min_bytes",
+             "Minimum bytes",
+             "The size in bytes of the allocation which must be possible (e.g., the size of the "
+             "output buffer of the operator).",
+             1UL);
+  spec.param(poll_period_ns_,
+             "poll_period_ns",
+             "Poll period",
+             "The period in nanoseconds after which an exhausted allocator is checked again.",
+             1'000'000L);
+}
+
+}  // namespace holoscan
@@ -20,6 +20,7 @@
 #include <yaml-cpp/yaml.h>
 
 #include <string>
+#include <utility>
 
 namespace holoscan {
 
@@ -29,5 +30,64 @@ void Config::parse_file(const std::string& config_file) {
   } catch (const YAML::Exception& e) {
     HOLOSCAN_LOG_ERROR("Failed to load config file: '{}' ({})", config_file, e.what());
   }
+  build_key_index();
 }
+
+const ArgList* Config::find_args(const std::string& key) const {
+  auto it = key_index_.find(key);
+  if (it == key_index_.end()) { return nullptr; }
+  return &it->second.first;
+}
+
+void Config::build_key_index() {
+  key_index_.clear();
+  size_t map_document_count = 0;
+  for (const auto& yaml_node : yaml_nodes_) {
+    if (!yaml_node.IsMap()) { continue; }
+    ++map_document_count;
+    index_map(yaml_node, "");
+  }
+
+  // Fragment::from_config() logs an error for each document missing the key, so such keys are
+  // left to the document walk.
+  for (auto it = key_index_.begin(); it != key_index_.end();) {
+    if (it->second.second < map_document_count) {
+      it = key_index_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+void Config::index_map(const YAML::Node& yaml_map, const std::string& key_prefix) {
+  for (const auto& item : yaml_map) {
+    if (!item.first.IsScalar()) { continue; }
+    const std::string& param_key = item.first.Scalar();
+    // Dotted keys are split by Fragment::from_config() so a key containing a dot can't match.
+    if (param_key.empty() || param_key.find('.') != std::string::npos) { continue; }
+
+    const YAML::Node& value = item.second;
+    ArgList args;
+    if (value.IsScalar()) {
+      args.add(Arg(param_key) = value);
+    } else if (value.IsMap()) {
+      for (const auto& p : value) {
+        if (!p.first.IsScalar()) { break; }
+        args.add(Arg(p.first.Scalar()) = p.second);
+      }
+      if (args.size() != value.size()) { continue; }
+    } else {
+      // Null values and sequences are left to the document walk.
+      continue;
+    }
+
+    std::string key = key_prefix.empty() ? param_key : key_prefix + "." + param_key;
+    auto& [indexed_args, document_count] = key_index_[key];
+    indexed_args.add(std::move(args));
+    ++document_count;
+
+    if (value.IsMap()) { index_map(value, key); }
+  }
+}
+
 }  // namespace holoscan
@@ -20,11 +20,19 @@
 #include <signal.h>
 
 #include <algorithm>
+#include <any>
+#include <chrono>
+#include <condition_variable>
 #include <deque>
+#include <exception>
+#include <future>
+#include <map>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <set>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -33,6 +41,7 @@
 #include <common/assert.hpp>
 #include <common/logger.hpp>
 
+#include "holoscan/core/app_driver.hpp"
 #include "holoscan/core/application.hpp"
 #include "holoscan/core/conditions/gxf/downstream_affordable.hpp"
 #include "holoscan/core/conditions/gxf/message_available.hpp"
@@ -56,9 +65,30 @@
 #include "holoscan/core/operator.hpp"
 #include "holoscan/core/resources/gxf/annotated_double_buffer_receiver.hpp"
 #include "holoscan/core/resources/gxf/annotated_double_buffer_transmitter.hpp"
+#include "holoscan/core/resources/gxf/backpressure_allocator.hpp"
+#include "holoscan/core/resources/gxf/buffer_recycling_allocator.hpp"
+#include "holoscan/core/resources/gxf/conflating_mailbox_receiver.hpp"
+#include "holoscan/core/resources/gxf/conflating_receiver.hpp"
 #include "holoscan/core/resources/gxf/dfft_collector.hpp"
 #include "holoscan/core/resources/gxf/double_buffer_receiver.hpp"
 #include "holoscan/core/resources/gxf/double_buffer_transmitter.hpp"
+#include "holoscan/core/resources/gxf/fan_out_transmitter.hpp"
+#include "holoscan/core/resources/gxf/huge_page_allocator.hpp"
+#include "holoscan/core/resources/gxf/multi_subscriber_transmitter.hpp"
+#include "holoscan/core/resources/gxf/numa_binding_allocator.hpp"
+#include "holoscan/core/resources/gxf/ring_buffer_receiver.hpp"
+#include "holoscan/core/resources/gxf/ring_buffer_transmitter.hpp"
+#include "holoscan/core/resources/gxf/shared_memory_channel_receiver.hpp"
+#include "holoscan/core/resources/gxf/shared_memory_channel_transmitter.hpp"
+#include "holoscan/core/resources/gxf/shared_memory_transmitter.hpp"
+#include "holoscan/core/resources/gxf/slab_allocator.hpp"
+#include "holoscan/core/resources/gxf/spsc_ring_buffer_receiver.hpp"
+#include "holoscan/core/resources/gxf/spsc_ring_buffer_transmitter.hpp"
+#include "holoscan/core/resources/gxf/timestamp_counter_clock.hpp"
+#include "holoscan/core/resources/gxf/tracking_allocator.hpp"
+#include "holoscan/core/resources/gxf/ucx_coalescing_receiver.hpp"
+#include "holoscan/core/resources/gxf/ucx_coalescing_transmitter.hpp"
+#include "holoscan/core/schedulers/gxf/multithread_scheduler.hpp"
 #include "holoscan/core/services/common/virtual_operator.hpp"
 #include "holoscan/core/signal_handler.hpp"
 
@@ -84,6 +114,39 @@ static const std::vector<std::string> kDefaultHoloscanGXFExtensions{
     "libgxf_ucx_holoscan.so",     // serialize holoscan::gxf::GXFTensor and holoscan::Message
 };
 
+// GXF extension that is always loaded (the Holoscan SDK internal extension depends on it)
+static const std::string kStdGXFExtension{"libgxf_std.so"};
+
+/// Default GXF extension loaded on demand (see GXFExecutor::load_required_extensions()).
+struct OnDemandGXFExtension {
+  std::string file_name;                   ///< The file name of the extension.
+  std::vector<std::string> type_prefixes;  ///< Prefixes of the type names requiring it.
+  std::vector<std::string> dependencies;   ///< Extensions to load with it.
+};
+
+static const std::vector<OnDemandGXFExtension> kOnDemandGXFExtensions{
+    {"libgxf_cuda.so", {"nvidia::gxf::Cuda", "nvidia::gxf::GPUDevice"}, {}},
+    {"libgxf_multimedia.so", {"nvidia::gxf::VideoBuffer", "nvidia::gxf::AudioBuffer"}, {}},
+    {"libgxf_serialization.so",
+     {"nvidia::gxf::SerializationBuffer",
+      "nvidia::gxf::StdComponentSerializer",
+      "nvidia::gxf::StdEntitySerializer",
+      "nvidia::gxf::EntityRecorder",
+      "nvidia::gxf::EntityReplayer"},
+     {"libgxf_cuda.so", "libgxf_multimedia.so"}},
+    {"libgxf_ucx.so", {"nvidia::gxf::Ucx"}, {"libgxf_serialization.so"}},
+    {"libgxf_bayer_demosaic.so",
+     {"nvidia::holoscan::BayerDemosaic"},
+     {"libgxf_cuda.so", "libgxf_multimedia.so"}},
+    {"libgxf_stream_playback.so",
+     {"nvidia::holoscan::stream_playback::"},
+     {"libgxf_serialization.so"}},
+    // UcxContext and the shared memory connectors create UCX serializers when initialized
+    {"libgxf_ucx_holoscan.so",
+     {"nvidia::gxf::Ucx", "holoscan::SharedMemoryChannel"},
+     {"libgxf_ucx.so"}},
+};
+
 static nvidia::Severity s_gxf_log_level = nvidia::Severity::INFO;
 
 void gxf_logging_holoscan_format(const char* file, int line, nvidia::Severity severity,
@@ -240,6 +303,41 @@ GXFExecutor::~GXFExecutor() {
   }
 }
 
+/**
+ * @brief Convert the value of an integral argument (of any integer type) to uint64_t.
+ *
+ * Arguments such as `Arg("min_size") = 4` or a YAML node are accepted, as when the argument is
+ * set on the condition itself.
+ *
+ * @param value The value of the argument.
+ * @return The converted value, or std::nullopt if the value is not a non-negative integer.
+ */
+static std::optional<uint64_t> get_unsigned_arg_value(const std::any& value) {
+  const auto& type = value.type();
+  int64_t signed_value = 0;
+  if (type == typeid(uint64_t)) { return std::any_cast<uint64_t>(value); }
+  if (type == typeid(uint32_t)) { return std::any_cast<uint32_t>(value); }
+  if (type == typeid(uint16_t)) { return std::any_cast<uint16_t>(value); }
+  if (type == typeid(uint8_t)) { return std::any_cast<uint8_t>(value); }
+  if (type == typeid(int64_t)) {
+    signed_value = std::any_cast<int64_t>(value);
+  } else if (type == typeid(int32_t)) {
+    signed_value = std::any_cast<int32_t>(value);
+  } else if (type == typeid(int16_t)) {
+    signed_value = std::any_cast<int16_t>(value);
+  } else if (type == typeid(int8_t)) {
+    signed_value = std::any_cast<int8_t>(value);
+  } else if (type == typeid(YAML::Node)) {
+    try {
+      return std::any_cast<YAML::Node>(value).as<uint64_t>();
+    } catch (const std::exception&) { return std::nullopt; }
+  } else {
+    return std::nullopt;
+  }
+  if (signed_value < 0) { return std::nullopt; }
+  return static_cast<uint64_t>(signed_value);
+}
+
 static gxf_uid_t add_entity_group(void* context, std::string name) {
   gxf_uid_t entity_group_gid = kNullUid;
   HOLOSCAN_GXF_CALL_FATAL(GxfCreateEntityGroup(context, name.c_str(), &entity_group_gid));
@@ -274,6 +372,34 @@ static gxf_uid_t create_gpu_device_component(void* context, gxf_tid_t device_tid
   return device_cid;
 }
 
+/**
+ * @brief Create the entity sending the messages queued by a UcxCoalescingTransmitter.
+ *
+ * The entity is scheduled at the deadline of the oldest queued message, so that queued messages
+ * are sent within the coalescing window even if the operator does not tick again.
+ *
+ * @param context The GXF context.
+ * @param tx_eid The entity of the transmitter.
+ * @param tx_cid The UcxCoalescingTransmitter component.
+ * @param tx_name The name of the transmitter (used to name the entity).
+ */
+static void create_ucx_coalescing_flush_entity(void* context, gxf_uid_t tx_eid, gxf_uid_t tx_cid,
+                                               const std::string& tx_name) {
+  const char* tx_entity_name = nullptr;
+  HOLOSCAN_GXF_CALL_FATAL(GxfEntityGetName(context, tx_eid, &tx_entity_name));
+  const std::string entity_name = fmt::format("{}_ucx_flush_{}", tx_entity_name, tx_name);
+  gxf_uid_t flush_eid = kNullUid;
+  const GxfEntityCreateInfo entity_create_info = {entity_name.c_str(),
+                                                  GXF_ENTITY_CREATE_PROGRAM_BIT};
+  HOLOSCAN_GXF_CALL_FATAL(GxfCreateEntity(context, &entity_create_info, &flush_eid));
+  for (const char* type_name : {"nvidia::gxf::UcxCoalescingFlushCodelet",
+                                "nvidia::gxf::UcxCoalescingDeadlineSchedulingTerm"}) {
+    gxf_uid_t cid = kNullUid;
+    create_gxf_component(context, type_name, "", flush_eid, &cid);
+    HOLOSCAN_GXF_CALL_FATAL(GxfParameterSetHandle(context, cid, "transmitter", tx_cid));
+  }
+}
+
 void GXFExecutor::add_operator_to_entity_group(gxf_context_t context, gxf_uid_t entity_group_gid,
                                                std::shared_ptr<Operator> op) {
   gxf_uid_t op_eid = kNullUid;
@@ -455,6 +581,22 @@ void GXFExecutor::create_input_port(Fragment* fragment, gxf_context_t gxf_contex
           HOLOSCAN_LOG_ERROR("data flow tracking not implemented for UCX ports");
         }
         break;
+      case IOSpec::ConnectorType::kSharedMemory:
+        rx_resource = std::dynamic_pointer_cast<Receiver>(io_spec->connector());
+        if (fragment->data_flow_tracker()) {
+          HOLOSCAN_LOG_ERROR("data flow tracking not implemented for shared memory ports");
+        }
+        break;
+      case IOSpec::ConnectorType::kRingBuffer:
+        HOLOSCAN_LOG_DEBUG("creating input port using RingBufferReceiver");
+        rx_resource = std::dynamic_pointer_cast<Receiver>(io_spec->connector());
+        if (!rx_resource) { rx_resource = std::make_shared<RingBufferReceiver>(); }
+        break;
+      case IOSpec::ConnectorType::kConflating:
+        HOLOSCAN_LOG_DEBUG("creating input port using ConflatingReceiver");
+        rx_resource = std::dynamic_pointer_cast<Receiver>(io_spec->connector());
+        if (!rx_resource) { rx_resource = std::make_shared<ConflatingReceiver>(); }
+        break;
       default:
         HOLOSCAN_LOG_ERROR("Unsupported GXF connector_type: '{}'", static_cast<int>(rx_type));
     }
@@ -649,6 +791,25 @@ void GXFExecutor::create_output_port(Fragment* fragment, gxf_context_t gxf_conte
           HOLOSCAN_LOG_ERROR("data flow tracking not implemented for UCX ports");
         }
         break;
+      case IOSpec::ConnectorType::kSharedMemory:
+        tx_resource = std::dynamic_pointer_cast<Transmitter>(io_spec->connector());
+        if (fragment->data_flow_tracker()) {
+          HOLOSCAN_LOG_ERROR("data flow tracking not implemented for shared memory ports");
+        }
+        break;
+      case IOSpec::ConnectorType::kRingBuffer:
+        HOLOSCAN_LOG_DEBUG("creating output port using RingBufferTransmitter");
+        tx_resource = std::dynamic_pointer_cast<Transmitter>(io_spec->connector());
+        if (!tx_resource) { tx_resource = std::make_shared<RingBufferTransmitter>(); }
+        break;
+      case IOSpec::ConnectorType::kConflating:
+        // The receiver keeps the latest message; the transmitter must never hold the producer.
+        tx_resource = std::dynamic_pointer_cast<Transmitter>(io_spec->connector());
+        if (!tx_resource) {
+          tx_resource = std::make_shared<DoubleBufferTransmitter>(Arg("capacity", 1UL),
+                                                                  Arg("policy", 0UL));
+        }
+        break;
       default:
         HOLOSCAN_LOG_ERROR("Unsupported GXF connector_type: '{}'", static_cast<int>(tx_type));
     }
@@ -684,11 +845,65 @@ void GXFExecutor::create_output_port(Fragment* fragment, gxf_context_t gxf_conte
     // Set the connector for this output
     connector = tx_resource;
     io_spec->connector(connector);
+
+    if (std::dynamic_pointer_cast<UcxCoalescingTransmitter>(connector)) {
+      create_ucx_coalescing_flush_entity(gxf_context, eid, connector->gxf_cid(), tx_name);
+    }
+  }
+
+  // A MultiSubscriberTransmitter is not connected to its receivers through GXF Connection
+  // components, and the receiver of a SharedMemoryTransmitter is in another process, so the
+  // DownstreamReceptiveSchedulingTerm cannot see them. Replace the kDownstreamMessageAffordable
+  // condition (also the default one if the port has no condition) with a scheduling term checking
+  // the subscribed receivers (FanOutReceptiveSchedulingTerm) or the free slots of the shared memory
+  // segment (SharedMemoryReceptiveSchedulingTerm).
+  const bool is_fan_out =
+      static_cast<bool>(std::dynamic_pointer_cast<MultiSubscriberTransmitter>(connector));
+  const bool is_shared_memory =
+      static_cast<bool>(std::dynamic_pointer_cast<SharedMemoryTransmitter>(connector));
+  if (is_fan_out || is_shared_memory) {
+    uint64_t min_size = 1;
+    auto& conditions = io_spec->conditions();
+    bool is_receptive_term_needed = conditions.empty();
+    for (auto it = conditions.begin(); it != conditions.end();) {
+      if (it->first == ConditionType::kDownstreamMessageAffordable) {
+        is_receptive_term_needed = true;
+        // The condition is not initialized yet, so 'min_size' is only available as an argument.
+        for (auto& arg : it->second->args()) {
+          if (arg.name() != "min_size") { continue; }
+          if (auto value = get_unsigned_arg_value(arg.value())) {
+            min_size = value.value();
+          } else {
+            HOLOSCAN_LOG_WARN("Ignoring invalid 'min_size' argument of output port '{}'",
+                              io_spec->name());
+          }
+        }
+        it = conditions.erase(it);
+      } else {
+        ++it;
+      }
+    }
+    if (is_receptive_term_needed) {
+      gxf_uid_t term_cid;
+      create_gxf_component(gxf_context,
+                           is_fan_out ? "holoscan::FanOutReceptiveSchedulingTerm"
+                                      : "holoscan::SharedMemoryReceptiveSchedulingTerm",
+                           "",
+                           eid,
+                           &term_cid);
+      HOLOSCAN_GXF_CALL_FATAL(
+          GxfParameterSetHandle(gxf_context, term_cid, "transmitter", connector->gxf_cid()));
+      HOLOSCAN_GXF_CALL_FATAL(
+          GxfParameterSetUInt64(gxf_context, term_cid, "min_size", min_size));
+    }
   }
 
   // Set the default scheduling term for this output
-  // For the UCX connector, we shouldn't set kDownstreamMessageAffordable condition.
-  if (io_spec->conditions().empty() && (tx_type != IOSpec::ConnectorType::kUCX)) {
+  // For the UCX and shared memory connectors, we shouldn't set kDownstreamMessageAffordable
+  // condition (the receiver is in another fragment).
+  const bool is_inter_fragment = tx_type == IOSpec::ConnectorType::kUCX ||
+                                 tx_type == IOSpec::ConnectorType::kSharedMemory;
+  if (io_spec->conditions().empty() && !is_inter_fragment && !is_fan_out) {
     io_spec->condition(ConditionType::kDownstreamMessageAffordable,
                        Arg("transmitter") = io_spec->connector(),
                        Arg("min_size") = 1UL);
@@ -776,10 +991,10 @@ void create_virtual_operators_and_connections(
         std::shared_ptr<ops::VirtualOperator> virtual_op;
         if (io_type == IOSpec::IOType::kOutput) {
           virtual_op = std::make_shared<ops::VirtualTransmitterOp>(
-              port_name, IOSpec::ConnectorType::kUCX, connection->args);
+              port_name, connection->connector_type, connection->args);
         } else {
           virtual_op = std::make_shared<ops::VirtualReceiverOp>(
-              port_name, IOSpec::ConnectorType::kUCX, connection->args);
+              port_name, connection->connector_type, connection->args);
         }
         virtual_ops.push_back(virtual_op);
 
@@ -819,6 +1034,50 @@ void create_virtual_operators_and_connections(
   }
 }
 
+/**
+ * @brief Split the coalescing window argument from the arguments of a UCX connection.
+ *
+ * @param arg_list The arguments of the connection (from the VirtualOperator).
+ * @param ucx_args The arguments of the UCX receiver/transmitter.
+ * @return The coalescing window in microseconds (0 if the connection is not coalescing).
+ */
+int64_t split_ucx_coalescing_args(const ArgList& arg_list, ArgList& ucx_args) {
+  int64_t coalescing_window_us = 0;
+  for (const auto& arg : arg_list) {
+    if (arg.name() == kUcxCoalescingWindowArgName) {
+      coalescing_window_us = std::any_cast<int32_t>(arg.value());
+    } else {
+      ucx_args.add(arg);
+    }
+  }
+  return coalescing_window_us;
+}
+
+/**
+ * @brief Create the connector of a port connected to another fragment.
+ *
+ * UCX connections with a coalescing window use UcxCoalescingTransmitter/UcxCoalescingReceiver.
+ */
+void create_virtual_op_connector(IOSpec& io_spec, ops::VirtualOperator& virtual_op) {
+  if (virtual_op.connector_type() != IOSpec::ConnectorType::kUCX) {
+    io_spec.connector(virtual_op.connector_type(), virtual_op.arg_list());
+    return;
+  }
+
+  ArgList ucx_args;
+  const int64_t coalescing_window_us = split_ucx_coalescing_args(virtual_op.arg_list(), ucx_args);
+  // Also sets the connector type (the connector is replaced below when coalescing).
+  io_spec.connector(IOSpec::ConnectorType::kUCX, ucx_args);
+  if (coalescing_window_us <= 0) { return; }
+
+  if (io_spec.io_type() == IOSpec::IOType::kInput) {
+    io_spec.connector(std::make_shared<UcxCoalescingReceiver>(ucx_args));
+  } else {
+    io_spec.connector(std::make_shared<UcxCoalescingTransmitter>(
+        Arg(kUcxCoalescingWindowArgName, coalescing_window_us), ucx_args));
+  }
+}
+
 void connect_ucx_transmitters_to_virtual_ops(
     Fragment* fragment, std::vector<std::shared_ptr<ops::VirtualOperator>>& virtual_ops) {
   auto& graph = fragment->graph();
@@ -849,7 +1108,7 @@ void connect_ucx_transmitters_to_virtual_ops(
         if (connection_count == 1) {
           auto& out_spec = last_transmitter_op->spec()->outputs()[port_name];
           // Create the connector for out_spec from the virtual_op
-          out_spec->connector(virtual_op->connector_type(), virtual_op->arg_list());
+          create_virtual_op_connector(*out_spec, *virtual_op);
         }
       } break;
       case IOSpec::IOType::kInput: {
@@ -859,7 +1118,7 @@ void connect_ucx_transmitters_to_virtual_ops(
 
         auto& in_spec = first_receiver_op->spec()->inputs()[port_name];
         // Create the connector for in_spec from the virtual_op
-        in_spec->connector(virtual_op->connector_type(), virtual_op->arg_list());
+        create_virtual_op_connector(*in_spec, *virtual_op);
       } break;
     }
   }
@@ -904,7 +1163,8 @@ void connect_broadcast_to_previous_op(gxf_context_t context,  // context_
         // the current Operator's type.
         if (prev_connector_type == IOSpec::ConnectorType::kDefault) {
           if (op_type == Operator::OperatorType::kVirtual) {
-            prev_connector_type = IOSpec::ConnectorType::kUCX;
+            // kUCX, or kSharedMemory for a fragment on the same host
+            prev_connector_type = static_cast<ops::VirtualOperator*>(op.get())->connector_type();
           } else {
             prev_connector_type = IOSpec::ConnectorType::kDoubleBuffer;
           }
@@ -918,7 +1178,8 @@ void connect_broadcast_to_previous_op(gxf_context_t context,  // context_
         // TODO(gbae): create a special resource for the broadcast codelet and use it.
         switch (prev_connector_type) {
           case IOSpec::ConnectorType::kDefault:
-          case IOSpec::ConnectorType::kDoubleBuffer: {
+          case IOSpec::ConnectorType::kDoubleBuffer:
+          case IOSpec::ConnectorType::kConflating: {
             // We don't create a AnnotatedDoubleBufferTransmitter even if DFFT is on because
             // we don't want to annotate a message at the Broadcast component.
             auto prev_double_buffer_connector =
@@ -986,11 +1247,21 @@ void connect_broadcast_to_previous_op(gxf_context_t context,  // context_
             // If the current Operator is a VirtualTransmitterOp, we create a UcxTransmitter
             // from the current Operator's arguments.
             if (op_type == Operator::OperatorType::kVirtual) {
-              auto& arg_list = static_cast<ops::VirtualOperator*>(op.get())->arg_list();
-              transmitter =
-                  std::make_shared<UcxTransmitter>(Arg("capacity", prev_connector_capacity),
-                                                   Arg("policy", prev_connector_policy),
-                                                   arg_list);
+              ArgList ucx_args;
+              const int64_t coalescing_window_us = split_ucx_coalescing_args(
+                  static_cast<ops::VirtualOperator*>(op.get())->arg_list(), ucx_args);
+              if (coalescing_window_us > 0) {
+                transmitter = std::make_shared<UcxCoalescingTransmitter>(
+                    Arg("capacity", prev_connector_capacity),
+                    Arg("policy", prev_connector_policy),
+                    Arg(kUcxCoalescingWindowArgName, coalescing_window_us),
+                    ucx_args);
+              } else {
+                transmitter =
+                    std::make_shared<UcxTransmitter>(Arg("capacity", prev_connector_capacity),
+                                                     Arg("policy", prev_connector_policy),
+                                                     ucx_args);
+              }
             } else {
               auto prev_ucx_connector = std::dynamic_pointer_cast<UcxTransmitter>(prev_connector);
               prev_connector_capacity = prev_ucx_connector->capacity_;
@@ -1015,6 +1286,34 @@ void connect_broadcast_to_previous_op(gxf_context_t context,  // context_
             transmitter->gxf_eid(broadcast_eid);
             // Create a transmitter in the broadcast entity.
             transmitter->initialize();
+            if (std::dynamic_pointer_cast<UcxCoalescingTransmitter>(transmitter)) {
+              create_ucx_coalescing_flush_entity(
+                  context, broadcast_eid, transmitter->gxf_cid(), broadcast_out_port_name);
+            }
+          } break;
+          case IOSpec::ConnectorType::kSharedMemory: {
+            // Shared memory connections are only created for the VirtualTransmitterOp of a
+            // fragment on the same host, so the arguments come from the current Operator.
+            if (op_type != Operator::OperatorType::kVirtual) {
+              HOLOSCAN_LOG_ERROR(
+                  "Shared memory connector for source name '{}' is only supported between "
+                  "fragments",
+                  port_name);
+              break;
+            }
+            auto& arg_list = static_cast<ops::VirtualOperator*>(op.get())->arg_list();
+            auto transmitter =
+                std::make_shared<SharedMemoryTransmitter>(Arg("capacity", prev_connector_capacity),
+                                                          Arg("policy", prev_connector_policy),
+                                                          arg_list);
+            transmitter->name(fmt::format("{}_{}", op->name(), port_name));
+            transmitter->fragment(fragment_);
+            auto spec = std::make_shared<ComponentSpec>(fragment_);
+            transmitter->setup(*spec.get());
+            transmitter->spec(spec);
+            // Bind the transmitter to the broadcast entity.
+            transmitter->gxf_eid(broadcast_eid);
+            transmitter->initialize();
           } break;
           default:
             HOLOSCAN_LOG_ERROR("Unrecognized connector_type '{}' for source name '{}'",
@@ -1055,6 +1354,7 @@ void create_broadcast_components(gxf_context_t context,             // context_
   gxf_tid_t rx_term_tid = GxfTidNull();
 
   gxf_tid_t rx_double_buffer_tid = GxfTidNull();
+  gxf_tid_t rx_conflating_tid = GxfTidNull();
 
   auto& op_name = op->name();
 
@@ -1110,6 +1410,14 @@ void create_broadcast_components(gxf_context_t context,             // context_
       broadcast_eids[op][source_cname] = broadcast_eid;
 
       switch (connector_type) {
+        case IOSpec::ConnectorType::kConflating:
+          // The Broadcast entity only forwards the latest message, like the receivers it feeds.
+          if (rx_conflating_tid == GxfTidNull()) {
+            HOLOSCAN_GXF_CALL_FATAL(GxfComponentTypeId(
+                context, "holoscan::ConflatingMailboxReceiver", &rx_conflating_tid));
+          }
+          rx_tid = rx_conflating_tid;
+          break;
         case IOSpec::ConnectorType::kDefault:
         case IOSpec::ConnectorType::kDoubleBuffer:
         case IOSpec::ConnectorType::kUCX:  // In any case, need to add doubleBufferReceiver.
@@ -1142,11 +1450,13 @@ void create_broadcast_components(gxf_context_t context,             // context_
       }
       gxf_uid_t rx_cid;
       HOLOSCAN_GXF_CALL_FATAL(GxfComponentAdd(context, broadcast_eid, rx_tid, "", &rx_cid));
-      // Set capacity and policy of the receiver component.
-      HOLOSCAN_GXF_CALL_FATAL(
-          GxfParameterSetUInt64(context, rx_cid, "capacity", curr_connector_capacity));
-      HOLOSCAN_GXF_CALL_FATAL(
-          GxfParameterSetUInt64(context, rx_cid, "policy", curr_connector_policy));
+      if (connector_type != IOSpec::ConnectorType::kConflating) {
+        // Set capacity and policy of the receiver component.
+        HOLOSCAN_GXF_CALL_FATAL(
+            GxfParameterSetUInt64(context, rx_cid, "capacity", curr_connector_capacity));
+        HOLOSCAN_GXF_CALL_FATAL(
+            GxfParameterSetUInt64(context, rx_cid, "policy", curr_connector_policy));
+      }
 
       if (rx_term_tid == GxfTidNull()) {
         HOLOSCAN_GXF_CALL_FATAL(GxfComponentTypeId(
@@ -1180,6 +1490,186 @@ void create_broadcast_components(gxf_context_t context,             // context_
   }
 }
 
+/**
+ * @brief Replace a ring buffer connector that cannot be used with a double buffer connector.
+ *
+ * The arguments given to the ring buffer connector (capacity, policy) are kept.
+ */
+void fall_back_to_double_buffer(IOSpec* io_spec, const std::string& op_name) {
+  if (io_spec->connector_type() != IOSpec::ConnectorType::kRingBuffer) { return; }
+
+  HOLOSCAN_LOG_WARN(
+      "Port '{}.{}' is not a point-to-point connection within the fragment. Using "
+      "ConnectorType::kDoubleBuffer instead of ConnectorType::kRingBuffer.",
+      op_name,
+      io_spec->name());
+  ArgList arg_list;
+  if (auto connector = io_spec->connector()) {
+    for (const auto& arg : connector->args()) { arg_list.add(arg); }
+  }
+  io_spec->connector(IOSpec::ConnectorType::kDoubleBuffer, arg_list);
+}
+
+/**
+ * @brief Decide which ports of the fragment use the ring buffer connectors.
+ *
+ * A ring buffer connector can only be used when the port is the single endpoint of a single edge
+ * between two operators of the fragment (one producer and one consumer). Ports requesting
+ * ConnectorType::kRingBuffer which do not satisfy this fall back to ConnectorType::kDoubleBuffer.
+ *
+ * If `auto_select` is true, both ports of every such edge using ConnectorType::kDefault are
+ * switched to ConnectorType::kRingBuffer.
+ */
+void configure_ring_buffer_connectors(OperatorGraph& graph, bool auto_select) {
+  using PortKey = std::pair<Operator*, std::string>;
+  std::map<PortKey, size_t> num_targets;  // number of edges leaving each output port
+  std::map<PortKey, size_t> num_sources;  // number of edges entering each input port
+
+  struct Edge {
+    holoscan::OperatorGraph::NodeType source_op;
+    std::string source_port;
+    holoscan::OperatorGraph::NodeType target_op;
+    std::string target_port;
+  };
+  std::vector<Edge> edges;
+
+  for (const auto& op : graph.get_nodes()) {
+    for (const auto& next_op : graph.get_next_nodes(op)) {
+      auto port_map = graph.get_port_map(op, next_op);
+      if (!port_map.has_value()) { continue; }
+      for (const auto& [source_port, target_ports] : *port_map.value()) {
+        for (const auto& target_port : target_ports) {
+          ++num_targets[{op.get(), source_port}];
+          ++num_sources[{next_op.get(), target_port}];
+          edges.push_back({op, source_port, next_op, target_port});
+        }
+      }
+    }
+  }
+
+  for (const auto& edge : edges) {
+    bool is_virtual = edge.source_op->operator_type() == Operator::OperatorType::kVirtual ||
+                      edge.target_op->operator_type() == Operator::OperatorType::kVirtual;
+    bool single_target = num_targets[{edge.source_op.get(), edge.source_port}] == 1;
+    bool single_source = num_sources[{edge.target_op.get(), edge.target_port}] == 1;
+
+    IOSpec* output_spec = nullptr;
+    IOSpec* input_spec = nullptr;
+    if (edge.source_op->operator_type() != Operator::OperatorType::kVirtual) {
+      output_spec = edge.source_op->spec()->outputs()[edge.source_port].get();
+      if (is_virtual || !single_target) {
+        fall_back_to_double_buffer(output_spec, edge.source_op->name());
+      }
+    }
+    if (edge.target_op->operator_type() != Operator::OperatorType::kVirtual) {
+      input_spec = edge.target_op->spec()->inputs()[edge.target_port].get();
+      if (is_virtual || !single_source) {
+        fall_back_to_double_buffer(input_spec, edge.target_op->name());
+      }
+    }
+
+    if (auto_select && !is_virtual && single_target && single_source &&
+        output_spec->connector_type() == IOSpec::ConnectorType::kDefault &&
+        input_spec->connector_type() == IOSpec::ConnectorType::kDefault) {
+      HOLOSCAN_LOG_DEBUG("Using ring buffer connectors for {}.{} -> {}.{}",
+                         edge.source_op->name(),
+                         edge.source_port,
+                         edge.target_op->name(),
+                         edge.target_port);
+      output_spec->connector(IOSpec::ConnectorType::kRingBuffer);
+      input_spec->connector(IOSpec::ConnectorType::kRingBuffer);
+    }
+  }
+}
+
+/**
+ * @brief Use MultiSubscriberTransmitter for output ports connected to several input ports.
+ *
+ * Output ports using ConnectorType::kDefault, ConnectorType::kDoubleBuffer or
+ * ConnectorType::kConflating that are connected to more than one input port of the fragment
+ * publish directly to all the receivers instead of going through a Broadcast entity. Conflating
+ * ports keep their connector type and always use the 'pop' policy. Ports connected to a virtual
+ * operator (UCX) keep using the Broadcast entity.
+ */
+void configure_native_broadcast_connectors(OperatorGraph& graph) {
+  for (const auto& op : graph.get_nodes()) {
+    if (op->operator_type() == Operator::OperatorType::kVirtual) { continue; }
+
+    std::map<std::string, size_t> num_targets;
+    std::set<std::string> virtual_targets;
+    for (const auto& next_op : graph.get_next_nodes(op)) {
+      auto port_map = graph.get_port_map(op, next_op);
+      if (!port_map.has_value()) { continue; }
+      for (const auto& [source_port, target_ports] : *port_map.value()) {
+        num_targets[source_port] += target_ports.size();
+        if (next_op->operator_type() == Operator::OperatorType::kVirtual) {
+          virtual_targets.insert(source_port);
+        }
+      }
+    }
+
+    for (const auto& [source_port, count] : num_targets) {
+      if (count < 2 || virtual_targets.count(source_port)) { continue; }
+      auto& output_spec = op->spec()->outputs()[source_port];
+      auto connector_type = output_spec->connector_type();
+      if (connector_type != IOSpec::ConnectorType::kDefault &&
+          connector_type != IOSpec::ConnectorType::kDoubleBuffer &&
+          connector_type != IOSpec::ConnectorType::kConflating) {
+        continue;
+      }
+
+      // Only the policy applies to the subscribers; there is no intermediate queue.
+      ArgList arg_list;
+      const bool is_conflating = connector_type == IOSpec::ConnectorType::kConflating;
+      if (is_conflating) {
+        // The conflating receivers always accept a message; never hold the producer.
+        arg_list.add(Arg("policy", 0UL));
+      } else if (auto connector = output_spec->connector()) {
+        for (const auto& arg : connector->args()) {
+          if (arg.name() == "policy") { arg_list.add(arg); }
+        }
+      }
+      HOLOSCAN_LOG_DEBUG("Using MultiSubscriberTransmitter for {}.{} ({} targets)",
+                         op->name(),
+                         source_port,
+                         count);
+      // Use a connector type for which create_output_port() keeps the connector set here.
+      if (!is_conflating) { output_spec->connector(IOSpec::ConnectorType::kDoubleBuffer); }
+      output_spec->connector(std::make_shared<MultiSubscriberTransmitter>(arg_list));
+    }
+  }
+}
+
+/**
+ * @brief Subscribe the input ports of `op` to the MultiSubscriberTransmitter of `prev_op`.
+ *
+ * Any connected ports of the operator are removed from port_map_val.
+ */
+void connect_native_broadcast_to_previous_op(holoscan::OperatorGraph::NodeType op,
+                                             holoscan::OperatorGraph::NodeType prev_op,
+                                             holoscan::OperatorGraph::EdgeDataType port_map_val) {
+  std::vector<std::string> connected_ports;
+  for (const auto& [source_port, target_ports] : *port_map_val) {
+    auto transmitter = std::dynamic_pointer_cast<MultiSubscriberTransmitter>(
+        prev_op->spec()->outputs()[source_port]->connector());
+    if (!transmitter) { continue; }
+
+    auto fan_out_transmitter = static_cast<FanOutTransmitter*>(transmitter->gxf_cptr());
+    for (const auto& target_port : target_ports) {
+      auto receiver = std::dynamic_pointer_cast<GXFResource>(
+          op->spec()->inputs()[target_port]->connector());
+      fan_out_transmitter->add_receiver(
+          static_cast<nvidia::gxf::Receiver*>(receiver->gxf_cptr()));
+      HOLOSCAN_LOG_DEBUG(
+          "Subscribed to MultiSubscriberTransmitter source : {} -> target : {}",
+          source_port,
+          target_port);
+    }
+    connected_ports.push_back(source_port);
+  }
+  for (const auto& port_name : connected_ports) { port_map_val->erase(port_name); }
+}
+
 }  // unnamed namespace
 
 bool GXFExecutor::initialize_fragment() {
@@ -1208,6 +1698,27 @@ bool GXFExecutor::initialize_fragment() {
   create_virtual_operators_and_connections(fragment_, connection_map, virtual_ops);
   connect_ucx_transmitters_to_virtual_ops(fragment_, virtual_ops);
 
+  // Use the lock-free ring buffer connectors for point-to-point connections if requested.
+  // Automatic selection is opt-in (HOLOSCAN_ENABLE_RING_BUFFER_CONNECTOR) and only applies when
+  // operators can run on different worker threads (MultiThreadScheduler with several workers).
+  bool auto_select_ring_buffer = false;
+  if (!fragment_->data_flow_tracker() &&
+      AppDriver::get_bool_env_var("HOLOSCAN_ENABLE_RING_BUFFER_CONNECTOR")) {
+    auto multithread_scheduler =
+        std::dynamic_pointer_cast<MultiThreadScheduler>(fragment_->scheduler());
+    auto_select_ring_buffer =
+        multithread_scheduler && multithread_scheduler->worker_thread_number() > 1;
+  }
+  configure_ring_buffer_connectors(graph, auto_select_ring_buffer);
+
+  // Publish directly to all the receivers of an output port connected to several input ports
+  // instead of inserting a Broadcast entity (can be disabled with
+  // HOLOSCAN_ENABLE_NATIVE_BROADCAST=false). Data flow tracking relies on the Broadcast entity.
+  if (!fragment_->data_flow_tracker() &&
+      AppDriver::get_bool_env_var("HOLOSCAN_ENABLE_NATIVE_BROADCAST", true)) {
+    configure_native_broadcast_connectors(graph);
+  }
+
   auto operators = graph.get_nodes();
 
   // Create a list of nodes in the graph to iterate in topological order
@@ -1261,7 +1772,11 @@ bool GXFExecutor::initialize_fragment() {
 
     HOLOSCAN_LOG_DEBUG("Operator: {}", op_name);
     // Initialize the operator while we are visiting a node in the graph
-    op->initialize();
+    {
+      StartupProfiler::ScopedPhase op_phase(
+          fragment_->startup_profiler(), StartupProfiler::kOperatorInitialize, op_name);
+      op->initialize();
+    }
     auto op_type = op->operator_type();
 
     HOLOSCAN_LOG_DEBUG("Connecting earlier operators of Op: {}", op_name);
@@ -1290,6 +1805,12 @@ bool GXFExecutor::initialize_fragment() {
             context_, fragment_, broadcast_eids, op, prev_op, port_map_val);
       }
 
+      // Subscribe the input ports connected to a MultiSubscriberTransmitter of prev_op.
+      // Any connected ports are removed from port_map_val.
+      if (op_type != Operator::OperatorType::kVirtual) {
+        connect_native_broadcast_to_previous_op(op, prev_op, port_map_val);
+      }
+
       if (port_map_val->size()) {
         // If there are any more mappings in the input_port_map after Broadcast entity was added, or
         // if there was no Broadcast entity added, then there must be some direct connections
@@ -1314,9 +1835,11 @@ bool GXFExecutor::initialize_fragment() {
                 source_port);
             return false;
           }
-          // GXF Connection component should not be added for types using a NetworkContext
+          // GXF Connection component should not be added for types connecting to another
+          // fragment (using a NetworkContext or a shared memory segment)
           auto connector_type = prev_op->spec()->outputs()[source_port]->connector_type();
-          if (connector_type != IOSpec::ConnectorType::kUCX) {
+          if (connector_type != IOSpec::ConnectorType::kUCX &&
+              connector_type != IOSpec::ConnectorType::kSharedMemory) {
             const auto& target_port = target_ports.begin();
             auto target_gxf_resource = std::dynamic_pointer_cast<GXFResource>(
                 op->spec()->inputs()[*target_port]->connector());
@@ -1353,6 +1876,11 @@ bool GXFExecutor::initialize_fragment() {
 
           // If current operator's type is virtual operator, we don't need to connect it.
           if (op_type != Operator::OperatorType::kVirtual) {
+            // A MultiSubscriberTransmitter publishes to its targets without a Broadcast entity.
+            if (std::dynamic_pointer_cast<MultiSubscriberTransmitter>(
+                    op_spec->outputs()[source_port]->connector())) {
+              continue;
+            }
             auto source_gxf_resource = std::dynamic_pointer_cast<GXFResource>(
                 op_spec->outputs()[source_port]->connector());
             gxf_uid_t source_cid = source_gxf_resource->gxf_cid();
@@ -1448,6 +1976,7 @@ bool GXFExecutor::initialize_operator(Operator* op) {
           context_, codelet_cid, codelet_tid, reinterpret_cast<void**>(&gxf_wrapper)));
       if (gxf_wrapper) {
         gxf_wrapper->set_operator(op);
+        gxf_wrappers_[op] = gxf_wrapper;
       } else {
         HOLOSCAN_LOG_ERROR("Unable to get GXFWrapper for Operator '{}'", op->name());
       }
@@ -1584,6 +2113,9 @@ bool GXFExecutor::initialize_gxf_graph(OperatorGraph& graph) {
   }
 
   auto context = context_;
+  auto& startup_profiler = fragment_->startup_profiler();
+  StartupProfiler::ScopedPhase initialize_phase(startup_profiler,
+                                                StartupProfiler::kInitializeGXFGraph);
 
   // Since GXF is not thread-safe, we need to lock the GXF context for execution while
   // multiple threads are setting up the graph.
@@ -1592,7 +2124,11 @@ bool GXFExecutor::initialize_gxf_graph(OperatorGraph& graph) {
   // Load extensions from config file only if not already loaded,
   // to avoid unnecessary loading on multiple run() calls.
   if (!is_extensions_loaded_) {
+    if (load_extensions_on_demand_) { load_required_extensions(graph); }
+
     HOLOSCAN_LOG_INFO("Loading extensions from configs...");
+    StartupProfiler::ScopedPhase extension_phase(startup_profiler,
+                                                 StartupProfiler::kExtensionLoading);
     // Load extensions from config file if exists.
     for (const auto& yaml_node : fragment_->config().yaml_nodes()) {
       gxf_extension_manager_->load_extensions_from_yaml(yaml_node);
@@ -1617,9 +2153,13 @@ bool GXFExecutor::initialize_gxf_graph(OperatorGraph& graph) {
     scheduler->initialize();
 
     // Initialize the fragment and its operators
-    if (!initialize_fragment()) {
-      HOLOSCAN_LOG_ERROR("Failed to initialize fragment");
-      return false;
+    {
+      StartupProfiler::ScopedPhase fragment_phase(startup_profiler,
+                                                  StartupProfiler::kInitializeFragment);
+      if (!initialize_fragment()) {
+        HOLOSCAN_LOG_ERROR("Failed to initialize fragment");
+        return false;
+      }
     }
 
     // If DFFT is on, then attach the DFFTCollector EntityMonitor to the main entity
@@ -1739,8 +2279,124 @@ void GXFExecutor::activate_gxf_graph() {
   if (!is_gxf_graph_activated_) {
     auto context = context_;
     HOLOSCAN_LOG_INFO("Activating Graph...");
-    HOLOSCAN_GXF_CALL_FATAL(GxfGraphActivate(context));
+    auto& startup_profiler = fragment_->startup_profiler();
+    {
+      StartupProfiler::ScopedPhase activate_phase(startup_profiler,
+                                                  StartupProfiler::kActivateGXFGraph);
+      HOLOSCAN_GXF_CALL_FATAL(GxfGraphActivate(context));
+    }
     is_gxf_graph_activated_ = true;
+
+    if (AppDriver::get_bool_env_var("HOLOSCAN_PARALLEL_OPERATOR_START")) {
+      start_operators_in_parallel();
+    }
+
+    // The startup is complete once the native operators are started (see GXFWrapper::start())
+    size_t num_native_operators = 0;
+    for (auto& op : fragment_->graph().get_nodes()) {
+      if (op->operator_type() == Operator::OperatorType::kNative) { ++num_native_operators; }
+    }
+    startup_profiler.expect_operator_starts(num_native_operators);
+    if (startup_profiler.is_startup_complete()) { startup_profiler.log_report(fragment_->name()); }
+  }
+}
+
+void GXFExecutor::start_operators_in_parallel() {
+  auto& graph = fragment_->graph();
+  auto& startup_profiler = fragment_->startup_profiler();
+
+  // An operator is queued once all of its upstream operators are visited (topological order).
+  // Operators in a cycle are never queued and are started by GXF instead.
+  auto operators = graph.get_nodes();
+  std::deque<OperatorGraph::NodeType> ready_operators;
+  std::unordered_map<OperatorGraph::NodeType, size_t> indegrees;
+  for (auto& op : operators) {
+    indegrees[op] = graph.get_previous_nodes(op).size();
+    if (indegrees[op] == 0) { ready_operators.push_back(op); }
+  }
+
+  std::mutex mutex;
+  std::condition_variable cv;
+  size_t num_running = 0;
+  std::unordered_set<OperatorGraph::NodeType> failed_operators;
+  std::vector<OperatorGraph::NodeType> started_operators;
+  std::exception_ptr first_error;
+
+  auto start_ready_operators = [&]() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+      cv.wait(lock, [&]() { return !ready_operators.empty() || num_running == 0; });
+      if (ready_operators.empty()) { return; }
+      auto op = ready_operators.front();
+      ready_operators.pop_front();
+
+      bool is_upstream_failed = false;
+      for (auto& prev_op : graph.get_previous_nodes(op)) {
+        if (failed_operators.count(prev_op) > 0) { is_upstream_failed = true; }
+      }
+      auto wrapper_it = gxf_wrappers_.find(op.get());
+      if (is_upstream_failed) {
+        HOLOSCAN_LOG_ERROR("Operator '{}' is not started: an upstream operator failed to start",
+                           op->name());
+        failed_operators.insert(op);
+      } else if (wrapper_it != gxf_wrappers_.end()) {
+        // Operators started by GXF (GXF and virtual operators) only forward the upstream ordering.
+        ++num_running;
+        lock.unlock();
+        std::exception_ptr error;
+        try {
+          StartupProfiler::ScopedPhase phase(
+              startup_profiler, StartupProfiler::kOperatorStart, op->name());
+          AllocationTracker::ScopedOwner owner(op->name());
+          op->start();
+        } catch (const std::exception& e) {
+          HOLOSCAN_LOG_ERROR("Operator '{}' is not started: {}", op->name(), e.what());
+          error = std::current_exception();
+        }
+        lock.lock();
+        --num_running;
+        if (error) {
+          failed_operators.insert(op);
+          if (!first_error) { first_error = error; }
+        } else {
+          wrapper_it->second->operator_started(true);
+          started_operators.push_back(op);
+        }
+      }
+
+      for (auto& next_op : graph.get_next_nodes(op)) {
+        if (--indegrees[next_op] == 0) { ready_operators.push_back(next_op); }
+      }
+      cv.notify_all();
+    }
+  };
+
+  // Bound the number of threads by the number of hardware threads and native operators.
+  size_t num_threads = std::max(1U, std::thread::hardware_concurrency());
+  num_threads = std::max<size_t>(1, std::min(num_threads, gxf_wrappers_.size()));
+  std::vector<std::thread> threads;
+  threads.reserve(num_threads - 1);
+  for (size_t i = 1; i < num_threads; ++i) { threads.emplace_back(start_ready_operators); }
+  start_ready_operators();
+  for (auto& thread : threads) { thread.join(); }
+
+  // All the operators are visited, even if one of them failed, before reporting the first error.
+  if (first_error) {
+    // GXF never starts the entities of a failed graph, so it would not stop them either. Stop the
+    // started operators (in reverse order) to release their resources and deactivate the graph.
+    for (auto it = started_operators.rbegin(); it != started_operators.rend(); ++it) {
+      auto& op = *it;
+      gxf_wrappers_[op.get()]->operator_started(false);
+      try {
+        AllocationTracker::ScopedOwner owner(op->name());
+        op->stop();
+      } catch (const std::exception& e) {
+        HOLOSCAN_LOG_ERROR("Operator '{}' failed to stop: {}", op->name(), e.what());
+      }
+    }
+    HOLOSCAN_GXF_CALL_WARN(GxfGraphDeactivate(context_));
+    is_gxf_graph_activated_ = false;
+    std::rethrow_exception(first_error);
   }
 }
 
@@ -1780,6 +2436,9 @@ bool GXFExecutor::run_gxf_graph() {
     throw RuntimeError(ErrorCode::kFailure, "Failed to wait for graph to complete");
   }
 
+  // Log the startup profile if some operators were never started
+  fragment_->startup_profiler().log_report(fragment_->name());
+
   HOLOSCAN_LOG_INFO("Graph execution deactivating. Fragment: {}", fragment_->name());
   HOLOSCAN_LOG_INFO("Deactivating Graph...");
   HOLOSCAN_GXF_CALL_WARN(GxfGraphDeactivate(context));
@@ -1807,15 +2466,35 @@ void GXFExecutor::register_extensions() {
     return;
   }
 
-  // Register the default GXF extensions
-  for (auto& gxf_extension_file_name : kDefaultGXFExtensions) {
-    gxf_extension_manager_->load_extension(gxf_extension_file_name);
-  }
+  const auto load_start = std::chrono::steady_clock::now();
+  load_extensions_on_demand_ = AppDriver::get_bool_env_var("HOLOSCAN_LAZY_GXF_EXTENSIONS");
+  if (load_extensions_on_demand_) {
+    // The other default extensions are loaded by initialize_gxf_graph()
+    gxf_extension_manager_->load_extension(kStdGXFExtension);
+  } else {
+    // Register the default GXF extensions
+    for (auto& gxf_extension_file_name : kDefaultGXFExtensions) {
+      gxf_extension_manager_->load_extension(gxf_extension_file_name);
+    }
 
-  // Register the default Holoscan GXF extensions
-  for (auto& gxf_extension_file_name : kDefaultHoloscanGXFExtensions) {
-    gxf_extension_manager_->load_extension(gxf_extension_file_name);
+    // Register the default Holoscan GXF extensions
+    for (auto& gxf_extension_file_name : kDefaultHoloscanGXFExtensions) {
+      gxf_extension_manager_->load_extension(gxf_extension_file_name);
+    }
   }
+  const double load_ms =
+      std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - load_start)
+          .count();
+  // Reported with the other startup phases if HOLOSCAN_STARTUP_PROFILE is set
+  fragment_->startup_profiler().record(StartupProfiler::kExtensionLoading, load_ms);
+  HOLOSCAN_LOG_DEBUG(
+      "Loading default GXF extensions for fragment '{}' took {:.3f} ms ({} extensions{})",
+      fragment_->name(),
+      load_ms,
+      load_extensions_on_demand_
+          ? size_t{1}
+          : kDefaultGXFExtensions.size() + kDefaultHoloscanGXFExtensions.size(),
+      load_extensions_on_demand_ ? ", others on demand" : "");
 
   // Register the GXF extension that provides the native operators
   gxf_tid_t gxf_wrapper_tid{0xd4e7c16bcae741f8, 0xa5eb93731de9ccf6};
@@ -1847,9 +2526,84 @@ void GXFExecutor::register_extensions() {
                                     nvidia::gxf::DoubleBufferTransmitter>(
         "Holoscan's annotated double buffer transmitter", {0x444505a86c014d90, 0xab7503bcd0782877});
 
+    // Add the lock-free SPSC ring buffer receiver and transmitter
+    extension_factory.add_component<holoscan::SpscRingBufferReceiver, nvidia::gxf::Receiver>(
+        "Holoscan's lock-free SPSC ring buffer receiver", {0x5c3e2a0f7b9d4e61, 0x9a41c8d2e6f03b75});
+
+    extension_factory.add_component<holoscan::SpscRingBufferTransmitter, nvidia::gxf::Transmitter>(
+        "Holoscan's lock-free SPSC ring buffer transmitter",
+        {0x7e16d94b2c584f0a, 0xb3d75e19a08c6f42});
+
     extension_factory.add_type<holoscan::MessageLabel>("Holoscan message Label",
                                                        {0x6e09e888ccfa4a32, 0xbc501cd20c8b4337});
 
+    // Add the multi-subscriber transmitter used for fan-out without Broadcast entities
+    extension_factory.add_component<holoscan::FanOutTransmitter, nvidia::gxf::Transmitter>(
+        "Holoscan's transmitter publishing to multiple receivers",
+        {0x3b8f61c2d47e4a95, 0x8c02e7a5f19d6b34});
+    extension_factory
+        .add_component<holoscan::FanOutReceptiveSchedulingTerm, nvidia::gxf::SchedulingTerm>(
+            "Holoscan's scheduling term checking the receivers of a fan-out transmitter",
+            {0xd1a4e6b83f2c4705, 0x96e3b2c7a05f18d4});
+
+    // Add the conflating (latest-value) receiver
+    extension_factory.add_component<holoscan::ConflatingMailboxReceiver, nvidia::gxf::Receiver>(
+        "Holoscan's receiver keeping only the latest message",
+        {0x8f2d5a7c1e6b4b93, 0xa4c19e0d72b35f86});
+
+    // Add the shared memory receiver and transmitter used between fragments on the same host
+    extension_factory.add_component<holoscan::SharedMemoryChannelReceiver, nvidia::gxf::Receiver>(
+        "Holoscan's receiver reading messages from a shared memory segment",
+        {0x2c7f0e93b15a4d68, 0x81e4a6d30c9f5b27});
+    extension_factory
+        .add_component<holoscan::SharedMemoryChannelTransmitter, nvidia::gxf::Transmitter>(
+            "Holoscan's transmitter writing messages to a shared memory segment",
+            {0x6a91d3f4e82c4b05, 0xb7052c8e1fd94a63});
+    extension_factory
+        .add_component<holoscan::SharedMemoryReceptiveSchedulingTerm,
+                       nvidia::gxf::SchedulingTerm>(
+            "Holoscan's scheduling term checking the free slots of a shared memory transmitter",
+            {0x4e2b97d05a1c4f38, 0xa6d18c3f72e05b19});
+
+    // Add the allocator recycling the buffers of another allocator
+    extension_factory.add_component<holoscan::BufferRecyclingAllocator, nvidia::gxf::Allocator>(
+        "Holoscan's allocator recycling released buffers of the same size",
+        {0x4d8b27e1c9a54f36, 0xa2e5f07b3c1d9846});
+
+    // Add the allocator serving requests of mixed sizes from size classes
+    extension_factory.add_component<holoscan::SlabAllocator, nvidia::gxf::Allocator>(
+        "Holoscan's allocator with per-size-class free lists",
+        {0x4f65f18d34fa4eaa, 0xa13fc870a1e228ff});
+
+    // Add the allocator serving host blocks from a pre-faulted (huge-page) region
+    extension_factory.add_component<holoscan::HugePageAllocator, nvidia::gxf::Allocator>(
+        "Holoscan's host allocator reserving its blocks up front with huge pages",
+        {0xd4f50148f2414170, 0xaea9fad971c75232});
+
+    // Add the allocator binding host memory to NUMA nodes
+    extension_factory.add_component<holoscan::NumaBindingAllocator, nvidia::gxf::Allocator>(
+        "Holoscan's host allocator binding its allocations to a NUMA node",
+        {0x63a07b6ad390461e, 0x92b0af30735d8e8a});
+
+    // Add the allocator waiting for free memory and the matching scheduling term
+    extension_factory.add_component<holoscan::BackpressureAllocator, nvidia::gxf::Allocator>(
+        "Holoscan's allocator waiting for another allocator to free a buffer",
+        {0x817af9acd8c14f3d, 0x9f788783cd092d9a});
+    extension_factory
+        .add_component<holoscan::MemoryAvailableSchedulingTerm, nvidia::gxf::SchedulingTerm>(
+            "Holoscan's scheduling term checking that an allocator has free memory",
+            {0x3b65bef76f554d0e, 0x9dae456d57d316ac});
+
+    // Add the allocator recording the allocations of another allocator (HOLOSCAN_ALLOCATOR_STATS)
+    extension_factory.add_component<holoscan::TrackingAllocator, nvidia::gxf::Allocator>(
+        "Holoscan's allocator recording the usage of another allocator",
+        {0xfcd9e385bf364bbe, 0xa2b0b7d48b8562ce});
+
+    // Add the clock reading the CPU cycle counter
+    extension_factory.add_component<holoscan::TimestampCounterClock, nvidia::gxf::Clock>(
+        "Holoscan's clock calibrating the CPU cycle counter against CLOCK_MONOTONIC",
+        {0xaa1c215c06a043e2, 0xb6d74f18ef95401f});
+
     extension_factory.add_component<holoscan::DFFTCollector, nvidia::gxf::Monitor>(
         "Holoscan's DFFTCollector based on Monitor", {0xe6f50ca5cad74469, 0xad868076daf2c923});
 
@@ -1862,6 +2616,150 @@ void GXFExecutor::register_extensions() {
   }
 }
 
+/// Collect the GXF type names of the component and of the resources in its arguments.
+static void collect_gxf_typenames(Component* component, std::set<std::string>& typenames) {
+  if (component == nullptr) { return; }
+  auto gxf_component = dynamic_cast<GXFComponent*>(component);
+  if (gxf_component) { typenames.insert(gxf_component->gxf_typename()); }
+  for (auto& arg : component->args()) {
+    const auto& arg_type = arg.arg_type();
+    if (arg_type.element_type() != ArgElementType::kResource) { continue; }
+    try {
+      if (arg_type.container_type() == ArgContainerType::kNative) {
+        auto resource = std::any_cast<std::shared_ptr<Resource>>(arg.value());
+        collect_gxf_typenames(resource.get(), typenames);
+      } else if (arg_type.container_type() == ArgContainerType::kVector) {
+        for (auto& resource : std::any_cast<std::vector<std::shared_ptr<Resource>>>(arg.value())) {
+          collect_gxf_typenames(resource.get(), typenames);
+        }
+      }
+    } catch (const std::bad_any_cast& e) {
+      HOLOSCAN_LOG_DEBUG("Unable to cast argument '{}' to resource: {}", arg.name(), e.what());
+    }
+  }
+}
+
+void GXFExecutor::load_required_extensions(OperatorGraph& graph) {
+  const auto load_start = std::chrono::steady_clock::now();
+
+  std::set<std::string> typenames;
+  std::set<std::string> required_extensions;
+  for (auto& op : graph.get_nodes()) {
+    if (op->operator_type() == Operator::OperatorType::kGXF) {
+      typenames.insert(std::dynamic_pointer_cast<holoscan::ops::GXFOperator>(op)->gxf_typename());
+    }
+    collect_gxf_typenames(op.get(), typenames);
+    for (auto& [_, condition] : op->conditions()) {
+      collect_gxf_typenames(condition.get(), typenames);
+    }
+    for (auto& [_, resource] : op->resources()) {
+      collect_gxf_typenames(resource.get(), typenames);
+    }
+
+    auto op_spec = op->spec();
+    for (auto* io_specs : {&op_spec->inputs(), &op_spec->outputs()}) {
+      for (auto& [port_name, io_spec] : *io_specs) {
+        collect_gxf_typenames(io_spec->connector().get(), typenames);
+        for (auto& [condition_type, condition] : io_spec->conditions()) {
+          collect_gxf_typenames(condition.get(), typenames);
+        }
+      }
+    }
+    const auto& op_extensions = op_spec->required_gxf_extensions();
+    required_extensions.insert(op_extensions.begin(), op_extensions.end());
+  }
+  collect_gxf_typenames(fragment_->scheduler().get(), typenames);
+  collect_gxf_typenames(fragment_->network_context().get(), typenames);
+
+  // Connectors between fragments are created while the fragment is initialized
+  for (const auto& connection_item : connection_items_) {
+    switch (connection_item->connector_type) {
+      case IOSpec::ConnectorType::kUCX:
+        typenames.insert("nvidia::gxf::UcxReceiver");
+        break;
+      case IOSpec::ConnectorType::kSharedMemory:
+        typenames.insert("holoscan::SharedMemoryChannelReceiver");
+        break;
+      default:
+        break;
+    }
+  }
+
+  for (const auto& type_name : typenames) {
+    for (const auto& extension : kOnDemandGXFExtensions) {
+      for (const auto& prefix : extension.type_prefixes) {
+        if (type_name.compare(0, prefix.size(), prefix) == 0) {
+          required_extensions.insert(extension.file_name);
+          break;
+        }
+      }
+    }
+  }
+
+  // Add the dependencies (the default extensions are listed after their dependencies)
+  for (auto it = kOnDemandGXFExtensions.rbegin(); it != kOnDemandGXFExtensions.rend(); ++it) {
+    if (required_extensions.find(it->file_name) != required_extensions.end()) {
+      required_extensions.insert(it->dependencies.begin(), it->dependencies.end());
+    }
+  }
+
+  // Extensions listed in the configuration may depend on any of the default extensions
+  bool load_all = false;
+  for (const auto& yaml_node : fragment_->config().yaml_nodes()) {
+    const auto extensions_node = yaml_node["extensions"];
+    if (extensions_node && extensions_node.size() > 0) {
+      HOLOSCAN_LOG_DEBUG("Extensions are listed in the configuration. Loading all the default "
+                         "GXF extensions.");
+      load_all = true;
+      break;
+    }
+  }
+
+  std::vector<std::string> loaded_extensions;
+  auto load_default_extensions = [this, &loaded_extensions](
+                                     const std::set<std::string>& file_names, bool all) {
+    for (const auto* extension_list : {&kDefaultGXFExtensions, &kDefaultHoloscanGXFExtensions}) {
+      for (const auto& file_name : *extension_list) {
+        if (file_name == kStdGXFExtension) { continue; }
+        if (!all && file_names.find(file_name) == file_names.end()) { continue; }
+        if (std::find(loaded_extensions.begin(), loaded_extensions.end(), file_name) !=
+            loaded_extensions.end()) {
+          continue;
+        }
+        gxf_extension_manager_->load_extension(file_name);
+        loaded_extensions.push_back(file_name);
+      }
+    }
+  };
+  load_default_extensions(required_extensions, load_all);
+
+  // Types provided by other extensions (e.g., loaded by the user) may need any default extension
+  if (!load_all) {
+    for (const auto& type_name : typenames) {
+      gxf_tid_t tid = GxfTidNull();
+      if (GxfComponentTypeId(context_, type_name.c_str(), &tid) != GXF_SUCCESS) {
+        HOLOSCAN_LOG_DEBUG("GXF type '{}' is not registered. Loading all the default GXF "
+                           "extensions.",
+                           type_name);
+        load_default_extensions({}, true);
+        break;
+      }
+    }
+  }
+
+  const double load_ms =
+      std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - load_start)
+          .count();
+  // Reported with the other startup phases if HOLOSCAN_STARTUP_PROFILE is set
+  fragment_->startup_profiler().record(StartupProfiler::kExtensionLoading, load_ms);
+  HOLOSCAN_LOG_DEBUG(
+      "Loading required GXF extensions for fragment '{}' took {:.3f} ms ({} extensions: [{}])",
+      fragment_->name(),
+      load_ms,
+      loaded_extensions.size(),
+      fmt::join(loaded_extensions, ", "));
+}
+
 bool GXFExecutor::initialize_scheduler(Scheduler* sch) {
   if (!sch->spec()) {
     HOLOSCAN_LOG_ERROR("No component spec for GXFScheduler '{}'", sch->name());
@@ -20,10 +20,12 @@
 
 #include <functional>
 #include <iterator>  // for std::back_inserter
+#include <map>
 #include <memory>
 #include <set>
 #include <string>
 #include <typeinfo>
+#include <unordered_map>
 #include <utility>
 #include <variant>
 #include <vector>
@@ -35,6 +37,7 @@
 #include "holoscan/core/graphs/flow_graph.hpp"
 #include "holoscan/core/operator.hpp"
 #include "holoscan/core/schedulers/gxf/greedy_scheduler.hpp"
+#include "holoscan/core/system/tsc_counter.hpp"
 
 namespace holoscan {
 
@@ -91,6 +94,7 @@ void Fragment::config(const std::string& config_file, const std::string& prefix)
     }
   }
 
+  StartupProfiler::ScopedPhase config_phase(*startup_profiler_, StartupProfiler::kConfig);
   config_ = make_config<Config>(config_file, prefix);
 }
 
@@ -100,6 +104,7 @@ void Fragment::config(std::shared_ptr<Config>& config) {
 
 Config& Fragment::config() {
   if (!config_) {
+    StartupProfiler::ScopedPhase config_phase(*startup_profiler_, StartupProfiler::kConfig);
     // If the application is executed with `--config` option or HOLOSCAN_CONFIG_PATH environment
     // variable, we take the config file from there.
     if (app_) {
@@ -153,7 +158,11 @@ std::shared_ptr<NetworkContext> Fragment::network_context() {
 }
 
 ArgList Fragment::from_config(const std::string& key) {
-  auto& yaml_nodes = config().yaml_nodes();
+  auto& fragment_config = config();
+  // Most keys are resolved by the index built when the configuration file is parsed.
+  if (auto indexed_args = fragment_config.find_args(key)) { return *indexed_args; }
+
+  auto& yaml_nodes = fragment_config.yaml_nodes();
   ArgList args;
 
   std::vector<std::string> key_parts;
@@ -421,6 +430,100 @@ void Fragment::add_flow(const std::shared_ptr<Operator>& upstream_op,
   graph().add_flow(upstream_op, downstream_op, port_map);
 }
 
+void Fragment::add_flow(const std::shared_ptr<Operator>& upstream_op,
+                        const std::shared_ptr<Operator>& downstream_op,
+                        std::set<std::pair<std::string, std::string>> port_pairs,
+                        IOSpec::ConnectorType connector_type, const ArgList& connector_args) {
+  // Keep the existing connections between the two operators so that only the ports connected by
+  // this call are updated (port labels are resolved by add_flow()).
+  std::map<std::string, std::set<std::string, std::less<>>> existing_ports;
+  auto existing_port_map = graph().get_port_map(upstream_op, downstream_op);
+  if (existing_port_map.has_value()) {
+    for (const auto& [source_port, target_ports] : *existing_port_map.value()) {
+      existing_ports[source_port] = target_ports;
+    }
+  }
+
+  add_flow(upstream_op, downstream_op, std::move(port_pairs));
+
+  auto port_map = graph().get_port_map(upstream_op, downstream_op);
+  if (!port_map.has_value()) { return; }
+
+  auto& op_outputs = upstream_op->spec()->outputs();
+  auto& op_inputs = downstream_op->spec()->inputs();
+  for (const auto& [source_port, target_ports] : *port_map.value()) {
+    auto existing_it = existing_ports.find(source_port);
+    bool is_new_source = existing_it == existing_ports.end();
+    for (const auto& target_port : target_ports) {
+      if (!is_new_source && existing_it->second.count(target_port)) { continue; }
+      auto output_it = op_outputs.find(source_port);
+      if (output_it != op_outputs.end()) {
+        // An output port has a single transmitter: the first connector type given is kept.
+        auto& output_spec = output_it->second;
+        auto output_type = output_spec->connector_type();
+        if (output_type == IOSpec::ConnectorType::kDefault) {
+          output_spec->connector(connector_type);
+        } else if (output_type != connector_type) {
+          HOLOSCAN_LOG_WARN(
+              "Output port '{}.{}' already uses connector type {}; keeping it for the flow to "
+              "'{}.{}' (requested connector type {})",
+              upstream_op->name(),
+              source_port,
+              static_cast<int>(output_type),
+              downstream_op->name(),
+              target_port,
+              static_cast<int>(connector_type));
+        }
+      }
+      auto input_it = op_inputs.find(target_port);
+      if (input_it != op_inputs.end()) {
+        input_it->second->connector(connector_type, connector_args);
+      }
+    }
+  }
+}
+
+void Fragment::add_flow(const std::shared_ptr<Operator>& upstream_op,
+                        const std::shared_ptr<Operator>& downstream_op,
+                        std::set<std::pair<std::string, std::string>> port_pairs,
+                        const ArgList& connector_config) {
+  static const std::unordered_map<std::string, IOSpec::ConnectorType> connector_types{
+      {"default", IOSpec::ConnectorType::kDefault},
+      {"double_buffer", IOSpec::ConnectorType::kDoubleBuffer},
+      {"ring_buffer", IOSpec::ConnectorType::kRingBuffer},
+      {"conflating", IOSpec::ConnectorType::kConflating},
+  };
+
+  IOSpec::ConnectorType connector_type = IOSpec::ConnectorType::kDefault;
+  ArgList connector_args;
+  for (auto arg : connector_config) {
+    if (arg.name() != "type") {
+      connector_args.add(arg);
+      continue;
+    }
+    std::string type_name;
+    const auto& value = arg.value();
+    if (value.type() == typeid(YAML::Node)) {
+      type_name = std::any_cast<YAML::Node>(value).as<std::string>();
+    } else if (value.type() == typeid(std::string)) {
+      type_name = std::any_cast<std::string>(value);
+    } else if (value.type() == typeid(const char*)) {
+      type_name = std::any_cast<const char*>(value);
+    }
+    auto it = connector_types.find(type_name);
+    if (it == connector_types.end()) {
+      HOLOSCAN_LOG_ERROR("Unknown connector type '{}' for the flow between '{}' and '{}'",
+                         type_name,
+                         upstream_op->name(),
+                         downstream_op->name());
+      return;
+    }
+    connector_type = it->second;
+  }
+
+  add_flow(upstream_op, downstream_op, std::move(port_pairs), connector_type, connector_args);
+}
+
 void Fragment::compose() {}
 
 void Fragment::run() {
@@ -439,6 +542,9 @@ holoscan::DataFlowTracker& Fragment::track(uint64_t num_start_messages_to_skip,
     data_flow_tracker_->set_skip_starting_messages(num_start_messages_to_skip);
     data_flow_tracker_->set_discard_last_messages(num_last_messages_to_discard);
     data_flow_tracker_->set_skip_latencies(latency_threshold);
+    // Calibrate the counter now rather than on the first message timestamp (see
+    // get_current_time_us()), as the calibration sleeps for a few milliseconds.
+    if (TscCounter::is_timestamp_source_enabled()) { TscCounter::instance(); }
   }
   return *data_flow_tracker_;
 }
@@ -449,6 +555,7 @@ void Fragment::compose_graph() {
     return;
   }
   is_composed_ = true;
+  StartupProfiler::ScopedPhase compose_phase(*startup_profiler_, StartupProfiler::kCompose);
   compose();
 }
 
@@ -22,7 +22,9 @@
 #include <unordered_map>
 #include <utility>
 
+#include "holoscan/core/schedulers/communication_aware_fragment_allocation.hpp"
 #include "holoscan/core/schedulers/greedy_fragment_allocation.hpp"
+#include "holoscan/logger/logger.hpp"
 
 namespace holoscan {
 
@@ -86,6 +88,26 @@ void FragmentAllocationStrategy::add_available_resource(
   if (result.second) { on_add_available_resource(result.first->second); }
 }
 
+void FragmentAllocationStrategy::add_connection_requirement(
+    const FragmentConnectionRequirement& connection_requirement) {
+  connection_requirements_.push_back(connection_requirement);
+  on_add_connection_requirement(connection_requirement);
+}
+
+holoscan::expected<std::unique_ptr<FragmentAllocationStrategy>, std::string>
+make_fragment_allocation_strategy(const std::string& name, uint32_t max_fragments_per_worker) {
+  if (name.empty() || name == "greedy") {
+    return std::make_unique<GreedyFragmentAllocationStrategy>();
+  }
+  if (name == "communication_aware") {
+    return std::make_unique<CommunicationAwareFragmentAllocationStrategy>(
+        max_fragments_per_worker);
+  }
+  return holoscan::make_unexpected(fmt::format(
+      "Unknown fragment allocation strategy '{}' (expected 'greedy' or 'communication_aware')",
+      name));
+}
+
 FragmentScheduler::FragmentScheduler(
     std::unique_ptr<FragmentAllocationStrategy>&& allocation_strategy)
     : strategy_([&allocation_strategy]() {
@@ -116,6 +138,11 @@ void FragmentScheduler::add_available_resource(AvailableSystemResource&& availab
   strategy_->add_available_resource(std::move(available_resource));
 }
 
+void FragmentScheduler::add_connection_requirement(
+    const FragmentConnectionRequirement& connection_requirement) {
+  strategy_->add_connection_requirement(connection_requirement);
+}
+
 holoscan::expected<std::unordered_map<std::string, std::string>, std::string>
 FragmentScheduler::schedule() {
   if (!strategy_) {
@@ -18,8 +18,10 @@
 #include "holoscan/core/gxf/gxf_wrapper.hpp"
 
 #include "holoscan/core/common.hpp"
+#include "holoscan/core/fragment.hpp"
 #include "holoscan/core/gxf/gxf_execution_context.hpp"
 #include "holoscan/core/io_context.hpp"
+#include "holoscan/core/resources/gxf/allocation_tracker.hpp"
 
 #include "gxf/std/transmitter.hpp"
 
@@ -46,7 +48,19 @@ gxf_result_t GXFWrapper::start() {
     HOLOSCAN_LOG_ERROR("GXFWrapper::start() - Operator is not set");
     return GXF_FAILURE;
   }
-  op_->start();
+  if (is_operator_started_) {
+    HOLOSCAN_LOG_DEBUG("Operator '{}' is already started", op_->name());
+    return GXF_SUCCESS;
+  }
+  auto fragment = op_->fragment();
+  auto& startup_profiler = fragment->startup_profiler();
+  {
+    StartupProfiler::ScopedPhase phase(
+        startup_profiler, StartupProfiler::kOperatorStart, op_->name());
+    AllocationTracker::ScopedOwner owner(op_->name());
+    op_->start();
+  }
+  if (startup_profiler.is_startup_complete()) { startup_profiler.log_report(fragment->name()); }
   return GXF_SUCCESS;
 }
 
@@ -59,6 +73,7 @@ gxf_result_t GXFWrapper::tick() {
 
   HOLOSCAN_LOG_TRACE("Calling operator: {}", op_->name());
 
+  AllocationTracker::ScopedOwner owner(op_->name());
   GXFExecutionContext exec_context(context(), op_);
   InputContext* op_input = exec_context.input();
   OutputContext* op_output = exec_context.output();
@@ -78,7 +93,10 @@ gxf_result_t GXFWrapper::stop() {
     HOLOSCAN_LOG_ERROR("GXFWrapper::stop() - Operator is not set");
     return GXF_FAILURE;
   }
+  AllocationTracker::ScopedOwner owner(op_->name());
   op_->stop();
+  // The operator is started again by start() if the graph is run again.
+  is_operator_started_ = false;
   return GXF_SUCCESS;
 }
 
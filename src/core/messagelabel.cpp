@@ -17,16 +17,26 @@
 
 #include <limits.h>
 #include <algorithm>
+#include <chrono>
 #include <iterator>
 #include <string>
 #include <vector>
 
 #include "holoscan/core/messagelabel.hpp"
 #include "holoscan/core/operator.hpp"
+#include "holoscan/core/system/tsc_counter.hpp"
 #include "holoscan/logger/logger.hpp"
 
 namespace holoscan {
 
+int64_t get_current_time_us() {
+  static const bool use_tsc = TscCounter::is_timestamp_source_enabled();
+  if (use_tsc) { return TscCounter::instance().epoch_ns() / 1000; }
+  return static_cast<int64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+                                  std::chrono::system_clock::now().time_since_epoch())
+                                  .count());
+}
+
 OperatorTimestampLabel& OperatorTimestampLabel::operator=(const OperatorTimestampLabel& o) {
   if (this != &o) {
     this->operator_ptr = o.operator_ptr;
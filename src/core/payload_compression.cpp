@@ -0,0 +1,249 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "holoscan/core/payload_compression.hpp"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <limits>
+#include <string>
+#include <vector>
+
+#ifdef HOLOSCAN_HAS_LZ4
+#include <lz4.h>
+#include <lz4hc.h>
+#endif
+#ifdef HOLOSCAN_HAS_ZSTD
+#include <zstd.h>
+#endif
+
+namespace holoscan {
+
+namespace {
+
+// Negotiated algorithms (one bit per algorithm) and whether the negotiation was done. Read for
+// every payload, so it is kept in a single atomic word.
+constexpr uint32_t kNegotiationDoneBit = 1U << 31;
+std::atomic<uint32_t> negotiated_state{0};
+
+constexpr uint32_t algorithm_bit(CompressionAlgorithm algorithm) {
+  return 1U << static_cast<uint32_t>(algorithm);
+}
+
+expected<size_t, RuntimeError> compression_error(CompressionAlgorithm algorithm,
+                                                 const std::string& message) {
+  return make_unexpected<RuntimeError>(RuntimeError(
+      ErrorCode::kCodecError,
+      fmt::format("{} payload compression error: {}", PayloadCompression::to_string(algorithm),
+                  message)));
+}
+
+}  // namespace
+
+bool PayloadCompression::is_available(CompressionAlgorithm algorithm) {
+  switch (algorithm) {
+    case CompressionAlgorithm::kNone:
+      return true;
+    case CompressionAlgorithm::kLz4:
+#ifdef HOLOSCAN_HAS_LZ4
+      return true;
+#else
+      return false;
+#endif
+    case CompressionAlgorithm::kZstd:
+#ifdef HOLOSCAN_HAS_ZSTD
+      return true;
+#else
+      return false;
+#endif
+  }
+  return false;
+}
+
+std::vector<std::string> PayloadCompression::available_algorithms() {
+  std::vector<std::string> names;
+  for (auto algorithm : {CompressionAlgorithm::kLz4, CompressionAlgorithm::kZstd}) {
+    if (is_available(algorithm)) { names.emplace_back(to_string(algorithm)); }
+  }
+  return names;
+}
+
+const char* PayloadCompression::to_string(CompressionAlgorithm algorithm) {
+  switch (algorithm) {
+    case CompressionAlgorithm::kNone:
+      return "none";
+    case CompressionAlgorithm::kLz4:
+      return "lz4";
+    case CompressionAlgorithm::kZstd:
+      return "zstd";
+  }
+  return "unknown";
+}
+
+expected<CompressionAlgorithm, RuntimeError> PayloadCompression::from_string(
+    const std::string& name) {
+  if (name.empty() || name == "none") { return CompressionAlgorithm::kNone; }
+  if (name == "lz4") { return CompressionAlgorithm::kLz4; }
+  if (name == "zstd") { return CompressionAlgorithm::kZstd; }
+  return make_unexpected<RuntimeError>(RuntimeError(
+      ErrorCode::kInvalidArgument, fmt::format("Unknown compression algorithm '{}'", name)));
+}
+
+size_t PayloadCompression::max_compressed_size(CompressionAlgorithm algorithm, size_t size) {
+  switch (algorithm) {
+    case CompressionAlgorithm::kNone:
+      return size;
+    case CompressionAlgorithm::kLz4:
+#ifdef HOLOSCAN_HAS_LZ4
+      if (size > static_cast<size_t>(LZ4_MAX_INPUT_SIZE)) { return 0; }
+      return static_cast<size_t>(LZ4_compressBound(static_cast<int>(size)));
+#else
+      return 0;
+#endif
+    case CompressionAlgorithm::kZstd:
+#ifdef HOLOSCAN_HAS_ZSTD
+      return ZSTD_compressBound(size);
+#else
+      return 0;
+#endif
+  }
+  return 0;
+}
+
+expected<size_t, RuntimeError> PayloadCompression::compress(CompressionAlgorithm algorithm,
+                                                            [[maybe_unused]] int32_t level,
+                                                            [[maybe_unused]] const void* src,
+                                                            [[maybe_unused]] size_t src_size,
+                                                            [[maybe_unused]] void* dst,
+                                                            [[maybe_unused]] size_t dst_capacity) {
+  switch (algorithm) {
+    case CompressionAlgorithm::kNone:
+      break;
+    case CompressionAlgorithm::kLz4: {
+#ifdef HOLOSCAN_HAS_LZ4
+      constexpr size_t kMaxSize = static_cast<size_t>(std::numeric_limits<int>::max());
+      if (src_size > static_cast<size_t>(LZ4_MAX_INPUT_SIZE)) {
+        return compression_error(algorithm, "input too large");
+      }
+      const int capacity = static_cast<int>(std::min(dst_capacity, kMaxSize));
+      // Levels above 1 use the (slower, denser) high compression mode.
+      const int size =
+          level > 1 ? LZ4_compress_HC(static_cast<const char*>(src),
+                                      static_cast<char*>(dst),
+                                      static_cast<int>(src_size),
+                                      capacity,
+                                      level)
+                    : LZ4_compress_default(static_cast<const char*>(src),
+                                           static_cast<char*>(dst),
+                                           static_cast<int>(src_size),
+                                           capacity);
+      if (size <= 0) { return compression_error(algorithm, "destination buffer too small"); }
+      return static_cast<size_t>(size);
+#else
+      break;
+#endif
+    }
+    case CompressionAlgorithm::kZstd: {
+#ifdef HOLOSCAN_HAS_ZSTD
+      const size_t size = ZSTD_compress(dst, dst_capacity, src, src_size, level);
+      if (ZSTD_isError(size)) { return compression_error(algorithm, ZSTD_getErrorName(size)); }
+      return size;
+#else
+      break;
+#endif
+    }
+  }
+  return compression_error(algorithm, "algorithm not available");
+}
+
+expected<size_t, RuntimeError> PayloadCompression::decompress(CompressionAlgorithm algorithm,
+                                                              [[maybe_unused]] const void* src,
+                                                              [[maybe_unused]] size_t src_size,
+                                                              [[maybe_unused]] void* dst,
+                                                              [[maybe_unused]] size_t dst_size) {
+  switch (algorithm) {
+    case CompressionAlgorithm::kNone:
+      break;
+    case CompressionAlgorithm::kLz4: {
+#ifdef HOLOSCAN_HAS_LZ4
+      if (src_size > static_cast<size_t>(LZ4_MAX_INPUT_SIZE) ||
+          dst_size > static_cast<size_t>(std::numeric_limits<int>::max())) {
+        return compression_error(algorithm, "payload too large");
+      }
+      const int size = LZ4_decompress_safe(static_cast<const char*>(src),
+                                           static_cast<char*>(dst),
+                                           static_cast<int>(src_size),
+                                           static_cast<int>(dst_size));
+      if (size < 0 || static_cast<size_t>(size) != dst_size) {
+        return compression_error(algorithm, "corrupted payload");
+      }
+      return dst_size;
+#else
+      break;
+#endif
+    }
+    case CompressionAlgorithm::kZstd: {
+#ifdef HOLOSCAN_HAS_ZSTD
+      const size_t size = ZSTD_decompress(dst, dst_size, src, src_size);
+      if (ZSTD_isError(size)) { return compression_error(algorithm, ZSTD_getErrorName(size)); }
+      if (size != dst_size) { return compression_error(algorithm, "corrupted payload"); }
+      return dst_size;
+#else
+      break;
+#endif
+    }
+  }
+  return compression_error(algorithm, "algorithm not available");
+}
+
+std::vector<std::string> PayloadCompression::requested_algorithms() {
+  const char* env_value = std::getenv("HOLOSCAN_UCX_COMPRESSION");
+  if (env_value == nullptr) { return {}; }
+  auto algorithm = from_string(env_value);
+  if (!algorithm || algorithm.value() == CompressionAlgorithm::kNone) { return {}; }
+  return available_algorithms();
+}
+
+void PayloadCompression::set_negotiated_algorithms(const std::vector<std::string>& names) {
+  uint32_t state = kNegotiationDoneBit;
+  for (const auto& name : names) {
+    auto algorithm = from_string(name);
+    if (algorithm && algorithm.value() != CompressionAlgorithm::kNone &&
+        is_available(algorithm.value())) {
+      state |= algorithm_bit(algorithm.value());
+    }
+  }
+  negotiated_state.store(state, std::memory_order_release);
+}
+
+bool PayloadCompression::is_negotiated(CompressionAlgorithm algorithm) {
+  if (algorithm == CompressionAlgorithm::kNone) { return true; }
+  if (!is_available(algorithm)) { return false; }
+  const uint32_t state = negotiated_state.load(std::memory_order_acquire);
+  if ((state & kNegotiationDoneBit) == 0) { return true; }
+  return (state & algorithm_bit(algorithm)) != 0;
+}
+
+bool PayloadCompression::is_enabled() {
+  const uint32_t state = negotiated_state.load(std::memory_order_acquire);
+  return (state & kNegotiationDoneBit) == 0 || (state & ~kNegotiationDoneBit) != 0;
+}
+
+}  // namespace holoscan
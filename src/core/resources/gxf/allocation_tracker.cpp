@@ -0,0 +1,137 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "holoscan/core/resources/gxf/allocation_tracker.hpp"
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+
+namespace holoscan {
+
+namespace {
+
+// Operator running on the current thread (see AllocationTracker::ScopedOwner)
+thread_local const std::string* current_owner = nullptr;
+
+const std::string kUnknownOwner = "(unknown)";
+
+}  // namespace
+
+AllocationTracker::ScopedOwner::ScopedOwner(const std::string& name)
+    : previous_owner_(current_owner) {
+  current_owner = &name;
+}
+
+AllocationTracker::ScopedOwner::~ScopedOwner() {
+  current_owner = previous_owner_;
+}
+
+void AllocationTracker::record_allocation(void* pointer, uint64_t size,
+                                          std::chrono::nanoseconds latency) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  const std::string* owner = nullptr;
+  if (current_owner) { owner = &*owners_.insert(*current_owner).first; }
+  allocations_[pointer] = Allocation{size, owner};
+  allocation_count_++;
+  in_use_bytes_ += size;
+  peak_bytes_ = std::max(peak_bytes_, in_use_bytes_);
+  record_latency(latency);
+}
+
+void AllocationTracker::record_failure(uint64_t, std::chrono::nanoseconds latency) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  failure_count_++;
+  record_latency(latency);
+}
+
+bool AllocationTracker::record_free(void* pointer) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = allocations_.find(pointer);
+  if (it == allocations_.end()) { return false; }
+  in_use_bytes_ -= it->second.size;
+  free_count_++;
+  allocations_.erase(it);
+  return true;
+}
+
+AllocationStats AllocationTracker::stats() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  AllocationStats stats;
+  stats.allocations = allocation_count_;
+  stats.frees = free_count_;
+  stats.failures = failure_count_;
+  stats.in_use_bytes = in_use_bytes_;
+  stats.peak_bytes = peak_bytes_;
+
+  if (!latencies_ns_.empty()) {
+    std::vector<int64_t> latencies = latencies_ns_;
+    auto p99 = latencies.begin() + (latencies.size() - 1) * 99 / 100;
+    std::nth_element(latencies.begin(), p99, latencies.end());
+    stats.p99_allocate_latency_us = static_cast<double>(*p99) / 1000.0;
+  }
+
+  std::map<const std::string*, AllocationHolder> holders;
+  for (const auto& [pointer, allocation] : allocations_) {
+    auto& holder = holders[allocation.owner];
+    holder.buffers++;
+    holder.bytes += allocation.size;
+  }
+  stats.holders.reserve(holders.size());
+  for (auto& [owner, holder] : holders) {
+    holder.name = owner ? *owner : kUnknownOwner;
+    stats.holders.push_back(std::move(holder));
+  }
+  std::sort(stats.holders.begin(), stats.holders.end(), [](const auto& lhs, const auto& rhs) {
+    return lhs.bytes > rhs.bytes;
+  });
+  return stats;
+}
+
+std::string AllocationTracker::report(const std::string& name) const {
+  auto stats = this->stats();
+  std::string result = fmt::format(
+      "Allocator '{}': {} allocations, {} frees, {} failures, {} bytes in use (peak {} bytes), "
+      "p99 allocate latency {:.3f} us",
+      name,
+      stats.allocations,
+      stats.frees,
+      stats.failures,
+      stats.in_use_bytes,
+      stats.peak_bytes,
+      stats.p99_allocate_latency_us);
+  for (const auto& holder : stats.holders) {
+    result += fmt::format(
+        "\n  held by {}: {} buffers, {} bytes", holder.name, holder.buffers, holder.bytes);
+  }
+  return result;
+}
+
+void AllocationTracker::record_latency(std::chrono::nanoseconds latency) {
+  if (latencies_ns_.size() < kLatencyWindow) {
+    latencies_ns_.push_back(latency.count());
+  } else {
+    latencies_ns_[next_latency_index_] = latency.count();
+    next_latency_index_ = (next_latency_index_ + 1) % kLatencyWindow;
+  }
+}
+
+}  // namespace holoscan
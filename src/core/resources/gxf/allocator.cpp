@@ -19,23 +19,61 @@
 
 #include <string>
 
+#include "holoscan/core/app_driver.hpp"
+#include "holoscan/core/gxf/gxf_utils.hpp"
+#include "holoscan/core/resources/gxf/tracking_allocator.hpp"
+
 namespace holoscan {
 
 Allocator::Allocator(const std::string& name, nvidia::gxf::Allocator* component)
     : GXFResource(name, component) {}
 
-bool Allocator::is_available(uint64_t size) {
-  if (gxf_cptr_) {
-    nvidia::gxf::Allocator* allocator = static_cast<nvidia::gxf::Allocator*>(gxf_cptr_);
-    return allocator->is_available(size);
+void Allocator::initialize() {
+  const bool was_initialized = is_initialized_;
+  GXFResource::initialize();
+  if (was_initialized || !is_initialized_ ||
+      !AppDriver::get_bool_env_var("HOLOSCAN_ALLOCATOR_STATS", false)) {
+    return;
+  }
+
+  gxf_tid_t tracking_tid{};
+  if (GxfComponentTypeId(gxf_context_, "holoscan::TrackingAllocator", &tracking_tid) !=
+      GXF_SUCCESS) {
+    HOLOSCAN_LOG_WARN("Allocator '{}': TrackingAllocator is not registered, statistics disabled",
+                      name());
+    return;
   }
 
+  // Add the tracking allocator to the same entity, after the allocator it wraps so that it is
+  // deinitialized (and reports) first.
+  const std::string tracking_name = name() + "_tracking";
+  gxf_uid_t tracking_cid = 0;
+  HOLOSCAN_GXF_CALL_FATAL(GxfComponentAdd(
+      gxf_context_, gxf_eid_, tracking_tid, tracking_name.c_str(), &tracking_cid));
+  HOLOSCAN_GXF_CALL_FATAL(
+      GxfParameterSetHandle(gxf_context_, tracking_cid, "allocator", gxf_cid_));
+  HOLOSCAN_GXF_CALL_FATAL(GxfComponentPointer(
+      gxf_context_, tracking_cid, tracking_tid, reinterpret_cast<void**>(&tracking_allocator_)));
+
+  // Operator parameters are set from gxf_handle_cid(), so they receive the tracking allocator.
+  // gxf_cid() and the component pointer still refer to the allocator itself.
+  tracking_cid_ = tracking_cid;
+  HOLOSCAN_LOG_DEBUG("Allocator '{}': allocations are tracked by '{}'", name(), tracking_name);
+}
+
+gxf_uid_t Allocator::gxf_handle_cid() const {
+  return tracking_cid_ != 0 ? tracking_cid_ : gxf_cid_;
+}
+
+bool Allocator::is_available(uint64_t size) {
+  if (gxf_cptr_) { return gxf_allocator()->is_available(size); }
+
   return false;
 }
 
 nvidia::byte* Allocator::allocate(uint64_t size, MemoryStorageType type) {
   if (gxf_cptr_) {
-    nvidia::gxf::Allocator* allocator = static_cast<nvidia::gxf::Allocator*>(gxf_cptr_);
+    nvidia::gxf::Allocator* allocator = gxf_allocator();
 
     auto result = allocator->allocate(size, static_cast<nvidia::gxf::MemoryStorageType>(type));
     if (result) { return result.value(); }
@@ -49,10 +87,19 @@ nvidia::byte* Allocator::allocate(uint64_t size, MemoryStorageType type) {
 
 void Allocator::free(nvidia::byte* pointer) {
   if (gxf_cptr_) {
-    nvidia::gxf::Allocator* allocator = static_cast<nvidia::gxf::Allocator*>(gxf_cptr_);
+    nvidia::gxf::Allocator* allocator = gxf_allocator();
     auto result = allocator->free(pointer);
     if (!result) { HOLOSCAN_LOG_ERROR("Failed to free memory at {}", static_cast<void*>(pointer)); }
   }
 }
 
+AllocationStats Allocator::allocation_stats() const {
+  return tracking_allocator_ ? tracking_allocator_->stats() : AllocationStats{};
+}
+
+nvidia::gxf::Allocator* Allocator::gxf_allocator() const {
+  if (tracking_allocator_) { return tracking_allocator_; }
+  return static_cast<nvidia::gxf::Allocator*>(gxf_cptr_);
+}
+
 }  // namespace holoscan
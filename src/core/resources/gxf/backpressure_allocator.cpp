@@ -0,0 +1,133 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "holoscan/core/resources/gxf/backpressure_allocator.hpp"
+
+#include <chrono>
+#include <memory>
+
+#include "holoscan/logger/logger.hpp"
+
+namespace holoscan {
+
+gxf_result_t BackpressureAllocator::registerInterface(nvidia::gxf::Registrar* registrar) {
+  nvidia::gxf::Expected<void> result;
+  result &= registrar->parameter(
+      allocator_, "allocator", "Allocator", "Allocator providing the buffers");
+  result &= registrar->parameter(timeout_ms_,
+                                 "timeout_ms",
+                                 "Timeout",
+                                 "Maximum time in milliseconds an allocation waits for a buffer "
+                                 "to be freed (0 to fail immediately)",
+                                 100UL);
+  return nvidia::gxf::ToResultCode(result);
+}
+
+gxf_result_t BackpressureAllocator::initialize() {
+  waiter_ = std::make_unique<MemoryWaiter>(std::chrono::milliseconds(timeout_ms_.get()));
+  return GXF_SUCCESS;
+}
+
+gxf_result_t BackpressureAllocator::deinitialize() {
+  if (waiter_ == nullptr) { return GXF_SUCCESS; }
+  auto stats = waiter_->stats();
+  HOLOSCAN_LOG_DEBUG(
+      "BackpressureAllocator '{}': {} allocations, {} waits ({:.3f} ms max), {} timeouts, "
+      "{} errors",
+      name(),
+      stats.allocations,
+      stats.waits,
+      stats.max_wait_ms,
+      stats.timeouts,
+      stats.errors);
+  waiter_.reset();
+  return GXF_SUCCESS;
+}
+
+gxf_result_t BackpressureAllocator::is_available_abi(uint64_t size) {
+  return allocator_.get()->is_available_abi(size);
+}
+
+gxf_result_t BackpressureAllocator::allocate_abi(uint64_t size, int32_t type, void** pointer) {
+  if (pointer == nullptr || waiter_ == nullptr) { return GXF_ARGUMENT_NULL; }
+  gxf_result_t code = GXF_SUCCESS;
+  *pointer = waiter_->allocate([this, size, type, &code](void** result) {
+    code = allocator_.get()->allocate_abi(size, type, result);
+    if (code != GXF_SUCCESS) { *result = nullptr; }
+    // Only exhaustion is worth waiting for (e.g., not an invalid storage type)
+    return code == GXF_SUCCESS || code == GXF_FAILURE || code == GXF_OUT_OF_MEMORY;
+  });
+  if (*pointer == nullptr) {
+    if (code != GXF_FAILURE && code != GXF_OUT_OF_MEMORY) { return code; }
+    if (timeout_ms_.get() == 0) { return code; }
+    HOLOSCAN_LOG_WARN("BackpressureAllocator '{}': no buffer of {} bytes freed within {} ms",
+                      name(),
+                      size,
+                      timeout_ms_.get());
+    return code;
+  }
+  return GXF_SUCCESS;
+}
+
+gxf_result_t BackpressureAllocator::free_abi(void* pointer) {
+  const gxf_result_t code = allocator_.get()->free_abi(pointer);
+  if (code == GXF_SUCCESS && waiter_ != nullptr) { waiter_->notify_free(); }
+  return code;
+}
+
+MemoryWaiterStats BackpressureAllocator::stats() const {
+  return waiter_ ? waiter_->stats() : MemoryWaiterStats{};
+}
+
+gxf_result_t MemoryAvailableSchedulingTerm::registerInterface(nvidia::gxf::Registrar* registrar) {
+  nvidia::gxf::Expected<void> result;
+  result &= registrar->parameter(
+      allocator_, "allocator", "Allocator", "The allocator whose free memory is checked");
+  result &= registrar->parameter(min_bytes_,
+                                 "min_bytes",
+                                 "Minimum bytes",
+                                 "The size in bytes of the allocation which must be possible",
+                                 1UL);
+  result &= registrar->parameter(poll_period_ns_,
+                                 "poll_period_ns",
+                                 "Poll period",
+                                 "Period in nanoseconds after which an exhausted allocator is "
+                                 "checked again",
+                                 1'000'000L);
+  return nvidia::gxf::ToResultCode(result);
+}
+
+gxf_result_t MemoryAvailableSchedulingTerm::check_abi(int64_t timestamp,
+                                                      nvidia::gxf::SchedulingConditionType* type,
+                                                      int64_t* target_timestamp) const {
+  if (allocator_.get()->is_available_abi(min_bytes_.get()) == GXF_SUCCESS) {
+    *type = nvidia::gxf::SchedulingConditionType::READY;
+    *target_timestamp = timestamp;
+  } else {
+    // Nothing notifies the scheduler when memory is freed, so ask to be checked again later.
+    *type = nvidia::gxf::SchedulingConditionType::WAIT_TIME;
+    *target_timestamp = timestamp + poll_period_ns_.get();
+  }
+  return GXF_SUCCESS;
+}
+
+gxf_result_t MemoryAvailableSchedulingTerm::onExecute_abi(int64_t dt) {
+  (void)dt;
+  return GXF_SUCCESS;
+}
+
+}  // namespace holoscan
@@ -0,0 +1,50 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "holoscan/core/resources/gxf/blocking_allocator.hpp"
+
+#include <string>
+
+#include "holoscan/core/component_spec.hpp"
+#include "holoscan/core/gxf/gxf_utils.hpp"
+#include "holoscan/core/resources/gxf/backpressure_allocator.hpp"
+
+namespace holoscan {
+
+BlockingAllocator::BlockingAllocator(const std::string& name, BackpressureAllocator* component)
+    : Allocator(name, component) {
+  uint64_t timeout_ms = 0;
+  HOLOSCAN_GXF_CALL_FATAL(
+      GxfParameterGetUInt64(gxf_context_, gxf_cid_, "timeout_ms", &timeout_ms));
+  timeout_ms_ = timeout_ms;
+}
+
+void BlockingAllocator::setup(ComponentSpec& spec) {
+  spec.param(allocator_, "allocator", "Allocator", "Allocator providing the buffers");
+  spec.param(timeout_ms_,
+             "timeout_ms",
+             "Timeout",
+             "Maximum time in milliseconds an allocation waits for a buffer to be freed (0 to "
+             "fail immediately)",
+             100UL);
+}
+
+MemoryWaiterStats BlockingAllocator::stats() const {
+  return gxf_component_stats<BackpressureAllocator>();
+}
+
+}  // namespace holoscan
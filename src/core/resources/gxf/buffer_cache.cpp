@@ -0,0 +1,106 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "holoscan/core/resources/gxf/buffer_cache.hpp"
+
+#include <limits>
+#include <vector>
+
+namespace holoscan {
+
+BufferCache::BufferCache(uint64_t max_buffers_per_size, uint64_t max_cached_bytes)
+    : max_buffers_per_size_(max_buffers_per_size), max_cached_bytes_(max_cached_bytes) {}
+
+void* BufferCache::acquire(uint64_t size, int32_t storage_type) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = cached_.find(Key{size, storage_type});
+  if (it == cached_.end() || it->second.empty()) {
+    stats_.misses++;
+    return nullptr;
+  }
+  void* pointer = it->second.back();
+  it->second.pop_back();
+  in_use_.emplace(pointer, it->first);
+  stats_.hits++;
+  stats_.cached_buffers--;
+  stats_.cached_bytes -= size;
+  stats_.in_use_buffers++;
+  return pointer;
+}
+
+void BufferCache::track(void* pointer, uint64_t size, int32_t storage_type) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (in_use_.emplace(pointer, Key{size, storage_type}).second) { stats_.in_use_buffers++; }
+}
+
+BufferCache::ReleaseResult BufferCache::release(void* pointer) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = in_use_.find(pointer);
+  if (it == in_use_.end()) { return ReleaseResult::kUnknown; }
+  const Key key = it->second;
+  in_use_.erase(it);
+  stats_.in_use_buffers--;
+
+  auto cached = cached_.find(key);
+  const size_t num_cached = cached != cached_.end() ? cached->second.size() : 0;
+  if (closed_ || num_cached >= max_buffers_per_size_ ||
+      stats_.cached_bytes + key.first > max_cached_bytes_) {
+    stats_.evicted++;
+    return ReleaseResult::kEvict;
+  }
+  if (cached == cached_.end()) { cached = cached_.emplace(key, std::vector<void*>{}).first; }
+  cached->second.push_back(pointer);
+  stats_.recycled++;
+  stats_.cached_buffers++;
+  stats_.cached_bytes += key.first;
+  return ReleaseResult::kCached;
+}
+
+std::vector<void*> BufferCache::evict(uint64_t size) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  std::vector<void*> buffers;
+  auto it = cached_.lower_bound(Key{size, std::numeric_limits<int32_t>::min()});
+  while (it != cached_.end() && it->first.first == size) {
+    buffers.insert(buffers.end(), it->second.begin(), it->second.end());
+    it = cached_.erase(it);
+  }
+  stats_.evicted += buffers.size();
+  stats_.cached_buffers -= buffers.size();
+  stats_.cached_bytes -= buffers.size() * size;
+  return buffers;
+}
+
+std::vector<void*> BufferCache::close() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  closed_ = true;
+  std::vector<void*> buffers;
+  buffers.reserve(stats_.cached_buffers);
+  for (auto& entry : cached_) {
+    buffers.insert(buffers.end(), entry.second.begin(), entry.second.end());
+  }
+  cached_.clear();
+  stats_.cached_buffers = 0;
+  stats_.cached_bytes = 0;
+  return buffers;
+}
+
+BufferCacheStats BufferCache::stats() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return stats_;
+}
+
+}  // namespace holoscan
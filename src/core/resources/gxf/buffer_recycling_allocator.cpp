@@ -0,0 +1,102 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "holoscan/core/resources/gxf/buffer_recycling_allocator.hpp"
+
+#include <memory>
+
+#include "holoscan/logger/logger.hpp"
+
+namespace holoscan {
+
+gxf_result_t BufferRecyclingAllocator::registerInterface(nvidia::gxf::Registrar* registrar) {
+  nvidia::gxf::Expected<void> result;
+  result &= registrar->parameter(
+      allocator_, "allocator", "Allocator", "Allocator providing the recycled buffers");
+  result &= registrar->parameter(max_buffers_per_size_,
+                                 "max_buffers_per_size",
+                                 "Maximum buffers per size",
+                                 "Maximum number of cached buffers of a given size and type",
+                                 4UL);
+  result &= registrar->parameter(max_cached_bytes_,
+                                 "max_cached_bytes",
+                                 "Maximum cached bytes",
+                                 "Maximum number of bytes kept in the cache",
+                                 256UL * 1024 * 1024);
+  return nvidia::gxf::ToResultCode(result);
+}
+
+gxf_result_t BufferRecyclingAllocator::initialize() {
+  cache_ = std::make_unique<BufferCache>(max_buffers_per_size_.get(), max_cached_bytes_.get());
+  return GXF_SUCCESS;
+}
+
+gxf_result_t BufferRecyclingAllocator::deinitialize() {
+  if (cache_ == nullptr) { return GXF_SUCCESS; }
+  // The underlying allocator is still initialized: the holoscan::RecyclingAllocator adds this
+  // component after it to the same entity, so this component is deinitialized first.
+  // Buffers still handed out are returned to the underlying allocator when they are freed.
+  for (void* pointer : cache_->close()) {
+    allocator_.get()->free(static_cast<nvidia::byte*>(pointer));
+  }
+  auto stats = cache_->stats();
+  HOLOSCAN_LOG_DEBUG("BufferRecyclingAllocator '{}': {} hits, {} misses, {} recycled, {} evicted",
+                     name(),
+                     stats.hits,
+                     stats.misses,
+                     stats.recycled,
+                     stats.evicted);
+  return GXF_SUCCESS;
+}
+
+gxf_result_t BufferRecyclingAllocator::is_available_abi(uint64_t size) {
+  auto result = allocator_.get()->is_available_abi(size);
+  if (result == GXF_SUCCESS || cache_ == nullptr) { return result; }
+  // The query has no storage type, so it can't be answered from the cache: return the cached
+  // buffers of that size to the underlying allocator instead, then ask it again.
+  auto buffers = cache_->evict(size);
+  if (buffers.empty()) { return result; }
+  for (void* pointer : buffers) { allocator_.get()->free(static_cast<nvidia::byte*>(pointer)); }
+  return allocator_.get()->is_available_abi(size);
+}
+
+gxf_result_t BufferRecyclingAllocator::allocate_abi(uint64_t size, int32_t type, void** pointer) {
+  if (pointer == nullptr || cache_ == nullptr) { return GXF_ARGUMENT_NULL; }
+  void* cached = cache_->acquire(size, type);
+  if (cached != nullptr) {
+    *pointer = cached;
+    return GXF_SUCCESS;
+  }
+  auto result = allocator_.get()->allocate(size, static_cast<nvidia::gxf::MemoryStorageType>(type));
+  if (!result) { return result.error(); }
+  *pointer = result.value();
+  cache_->track(*pointer, size, type);
+  return GXF_SUCCESS;
+}
+
+gxf_result_t BufferRecyclingAllocator::free_abi(void* pointer) {
+  if (cache_ && cache_->release(pointer) == BufferCache::ReleaseResult::kCached) {
+    return GXF_SUCCESS;
+  }
+  return nvidia::gxf::ToResultCode(allocator_.get()->free(static_cast<nvidia::byte*>(pointer)));
+}
+
+BufferCacheStats BufferRecyclingAllocator::stats() const {
+  return cache_ ? cache_->stats() : BufferCacheStats{};
+}
+
+}  // namespace holoscan
@@ -0,0 +1,193 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "holoscan/core/resources/gxf/conflating_mailbox_receiver.hpp"
+
+#include <algorithm>
+#include <mutex>
+#include <string>
+
+#include <gxf/core/entity.hpp>
+#include <gxf/std/tensor.hpp>
+
+#include "holoscan/logger/logger.hpp"
+
+namespace holoscan {
+
+gxf_result_t ConflatingMailboxReceiver::registerInterface(nvidia::gxf::Registrar* registrar) {
+  nvidia::gxf::Expected<void> result;
+  result &= registrar->parameter(key_by_tensor_name_,
+                                 "key_by_tensor_name",
+                                 "Key by tensor name",
+                                 "Keep the latest message per tensor name",
+                                 false);
+  return nvidia::gxf::ToResultCode(result);
+}
+
+gxf_result_t ConflatingMailboxReceiver::deinitialize() {
+  release_peeked();
+
+  gxf_uid_t uid = kNullUid;
+  {
+    std::lock_guard<std::mutex> lock(latest_mutex_);
+    uid = latest_.exchange(kNullUid, std::memory_order_acq_rel);
+  }
+  if (uid != kNullUid) { GxfEntityRefCountDec(context(), uid); }
+
+  std::lock_guard<std::mutex> lock(keyed_mutex_);
+  for (const auto& [key, keyed_uid] : keyed_latest_) { GxfEntityRefCountDec(context(), keyed_uid); }
+  keyed_latest_.clear();
+  return GXF_SUCCESS;
+}
+
+gxf_result_t ConflatingMailboxReceiver::pop_abi(gxf_uid_t* uid) {
+  if (uid == nullptr) { return GXF_ARGUMENT_NULL; }
+
+  // The reference held by the mailbox is handed over to the caller.
+  if (!key_by_tensor_name_.get()) {
+    gxf_uid_t latest = kNullUid;
+    {
+      std::lock_guard<std::mutex> lock(latest_mutex_);
+      latest = latest_.exchange(kNullUid, std::memory_order_acq_rel);
+    }
+    if (latest == kNullUid) { return GXF_FAILURE; }
+    *uid = latest;
+    return GXF_SUCCESS;
+  }
+
+  std::lock_guard<std::mutex> lock(keyed_mutex_);
+  if (keyed_latest_.empty()) { return GXF_FAILURE; }
+  *uid = keyed_latest_.front().second;
+  keyed_latest_.erase(keyed_latest_.begin());
+  return GXF_SUCCESS;
+}
+
+gxf_result_t ConflatingMailboxReceiver::push_abi(gxf_uid_t other) {
+  gxf_result_t code = GxfEntityRefCountInc(context(), other);
+  if (code != GXF_SUCCESS) { return code; }
+
+  if (!key_by_tensor_name_.get()) {
+    gxf_uid_t previous = kNullUid;
+    {
+      // peek_abi() takes its reference under the lock, before the message can be dropped.
+      std::lock_guard<std::mutex> lock(latest_mutex_);
+      previous = latest_.exchange(other, std::memory_order_acq_rel);
+    }
+    if (previous != kNullUid) { drop(previous); }
+    return GXF_SUCCESS;
+  }
+
+  std::string key = message_key(other);
+  gxf_uid_t previous = kNullUid;
+  {
+    std::lock_guard<std::mutex> lock(keyed_mutex_);
+    auto it = std::find_if(keyed_latest_.begin(), keyed_latest_.end(), [&key](const auto& entry) {
+      return entry.first == key;
+    });
+    if (it != keyed_latest_.end()) {
+      previous = it->second;
+      keyed_latest_.erase(it);
+    }
+    keyed_latest_.emplace_back(std::move(key), other);
+  }
+  if (previous != kNullUid) { drop(previous); }
+  return GXF_SUCCESS;
+}
+
+gxf_result_t ConflatingMailboxReceiver::peek_abi(gxf_uid_t* uid, int32_t index) {
+  if (uid == nullptr) { return GXF_ARGUMENT_NULL; }
+  if (index < 0) { return GXF_ARGUMENT_OUT_OF_RANGE; }
+
+  if (!key_by_tensor_name_.get()) {
+    std::lock_guard<std::mutex> lock(latest_mutex_);
+    gxf_uid_t latest = latest_.load(std::memory_order_acquire);
+    if (index != 0 || latest == kNullUid) { return GXF_FAILURE; }
+    gxf_result_t code = hold_peeked(latest);
+    if (code == GXF_SUCCESS) { *uid = latest; }
+    return code;
+  }
+
+  std::lock_guard<std::mutex> lock(keyed_mutex_);
+  if (static_cast<size_t>(index) >= keyed_latest_.size()) { return GXF_FAILURE; }
+  gxf_result_t code = hold_peeked(keyed_latest_[index].second);
+  if (code == GXF_SUCCESS) { *uid = keyed_latest_[index].second; }
+  return code;
+}
+
+gxf_result_t ConflatingMailboxReceiver::peek_back_abi(gxf_uid_t* /*uid*/, int32_t /*index*/) {
+  // There is no back stage.
+  return GXF_FAILURE;
+}
+
+size_t ConflatingMailboxReceiver::capacity_abi() {
+  // A new message can always be accepted by replacing the stored one.
+  return size_abi() + 1;
+}
+
+size_t ConflatingMailboxReceiver::size_abi() {
+  if (!key_by_tensor_name_.get()) {
+    return latest_.load(std::memory_order_acquire) == kNullUid ? 0 : 1;
+  }
+  std::lock_guard<std::mutex> lock(keyed_mutex_);
+  return keyed_latest_.size();
+}
+
+gxf_result_t ConflatingMailboxReceiver::receive_abi(gxf_uid_t* uid) {
+  return pop_abi(uid);
+}
+
+size_t ConflatingMailboxReceiver::back_size_abi() {
+  return 0;
+}
+
+gxf_result_t ConflatingMailboxReceiver::sync_abi() {
+  // Called before the consumer is ticked: the messages peeked during its last tick are released.
+  release_peeked();
+  return GXF_SUCCESS;
+}
+
+std::string ConflatingMailboxReceiver::message_key(gxf_uid_t uid) {
+  auto entity = nvidia::gxf::Entity::Shared(context(), uid);
+  if (!entity) { return ""; }
+  auto tensor = entity.value().get<nvidia::gxf::Tensor>();
+  if (!tensor) { return ""; }
+  return tensor.value().name();
+}
+
+void ConflatingMailboxReceiver::drop(gxf_uid_t uid) {
+  dropped_count_.fetch_add(1, std::memory_order_relaxed);
+  GxfEntityRefCountDec(context(), uid);
+}
+
+gxf_result_t ConflatingMailboxReceiver::hold_peeked(gxf_uid_t uid) {
+  gxf_result_t code = GxfEntityRefCountInc(context(), uid);
+  if (code != GXF_SUCCESS) { return code; }
+  std::lock_guard<std::mutex> lock(peeked_mutex_);
+  peeked_.push_back(uid);
+  return GXF_SUCCESS;
+}
+
+void ConflatingMailboxReceiver::release_peeked() {
+  std::vector<gxf_uid_t> peeked;
+  {
+    std::lock_guard<std::mutex> lock(peeked_mutex_);
+    peeked.swap(peeked_);
+  }
+  for (gxf_uid_t uid : peeked) { GxfEntityRefCountDec(context(), uid); }
+}
+
+}  // namespace holoscan
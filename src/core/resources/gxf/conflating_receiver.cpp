@@ -0,0 +1,50 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "holoscan/core/resources/gxf/conflating_receiver.hpp"
+
+#include <string>
+
+#include "holoscan/core/component_spec.hpp"
+#include "holoscan/core/gxf/gxf_utils.hpp"
+#include "holoscan/core/resources/gxf/conflating_mailbox_receiver.hpp"
+
+namespace holoscan {
+
+ConflatingReceiver::ConflatingReceiver(const std::string& name,
+                                       ConflatingMailboxReceiver* component)
+    : Receiver(name, component) {
+  bool key_by_tensor_name = false;
+  HOLOSCAN_GXF_CALL_FATAL(GxfParameterGetBool(
+      gxf_context_, gxf_cid_, "key_by_tensor_name", &key_by_tensor_name));
+  key_by_tensor_name_ = key_by_tensor_name;
+}
+
+void ConflatingReceiver::setup(ComponentSpec& spec) {
+  spec.param(key_by_tensor_name_,
+             "key_by_tensor_name",
+             "Key by tensor name",
+             "Keep the latest message per tensor name",
+             false);
+}
+
+uint64_t ConflatingReceiver::dropped_count() {
+  if (gxf_cptr_ == nullptr) { return 0; }
+  return static_cast<ConflatingMailboxReceiver*>(gxf_cptr_)->dropped_count();
+}
+
+}  // namespace holoscan
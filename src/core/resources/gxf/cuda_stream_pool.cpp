@@ -79,4 +79,9 @@ void CudaStreamPool::setup(ComponentSpec& spec) {
              kDefaultMaxSize);
 }
 
+void CudaStreamPool::initialize() {
+  // CUDA streams are not memory allocations: skip the tracking set up by Allocator::initialize()
+  GXFResource::initialize();
+}
+
 }  // namespace holoscan
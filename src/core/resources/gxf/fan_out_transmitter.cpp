@@ -0,0 +1,161 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "holoscan/core/resources/gxf/fan_out_transmitter.hpp"
+
+#include <algorithm>
+#include <limits>
+
+#include "holoscan/logger/logger.hpp"
+
+namespace holoscan {
+
+namespace {
+
+constexpr uint64_t kPolicyPop = 0;
+constexpr uint64_t kPolicyReject = 1;
+
+bool has_free_space(nvidia::gxf::Receiver* receiver, size_t min_size) {
+  const size_t used = receiver->size_abi() + receiver->back_size_abi();
+  const size_t capacity = receiver->capacity_abi();
+  return used <= capacity && capacity - used >= min_size;
+}
+
+}  // namespace
+
+gxf_result_t FanOutTransmitter::registerInterface(nvidia::gxf::Registrar* registrar) {
+  nvidia::gxf::Expected<void> result;
+  result &= registrar->parameter(policy_, "policy", "Policy", "0: pop, 1: reject, 2: fault", 2UL);
+  return nvidia::gxf::ToResultCode(result);
+}
+
+gxf_result_t FanOutTransmitter::initialize() {
+  if (policy_.get() > 2) {
+    HOLOSCAN_LOG_ERROR("FanOutTransmitter '{}': invalid policy {}", name(), policy_.get());
+    return GXF_ARGUMENT_OUT_OF_RANGE;
+  }
+  return GXF_SUCCESS;
+}
+
+gxf_result_t FanOutTransmitter::pop_abi(gxf_uid_t* uid) {
+  // Messages are handed over to the receivers when they are published.
+  (void)uid;
+  return GXF_FAILURE;
+}
+
+gxf_result_t FanOutTransmitter::push_abi(gxf_uid_t other) {
+  if (receivers_.empty()) {
+    HOLOSCAN_LOG_DEBUG("FanOutTransmitter '{}': no receiver, dropping message", name());
+    return GXF_SUCCESS;
+  }
+
+  if (policy_.get() != kPolicyPop && !is_receptive(1)) {
+    if (policy_.get() == kPolicyReject) {
+      HOLOSCAN_LOG_DEBUG("FanOutTransmitter '{}': a receiver is full, rejecting message", name());
+      return GXF_SUCCESS;
+    }
+    HOLOSCAN_LOG_WARN("FanOutTransmitter '{}': a receiver is full", name());
+    return GXF_EXCEEDING_PREALLOCATED_SIZE;
+  }
+
+  // Each receiver acquires its own reference to the entity; the payload is not copied.
+  gxf_result_t result = GXF_SUCCESS;
+  for (auto* receiver : receivers_) {
+    const gxf_result_t code = receiver->push_abi(other);
+    if (code != GXF_SUCCESS) {
+      result = code;
+      continue;
+    }
+    // Let event-based schedulers know that the receiving entity may be ready.
+    GxfEntityEventNotify(context(), receiver->eid());
+  }
+  return result;
+}
+
+gxf_result_t FanOutTransmitter::peek_abi(gxf_uid_t* uid, int32_t index) {
+  (void)uid;
+  (void)index;
+  return GXF_FAILURE;
+}
+
+size_t FanOutTransmitter::capacity_abi() {
+  if (receivers_.empty()) { return 0; }
+  size_t capacity = std::numeric_limits<size_t>::max();
+  for (auto* receiver : receivers_) { capacity = std::min(capacity, receiver->capacity_abi()); }
+  return capacity;
+}
+
+size_t FanOutTransmitter::size_abi() {
+  return 0;
+}
+
+gxf_result_t FanOutTransmitter::publish_abi(gxf_uid_t uid) {
+  return push_abi(uid);
+}
+
+size_t FanOutTransmitter::back_size_abi() {
+  return 0;
+}
+
+gxf_result_t FanOutTransmitter::sync_abi() {
+  return GXF_SUCCESS;
+}
+
+void FanOutTransmitter::add_receiver(nvidia::gxf::Receiver* receiver) {
+  if (receiver == nullptr) { return; }
+  if (std::find(receivers_.begin(), receivers_.end(), receiver) == receivers_.end()) {
+    receivers_.push_back(receiver);
+  }
+}
+
+bool FanOutTransmitter::is_receptive(size_t min_size) const {
+  for (auto* receiver : receivers_) {
+    if (!has_free_space(receiver, min_size)) { return false; }
+  }
+  return true;
+}
+
+gxf_result_t FanOutReceptiveSchedulingTerm::registerInterface(nvidia::gxf::Registrar* registrar) {
+  nvidia::gxf::Expected<void> result;
+  result &= registrar->parameter(transmitter_,
+                                 "transmitter",
+                                 "Transmitter",
+                                 "The fan-out transmitter whose receivers are checked");
+  result &= registrar->parameter(min_size_,
+                                 "min_size",
+                                 "Minimum size",
+                                 "The minimum number of free slots required in every receiver",
+                                 1UL);
+  return nvidia::gxf::ToResultCode(result);
+}
+
+gxf_result_t FanOutReceptiveSchedulingTerm::check_abi(int64_t timestamp,
+                                                      nvidia::gxf::SchedulingConditionType* type,
+                                                      int64_t* target_timestamp) const {
+  *type = transmitter_.get()->is_receptive(min_size_.get())
+              ? nvidia::gxf::SchedulingConditionType::READY
+              : nvidia::gxf::SchedulingConditionType::WAIT;
+  *target_timestamp = timestamp;
+  return GXF_SUCCESS;
+}
+
+gxf_result_t FanOutReceptiveSchedulingTerm::onExecute_abi(int64_t dt) {
+  (void)dt;
+  return GXF_SUCCESS;
+}
+
+}  // namespace holoscan
@@ -0,0 +1,169 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "holoscan/core/resources/gxf/huge_page_allocator.hpp"
+
+#include <cuda_runtime.h>
+
+#include <memory>
+
+#include "holoscan/logger/logger.hpp"
+
+namespace holoscan {
+
+namespace {
+
+// Values of the 'storage_type' parameter (nvidia::gxf::MemoryStorageType)
+constexpr int32_t kHost = 0;
+constexpr int32_t kSystem = 2;
+
+const char* backing_name(HugePagePool::Backing backing) {
+  switch (backing) {
+    case HugePagePool::Backing::kHugeTLB:
+      return "explicit huge pages";
+    case HugePagePool::Backing::kTransparentHugePages:
+      return "transparent huge pages";
+    case HugePagePool::Backing::kRegularPages:
+      return "regular pages";
+    default:
+      return "none";
+  }
+}
+
+}  // namespace
+
+gxf_result_t HugePageAllocator::registerInterface(nvidia::gxf::Registrar* registrar) {
+  nvidia::gxf::Expected<void> result;
+  result &= registrar->parameter(storage_type_,
+                                 "storage_type",
+                                 "Storage type",
+                                 "The memory storage type used by this allocator. Can be kHost "
+                                 "(0) or kSystem (2)",
+                                 kHost);
+  result &= registrar->parameter(
+      block_size_, "block_size", "Block size", "Size of the blocks in bytes");
+  result &= registrar->parameter(
+      num_blocks_, "num_blocks", "Number of blocks", "Number of blocks reserved up front");
+  result &= registrar->parameter(huge_pages_,
+                                 "huge_pages",
+                                 "Huge pages",
+                                 "Back the pool with huge pages (explicit, then transparent) if "
+                                 "available",
+                                 true);
+  result &= registrar->parameter(lock_memory_,
+                                 "lock_memory",
+                                 "Lock memory",
+                                 "Lock the pool in memory (mlock) so that it is never swapped out",
+                                 false);
+  return nvidia::gxf::ToResultCode(result);
+}
+
+gxf_result_t HugePageAllocator::initialize() {
+  const int32_t storage_type = storage_type_.get();
+  if (storage_type != kHost && storage_type != kSystem) {
+    HOLOSCAN_LOG_ERROR("HugePageAllocator '{}': invalid storage type {} (host memory only)",
+                       name(),
+                       storage_type);
+    return GXF_ARGUMENT_INVALID;
+  }
+
+  pool_ = std::make_unique<HugePagePool>(
+      block_size_.get(), num_blocks_.get(), huge_pages_.get(), lock_memory_.get());
+  if (pool_->data() == nullptr) {
+    HOLOSCAN_LOG_ERROR("HugePageAllocator '{}': failed to reserve {} blocks of {} bytes",
+                       name(),
+                       num_blocks_.get(),
+                       block_size_.get());
+    pool_.reset();
+    return GXF_OUT_OF_MEMORY;
+  }
+  if (huge_pages_.get() && pool_->backing() == HugePagePool::Backing::kRegularPages) {
+    HOLOSCAN_LOG_WARN("HugePageAllocator '{}': huge pages are not available, using regular pages",
+                      name());
+  }
+  if (lock_memory_.get() && !pool_->is_locked()) {
+    HOLOSCAN_LOG_WARN(
+        "HugePageAllocator '{}': failed to lock {} bytes in memory (see RLIMIT_MEMLOCK)",
+        name(),
+        pool_->size());
+  }
+
+  if (storage_type == kHost) {
+    cudaError_t error = cudaHostRegister(pool_->data(), pool_->size(), cudaHostRegisterDefault);
+    if (error != cudaSuccess) {
+      HOLOSCAN_LOG_ERROR("HugePageAllocator '{}': failed to register the pool with CUDA: {}",
+                         name(),
+                         cudaGetErrorString(error));
+      pool_.reset();
+      return GXF_FAILURE;
+    }
+    is_registered_ = true;
+  }
+
+  HOLOSCAN_LOG_DEBUG("HugePageAllocator '{}': {} bytes reserved with {}{}",
+                     name(),
+                     pool_->size(),
+                     backing_name(pool_->backing()),
+                     pool_->is_locked() ? " (locked)" : "");
+  return GXF_SUCCESS;
+}
+
+gxf_result_t HugePageAllocator::deinitialize() {
+  if (pool_ == nullptr) { return GXF_SUCCESS; }
+  if (is_registered_) {
+    cudaHostUnregister(pool_->data());
+    is_registered_ = false;
+  }
+  auto stats = pool_->stats();
+  HOLOSCAN_LOG_DEBUG("HugePageAllocator '{}': {} allocations, {} failed, {} blocks in use",
+                     name(),
+                     stats.allocations,
+                     stats.failed_allocations,
+                     stats.in_use_blocks);
+  pool_.reset();
+  return GXF_SUCCESS;
+}
+
+gxf_result_t HugePageAllocator::is_available_abi(uint64_t size) {
+  if (pool_ == nullptr) { return GXF_FAILURE; }
+  return pool_->is_available(size) ? GXF_SUCCESS : GXF_FAILURE;
+}
+
+gxf_result_t HugePageAllocator::allocate_abi(uint64_t size, int32_t type, void** pointer) {
+  if (pointer == nullptr || pool_ == nullptr) { return GXF_ARGUMENT_NULL; }
+  if (type != storage_type_.get()) {
+    HOLOSCAN_LOG_ERROR(
+        "HugePageAllocator '{}': requested storage type {} but the pool holds type {}",
+        name(),
+        type,
+        storage_type_.get());
+    return GXF_ARGUMENT_INVALID;
+  }
+  *pointer = pool_->allocate(size);
+  return *pointer != nullptr ? GXF_SUCCESS : GXF_FAILURE;
+}
+
+gxf_result_t HugePageAllocator::free_abi(void* pointer) {
+  if (pool_ == nullptr) { return GXF_FAILURE; }
+  return pool_->free(pointer) ? GXF_SUCCESS : GXF_ARGUMENT_INVALID;
+}
+
+HugePagePoolStats HugePageAllocator::stats() const {
+  return pool_ ? pool_->stats() : HugePagePoolStats{};
+}
+
+}  // namespace holoscan
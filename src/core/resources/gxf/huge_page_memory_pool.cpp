@@ -0,0 +1,75 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "holoscan/core/resources/gxf/huge_page_memory_pool.hpp"
+
+#include <string>
+
+#include "holoscan/core/component_spec.hpp"
+#include "holoscan/core/gxf/gxf_utils.hpp"
+#include "holoscan/core/resources/gxf/huge_page_allocator.hpp"
+
+namespace holoscan {
+
+HugePageMemoryPool::HugePageMemoryPool(const std::string& name, HugePageAllocator* component)
+    : Allocator(name, component) {
+  int32_t storage_type = 0;
+  HOLOSCAN_GXF_CALL_FATAL(
+      GxfParameterGetInt32(gxf_context_, gxf_cid_, "storage_type", &storage_type));
+  storage_type_ = storage_type;
+  uint64_t block_size = 0;
+  HOLOSCAN_GXF_CALL_FATAL(
+      GxfParameterGetUInt64(gxf_context_, gxf_cid_, "block_size", &block_size));
+  block_size_ = block_size;
+  uint64_t num_blocks = 0;
+  HOLOSCAN_GXF_CALL_FATAL(
+      GxfParameterGetUInt64(gxf_context_, gxf_cid_, "num_blocks", &num_blocks));
+  num_blocks_ = num_blocks;
+  bool huge_pages = true;
+  HOLOSCAN_GXF_CALL_FATAL(GxfParameterGetBool(gxf_context_, gxf_cid_, "huge_pages", &huge_pages));
+  huge_pages_ = huge_pages;
+  bool lock_memory = false;
+  HOLOSCAN_GXF_CALL_FATAL(
+      GxfParameterGetBool(gxf_context_, gxf_cid_, "lock_memory", &lock_memory));
+  lock_memory_ = lock_memory;
+}
+
+void HugePageMemoryPool::setup(ComponentSpec& spec) {
+  spec.param(storage_type_,
+             "storage_type",
+             "Storage type",
+             "The memory storage type used by this allocator. Can be kHost (0) or kSystem (2)",
+             0);
+  spec.param(block_size_, "block_size", "Block size", "Size of the blocks in bytes");
+  spec.param(num_blocks_, "num_blocks", "Number of blocks", "Number of blocks reserved up front");
+  spec.param(huge_pages_,
+             "huge_pages",
+             "Huge pages",
+             "Back the pool with huge pages (explicit, then transparent) if available",
+             true);
+  spec.param(lock_memory_,
+             "lock_memory",
+             "Lock memory",
+             "Lock the pool in memory (mlock) so that it is never swapped out",
+             false);
+}
+
+HugePagePoolStats HugePageMemoryPool::stats() const {
+  return gxf_component_stats<HugePageAllocator>();
+}
+
+}  // namespace holoscan
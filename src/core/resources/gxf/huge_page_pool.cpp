@@ -0,0 +1,149 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "holoscan/core/resources/gxf/huge_page_pool.hpp"
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <fstream>
+#include <string>
+
+namespace holoscan {
+
+namespace {
+
+uint64_t round_up(uint64_t value, uint64_t alignment) {
+  return (value + alignment - 1) / alignment * alignment;
+}
+
+}  // namespace
+
+HugePagePool::HugePagePool(uint64_t block_size, uint64_t num_blocks, bool use_huge_pages,
+                           bool lock_memory)
+    : block_size_(round_up(block_size > 0 ? block_size : 1, kBlockAlignment)) {
+  const uint64_t base_page_size = static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+  const uint64_t requested_size = block_size_ * num_blocks;
+  if (requested_size == 0) { return; }
+
+  if (use_huge_pages) {
+    const uint64_t huge_page_size = default_huge_page_size();
+    const uint64_t size = round_up(requested_size, huge_page_size);
+    void* region = mmap(nullptr,
+                        size,
+                        PROT_READ | PROT_WRITE,
+                        MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB,
+                        -1,
+                        0);
+    if (region != MAP_FAILED) {
+      region_ = region;
+      region_size_ = size;
+      page_size_ = huge_page_size;
+      backing_ = Backing::kHugeTLB;
+    }
+  }
+  if (region_ == nullptr) {
+    const uint64_t size = round_up(requested_size, base_page_size);
+    void* region =
+        mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (region == MAP_FAILED) { return; }
+    region_ = region;
+    region_size_ = size;
+    page_size_ = base_page_size;
+    backing_ = Backing::kRegularPages;
+    // Must be advised before the pages are touched
+    if (use_huge_pages && madvise(region_, region_size_, MADV_HUGEPAGE) == 0) {
+      backing_ = Backing::kTransparentHugePages;
+    }
+  }
+
+  // Pre-fault the region (one write per base page also covers the huge pages)
+  auto bytes = static_cast<volatile uint8_t*>(region_);
+  for (uint64_t offset = 0; offset < region_size_; offset += base_page_size) { bytes[offset] = 0; }
+
+  if (lock_memory) { is_locked_ = mlock(region_, region_size_) == 0; }
+
+  // The region may be larger than requested (rounded up to the page size)
+  free_blocks_.reserve(num_blocks);
+  // Hand out the blocks in address order
+  for (uint64_t index = num_blocks; index > 0; --index) { free_blocks_.push_back(index - 1); }
+  in_use_.assign(num_blocks, false);
+}
+
+HugePagePool::~HugePagePool() {
+  if (region_ != nullptr) { munmap(region_, region_size_); }
+}
+
+uint64_t HugePagePool::default_huge_page_size() {
+  constexpr uint64_t kDefaultHugePageSize = 2UL * 1024 * 1024;
+  std::ifstream meminfo("/proc/meminfo");
+  std::string key;
+  while (meminfo >> key) {
+    if (key == "Hugepagesize:") {
+      uint64_t size_kb = 0;
+      if (meminfo >> size_kb && size_kb > 0) { return size_kb * 1024; }
+      break;
+    }
+    meminfo.ignore(256, '\n');
+  }
+  return kDefaultHugePageSize;
+}
+
+void* HugePagePool::allocate(uint64_t size) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (size > block_size_ || free_blocks_.empty()) {
+    failed_allocations_++;
+    return nullptr;
+  }
+  const uint64_t index = free_blocks_.back();
+  free_blocks_.pop_back();
+  in_use_[index] = true;
+  allocations_++;
+  return static_cast<uint8_t*>(region_) + index * block_size_;
+}
+
+bool HugePagePool::free(void* pointer) {
+  if (region_ == nullptr || pointer < region_) { return false; }
+  const uint64_t offset =
+      static_cast<uint64_t>(static_cast<uint8_t*>(pointer) - static_cast<uint8_t*>(region_));
+  if (offset % block_size_ != 0) { return false; }
+  const uint64_t index = offset / block_size_;
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (index >= in_use_.size() || !in_use_[index]) { return false; }
+  in_use_[index] = false;
+  free_blocks_.push_back(index);
+  return true;
+}
+
+bool HugePagePool::is_available(uint64_t size) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return size <= block_size_ && !free_blocks_.empty();
+}
+
+HugePagePoolStats HugePagePool::stats() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  HugePagePoolStats stats;
+  stats.allocations = allocations_;
+  stats.failed_allocations = failed_allocations_;
+  stats.in_use_blocks = in_use_.size() - free_blocks_.size();
+  stats.reserved_bytes = region_size_;
+  stats.page_size = page_size_;
+  return stats;
+}
+
+}  // namespace holoscan
@@ -0,0 +1,86 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "holoscan/core/resources/gxf/memory_waiter.hpp"
+
+#include <algorithm>
+#include <chrono>
+
+namespace holoscan {
+
+void* MemoryWaiter::allocate(const TryAllocateFunction& try_allocate) {
+  void* pointer = nullptr;
+  bool can_wait = try_allocate(&pointer);
+  if (pointer != nullptr || !can_wait || timeout_.count() <= 0) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (pointer != nullptr) {
+      stats_.allocations++;
+    } else if (!can_wait) {
+      stats_.errors++;
+    } else {
+      stats_.timeouts++;
+    }
+    return pointer;
+  }
+
+  const auto start = std::chrono::steady_clock::now();
+  const auto deadline = start + timeout_;
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    // Sample the frees before the attempt so that a free racing with it isn't missed
+    const uint64_t free_count = free_count_;
+    lock.unlock();
+    can_wait = try_allocate(&pointer);
+    lock.lock();
+    const auto now = std::chrono::steady_clock::now();
+    if (pointer != nullptr || !can_wait || now >= deadline) { break; }
+    if (free_count_ == free_count) {
+      freed_.wait_until(lock, std::min(deadline, now + kPollInterval), [this, free_count]() {
+        return free_count_ != free_count;
+      });
+    }
+  }
+
+  const double wait_ms =
+      std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+  stats_.waits++;
+  stats_.total_wait_ms += wait_ms;
+  stats_.max_wait_ms = std::max(stats_.max_wait_ms, wait_ms);
+  if (pointer != nullptr) {
+    stats_.allocations++;
+  } else if (!can_wait) {
+    stats_.errors++;
+  } else {
+    stats_.timeouts++;
+  }
+  return pointer;
+}
+
+void MemoryWaiter::notify_free() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    free_count_++;
+  }
+  freed_.notify_all();
+}
+
+MemoryWaiterStats MemoryWaiter::stats() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return stats_;
+}
+
+}  // namespace holoscan
@@ -0,0 +1,57 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "holoscan/core/resources/gxf/numa_allocator.hpp"
+
+#include <string>
+
+#include "holoscan/core/component_spec.hpp"
+#include "holoscan/core/gxf/gxf_utils.hpp"
+#include "holoscan/core/resources/gxf/numa_binding_allocator.hpp"
+
+namespace holoscan {
+
+NumaAllocator::NumaAllocator(const std::string& name, NumaBindingAllocator* component)
+    : Allocator(name, component) {
+  int32_t storage_type = 0;
+  HOLOSCAN_GXF_CALL_FATAL(
+      GxfParameterGetInt32(gxf_context_, gxf_cid_, "storage_type", &storage_type));
+  storage_type_ = storage_type;
+  int32_t numa_node = 0;
+  HOLOSCAN_GXF_CALL_FATAL(GxfParameterGetInt32(gxf_context_, gxf_cid_, "numa_node", &numa_node));
+  numa_node_ = numa_node;
+}
+
+void NumaAllocator::setup(ComponentSpec& spec) {
+  spec.param(storage_type_,
+             "storage_type",
+             "Storage type",
+             "The memory storage type used by this allocator. Can be kHost (0) or kSystem (2)",
+             2);
+  spec.param(numa_node_,
+             "numa_node",
+             "NUMA node",
+             "OS index of the NUMA node of the allocations (-1 for the node of the calling "
+             "thread)",
+             NumaHostMemory::kCallingThreadNode);
+}
+
+NumaHostMemoryStats NumaAllocator::stats() const {
+  return gxf_component_stats<NumaBindingAllocator>();
+}
+
+}  // namespace holoscan
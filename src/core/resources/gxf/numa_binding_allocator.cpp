@@ -0,0 +1,126 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "holoscan/core/resources/gxf/numa_binding_allocator.hpp"
+
+#include <cuda_runtime.h>
+
+#include <algorithm>
+#include <memory>
+
+#include "holoscan/logger/logger.hpp"
+
+namespace holoscan {
+
+namespace {
+
+// Values of the 'storage_type' parameter (nvidia::gxf::MemoryStorageType)
+constexpr int32_t kHost = 0;
+constexpr int32_t kSystem = 2;
+
+}  // namespace
+
+gxf_result_t NumaBindingAllocator::registerInterface(nvidia::gxf::Registrar* registrar) {
+  nvidia::gxf::Expected<void> result;
+  result &= registrar->parameter(storage_type_,
+                                 "storage_type",
+                                 "Storage type",
+                                 "The memory storage type used by this allocator. Can be kHost "
+                                 "(0) or kSystem (2)",
+                                 kSystem);
+  result &= registrar->parameter(numa_node_,
+                                 "numa_node",
+                                 "NUMA node",
+                                 "OS index of the NUMA node of the allocations (-1 for the node "
+                                 "of the calling thread)",
+                                 NumaHostMemory::kCallingThreadNode);
+  return nvidia::gxf::ToResultCode(result);
+}
+
+gxf_result_t NumaBindingAllocator::initialize() {
+  const int32_t storage_type = storage_type_.get();
+  if (storage_type != kHost && storage_type != kSystem) {
+    HOLOSCAN_LOG_ERROR("NumaBindingAllocator '{}': invalid storage type {} (host memory only)",
+                       name(),
+                       storage_type);
+    return GXF_ARGUMENT_INVALID;
+  }
+  memory_ = std::make_unique<NumaHostMemory>(numa_node_.get());
+  const auto& numa_nodes = memory_->numa_nodes();
+  if (numa_node_.get() != NumaHostMemory::kCallingThreadNode &&
+      std::find(numa_nodes.begin(), numa_nodes.end(), numa_node_.get()) == numa_nodes.end()) {
+    HOLOSCAN_LOG_ERROR("NumaBindingAllocator '{}': NUMA node {} doesn't exist (nodes: {})",
+                       name(),
+                       numa_node_.get(),
+                       fmt::join(numa_nodes, ", "));
+    memory_.reset();
+    return GXF_ARGUMENT_INVALID;
+  }
+  return GXF_SUCCESS;
+}
+
+gxf_result_t NumaBindingAllocator::deinitialize() {
+  if (memory_ == nullptr) { return GXF_SUCCESS; }
+  auto stats = memory_->stats();
+  HOLOSCAN_LOG_DEBUG(
+      "NumaBindingAllocator '{}': {} allocations ({} local, {} remote), {} failed, {} remote "
+      "frees",
+      name(),
+      stats.allocations,
+      stats.local_allocations,
+      stats.remote_allocations,
+      stats.failed_allocations,
+      stats.remote_frees);
+  memory_.reset();
+  return GXF_SUCCESS;
+}
+
+gxf_result_t NumaBindingAllocator::is_available_abi(uint64_t) {
+  return memory_ != nullptr ? GXF_SUCCESS : GXF_FAILURE;
+}
+
+gxf_result_t NumaBindingAllocator::allocate_abi(uint64_t size, int32_t type, void** pointer) {
+  if (pointer == nullptr || memory_ == nullptr) { return GXF_ARGUMENT_NULL; }
+  if (type != storage_type_.get()) {
+    HOLOSCAN_LOG_ERROR(
+        "NumaBindingAllocator '{}': requested storage type {} but the allocator holds type {}",
+        name(),
+        type,
+        storage_type_.get());
+    return GXF_ARGUMENT_INVALID;
+  }
+  *pointer = memory_->allocate(size);
+  if (*pointer == nullptr) { return GXF_OUT_OF_MEMORY; }
+  if (type == kHost && cudaHostRegister(*pointer, size, cudaHostRegisterDefault) != cudaSuccess) {
+    memory_->free(*pointer);
+    *pointer = nullptr;
+    return GXF_FAILURE;
+  }
+  return GXF_SUCCESS;
+}
+
+gxf_result_t NumaBindingAllocator::free_abi(void* pointer) {
+  if (memory_ == nullptr) { return GXF_FAILURE; }
+  if (storage_type_.get() == kHost) { cudaHostUnregister(pointer); }
+  return memory_->free(pointer) ? GXF_SUCCESS : GXF_ARGUMENT_INVALID;
+}
+
+NumaHostMemoryStats NumaBindingAllocator::stats() const {
+  return memory_ ? memory_->stats() : NumaHostMemoryStats{};
+}
+
+}  // namespace holoscan
@@ -0,0 +1,89 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "holoscan/core/resources/gxf/numa_host_memory.hpp"
+
+#include <sched.h>
+
+#include <vector>
+
+namespace holoscan {
+
+NumaHostMemory::NumaHostMemory(int numa_node) : numa_node_(numa_node) {
+  topology_.load();
+  numa_nodes_ = topology_.numa_nodes();
+  numa_node_by_cpu_ = topology_.numa_node_by_cpu();
+}
+
+int NumaHostMemory::current_numa_node() const {
+  // sched_getcpu() is cheap (vDSO) compared to querying the topology
+  const int cpu = sched_getcpu();
+  if (cpu < 0 || static_cast<size_t>(cpu) >= numa_node_by_cpu_.size()) { return -1; }
+  return numa_node_by_cpu_[cpu];
+}
+
+void* NumaHostMemory::allocate(uint64_t size) {
+  const int current_node = current_numa_node();
+  const int numa_node = numa_node_ == kCallingThreadNode ? current_node : numa_node_;
+  void* pointer = nullptr;
+  if (size > 0) {
+    // Don't fail when the node of the calling thread is unknown: fall back to unbound memory.
+    pointer = numa_node == kUnboundNode ? topology_.allocate_memory(size)
+                                        : topology_.allocate_on_numa_node(size, numa_node);
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (pointer == nullptr) {
+    stats_.failed_allocations++;
+    return nullptr;
+  }
+  allocations_[pointer] = Allocation{size, numa_node};
+  stats_.allocations++;
+  if (numa_node != kUnboundNode && numa_node == current_node) {
+    stats_.local_allocations++;
+  } else {
+    stats_.remote_allocations++;
+  }
+  stats_.in_use_bytes += size;
+  stats_.in_use_bytes_per_node[numa_node] += size;
+  return pointer;
+}
+
+bool NumaHostMemory::free(void* pointer) {
+  Allocation allocation;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = allocations_.find(pointer);
+    if (it == allocations_.end()) { return false; }
+    allocation = it->second;
+    allocations_.erase(it);
+    if (allocation.numa_node != current_numa_node()) { stats_.remote_frees++; }
+    stats_.in_use_bytes -= allocation.size;
+    auto node_it = stats_.in_use_bytes_per_node.find(allocation.numa_node);
+    node_it->second -= allocation.size;
+    if (node_it->second == 0) { stats_.in_use_bytes_per_node.erase(node_it); }
+  }
+  topology_.free_memory(pointer, allocation.size);
+  return true;
+}
+
+NumaHostMemoryStats NumaHostMemory::stats() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return stats_;
+}
+
+}  // namespace holoscan
@@ -0,0 +1,96 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "holoscan/core/resources/gxf/recycling_allocator.hpp"
+
+#include <algorithm>
+#include <any>
+#include <memory>
+#include <string>
+
+#include "holoscan/core/component_spec.hpp"
+#include "holoscan/core/fragment.hpp"
+#include "holoscan/core/gxf/gxf_utils.hpp"
+#include "holoscan/core/resources/gxf/buffer_recycling_allocator.hpp"
+#include "holoscan/core/resources/gxf/unbounded_allocator.hpp"
+
+namespace holoscan {
+
+RecyclingAllocator::RecyclingAllocator(const std::string& name,
+                                       BufferRecyclingAllocator* component)
+    : Allocator(name, component) {
+  uint64_t max_buffers_per_size = 0;
+  HOLOSCAN_GXF_CALL_FATAL(GxfParameterGetUInt64(
+      gxf_context_, gxf_cid_, "max_buffers_per_size", &max_buffers_per_size));
+  max_buffers_per_size_ = max_buffers_per_size;
+  uint64_t max_cached_bytes = 0;
+  HOLOSCAN_GXF_CALL_FATAL(
+      GxfParameterGetUInt64(gxf_context_, gxf_cid_, "max_cached_bytes", &max_cached_bytes));
+  max_cached_bytes_ = max_cached_bytes;
+}
+
+void RecyclingAllocator::setup(ComponentSpec& spec) {
+  spec.param(allocator_,
+             "allocator",
+             "Allocator",
+             "Allocator providing the recycled buffers (an UnboundedAllocator is created if not "
+             "provided)");
+  spec.param(max_buffers_per_size_,
+             "max_buffers_per_size",
+             "Maximum buffers per size",
+             "Maximum number of cached buffers of a given size and storage type",
+             4UL);
+  spec.param(max_cached_bytes_,
+             "max_cached_bytes",
+             "Maximum cached bytes",
+             "Maximum number of bytes kept in the cache",
+             256UL * 1024 * 1024);
+}
+
+void RecyclingAllocator::initialize() {
+  // Set up prerequisite parameters before calling Allocator::initialize()
+  auto frag = fragment();
+
+  // Find if there is an argument for 'allocator'
+  auto has_allocator = std::find_if(
+      args().begin(), args().end(), [](const auto& arg) { return (arg.name() == "allocator"); });
+  // Create an UnboundedAllocator if no allocator was provided
+  std::shared_ptr<Resource> allocator;
+  if (has_allocator == args().end()) {
+    allocator = frag->make_resource<UnboundedAllocator>(name() + "_allocator");
+    add_arg(Arg("allocator") = allocator);
+  } else if (has_allocator->arg_type().element_type() == ArgElementType::kResource) {
+    allocator = std::any_cast<std::shared_ptr<Resource>>(has_allocator->value());
+  }
+
+  // The cached buffers are returned to the wrapped allocator when this allocator is
+  // deinitialized. Add this allocator to the same entity, after the wrapped allocator, so that it
+  // is deinitialized first.
+  auto gxf_allocator = std::dynamic_pointer_cast<gxf::GXFResource>(allocator);
+  if (gxf_allocator) {
+    if (gxf_allocator->gxf_eid() == 0) { gxf_allocator->gxf_eid(gxf_eid_); }
+    gxf_allocator->initialize();
+    if (gxf_allocator->gxf_eid() != 0) { gxf_eid(gxf_allocator->gxf_eid()); }
+  }
+  Allocator::initialize();
+}
+
+BufferCacheStats RecyclingAllocator::stats() const {
+  return gxf_component_stats<BufferRecyclingAllocator>();
+}
+
+}  // namespace holoscan
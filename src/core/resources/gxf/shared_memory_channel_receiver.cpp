@@ -0,0 +1,132 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "holoscan/core/resources/gxf/shared_memory_channel_receiver.hpp"
+
+#include <string>
+
+#include <gxf/core/entity.hpp>
+
+#include "holoscan/logger/logger.hpp"
+
+namespace holoscan {
+
+gxf_result_t SharedMemoryChannelReceiver::registerInterface(nvidia::gxf::Registrar* registrar) {
+  nvidia::gxf::Expected<void> result;
+  result &= registrar->parameter(segment_name_,
+                                 "segment_name",
+                                 "Segment name",
+                                 "Name of the shared memory segment created by this receiver");
+  result &= registrar->parameter(
+      capacity_, "capacity", "Capacity", "Number of slots", kDefaultSharedMemorySlotCount);
+  result &= registrar->parameter(slot_size_,
+                                 "slot_size",
+                                 "Slot size",
+                                 "Maximum size (in bytes) of a serialized message",
+                                 kDefaultSharedMemorySlotSize);
+  result &= registrar->parameter(
+      serializer_, "serializer", "Entity serializer", "Serializer used to read the messages");
+  return nvidia::gxf::ToResultCode(result);
+}
+
+gxf_result_t SharedMemoryChannelReceiver::initialize() {
+  segment_ = SharedMemorySegment::create(segment_name_.get(), capacity_.get(), slot_size_.get());
+  if (!segment_) { return GXF_FAILURE; }
+  HOLOSCAN_LOG_DEBUG("SharedMemoryChannelReceiver '{}': created '{}' ({} slots of {} bytes)",
+                     name(),
+                     segment_->name(),
+                     segment_->slot_count(),
+                     segment_->slot_size());
+  return GXF_SUCCESS;
+}
+
+gxf_result_t SharedMemoryChannelReceiver::deinitialize() {
+  segment_.reset();
+  return GXF_SUCCESS;
+}
+
+gxf_result_t SharedMemoryChannelReceiver::pop_abi(gxf_uid_t* uid) {
+  if (uid == nullptr) { return GXF_ARGUMENT_NULL; }
+  if (!segment_) { return GXF_FAILURE; }
+
+  size_t inline_size = 0;
+  size_t payload_size = 0;
+  const uint8_t* slot = segment_->begin_read(&inline_size, &payload_size);
+  if (slot == nullptr) { return GXF_FAILURE; }
+
+  auto entity = nvidia::gxf::Entity::New(context());
+  if (!entity) {
+    segment_->end_read();
+    return entity.error();
+  }
+  // The payloads are copied out of the slot while deserializing, so the slot can be released
+  // right after.
+  endpoint_.begin_read(slot, segment_->slot_size(), inline_size, payload_size);
+  auto result = serializer_.get()->deserializeEntity(entity.value(), &endpoint_);
+  segment_->end_read();
+  if (!result) {
+    HOLOSCAN_LOG_ERROR("SharedMemoryChannelReceiver '{}': unable to deserialize a message",
+                       name());
+    return result.error();
+  }
+
+  // Hand a reference over to the caller (the one held by 'entity' is released on return).
+  gxf_result_t code = GxfEntityRefCountInc(context(), entity->eid());
+  if (code != GXF_SUCCESS) { return code; }
+  *uid = entity->eid();
+  return GXF_SUCCESS;
+}
+
+gxf_result_t SharedMemoryChannelReceiver::push_abi(gxf_uid_t /*other*/) {
+  HOLOSCAN_LOG_ERROR(
+      "SharedMemoryChannelReceiver '{}' only receives messages from a "
+      "SharedMemoryChannelTransmitter",
+      name());
+  return GXF_FAILURE;
+}
+
+gxf_result_t SharedMemoryChannelReceiver::peek_abi(gxf_uid_t* /*uid*/, int32_t /*index*/) {
+  // Messages only exist as entities once they are popped.
+  return GXF_FAILURE;
+}
+
+gxf_result_t SharedMemoryChannelReceiver::peek_back_abi(gxf_uid_t* /*uid*/, int32_t /*index*/) {
+  // There is no back stage.
+  return GXF_FAILURE;
+}
+
+size_t SharedMemoryChannelReceiver::capacity_abi() {
+  return segment_ ? segment_->slot_count() : capacity_.get();
+}
+
+size_t SharedMemoryChannelReceiver::size_abi() {
+  return segment_ ? segment_->size() : 0;
+}
+
+gxf_result_t SharedMemoryChannelReceiver::receive_abi(gxf_uid_t* uid) {
+  return pop_abi(uid);
+}
+
+size_t SharedMemoryChannelReceiver::back_size_abi() {
+  return 0;
+}
+
+gxf_result_t SharedMemoryChannelReceiver::sync_abi() {
+  return GXF_SUCCESS;
+}
+
+}  // namespace holoscan
@@ -0,0 +1,294 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "holoscan/core/resources/gxf/shared_memory_channel_transmitter.hpp"
+
+#include <chrono>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include <gxf/core/entity.hpp>
+
+#include "holoscan/logger/logger.hpp"
+
+namespace holoscan {
+
+namespace {
+
+constexpr auto kConnectPollInterval = std::chrono::milliseconds(1);
+constexpr auto kSlotPollInterval = std::chrono::microseconds(20);
+constexpr auto kLivenessCheckInterval = std::chrono::milliseconds(10);
+
+}  // namespace
+
+gxf_result_t SharedMemoryChannelTransmitter::registerInterface(
+    nvidia::gxf::Registrar* registrar) {
+  nvidia::gxf::Expected<void> result;
+  result &= registrar->parameter(segment_name_,
+                                 "segment_name",
+                                 "Segment name",
+                                 "Name of the shared memory segment created by the receiver");
+  result &= registrar->parameter(capacity_, "capacity", "Capacity", "", 1UL);
+  result &= registrar->parameter(policy_, "policy", "Policy", "0: pop, 1: reject, 2: fault", 2UL);
+  result &= registrar->parameter(connection_timeout_,
+                                 "connection_timeout",
+                                 "Connection timeout",
+                                 "Time (in ms) to wait for the receiver to create the segment",
+                                 static_cast<int64_t>(10000));
+  result &= registrar->parameter(send_timeout_,
+                                 "send_timeout",
+                                 "Send timeout",
+                                 "Time (in ms) to wait for the receiver to release a slot before "
+                                 "applying the policy (see SharedMemoryReceptiveSchedulingTerm)",
+                                 static_cast<int64_t>(0));
+  result &= registrar->parameter(
+      serializer_, "serializer", "Entity serializer", "Serializer used to write the messages");
+  return nvidia::gxf::ToResultCode(result);
+}
+
+gxf_result_t SharedMemoryChannelTransmitter::deinitialize() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (gxf_uid_t uid : pending_) { GxfEntityRefCountDec(context(), uid); }
+    pending_.clear();
+  }
+  std::lock_guard<std::mutex> lock(segment_mutex_);
+  segment_.reset();
+  connect_start_.reset();
+  connect_timed_out_ = false;
+  consumer_lost_ = false;
+  return GXF_SUCCESS;
+}
+
+gxf_result_t SharedMemoryChannelTransmitter::pop_abi(gxf_uid_t* uid) {
+  if (uid == nullptr) { return GXF_ARGUMENT_NULL; }
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (pending_.empty()) { return GXF_FAILURE; }
+  *uid = pending_.front();
+  pending_.pop_front();
+  return GXF_SUCCESS;
+}
+
+gxf_result_t SharedMemoryChannelTransmitter::push_abi(gxf_uid_t other) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (pending_.size() >= capacity_.get()) {
+    switch (policy_.get()) {
+      case 0:  // pop
+        GxfEntityRefCountDec(context(), pending_.front());
+        pending_.pop_front();
+        break;
+      case 1:  // reject
+        HOLOSCAN_LOG_WARN("SharedMemoryChannelTransmitter '{}': queue is full, message rejected",
+                          name());
+        return GXF_SUCCESS;
+      default:  // fault
+        HOLOSCAN_LOG_ERROR("SharedMemoryChannelTransmitter '{}': queue is full", name());
+        return GXF_EXCEEDING_PREALLOCATED_SIZE;
+    }
+  }
+  gxf_result_t code = GxfEntityRefCountInc(context(), other);
+  if (code != GXF_SUCCESS) { return code; }
+  pending_.push_back(other);
+  return GXF_SUCCESS;
+}
+
+gxf_result_t SharedMemoryChannelTransmitter::peek_abi(gxf_uid_t* uid, int32_t index) {
+  if (uid == nullptr) { return GXF_ARGUMENT_NULL; }
+  if (index < 0) { return GXF_ARGUMENT_OUT_OF_RANGE; }
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (static_cast<size_t>(index) >= pending_.size()) { return GXF_FAILURE; }
+  *uid = pending_[index];
+  return GXF_SUCCESS;
+}
+
+size_t SharedMemoryChannelTransmitter::capacity_abi() {
+  return capacity_.get();
+}
+
+size_t SharedMemoryChannelTransmitter::size_abi() {
+  // Messages are sent to the receiver on sync, so nothing is ever left in the main stage.
+  return 0;
+}
+
+gxf_result_t SharedMemoryChannelTransmitter::publish_abi(gxf_uid_t uid) {
+  return push_abi(uid);
+}
+
+size_t SharedMemoryChannelTransmitter::back_size_abi() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return pending_.size();
+}
+
+gxf_result_t SharedMemoryChannelTransmitter::sync_abi() {
+  std::deque<gxf_uid_t> messages;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    messages.swap(pending_);
+  }
+  gxf_result_t code = GXF_SUCCESS;
+  for (gxf_uid_t uid : messages) {
+    if (code == GXF_SUCCESS) { code = send(uid); }
+    GxfEntityRefCountDec(context(), uid);
+  }
+  return code;
+}
+
+bool SharedMemoryChannelTransmitter::is_receptive(size_t min_size) {
+  // The scheduler must not wait for a send in progress: check again later instead.
+  std::unique_lock<std::mutex> lock(segment_mutex_, std::try_to_lock);
+  if (!lock.owns_lock()) { return false; }
+  if (!connect(false)) { return connect_timed_out_; }
+  if (segment_->slot_count() - segment_->size() >= min_size) { return true; }
+  return is_consumer_lost();
+}
+
+bool SharedMemoryChannelTransmitter::connect(bool wait) {
+  if (segment_) { return true; }
+  const auto now = std::chrono::steady_clock::now();
+  if (!connect_start_) { connect_start_ = now; }
+  // Only wait for the receiver once: after a timeout, sends fail fast unless it showed up since.
+  const auto deadline =
+      connect_timed_out_ ? now
+                         : *connect_start_ + std::chrono::milliseconds(connection_timeout_.get());
+  while (!(segment_ = SharedMemorySegment::open(segment_name_.get()))) {
+    if (std::chrono::steady_clock::now() >= deadline) {
+      if (!connect_timed_out_) {
+        HOLOSCAN_LOG_ERROR(
+            "SharedMemoryChannelTransmitter '{}': shared memory segment '{}' was not created by "
+            "the receiver within {} ms",
+            name(),
+            segment_name_.get(),
+            connection_timeout_.get());
+        connect_timed_out_ = true;
+      }
+      return false;
+    }
+    if (!wait) { return false; }
+    std::this_thread::sleep_for(kConnectPollInterval);
+  }
+  HOLOSCAN_LOG_DEBUG("SharedMemoryChannelTransmitter '{}': connected to '{}' ({} slots of {} B)",
+                     name(),
+                     segment_->name(),
+                     segment_->slot_count(),
+                     segment_->slot_size());
+  return true;
+}
+
+bool SharedMemoryChannelTransmitter::is_consumer_lost() {
+  if (consumer_lost_) { return true; }
+  const auto now = std::chrono::steady_clock::now();
+  if (now < next_liveness_check_) { return false; }
+  next_liveness_check_ = now + kLivenessCheckInterval;
+  if (segment_->is_consumer_alive()) { return false; }
+  HOLOSCAN_LOG_WARN(
+      "SharedMemoryChannelTransmitter '{}': receiver is closed, dropping the messages", name());
+  consumer_lost_ = true;
+  return true;
+}
+
+gxf_result_t SharedMemoryChannelTransmitter::send(gxf_uid_t uid) {
+  std::lock_guard<std::mutex> lock(segment_mutex_);
+  if (!connect(true)) { return GXF_FAILURE; }
+  if (consumer_lost_) { return GXF_SUCCESS; }
+
+  // Wait for the receiver to release a slot. With the SharedMemoryReceptiveSchedulingTerm, a slot
+  // is free unless more messages than free slots were published.
+  uint8_t* slot = nullptr;
+  const auto deadline =
+      std::chrono::steady_clock::now() + std::chrono::milliseconds(send_timeout_.get());
+  next_liveness_check_ = std::chrono::steady_clock::now();
+  while ((slot = segment_->begin_write()) == nullptr) {
+    if (is_consumer_lost()) { return GXF_SUCCESS; }
+    if (std::chrono::steady_clock::now() >= deadline) {
+      if (policy_.get() == 2) {  // fault
+        HOLOSCAN_LOG_ERROR(
+            "SharedMemoryChannelTransmitter '{}': no slot released by the receiver within {} ms",
+            name(),
+            send_timeout_.get());
+        return GXF_EXCEEDING_PREALLOCATED_SIZE;
+      }
+      // pop/reject: the slots belong to the receiver, so the new message is dropped.
+      HOLOSCAN_LOG_WARN(
+          "SharedMemoryChannelTransmitter '{}': no slot released by the receiver within {} ms, "
+          "message dropped",
+          name(),
+          send_timeout_.get());
+      return GXF_SUCCESS;
+    }
+    std::this_thread::sleep_for(kSlotPollInterval);
+  }
+
+  auto entity = nvidia::gxf::Entity::Shared(context(), uid);
+  if (!entity) { return entity.error(); }
+
+  endpoint_.begin_write(slot, segment_->slot_size());
+  auto result = serializer_.get()->serializeEntity(entity.value(), &endpoint_);
+  if (!result) {
+    if (endpoint_.overflowed()) {
+      HOLOSCAN_LOG_ERROR(
+          "SharedMemoryChannelTransmitter '{}': message does not fit in a slot of {} bytes. "
+          "Increase 'slot_size' of the receiver.",
+          name(),
+          segment_->slot_size());
+    }
+    return result.error();
+  }
+  segment_->commit_write(endpoint_.inline_size(), endpoint_.payload_size());
+  return GXF_SUCCESS;
+}
+
+gxf_result_t SharedMemoryReceptiveSchedulingTerm::registerInterface(
+    nvidia::gxf::Registrar* registrar) {
+  nvidia::gxf::Expected<void> result;
+  result &= registrar->parameter(transmitter_,
+                                 "transmitter",
+                                 "Transmitter",
+                                 "The shared memory transmitter whose segment is checked");
+  result &= registrar->parameter(min_size_,
+                                 "min_size",
+                                 "Minimum size",
+                                 "The minimum number of free slots required in the segment",
+                                 1UL);
+  result &= registrar->parameter(poll_period_,
+                                 "poll_period",
+                                 "Poll period",
+                                 "Time (in ns) after which a full segment is checked again",
+                                 static_cast<int64_t>(100000));
+  return nvidia::gxf::ToResultCode(result);
+}
+
+gxf_result_t SharedMemoryReceptiveSchedulingTerm::check_abi(
+    int64_t timestamp, nvidia::gxf::SchedulingConditionType* type,
+    int64_t* target_timestamp) const {
+  if (transmitter_.get()->is_receptive(min_size_.get())) {
+    *type = nvidia::gxf::SchedulingConditionType::READY;
+    *target_timestamp = timestamp;
+  } else {
+    *type = nvidia::gxf::SchedulingConditionType::WAIT_TIME;
+    *target_timestamp = timestamp + poll_period_.get();
+  }
+  return GXF_SUCCESS;
+}
+
+gxf_result_t SharedMemoryReceptiveSchedulingTerm::onExecute_abi(int64_t dt) {
+  (void)dt;
+  return GXF_SUCCESS;
+}
+
+}  // namespace holoscan
@@ -0,0 +1,138 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "holoscan/core/resources/gxf/shared_memory_endpoint.hpp"
+
+#include <cuda_runtime.h>
+
+#include <cstring>
+
+#include "holoscan/core/resources/gxf/shared_memory_segment.hpp"
+#include "holoscan/logger/logger.hpp"
+
+namespace holoscan {
+
+void SharedMemorySlotEndpoint::begin_write(uint8_t* slot, size_t slot_size) {
+  write_slot_ = slot;
+  read_slot_ = nullptr;
+  slot_size_ = slot_size;
+  inline_end_ = 0;
+  inline_limit_ = slot_size;
+  payload_end_ = 0;
+  payload_limit_ = slot_size;
+  overflowed_ = false;
+}
+
+void SharedMemorySlotEndpoint::begin_read(const uint8_t* slot, size_t slot_size,
+                                          size_t inline_size, size_t payload_size) {
+  write_slot_ = nullptr;
+  read_slot_ = slot;
+  slot_size_ = slot_size;
+  inline_end_ = 0;
+  inline_limit_ = inline_size;
+  payload_end_ = 0;
+  payload_limit_ = payload_size;
+  overflowed_ = false;
+}
+
+gxf_result_t SharedMemorySlotEndpoint::is_write_available_abi() {
+  return write_slot_ != nullptr ? GXF_SUCCESS : GXF_FAILURE;
+}
+
+gxf_result_t SharedMemorySlotEndpoint::is_read_available_abi() {
+  return read_slot_ != nullptr && inline_end_ < inline_limit_ ? GXF_SUCCESS : GXF_FAILURE;
+}
+
+gxf_result_t SharedMemorySlotEndpoint::write_abi(const void* data, size_t size,
+                                                 size_t* bytes_written) {
+  if (data == nullptr || bytes_written == nullptr) { return GXF_ARGUMENT_NULL; }
+  if (write_slot_ == nullptr) { return GXF_FAILURE; }
+  // Inline bytes must not overlap the payloads placed at the end of the slot.
+  if (inline_end_ + size > slot_size_ - payload_end_) {
+    overflowed_ = true;
+    return GXF_EXCEEDING_PREALLOCATED_SIZE;
+  }
+  std::memcpy(write_slot_ + inline_end_, data, size);
+  inline_end_ += size;
+  *bytes_written = size;
+  return GXF_SUCCESS;
+}
+
+gxf_result_t SharedMemorySlotEndpoint::read_abi(void* data, size_t size, size_t* bytes_read) {
+  if (data == nullptr || bytes_read == nullptr) { return GXF_ARGUMENT_NULL; }
+  if (read_slot_ == nullptr) { return GXF_FAILURE; }
+  if (inline_end_ + size > inline_limit_) { return GXF_FAILURE; }
+  std::memcpy(data, read_slot_ + inline_end_, size);
+  inline_end_ += size;
+  *bytes_read = size;
+  return GXF_SUCCESS;
+}
+
+gxf_result_t SharedMemorySlotEndpoint::write_ptr_abi(const void* pointer, size_t size,
+                                                     nvidia::gxf::MemoryStorageType type) {
+  if (size == 0) { return GXF_SUCCESS; }
+  if (pointer == nullptr) { return GXF_ARGUMENT_NULL; }
+
+  const int64_t offset = next_payload_offset(size);
+  if (offset < 0) { return write_slot_ ? GXF_EXCEEDING_PREALLOCATED_SIZE : GXF_FAILURE; }
+
+  const bool is_device = type == nvidia::gxf::MemoryStorageType::kDevice;
+  if (write_slot_ != nullptr) {
+    // Serializing: copy the payload into the slot.
+    uint8_t* target = write_slot_ + offset;
+    if (is_device) {
+      cudaError_t cuda_error = cudaMemcpy(target, pointer, size, cudaMemcpyDeviceToHost);
+      if (cuda_error != cudaSuccess) {
+        HOLOSCAN_LOG_ERROR("Failed to copy a device payload to shared memory: {}",
+                           cudaGetErrorString(cuda_error));
+        return GXF_FAILURE;
+      }
+    } else {
+      std::memcpy(target, pointer, size);
+    }
+    return GXF_SUCCESS;
+  }
+
+  // Deserializing: 'pointer' is the memory allocated for the payload by the deserializer.
+  const uint8_t* source = read_slot_ + offset;
+  void* target = const_cast<void*>(pointer);
+  if (is_device) {
+    cudaError_t cuda_error = cudaMemcpy(target, source, size, cudaMemcpyHostToDevice);
+    if (cuda_error != cudaSuccess) {
+      HOLOSCAN_LOG_ERROR("Failed to copy a payload from shared memory to the device: {}",
+                         cudaGetErrorString(cuda_error));
+      return GXF_FAILURE;
+    }
+  } else {
+    std::memcpy(target, source, size);
+  }
+  return GXF_SUCCESS;
+}
+
+int64_t SharedMemorySlotEndpoint::next_payload_offset(size_t size) {
+  if (write_slot_ == nullptr && read_slot_ == nullptr) { return -1; }
+  const size_t offset = shared_memory_payload_offset(slot_size_, payload_end_, size);
+  if (offset >= slot_size_ || slot_size_ - offset > payload_limit_ ||
+      (write_slot_ != nullptr && offset < inline_end_)) {
+    if (write_slot_ != nullptr) { overflowed_ = true; }
+    return -1;
+  }
+  payload_end_ = slot_size_ - offset;
+  return static_cast<int64_t>(offset);
+}
+
+}  // namespace holoscan
@@ -0,0 +1,82 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "holoscan/core/resources/gxf/shared_memory_receiver.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+
+#include "holoscan/core/component_spec.hpp"
+#include "holoscan/core/fragment.hpp"
+#include "holoscan/core/gxf/gxf_utils.hpp"
+#include "holoscan/core/resources/gxf/shared_memory_channel_receiver.hpp"
+
+namespace holoscan {
+
+SharedMemoryReceiver::SharedMemoryReceiver(const std::string& name,
+                                           SharedMemoryChannelReceiver* component)
+    : Receiver(name, component) {
+  uint64_t capacity = 0;
+  HOLOSCAN_GXF_CALL_FATAL(GxfParameterGetUInt64(gxf_context_, gxf_cid_, "capacity", &capacity));
+  capacity_ = capacity;
+  uint64_t slot_size = 0;
+  HOLOSCAN_GXF_CALL_FATAL(GxfParameterGetUInt64(gxf_context_, gxf_cid_, "slot_size", &slot_size));
+  slot_size_ = slot_size;
+  const char* segment_name;
+  HOLOSCAN_GXF_CALL_FATAL(
+      GxfParameterGetStr(gxf_context_, gxf_cid_, "segment_name", &segment_name));
+  segment_name_ = std::string(segment_name);
+}
+
+void SharedMemoryReceiver::setup(ComponentSpec& spec) {
+  HOLOSCAN_LOG_DEBUG("SharedMemoryReceiver::setup");
+  spec.param(capacity_, "capacity", "Capacity", "Number of slots", kDefaultSharedMemorySlotCount);
+  spec.param(slot_size_,
+             "slot_size",
+             "Slot size",
+             "Maximum size (in bytes) of a serialized message",
+             kDefaultSharedMemorySlotSize);
+  spec.param(segment_name_,
+             "segment_name",
+             "Segment name",
+             "Name of the shared memory segment created by this receiver");
+  spec.param(serializer_, "serializer", "Entity serializer", "");
+}
+
+void SharedMemoryReceiver::initialize() {
+  HOLOSCAN_LOG_DEBUG("SharedMemoryReceiver::initialize");
+  // Set up prerequisite parameters before calling GXFResource::initialize()
+  auto frag = fragment();
+
+  // Find if there is an argument for 'serializer'
+  auto has_serializer = std::find_if(
+      args().begin(), args().end(), [](const auto& arg) { return (arg.name() == "serializer"); });
+  // Create a UcxEntitySerializer if no serializer was provided
+  if (has_serializer == args().end()) {
+    auto serializer = frag->make_resource<holoscan::UcxEntitySerializer>(
+        "shm_rx_entity_serializer", Arg("verbose_warning") = false);
+    add_arg(Arg("serializer") = serializer);
+  }
+  GXFResource::initialize();
+}
+
+std::string SharedMemoryReceiver::segment_name() {
+  return segment_name_.get();
+}
+
+}  // namespace holoscan
@@ -0,0 +1,264 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "holoscan/core/resources/gxf/shared_memory_segment.hpp"
+
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <string>
+#include <utility>
+
+#include "holoscan/logger/logger.hpp"
+
+namespace holoscan {
+
+namespace {
+
+constexpr uint64_t kSegmentMagic = 0x484f4c4f53484d31;  // "HOLOSHM1"
+constexpr uint64_t kSegmentVersion = 1;
+constexpr size_t kSegmentAlignment = 4096;
+constexpr size_t kMaxSegmentNameLength = 255;
+
+size_t align_up(size_t value, size_t alignment) {
+  return (value + alignment - 1) / alignment * alignment;
+}
+
+}  // namespace
+
+struct SharedMemorySegment::Header {
+  /// Set last by the consumer once the segment is initialized.
+  std::atomic<uint64_t> magic;
+  uint64_t version;
+  uint64_t slot_count;
+  uint64_t slot_size;
+  uint64_t slots_offset;
+  /// Index of the oldest message, advanced by the consumer.
+  alignas(64) std::atomic<uint64_t> head;
+  /// Index of the next free slot, advanced by the producer.
+  alignas(64) std::atomic<uint64_t> tail;
+  /// Cleared by the consumer when it closes the segment.
+  alignas(64) std::atomic<uint32_t> consumer_open;
+};
+
+struct SharedMemorySegment::SlotDescriptor {
+  uint64_t inline_size;
+  uint64_t payload_size;
+};
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free,
+              "Shared memory segments require lock-free 64-bit atomics");
+
+SharedMemorySegment::SharedMemorySegment(std::string name, int fd, void* address,
+                                         size_t mapped_size, bool is_owner)
+    : name_(std::move(name)),
+      fd_(fd),
+      address_(address),
+      mapped_size_(mapped_size),
+      is_owner_(is_owner),
+      header_(static_cast<Header*>(address)),
+      slot_count_(header_->slot_count),
+      slot_size_(header_->slot_size) {}
+
+SharedMemorySegment::~SharedMemorySegment() {
+  if (is_owner_) {
+    header_->consumer_open.store(0, std::memory_order_release);
+    shm_unlink(name_.c_str());
+  }
+  munmap(address_, mapped_size_);
+  // Closing the descriptor releases the consumer lock.
+  close(fd_);
+}
+
+std::string SharedMemorySegment::segment_name(const std::string& name) {
+  std::string result = "/";
+  for (char c : name) { result.push_back(c == '/' ? '_' : c); }
+  if (!name.empty() && name[0] == '/') { result.erase(1, 1); }
+  if (result.size() > kMaxSegmentNameLength) { result.resize(kMaxSegmentNameLength); }
+  return result;
+}
+
+std::unique_ptr<SharedMemorySegment> SharedMemorySegment::create(const std::string& name,
+                                                                 size_t slot_count,
+                                                                 size_t slot_size) {
+  if (slot_count == 0 || slot_size == 0) {
+    HOLOSCAN_LOG_ERROR("Shared memory segment '{}': slot count and slot size must be positive",
+                       name);
+    return nullptr;
+  }
+  const std::string shm_name = segment_name(name);
+  const size_t slot_stride = align_up(slot_size, kSegmentAlignment);
+  const size_t slots_offset =
+      align_up(sizeof(Header) + slot_count * sizeof(SlotDescriptor), kSegmentAlignment);
+  const size_t total_size = slots_offset + slot_count * slot_stride;
+
+  // Replace any stale segment left over by a previous run.
+  shm_unlink(shm_name.c_str());
+  int fd = shm_open(shm_name.c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+  if (fd < 0) {
+    HOLOSCAN_LOG_ERROR(
+        "Unable to create shared memory segment '{}': {}", shm_name, std::strerror(errno));
+    return nullptr;
+  }
+  if (ftruncate(fd, static_cast<off_t>(total_size)) != 0) {
+    HOLOSCAN_LOG_ERROR("Unable to resize shared memory segment '{}' to {} bytes: {}",
+                       shm_name,
+                       total_size,
+                       std::strerror(errno));
+    close(fd);
+    shm_unlink(shm_name.c_str());
+    return nullptr;
+  }
+  if (flock(fd, LOCK_SH | LOCK_NB) != 0) {
+    HOLOSCAN_LOG_ERROR(
+        "Unable to lock shared memory segment '{}': {}", shm_name, std::strerror(errno));
+    close(fd);
+    shm_unlink(shm_name.c_str());
+    return nullptr;
+  }
+  void* address = mmap(nullptr, total_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if (address == MAP_FAILED) {
+    HOLOSCAN_LOG_ERROR(
+        "Unable to map shared memory segment '{}': {}", shm_name, std::strerror(errno));
+    close(fd);
+    shm_unlink(shm_name.c_str());
+    return nullptr;
+  }
+
+  auto header = new (address) Header();
+  header->version = kSegmentVersion;
+  header->slot_count = slot_count;
+  header->slot_size = slot_stride;
+  header->slots_offset = slots_offset;
+  header->head.store(0, std::memory_order_relaxed);
+  header->tail.store(0, std::memory_order_relaxed);
+  header->consumer_open.store(1, std::memory_order_relaxed);
+  header->magic.store(kSegmentMagic, std::memory_order_release);
+
+  return std::unique_ptr<SharedMemorySegment>(
+      new SharedMemorySegment(shm_name, fd, address, total_size, true));
+}
+
+std::unique_ptr<SharedMemorySegment> SharedMemorySegment::open(const std::string& name) {
+  const std::string shm_name = segment_name(name);
+  int fd = shm_open(shm_name.c_str(), O_RDWR, 0);
+  if (fd < 0) { return nullptr; }
+
+  struct stat segment_stat {};
+  if (fstat(fd, &segment_stat) != 0 ||
+      static_cast<size_t>(segment_stat.st_size) < sizeof(Header)) {
+    // The consumer has not resized the segment yet.
+    close(fd);
+    return nullptr;
+  }
+  const size_t total_size = static_cast<size_t>(segment_stat.st_size);
+  void* address = mmap(nullptr, total_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if (address == MAP_FAILED) {
+    HOLOSCAN_LOG_ERROR(
+        "Unable to map shared memory segment '{}': {}", shm_name, std::strerror(errno));
+    close(fd);
+    return nullptr;
+  }
+
+  auto header = static_cast<Header*>(address);
+  if (header->magic.load(std::memory_order_acquire) != kSegmentMagic) {
+    munmap(address, total_size);
+    close(fd);
+    return nullptr;
+  }
+  if (header->version != kSegmentVersion ||
+      header->slots_offset + header->slot_count * header->slot_size > total_size) {
+    HOLOSCAN_LOG_ERROR("Shared memory segment '{}' has an unsupported layout", shm_name);
+    munmap(address, total_size);
+    close(fd);
+    return nullptr;
+  }
+  return std::unique_ptr<SharedMemorySegment>(
+      new SharedMemorySegment(shm_name, fd, address, total_size, false));
+}
+
+size_t SharedMemorySegment::size() const {
+  const uint64_t head = header_->head.load(std::memory_order_acquire);
+  const uint64_t tail = header_->tail.load(std::memory_order_acquire);
+  return static_cast<size_t>(tail - head);
+}
+
+bool SharedMemorySegment::is_consumer_open() const {
+  return header_->consumer_open.load(std::memory_order_acquire) != 0;
+}
+
+bool SharedMemorySegment::is_consumer_alive() const {
+  if (!is_consumer_open()) { return false; }
+  if (is_owner_) { return true; }
+  // An exclusive lock can only be taken once the consumer released its shared lock.
+  if (flock(fd_, LOCK_EX | LOCK_NB) == 0) {
+    flock(fd_, LOCK_UN);
+    return false;
+  }
+  return true;
+}
+
+uint8_t* SharedMemorySegment::begin_write() {
+  const uint64_t tail = header_->tail.load(std::memory_order_relaxed);
+  const uint64_t head = header_->head.load(std::memory_order_acquire);
+  if (tail - head >= slot_count_) { return nullptr; }
+  return slot(tail);
+}
+
+void SharedMemorySegment::commit_write(size_t inline_size, size_t payload_size) {
+  const uint64_t tail = header_->tail.load(std::memory_order_relaxed);
+  SlotDescriptor* slot_descriptor = descriptor(tail);
+  slot_descriptor->inline_size = inline_size;
+  slot_descriptor->payload_size = payload_size;
+  header_->tail.store(tail + 1, std::memory_order_release);
+}
+
+const uint8_t* SharedMemorySegment::begin_read(size_t* inline_size, size_t* payload_size) {
+  const uint64_t head = header_->head.load(std::memory_order_relaxed);
+  const uint64_t tail = header_->tail.load(std::memory_order_acquire);
+  if (head == tail) { return nullptr; }
+  const SlotDescriptor* slot_descriptor = descriptor(head);
+  if (inline_size != nullptr) { *inline_size = slot_descriptor->inline_size; }
+  if (payload_size != nullptr) { *payload_size = slot_descriptor->payload_size; }
+  return slot(head);
+}
+
+void SharedMemorySegment::end_read() {
+  const uint64_t head = header_->head.load(std::memory_order_relaxed);
+  header_->head.store(head + 1, std::memory_order_release);
+}
+
+SharedMemorySegment::SlotDescriptor* SharedMemorySegment::descriptor(uint64_t index) const {
+  auto descriptors = reinterpret_cast<SlotDescriptor*>(static_cast<uint8_t*>(address_) +
+                                                       sizeof(Header));
+  return &descriptors[index % slot_count_];
+}
+
+uint8_t* SharedMemorySegment::slot(uint64_t index) const {
+  return static_cast<uint8_t*>(address_) + header_->slots_offset +
+         (index % slot_count_) * slot_size_;
+}
+
+}  // namespace holoscan
@@ -0,0 +1,99 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "holoscan/core/resources/gxf/shared_memory_transmitter.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+
+#include "holoscan/core/component_spec.hpp"
+#include "holoscan/core/fragment.hpp"
+#include "holoscan/core/gxf/gxf_utils.hpp"
+#include "holoscan/core/resources/gxf/shared_memory_channel_transmitter.hpp"
+
+namespace holoscan {
+
+SharedMemoryTransmitter::SharedMemoryTransmitter(const std::string& name,
+                                                 SharedMemoryChannelTransmitter* component)
+    : Transmitter(name, component) {
+  uint64_t capacity = 0;
+  HOLOSCAN_GXF_CALL_FATAL(GxfParameterGetUInt64(gxf_context_, gxf_cid_, "capacity", &capacity));
+  capacity_ = capacity;
+  uint64_t policy = 0;
+  HOLOSCAN_GXF_CALL_FATAL(GxfParameterGetUInt64(gxf_context_, gxf_cid_, "policy", &policy));
+  policy_ = policy;
+  const char* segment_name;
+  HOLOSCAN_GXF_CALL_FATAL(
+      GxfParameterGetStr(gxf_context_, gxf_cid_, "segment_name", &segment_name));
+  segment_name_ = std::string(segment_name);
+  int64_t connection_timeout = 0;
+  HOLOSCAN_GXF_CALL_FATAL(
+      GxfParameterGetInt64(gxf_context_, gxf_cid_, "connection_timeout", &connection_timeout));
+  connection_timeout_ = connection_timeout;
+  int64_t send_timeout = 0;
+  HOLOSCAN_GXF_CALL_FATAL(
+      GxfParameterGetInt64(gxf_context_, gxf_cid_, "send_timeout", &send_timeout));
+  send_timeout_ = send_timeout;
+}
+
+void SharedMemoryTransmitter::setup(ComponentSpec& spec) {
+  HOLOSCAN_LOG_DEBUG("SharedMemoryTransmitter::setup");
+  spec.param(capacity_, "capacity", "Capacity", "", 1UL);
+  spec.param(policy_, "policy", "Policy", "0: pop, 1: reject, 2: fault", 2UL);
+  spec.param(segment_name_,
+             "segment_name",
+             "Segment name",
+             "Name of the shared memory segment created by the receiver");
+  spec.param(connection_timeout_,
+             "connection_timeout",
+             "Connection timeout",
+             "Time (in ms) to wait for the receiver to create the segment",
+             static_cast<int64_t>(10000));
+  spec.param(send_timeout_,
+             "send_timeout",
+             "Send timeout",
+             "Time (in ms) to wait for the receiver to release a slot before applying the policy "
+             "(the upstream operator already waits for a free slot before it is executed)",
+             static_cast<int64_t>(0));
+  spec.param(serializer_, "serializer", "Entity serializer", "");
+}
+
+void SharedMemoryTransmitter::initialize() {
+  HOLOSCAN_LOG_DEBUG("SharedMemoryTransmitter::initialize");
+  // Set up prerequisite parameters before calling GXFResource::initialize()
+  auto frag = fragment();
+
+  // Find if there is an argument for 'serializer'
+  auto has_serializer = std::find_if(
+      args().begin(), args().end(), [](const auto& arg) { return (arg.name() == "serializer"); });
+  // Create a UcxEntitySerializer if no serializer was provided. The UCX serializers write tensor
+  // payloads through Endpoint::write_ptr(), which lets the shared memory endpoint place them in
+  // the segment directly.
+  if (has_serializer == args().end()) {
+    auto serializer = frag->make_resource<holoscan::UcxEntitySerializer>(
+        "shm_tx_entity_serializer", Arg("verbose_warning") = false);
+    add_arg(Arg("serializer") = serializer);
+  }
+  GXFResource::initialize();
+}
+
+std::string SharedMemoryTransmitter::segment_name() {
+  return segment_name_.get();
+}
+
+}  // namespace holoscan
@@ -0,0 +1,176 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "holoscan/core/resources/gxf/slab_allocator.hpp"
+
+#include <cuda_runtime.h>
+
+#include <cstdlib>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "holoscan/logger/logger.hpp"
+
+namespace holoscan {
+
+namespace {
+
+// Values of the 'storage_type' parameter (nvidia::gxf::MemoryStorageType)
+constexpr int32_t kHost = 0;
+constexpr int32_t kDevice = 1;
+constexpr int32_t kSystem = 2;
+
+}  // namespace
+
+gxf_result_t SlabAllocator::registerInterface(nvidia::gxf::Registrar* registrar) {
+  nvidia::gxf::Expected<void> result;
+  result &= registrar->parameter(storage_type_,
+                                 "storage_type",
+                                 "Storage type",
+                                 "The memory storage type used by this allocator. Can be kHost "
+                                 "(0), kDevice (1) or kSystem (2)",
+                                 kHost);
+  result &= registrar->parameter(size_classes_,
+                                 "size_classes",
+                                 "Size classes",
+                                 "Block sizes of the size classes in bytes. If empty, the powers "
+                                 "of two from 'min_block_size' to 'max_block_size' are used",
+                                 std::vector<uint64_t>{});
+  result &= registrar->parameter(min_block_size_,
+                                 "min_block_size",
+                                 "Minimum block size",
+                                 "Block size of the smallest power-of-two size class",
+                                 256UL);
+  result &= registrar->parameter(max_block_size_,
+                                 "max_block_size",
+                                 "Maximum block size",
+                                 "Block size of the largest power-of-two size class",
+                                 16UL * 1024 * 1024);
+  result &= registrar->parameter(slab_size_,
+                                 "slab_size",
+                                 "Slab size",
+                                 "Size of the chunks of memory divided into the blocks of a size "
+                                 "class (a slab holds at least one block)",
+                                 16UL * 1024 * 1024);
+  result &= registrar->parameter(max_bytes_,
+                                 "max_bytes",
+                                 "Maximum bytes",
+                                 "Maximum number of bytes allocated by the pool (0 for no limit)",
+                                 0UL);
+  result &= registrar->parameter(thread_cache_size_,
+                                 "thread_cache_size",
+                                 "Thread cache size",
+                                 "Maximum number of freed blocks per size class kept by each "
+                                 "thread (0 to disable the thread-local caches)",
+                                 0UL);
+  return nvidia::gxf::ToResultCode(result);
+}
+
+gxf_result_t SlabAllocator::initialize() {
+  SlabPool::AllocateFunction allocate;
+  SlabPool::FreeFunction free;
+  switch (storage_type_.get()) {
+    case kHost:
+      allocate = [](uint64_t size) -> void* {
+        void* pointer = nullptr;
+        if (cudaMallocHost(&pointer, size) != cudaSuccess) { return nullptr; }
+        return pointer;
+      };
+      free = [](void* pointer, uint64_t) { cudaFreeHost(pointer); };
+      break;
+    case kDevice:
+      allocate = [](uint64_t size) -> void* {
+        void* pointer = nullptr;
+        if (cudaMalloc(&pointer, size) != cudaSuccess) { return nullptr; }
+        return pointer;
+      };
+      free = [](void* pointer, uint64_t) { cudaFree(pointer); };
+      break;
+    case kSystem:
+      allocate = [](uint64_t size) -> void* {
+        // std::aligned_alloc requires the size to be a multiple of the alignment
+        const uint64_t alignment = SlabPool::kBlockAlignment;
+        return std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+      };
+      free = [](void* pointer, uint64_t) { std::free(pointer); };
+      break;
+    default:
+      HOLOSCAN_LOG_ERROR(
+          "SlabAllocator '{}': invalid storage type {}", name(), storage_type_.get());
+      return GXF_ARGUMENT_INVALID;
+  }
+
+  std::vector<uint64_t> size_classes = size_classes_.get();
+  if (size_classes.empty()) {
+    size_classes =
+        SlabPool::power_of_two_size_classes(min_block_size_.get(), max_block_size_.get());
+  }
+  pool_ = std::make_unique<SlabPool>(std::move(size_classes),
+                                     slab_size_.get(),
+                                     max_bytes_.get(),
+                                     thread_cache_size_.get(),
+                                     std::move(allocate),
+                                     std::move(free));
+  return GXF_SUCCESS;
+}
+
+gxf_result_t SlabAllocator::deinitialize() {
+  if (pool_ == nullptr) { return GXF_SUCCESS; }
+  auto stats = pool_->stats();
+  HOLOSCAN_LOG_DEBUG(
+      "SlabAllocator '{}': {} allocations ({} from thread caches), {} large, {} failed, {} slabs "
+      "({} bytes reserved)",
+      name(),
+      stats.allocations,
+      stats.thread_cache_hits,
+      stats.large_allocations,
+      stats.failed_allocations,
+      stats.slabs,
+      stats.reserved_bytes);
+  pool_.reset();
+  return GXF_SUCCESS;
+}
+
+gxf_result_t SlabAllocator::is_available_abi(uint64_t size) {
+  if (pool_ == nullptr) { return GXF_FAILURE; }
+  return pool_->is_available(size) ? GXF_SUCCESS : GXF_FAILURE;
+}
+
+gxf_result_t SlabAllocator::allocate_abi(uint64_t size, int32_t type, void** pointer) {
+  if (pointer == nullptr || pool_ == nullptr) { return GXF_ARGUMENT_NULL; }
+  if (type != storage_type_.get()) {
+    HOLOSCAN_LOG_ERROR("SlabAllocator '{}': requested storage type {} but the pool holds type {}",
+                       name(),
+                       type,
+                       storage_type_.get());
+    return GXF_ARGUMENT_INVALID;
+  }
+  *pointer = pool_->allocate(size);
+  return *pointer != nullptr ? GXF_SUCCESS : GXF_FAILURE;
+}
+
+gxf_result_t SlabAllocator::free_abi(void* pointer) {
+  if (pool_ == nullptr) { return GXF_FAILURE; }
+  return pool_->free(pointer) ? GXF_SUCCESS : GXF_ARGUMENT_INVALID;
+}
+
+SlabPoolStats SlabAllocator::stats() const {
+  return pool_ ? pool_->stats() : SlabPoolStats{};
+}
+
+}  // namespace holoscan
@@ -0,0 +1,103 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "holoscan/core/resources/gxf/slab_memory_pool.hpp"
+
+#include <string>
+#include <vector>
+
+#include "holoscan/core/component_spec.hpp"
+#include "holoscan/core/gxf/gxf_utils.hpp"
+#include "holoscan/core/resources/gxf/slab_allocator.hpp"
+
+namespace holoscan {
+
+SlabMemoryPool::SlabMemoryPool(const std::string& name, SlabAllocator* component)
+    : Allocator(name, component) {
+  int32_t storage_type = 0;
+  HOLOSCAN_GXF_CALL_FATAL(
+      GxfParameterGetInt32(gxf_context_, gxf_cid_, "storage_type", &storage_type));
+  storage_type_ = storage_type;
+  size_classes_ = component->size_classes_.get();
+  uint64_t min_block_size = 0;
+  HOLOSCAN_GXF_CALL_FATAL(
+      GxfParameterGetUInt64(gxf_context_, gxf_cid_, "min_block_size", &min_block_size));
+  min_block_size_ = min_block_size;
+  uint64_t max_block_size = 0;
+  HOLOSCAN_GXF_CALL_FATAL(
+      GxfParameterGetUInt64(gxf_context_, gxf_cid_, "max_block_size", &max_block_size));
+  max_block_size_ = max_block_size;
+  uint64_t slab_size = 0;
+  HOLOSCAN_GXF_CALL_FATAL(GxfParameterGetUInt64(gxf_context_, gxf_cid_, "slab_size", &slab_size));
+  slab_size_ = slab_size;
+  uint64_t max_bytes = 0;
+  HOLOSCAN_GXF_CALL_FATAL(GxfParameterGetUInt64(gxf_context_, gxf_cid_, "max_bytes", &max_bytes));
+  max_bytes_ = max_bytes;
+  uint64_t thread_cache_size = 0;
+  HOLOSCAN_GXF_CALL_FATAL(
+      GxfParameterGetUInt64(gxf_context_, gxf_cid_, "thread_cache_size", &thread_cache_size));
+  thread_cache_size_ = thread_cache_size;
+}
+
+void SlabMemoryPool::setup(ComponentSpec& spec) {
+  spec.param(storage_type_,
+             "storage_type",
+             "Storage type",
+             "The memory storage type used by this allocator. Can be kHost (0), kDevice (1) or "
+             "kSystem (2)",
+             0);
+  spec.param(size_classes_,
+             "size_classes",
+             "Size classes",
+             "Block sizes of the size classes in bytes. If empty, the powers of two from "
+             "'min_block_size' to 'max_block_size' are used.",
+             std::vector<uint64_t>{});
+  spec.param(min_block_size_,
+             "min_block_size",
+             "Minimum block size",
+             "Block size of the smallest power-of-two size class",
+             256UL);
+  spec.param(max_block_size_,
+             "max_block_size",
+             "Maximum block size",
+             "Block size of the largest power-of-two size class. Larger requests are allocated "
+             "directly.",
+             16UL * 1024 * 1024);
+  spec.param(slab_size_,
+             "slab_size",
+             "Slab size",
+             "Size of the chunks of memory divided into the blocks of a size class (a slab holds "
+             "at least one block)",
+             16UL * 1024 * 1024);
+  spec.param(max_bytes_,
+             "max_bytes",
+             "Maximum bytes",
+             "Maximum number of bytes allocated by the pool (0 for no limit)",
+             0UL);
+  spec.param(thread_cache_size_,
+             "thread_cache_size",
+             "Thread cache size",
+             "Maximum number of freed blocks per size class kept by each thread (0 to disable the "
+             "thread-local caches)",
+             0UL);
+}
+
+SlabPoolStats SlabMemoryPool::stats() const {
+  return gxf_component_stats<SlabAllocator>();
+}
+
+}  // namespace holoscan
@@ -0,0 +1,371 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "holoscan/core/resources/gxf/slab_pool.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace holoscan {
+
+namespace {
+
+uint64_t round_up(uint64_t value, uint64_t alignment) {
+  return (value + alignment - 1) / alignment * alignment;
+}
+
+// Pool ids are never reused, so the thread-local caches of a destroyed pool are never accessed
+// again. They are pruned when a thread starts caching blocks of a new pool. The pools are
+// destroyed only once they are unregistered, so holding the mutex keeps the live pools alive.
+std::mutex pool_ids_mutex;
+uint64_t next_pool_id = 1;
+std::unordered_set<uint64_t> live_pool_ids;
+
+uint64_t register_pool() {
+  std::lock_guard<std::mutex> lock(pool_ids_mutex);
+  uint64_t id = next_pool_id++;
+  live_pool_ids.insert(id);
+  return id;
+}
+
+void unregister_pool(uint64_t id) {
+  std::lock_guard<std::mutex> lock(pool_ids_mutex);
+  live_pool_ids.erase(id);
+}
+
+// Blocks cached by the current thread for a pool, one list per size class.
+struct ThreadCache {
+  uint64_t pool_id = 0;
+  std::vector<std::vector<void*>> blocks;
+  /// Moves the blocks back to the shared free lists of the pool (which must be alive).
+  std::function<void(std::vector<std::vector<void*>>& blocks)> release;
+};
+
+// The caches of the current thread, returned to their pools when the thread exits.
+struct ThreadCaches {
+  ~ThreadCaches() {
+    std::lock_guard<std::mutex> lock(pool_ids_mutex);
+    for (auto& cache : caches) {
+      if (live_pool_ids.count(cache.pool_id) > 0) { cache.release(cache.blocks); }
+    }
+  }
+
+  std::vector<ThreadCache> caches;
+};
+thread_local ThreadCaches thread_caches;
+
+void prune_thread_caches() {
+  std::lock_guard<std::mutex> lock(pool_ids_mutex);
+  auto& caches = thread_caches.caches;
+  caches.erase(std::remove_if(caches.begin(),
+                              caches.end(),
+                              [](const ThreadCache& cache) {
+                                return live_pool_ids.count(cache.pool_id) == 0;
+                              }),
+               caches.end());
+}
+
+}  // namespace
+
+SlabPool::SlabPool(std::vector<uint64_t> size_classes, uint64_t slab_size, uint64_t max_bytes,
+                   uint64_t thread_cache_size, AllocateFunction allocate, FreeFunction free)
+    : id_(register_pool()),
+      max_bytes_(max_bytes),
+      thread_cache_size_(thread_cache_size),
+      allocate_(std::move(allocate)),
+      free_(std::move(free)) {
+  for (auto& block_size : size_classes) {
+    block_size = round_up(std::max<uint64_t>(block_size, 1), kBlockAlignment);
+  }
+  std::sort(size_classes.begin(), size_classes.end());
+  size_classes.erase(std::unique(size_classes.begin(), size_classes.end()), size_classes.end());
+
+  size_classes_.reserve(size_classes.size());
+  for (uint64_t block_size : size_classes) {
+    auto size_class = std::make_unique<SizeClass>();
+    size_class->block_size = block_size;
+    size_class->blocks_per_slab = std::max<uint64_t>(slab_size / block_size, 1);
+    size_classes_.push_back(std::move(size_class));
+  }
+}
+
+SlabPool::~SlabPool() {
+  unregister_pool(id_);
+  // Blocks still handed out or cached by a thread are released with their slab.
+  std::unique_lock<std::shared_mutex> lock(chunks_mutex_);
+  for (const auto& [address, chunk] : chunks_) {
+    free_(reinterpret_cast<void*>(address), chunk.size);
+  }
+  chunks_.clear();
+}
+
+std::vector<uint64_t> SlabPool::power_of_two_size_classes(uint64_t min_block_size,
+                                                          uint64_t max_block_size) {
+  std::vector<uint64_t> size_classes;
+  uint64_t block_size = 1;
+  while (block_size < min_block_size && block_size != 0) { block_size <<= 1; }
+  for (; block_size != 0 && block_size <= max_block_size; block_size <<= 1) {
+    size_classes.push_back(block_size);
+  }
+  return size_classes;
+}
+
+std::vector<uint64_t> SlabPool::size_classes() const {
+  std::vector<uint64_t> result;
+  result.reserve(size_classes_.size());
+  for (const auto& size_class : size_classes_) { result.push_back(size_class->block_size); }
+  return result;
+}
+
+void* SlabPool::allocate(uint64_t size) {
+  size_t class_index = find_size_class(size);
+  if (class_index == kLargeAllocation) { return allocate_large(size); }
+
+  auto& size_class = *size_classes_[class_index];
+  void* pointer = nullptr;
+  auto cache = thread_cache(class_index);
+  if (cache && !cache->empty()) {
+    pointer = cache->back();
+    cache->pop_back();
+    thread_cache_hits_++;
+  } else {
+    std::lock_guard<std::mutex> lock(size_class.mutex);
+    if (size_class.free_blocks.empty() && !grow(size_class, class_index)) {
+      failed_allocations_++;
+      return nullptr;
+    }
+    pointer = size_class.free_blocks.back();
+    size_class.free_blocks.pop_back();
+    if (cache) {
+      // Refill half of the thread-local cache while holding the lock.
+      auto& free_blocks = size_class.free_blocks;
+      uint64_t batch = std::min<uint64_t>(thread_cache_size_ / 2, free_blocks.size());
+      cache->insert(cache->end(), free_blocks.end() - batch, free_blocks.end());
+      free_blocks.resize(free_blocks.size() - batch);
+    }
+  }
+  set_block_in_use(pointer, true);
+  allocations_++;
+  in_use_blocks_++;
+  in_use_bytes_ += size_class.block_size;
+  return pointer;
+}
+
+bool SlabPool::free(void* pointer) {
+  if (pointer == nullptr) { return false; }
+  const auto address = reinterpret_cast<uintptr_t>(pointer);
+  Chunk chunk;
+  uintptr_t chunk_address = find_chunk(address, chunk);
+  if (chunk_address == 0) { return false; }
+
+  if (chunk.class_index == kLargeAllocation) {
+    if (address != chunk_address) { return false; }
+    {
+      std::unique_lock<std::shared_mutex> lock(chunks_mutex_);
+      chunks_.erase(chunk_address);
+    }
+    free_(pointer, chunk.size);
+    reserved_bytes_ -= chunk.size;
+    in_use_blocks_--;
+    in_use_bytes_ -= chunk.size;
+    return true;
+  }
+
+  auto& size_class = *size_classes_[chunk.class_index];
+  if ((address - chunk_address) % size_class.block_size != 0) { return false; }
+  // Reject a block that is already free (double free).
+  if (!set_block_in_use(chunk, address - chunk_address, false)) { return false; }
+  in_use_blocks_--;
+  in_use_bytes_ -= size_class.block_size;
+
+  auto cache = thread_cache(chunk.class_index);
+  if (cache == nullptr) {
+    std::lock_guard<std::mutex> lock(size_class.mutex);
+    size_class.free_blocks.push_back(pointer);
+    return true;
+  }
+  if (cache->size() >= thread_cache_size_) {
+    // Move half of the thread-local cache back to the shared free list.
+    uint64_t batch = std::max<uint64_t>(thread_cache_size_ / 2, 1);
+    std::lock_guard<std::mutex> lock(size_class.mutex);
+    size_class.free_blocks.insert(size_class.free_blocks.end(), cache->end() - batch, cache->end());
+    cache->resize(cache->size() - batch);
+  }
+  cache->push_back(pointer);
+  return true;
+}
+
+bool SlabPool::is_available(uint64_t size) const {
+  size_t class_index = find_size_class(size);
+  uint64_t required_bytes = size;
+  if (class_index != kLargeAllocation) {
+    // Blocks cached by the current thread are handed out first by allocate().
+    auto cache = find_thread_cache(class_index);
+    if (cache && !cache->empty()) { return true; }
+    auto& size_class = *size_classes_[class_index];
+    {
+      std::lock_guard<std::mutex> lock(size_class.mutex);
+      if (!size_class.free_blocks.empty()) { return true; }
+    }
+    required_bytes = size_class.block_size * size_class.blocks_per_slab;
+  }
+  return max_bytes_ == 0 || reserved_bytes_.load() + required_bytes <= max_bytes_;
+}
+
+SlabPoolStats SlabPool::stats() const {
+  SlabPoolStats stats;
+  stats.allocations = allocations_.load();
+  stats.large_allocations = large_allocations_.load();
+  stats.thread_cache_hits = thread_cache_hits_.load();
+  stats.failed_allocations = failed_allocations_.load();
+  stats.slabs = slabs_.load();
+  stats.reserved_bytes = reserved_bytes_.load();
+  stats.in_use_blocks = in_use_blocks_.load();
+  stats.in_use_bytes = in_use_bytes_.load();
+  return stats;
+}
+
+uintptr_t SlabPool::find_chunk(uintptr_t address, Chunk& chunk) const {
+  std::shared_lock<std::shared_mutex> lock(chunks_mutex_);
+  auto it = chunks_.upper_bound(address);
+  if (it == chunks_.begin()) { return 0; }
+  --it;
+  if (address >= it->first + it->second.size) { return 0; }
+  chunk = it->second;
+  return it->first;
+}
+
+bool SlabPool::set_block_in_use(void* pointer, bool in_use) {
+  const auto address = reinterpret_cast<uintptr_t>(pointer);
+  Chunk chunk;
+  uintptr_t chunk_address = find_chunk(address, chunk);
+  return set_block_in_use(chunk, address - chunk_address, in_use);
+}
+
+bool SlabPool::set_block_in_use(const Chunk& chunk, uint64_t offset, bool in_use) {
+  const uint64_t block_index = offset / size_classes_[chunk.class_index]->block_size;
+  auto& word = chunk.blocks_in_use[block_index / 64];
+  const uint64_t mask = uint64_t{1} << (block_index % 64);
+  if (in_use) { return (word.fetch_or(mask, std::memory_order_acq_rel) & mask) == 0; }
+  return (word.fetch_and(~mask, std::memory_order_acq_rel) & mask) != 0;
+}
+
+size_t SlabPool::find_size_class(uint64_t size) const {
+  auto it = std::lower_bound(
+      size_classes_.begin(),
+      size_classes_.end(),
+      size,
+      [](const std::unique_ptr<SizeClass>& size_class, uint64_t value) {
+        return size_class->block_size < value;
+      });
+  if (it == size_classes_.end()) { return kLargeAllocation; }
+  return static_cast<size_t>(it - size_classes_.begin());
+}
+
+bool SlabPool::reserve(uint64_t size) {
+  if (max_bytes_ == 0) {
+    reserved_bytes_ += size;
+    return true;
+  }
+  uint64_t reserved = reserved_bytes_.load();
+  do {
+    if (reserved + size > max_bytes_) { return false; }
+  } while (!reserved_bytes_.compare_exchange_weak(reserved, reserved + size));
+  return true;
+}
+
+bool SlabPool::grow(SizeClass& size_class, size_t class_index) {
+  const uint64_t slab_bytes = size_class.block_size * size_class.blocks_per_slab;
+  if (!reserve(slab_bytes)) { return false; }
+  void* slab = allocate_(slab_bytes);
+  if (slab == nullptr) {
+    reserved_bytes_ -= slab_bytes;
+    return false;
+  }
+  {
+    // One bit per block tracks whether it is handed out.
+    const uint64_t num_words = (size_class.blocks_per_slab + 63) / 64;
+    auto blocks_in_use = std::make_unique<std::atomic<uint64_t>[]>(num_words);
+    for (uint64_t index = 0; index < num_words; ++index) { blocks_in_use[index] = 0; }
+    std::unique_lock<std::shared_mutex> lock(chunks_mutex_);
+    chunks_.emplace(reinterpret_cast<uintptr_t>(slab),
+                    Chunk{slab_bytes, class_index, blocks_in_use.get()});
+    blocks_in_use_.push_back(std::move(blocks_in_use));
+  }
+  slabs_++;
+
+  // Push the blocks in reverse order so that they are handed out in address order.
+  auto base = static_cast<uint8_t*>(slab);
+  for (uint64_t index = size_class.blocks_per_slab; index > 0; --index) {
+    size_class.free_blocks.push_back(base + (index - 1) * size_class.block_size);
+  }
+  return true;
+}
+
+void* SlabPool::allocate_large(uint64_t size) {
+  if (!reserve(size)) {
+    failed_allocations_++;
+    return nullptr;
+  }
+  void* pointer = allocate_(size);
+  if (pointer == nullptr) {
+    reserved_bytes_ -= size;
+    failed_allocations_++;
+    return nullptr;
+  }
+  {
+    std::unique_lock<std::shared_mutex> lock(chunks_mutex_);
+    chunks_.emplace(reinterpret_cast<uintptr_t>(pointer), Chunk{size, kLargeAllocation});
+  }
+  large_allocations_++;
+  in_use_blocks_++;
+  in_use_bytes_ += size;
+  return pointer;
+}
+
+std::vector<void*>* SlabPool::thread_cache(size_t class_index) {
+  if (thread_cache_size_ == 0) { return nullptr; }
+  auto cache_blocks = find_thread_cache(class_index);
+  if (cache_blocks) { return cache_blocks; }
+  prune_thread_caches();
+  auto& cache = thread_caches.caches.emplace_back();
+  cache.pool_id = id_;
+  cache.blocks.resize(size_classes_.size());
+  cache.release = [this](std::vector<std::vector<void*>>& blocks) {
+    for (size_t index = 0; index < blocks.size(); ++index) {
+      auto& size_class = *size_classes_[index];
+      std::lock_guard<std::mutex> lock(size_class.mutex);
+      size_class.free_blocks.insert(
+          size_class.free_blocks.end(), blocks[index].begin(), blocks[index].end());
+      blocks[index].clear();
+    }
+  };
+  return &cache.blocks[class_index];
+}
+
+std::vector<void*>* SlabPool::find_thread_cache(size_t class_index) const {
+  if (thread_cache_size_ == 0) { return nullptr; }
+  for (auto& cache : thread_caches.caches) {
+    if (cache.pool_id == id_) { return &cache.blocks[class_index]; }
+  }
+  return nullptr;
+}
+
+}  // namespace holoscan
@@ -0,0 +1,74 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "holoscan/core/resources/gxf/spsc_ring_buffer.hpp"
+
+#include "holoscan/logger/logger.hpp"
+
+namespace holoscan {
+
+SpscEntityRingBuffer::SpscEntityRingBuffer(gxf_context_t context, size_t capacity,
+                                           uint64_t policy)
+    : context_(context), policy_(static_cast<OverflowPolicy>(policy)), buffer_(capacity) {}
+
+SpscEntityRingBuffer::~SpscEntityRingBuffer() {
+  gxf_uid_t uid = kNullUid;
+  while (buffer_.pop(uid)) { GxfEntityRefCountDec(context_, uid); }
+}
+
+gxf_result_t SpscEntityRingBuffer::push(gxf_uid_t uid, const char* name) {
+  const gxf_result_t code = GxfEntityRefCountInc(context_, uid);
+  if (code != GXF_SUCCESS) { return code; }
+
+  if (buffer_.push(uid)) { return GXF_SUCCESS; }
+
+  switch (policy_) {
+    case OverflowPolicy::kPop: {
+      // Only this thread appends, so there is room once the oldest entity is gone (either evicted
+      // here or popped by the consumer in the meantime).
+      gxf_uid_t oldest = kNullUid;
+      if (buffer_.evict(oldest)) { GxfEntityRefCountDec(context_, oldest); }
+      if (buffer_.push(uid)) { return GXF_SUCCESS; }
+      break;
+    }
+    case OverflowPolicy::kReject:
+      HOLOSCAN_LOG_DEBUG("Ring buffer '{}' is full. Rejecting the new message.", name);
+      GxfEntityRefCountDec(context_, uid);
+      return GXF_SUCCESS;
+    case OverflowPolicy::kFault:
+    default:
+      break;
+  }
+
+  HOLOSCAN_LOG_WARN("Push failed on '{}': ring buffer is full (capacity: {})", name, capacity());
+  GxfEntityRefCountDec(context_, uid);
+  return GXF_EXCEEDING_PREALLOCATED_SIZE;
+}
+
+gxf_result_t SpscEntityRingBuffer::pop(gxf_uid_t* uid) {
+  if (uid == nullptr) { return GXF_ARGUMENT_NULL; }
+  if (!buffer_.pop(*uid)) { return GXF_FAILURE; }
+  return GXF_SUCCESS;
+}
+
+gxf_result_t SpscEntityRingBuffer::peek(gxf_uid_t* uid, int32_t index) {
+  if (uid == nullptr) { return GXF_ARGUMENT_NULL; }
+  if (index < 0 || !buffer_.peek(static_cast<size_t>(index), *uid)) { return GXF_FAILURE; }
+  return GXF_SUCCESS;
+}
+
+}  // namespace holoscan
@@ -0,0 +1,83 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "holoscan/core/resources/gxf/spsc_ring_buffer_transmitter.hpp"
+
+#include <memory>
+
+#include "holoscan/logger/logger.hpp"
+
+namespace holoscan {
+
+gxf_result_t SpscRingBufferTransmitter::registerInterface(nvidia::gxf::Registrar* registrar) {
+  nvidia::gxf::Expected<void> result;
+  result &= registrar->parameter(capacity_, "capacity", "Capacity", "", 1UL);
+  result &= registrar->parameter(policy_, "policy", "Policy", "0: pop, 1: reject, 2: fault", 2UL);
+  return nvidia::gxf::ToResultCode(result);
+}
+
+gxf_result_t SpscRingBufferTransmitter::initialize() {
+  if (capacity_.get() == 0) {
+    HOLOSCAN_LOG_ERROR("SpscRingBufferTransmitter '{}': capacity must be greater than 0", name());
+    return GXF_ARGUMENT_OUT_OF_RANGE;
+  }
+  queue_ = std::make_unique<SpscEntityRingBuffer>(context(), capacity_.get(), policy_.get());
+  return GXF_SUCCESS;
+}
+
+gxf_result_t SpscRingBufferTransmitter::deinitialize() {
+  queue_.reset();
+  return GXF_SUCCESS;
+}
+
+gxf_result_t SpscRingBufferTransmitter::pop_abi(gxf_uid_t* uid) {
+  if (queue_ == nullptr) { return GXF_ARGUMENT_NULL; }
+  return queue_->pop(uid);
+}
+
+gxf_result_t SpscRingBufferTransmitter::push_abi(gxf_uid_t other) {
+  if (queue_ == nullptr) { return GXF_ARGUMENT_NULL; }
+  return queue_->push(other, name());
+}
+
+gxf_result_t SpscRingBufferTransmitter::peek_abi(gxf_uid_t* uid, int32_t index) {
+  if (queue_ == nullptr) { return GXF_ARGUMENT_NULL; }
+  return queue_->peek(uid, index);
+}
+
+size_t SpscRingBufferTransmitter::capacity_abi() {
+  return queue_ ? queue_->capacity() : 0;
+}
+
+size_t SpscRingBufferTransmitter::size_abi() {
+  return queue_ ? queue_->size() : 0;
+}
+
+gxf_result_t SpscRingBufferTransmitter::publish_abi(gxf_uid_t uid) {
+  return push_abi(uid);
+}
+
+size_t SpscRingBufferTransmitter::back_size_abi() {
+  // Published messages are visible right away, so there is never anything in a back stage.
+  return 0;
+}
+
+gxf_result_t SpscRingBufferTransmitter::sync_abi() {
+  return GXF_SUCCESS;
+}
+
+}  // namespace holoscan
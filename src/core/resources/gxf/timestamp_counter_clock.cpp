@@ -0,0 +1,65 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "holoscan/core/resources/gxf/timestamp_counter_clock.hpp"
+
+#include <time.h>
+
+#include <cerrno>
+
+#include "holoscan/core/system/tsc_counter.hpp"
+#include "holoscan/logger/logger.hpp"
+
+namespace holoscan {
+
+TimestampCounterClock::TimestampCounterClock() : counter_(&TscCounter::instance()) {}
+
+gxf_result_t TimestampCounterClock::initialize() {
+  HOLOSCAN_LOG_DEBUG("TimestampCounterClock '{}': using '{}' ({:.3f} MHz)",
+                     name(),
+                     counter_->source_name(),
+                     counter_->frequency_hz() / 1e6);
+  return GXF_SUCCESS;
+}
+
+double TimestampCounterClock::time() const {
+  return static_cast<double>(timestamp()) / 1e9;
+}
+
+int64_t TimestampCounterClock::timestamp() const {
+  return counter_->now_ns();
+}
+
+nvidia::gxf::Expected<void> TimestampCounterClock::sleepFor(int64_t duration_ns) {
+  return sleepUntil(timestamp() + duration_ns);
+}
+
+nvidia::gxf::Expected<void> TimestampCounterClock::sleepUntil(int64_t target_time_ns) {
+  // The calibrated counter may lag CLOCK_MONOTONIC slightly: sleep again for the remainder
+  int64_t remaining_ns = target_time_ns - timestamp();
+  while (remaining_ns > 0) {
+    const int64_t wake_up_ns = TscCounter::monotonic_ns() + remaining_ns;
+    timespec target{};
+    target.tv_sec = wake_up_ns / 1000000000LL;
+    target.tv_nsec = wake_up_ns % 1000000000LL;
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &target, nullptr) == EINTR) {}
+    remaining_ns = target_time_ns - timestamp();
+  }
+  return nvidia::gxf::Success;
+}
+
+}  // namespace holoscan
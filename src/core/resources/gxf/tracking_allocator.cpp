@@ -0,0 +1,61 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "holoscan/core/resources/gxf/tracking_allocator.hpp"
+
+#include <chrono>
+
+#include "holoscan/logger/logger.hpp"
+
+namespace holoscan {
+
+gxf_result_t TrackingAllocator::registerInterface(nvidia::gxf::Registrar* registrar) {
+  nvidia::gxf::Expected<void> result;
+  result &= registrar->parameter(
+      allocator_, "allocator", "Allocator", "Allocator whose allocations are recorded");
+  return nvidia::gxf::ToResultCode(result);
+}
+
+gxf_result_t TrackingAllocator::deinitialize() {
+  HOLOSCAN_LOG_DEBUG("{}", tracker_.report(name()));
+  return GXF_SUCCESS;
+}
+
+gxf_result_t TrackingAllocator::is_available_abi(uint64_t size) {
+  return allocator_.get()->is_available_abi(size);
+}
+
+gxf_result_t TrackingAllocator::allocate_abi(uint64_t size, int32_t type, void** pointer) {
+  if (pointer == nullptr) { return GXF_ARGUMENT_NULL; }
+  const auto start = std::chrono::steady_clock::now();
+  const gxf_result_t code = allocator_.get()->allocate_abi(size, type, pointer);
+  const auto latency = std::chrono::steady_clock::now() - start;
+  if (code == GXF_SUCCESS) {
+    tracker_.record_allocation(*pointer, size, latency);
+  } else {
+    tracker_.record_failure(size, latency);
+  }
+  return code;
+}
+
+gxf_result_t TrackingAllocator::free_abi(void* pointer) {
+  // Record the release first: the pointer may be handed out again as soon as it is freed.
+  tracker_.record_free(pointer);
+  return allocator_.get()->free_abi(pointer);
+}
+
+}  // namespace holoscan
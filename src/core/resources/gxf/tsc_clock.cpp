@@ -0,0 +1,64 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "holoscan/core/resources/gxf/tsc_clock.hpp"
+
+#include <string>
+
+#include "holoscan/core/resources/gxf/timestamp_counter_clock.hpp"
+#include "holoscan/core/system/tsc_counter.hpp"
+
+namespace holoscan {
+
+TscClock::TscClock(const std::string& name, TimestampCounterClock* component)
+    : Clock(name, component) {}
+
+double TscClock::time() const {
+  if (gxf_cptr_) { return static_cast<TimestampCounterClock*>(gxf_cptr_)->time(); }
+  return 0.0;
+}
+
+int64_t TscClock::timestamp() const {
+  if (gxf_cptr_) { return static_cast<TimestampCounterClock*>(gxf_cptr_)->timestamp(); }
+  return 0;
+}
+
+void TscClock::sleep_for(int64_t duration_ns) {
+  if (gxf_cptr_) {
+    static_cast<TimestampCounterClock*>(gxf_cptr_)->sleepFor(duration_ns);
+  } else {
+    HOLOSCAN_LOG_ERROR("TscClock component not yet registered with GXF");
+  }
+}
+
+void TscClock::sleep_until(int64_t target_time_ns) {
+  if (gxf_cptr_) {
+    static_cast<TimestampCounterClock*>(gxf_cptr_)->sleepUntil(target_time_ns);
+  } else {
+    HOLOSCAN_LOG_ERROR("TscClock component not yet registered with GXF");
+  }
+}
+
+std::string TscClock::source() const {
+  return TscCounter::instance().source_name();
+}
+
+double TscClock::frequency_hz() const {
+  return TscCounter::instance().frequency_hz();
+}
+
+}  // namespace holoscan
@@ -0,0 +1,64 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "holoscan/core/resources/gxf/ucx_coalescing_transmitter.hpp"
+
+#include <string>
+
+#include "holoscan/core/component_spec.hpp"
+#include "holoscan/core/gxf/gxf_resource.hpp"
+
+namespace holoscan {
+
+UcxCoalescingTransmitter::UcxCoalescingTransmitter(const std::string& name,
+                                                   nvidia::gxf::Transmitter* component)
+    : UcxTransmitter(name, component) {
+  int64_t coalescing_window_us = 0;
+  HOLOSCAN_GXF_CALL_FATAL(GxfParameterGetInt64(
+      gxf_context_, gxf_cid_, "coalescing_window_us", &coalescing_window_us));
+  coalescing_window_us_ = coalescing_window_us;
+  uint64_t max_batch_size = 0;
+  HOLOSCAN_GXF_CALL_FATAL(
+      GxfParameterGetUInt64(gxf_context_, gxf_cid_, "max_batch_size", &max_batch_size));
+  max_batch_size_ = max_batch_size;
+}
+
+void UcxCoalescingTransmitter::setup(ComponentSpec& spec) {
+  HOLOSCAN_LOG_DEBUG("UcxCoalescingTransmitter::setup");
+  UcxTransmitter::setup(spec);
+  spec.param(coalescing_window_us_,
+             "coalescing_window_us",
+             "Coalescing window",
+             "Maximum time (in microseconds) a message is queued to be coalesced with the next "
+             "ones.",
+             kDefaultUcxCoalescingWindowUs);
+  spec.param(max_batch_size_,
+             "max_batch_size",
+             "Maximum batch size",
+             "Maximum number of messages coalesced into a single send.",
+             kDefaultUcxMaxBatchSize);
+}
+
+int64_t UcxCoalescingTransmitter::coalescing_window_us() {
+  return coalescing_window_us_.get();
+}
+
+uint64_t UcxCoalescingTransmitter::max_batch_size() {
+  return max_batch_size_.get();
+}
+
+}  // namespace holoscan
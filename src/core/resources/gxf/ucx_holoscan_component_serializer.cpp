@@ -17,15 +17,62 @@
 
 #include "holoscan/core/resources/gxf/ucx_holoscan_component_serializer.hpp"
 
+#include <cstdlib>
+#include <string>
+#include <type_traits>
+
 #include "holoscan/core/component_spec.hpp"
 #include "holoscan/core/fragment.hpp"
+#include "holoscan/core/payload_compression.hpp"
+#include "holoscan/core/resources/gxf/recycling_allocator.hpp"
 #include "holoscan/core/resources/gxf/unbounded_allocator.hpp"
 
 namespace holoscan {
 
+namespace {
+
+template <typename T>
+T get_env_value(const char* name, T default_value) {
+  const char* env_value = std::getenv(name);
+  if (env_value == nullptr) { return default_value; }
+  try {
+    if constexpr (std::is_same_v<T, std::string>) {
+      return std::string(env_value);
+    } else if constexpr (std::is_signed_v<T>) {
+      return static_cast<T>(std::stoll(env_value));
+    } else {
+      return static_cast<T>(std::stoull(env_value));
+    }
+  } catch (std::exception& e) {
+    HOLOSCAN_LOG_WARN("Unable to interpret environment variable '{}': '{}'", name, e.what());
+  }
+  return default_value;
+}
+
+}  // namespace
+
 void UcxHoloscanComponentSerializer::setup(ComponentSpec& spec) {
   HOLOSCAN_LOG_DEBUG("UcxHoloscanComponentSerializer::setup");
   spec.param(allocator_, "allocator", "Memory allocator", "Memory allocator for tensor components");
+  spec.param(compression_,
+             "compression",
+             "Compression algorithm",
+             "Compression of host tensors and message data ('none', 'lz4' or 'zstd'; 'none' by "
+             "default unless HOLOSCAN_UCX_COMPRESSION is defined)",
+             get_env_value<std::string>("HOLOSCAN_UCX_COMPRESSION", "none"));
+  spec.param(compression_level_,
+             "compression_level",
+             "Compression level",
+             "Compression level (0 for the default level of the algorithm unless "
+             "HOLOSCAN_UCX_COMPRESSION_LEVEL is defined)",
+             get_env_value<int32_t>("HOLOSCAN_UCX_COMPRESSION_LEVEL", 0));
+  spec.param(compression_min_size_,
+             "compression_min_size",
+             "Compression minimum size",
+             "Minimum size in bytes of the payloads that are compressed (65536 by default unless "
+             "HOLOSCAN_UCX_COMPRESSION_MIN_SIZE is defined)",
+             get_env_value<uint64_t>("HOLOSCAN_UCX_COMPRESSION_MIN_SIZE",
+                                     PayloadCompression::kDefaultMinSize));
 }
 
 void UcxHoloscanComponentSerializer::initialize() {
@@ -36,10 +83,20 @@ void UcxHoloscanComponentSerializer::initialize() {
   // Find if there is an argument for 'allocator'
   auto has_allocator = std::find_if(
       args().begin(), args().end(), [](const auto& arg) { return (arg.name() == "allocator"); });
-  // Create an UnboundedAllocator if no allocator was provided
+  // Create an UnboundedAllocator if no allocator was provided. The buffers of the received
+  // tensors are recycled unless HOLOSCAN_UCX_RECEIVE_BUFFER_POOL_SIZE is 0.
   if (has_allocator == args().end()) {
     auto allocator = frag->make_resource<UnboundedAllocator>("allocator");
-    add_arg(Arg("allocator") = allocator);
+    uint64_t pool_size = get_env_value<uint64_t>("HOLOSCAN_UCX_RECEIVE_BUFFER_POOL_SIZE",
+                                                 kDefaultUcxReceiveBufferPoolSize);
+    if (pool_size > 0) {
+      add_arg(Arg("allocator") =
+                  frag->make_resource<RecyclingAllocator>("receive_buffer_pool",
+                                                          Arg("allocator") = allocator,
+                                                          Arg("max_buffers_per_size", pool_size)));
+    } else {
+      add_arg(Arg("allocator") = allocator);
+    }
   }
   GXFResource::initialize();
 }
@@ -0,0 +1,329 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "holoscan/core/schedulers/communication_aware_fragment_allocation.hpp"
+
+#include <algorithm>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include "holoscan/logger/logger.hpp"
+
+namespace holoscan {
+
+namespace {
+
+/// Maximum number of improvement rounds (moves and swaps) applied to the initial placement
+constexpr int kMaxImprovementRounds = 100;
+/// Minimum cost reduction for a move or a swap to be applied
+constexpr double kMinCostReduction = 1e-6;
+
+/// Return the host (IP address) of an app worker id ('<ip>:<port>')
+std::string worker_host(const std::string& app_worker_id) {
+  auto pos = app_worker_id.rfind(':');
+  return pos == std::string::npos ? app_worker_id : app_worker_id.substr(0, pos);
+}
+
+double worker_distance(const std::string& a, const std::string& b) {
+  if (a == b) { return 0.0; }
+  if (worker_host(a) == worker_host(b)) {
+    return CommunicationAwareFragmentAllocationStrategy::kSameHostCostFactor;
+  }
+  return 1.0;
+}
+
+/// Fragments placed on app workers without target fragments
+class Placement {
+ public:
+  Placement(const std::unordered_map<std::string, AvailableSystemResource>& available_resources,
+            const std::unordered_map<std::string, SystemResourceRequirement>& requirements,
+            uint32_t max_fragments_per_worker,
+            std::unordered_map<std::string, std::string>& schedule)
+      : available_resources_(available_resources),
+        requirements_(requirements),
+        max_fragments_per_worker_(max_fragments_per_worker),
+        schedule_(schedule) {}
+
+  /// Number of fragments on the worker, not counting `excluded_fragment`
+  uint32_t fragment_count(const std::string& app_worker_id,
+                          const std::string& excluded_fragment = "") const {
+    uint32_t count = 0;
+    for (const auto& [fragment_name, worker_id] : schedule_) {
+      if (worker_id == app_worker_id && fragment_name != excluded_fragment) { ++count; }
+    }
+    return count;
+  }
+
+  /// Whether the fragment can be added to the worker if `excluded_fragment` is moved out of it
+  bool can_host(const std::string& app_worker_id, const std::string& fragment_name,
+                const std::string& excluded_fragment = "") const {
+    const auto& worker = available_resources_.at(app_worker_id);
+    const auto& requirement = requirements_.at(fragment_name);
+    if (!worker.has_enough_resources(requirement)) { return false; }
+
+    uint32_t count = 1;
+    double cpu = std::max(requirement.cpu, 0.0f);
+    uint64_t memory = requirement.memory;
+    uint64_t shared_memory = requirement.shared_memory;
+    uint64_t gpu_memory = requirement.gpu_memory;
+    for (const auto& [other_name, worker_id] : schedule_) {
+      if (worker_id != app_worker_id || other_name == fragment_name ||
+          other_name == excluded_fragment) {
+        continue;
+      }
+      const auto& other = requirements_.at(other_name);
+      ++count;
+      cpu += std::max(other.cpu, 0.0f);
+      memory += other.memory;
+      shared_memory += other.shared_memory;
+      gpu_memory += other.gpu_memory;
+    }
+    if (count > max_fragments_per_worker_) { return false; }
+    if (count == 1) { return true; }
+    // Co-located fragments share the CPUs and the memory of the worker (GPUs can be shared).
+    return (cpu <= 0 || worker.cpu >= cpu) && (memory == 0 || worker.memory >= memory) &&
+           (shared_memory == 0 || worker.shared_memory >= shared_memory) &&
+           (gpu_memory == 0 || worker.gpu_memory >= gpu_memory);
+  }
+
+ private:
+  const std::unordered_map<std::string, AvailableSystemResource>& available_resources_;
+  const std::unordered_map<std::string, SystemResourceRequirement>& requirements_;
+  uint32_t max_fragments_per_worker_;
+  std::unordered_map<std::string, std::string>& schedule_;
+};
+
+}  // namespace
+
+CommunicationAwareFragmentAllocationStrategy::CommunicationAwareFragmentAllocationStrategy(
+    uint32_t max_fragments_per_worker)
+    : max_fragments_per_worker_(std::max<uint32_t>(max_fragments_per_worker, 1)) {}
+
+void CommunicationAwareFragmentAllocationStrategy::on_add_available_resource(
+    const AvailableSystemResource& available_resource) {
+  greedy_strategy_.add_available_resource(available_resource);
+}
+
+void CommunicationAwareFragmentAllocationStrategy::on_add_resource_requirement(
+    const SystemResourceRequirement& resource_requirement) {
+  greedy_strategy_.add_resource_requirement(resource_requirement);
+}
+
+CommunicationAwareFragmentAllocationStrategy::Bandwidths
+CommunicationAwareFragmentAllocationStrategy::bandwidths() const {
+  Bandwidths result;
+  for (const auto& connection : connection_requirements_) {
+    if (connection.source_fragment == connection.target_fragment) { continue; }
+    const auto bandwidth = static_cast<double>(connection.bandwidth);
+    result[connection.source_fragment][connection.target_fragment] += bandwidth;
+    result[connection.target_fragment][connection.source_fragment] += bandwidth;
+  }
+  return result;
+}
+
+double CommunicationAwareFragmentAllocationStrategy::communication_cost(
+    const std::unordered_map<std::string, std::string>& schedule) const {
+  double cost = 0.0;
+  for (const auto& connection : connection_requirements_) {
+    auto source = schedule.find(connection.source_fragment);
+    auto target = schedule.find(connection.target_fragment);
+    if (source == schedule.end() || target == schedule.end()) { continue; }
+    cost += static_cast<double>(connection.bandwidth) *
+            worker_distance(source->second, target->second);
+  }
+  return cost;
+}
+
+holoscan::expected<std::unordered_map<std::string, std::string>, std::string>
+CommunicationAwareFragmentAllocationStrategy::schedule() {
+  HOLOSCAN_LOG_DEBUG("CommunicationAwareFragmentAllocationStrategy::schedule()");
+
+  auto greedy_result = greedy_strategy_.schedule();
+  const auto bandwidth = bandwidths();
+
+  std::unordered_map<std::string, std::string> schedule;
+  Placement placement(
+      available_resources_, resource_requirements_, max_fragments_per_worker_, schedule);
+
+  // Sort the workers (by id) and the fragments (by name) for a deterministic result.
+  std::vector<const AvailableSystemResource*> targeted_workers;
+  std::vector<std::string> workers;
+  for (const auto& [app_worker_id, available_resource] : available_resources_) {
+    if (available_resource.target_fragments.empty()) {
+      workers.push_back(app_worker_id);
+    } else {
+      targeted_workers.push_back(&available_resource);
+    }
+  }
+  std::sort(workers.begin(), workers.end());
+  std::sort(targeted_workers.begin(),
+            targeted_workers.end(),
+            [](const AvailableSystemResource* a, const AvailableSystemResource* b) {
+              return std::make_tuple(b->target_fragments.size(), a->app_worker_id) <
+                     std::make_tuple(a->target_fragments.size(), b->app_worker_id);
+            });
+
+  // Workers with target fragments run all of them (workers with more target fragments first).
+  for (const auto* worker : targeted_workers) {
+    bool is_schedulable = true;
+    for (const auto& fragment_name : worker->target_fragments) {
+      auto requirement = resource_requirements_.find(fragment_name);
+      if (requirement == resource_requirements_.end() || schedule.count(fragment_name) > 0 ||
+          !worker->has_enough_resources(requirement->second)) {
+        is_schedulable = false;
+        break;
+      }
+    }
+    if (!is_schedulable) { continue; }
+    for (const auto& fragment_name : worker->target_fragments) {
+      schedule[fragment_name] = worker->app_worker_id;
+    }
+  }
+
+  std::vector<std::string> movable_fragments;
+  for (const auto& [fragment_name, requirement] : resource_requirements_) {
+    if (schedule.count(fragment_name) == 0) { movable_fragments.push_back(fragment_name); }
+  }
+  std::sort(movable_fragments.begin(), movable_fragments.end());
+
+  auto fragment_bandwidth = [&bandwidth](const std::string& a, const std::string& b) {
+    auto loc = bandwidth.find(a);
+    if (loc == bandwidth.end()) { return 0.0; }
+    auto loc2 = loc->second.find(b);
+    return loc2 == loc->second.end() ? 0.0 : loc2->second;
+  };
+  auto total_bandwidth = [&bandwidth](const std::string& fragment_name) {
+    double total = 0.0;
+    auto loc = bandwidth.find(fragment_name);
+    if (loc != bandwidth.end()) {
+      for (const auto& [other_name, value] : loc->second) { total += value; }
+    }
+    return total;
+  };
+
+  // Place the fragment exchanging the most data with the placed fragments first, on the worker
+  // minimizing its traffic with the other workers (preferring the least loaded worker).
+  std::vector<std::string> unplaced = movable_fragments;
+  bool is_placed = true;
+  while (!unplaced.empty()) {
+    auto best_fragment = unplaced.begin();
+    std::tuple<double, double> best_key{-1.0, -1.0};
+    for (auto it = unplaced.begin(); it != unplaced.end(); ++it) {
+      double placed_bandwidth = 0.0;
+      for (const auto& [fragment_name, worker_id] : schedule) {
+        placed_bandwidth += fragment_bandwidth(*it, fragment_name);
+      }
+      std::tuple<double, double> key{placed_bandwidth, total_bandwidth(*it)};
+      if (key > best_key) {
+        best_key = key;
+        best_fragment = it;
+      }
+    }
+    const std::string fragment_name = *best_fragment;
+    unplaced.erase(best_fragment);
+
+    const std::string* best_worker = nullptr;
+    std::tuple<double, uint32_t> best_cost;
+    for (const auto& worker_id : workers) {
+      if (!placement.can_host(worker_id, fragment_name)) { continue; }
+      double cost = 0.0;
+      for (const auto& [other_name, other_worker_id] : schedule) {
+        cost += fragment_bandwidth(fragment_name, other_name) *
+                worker_distance(worker_id, other_worker_id);
+      }
+      std::tuple<double, uint32_t> worker_cost{cost, placement.fragment_count(worker_id)};
+      if (best_worker == nullptr || worker_cost < best_cost) {
+        best_worker = &worker_id;
+        best_cost = worker_cost;
+      }
+    }
+    if (best_worker == nullptr) {
+      HOLOSCAN_LOG_DEBUG("No app worker can run fragment '{}'", fragment_name);
+      is_placed = false;
+      break;
+    }
+    schedule[fragment_name] = *best_worker;
+  }
+
+  if (!is_placed) {
+    HOLOSCAN_LOG_DEBUG("Using the greedy fragment allocation");
+    return greedy_result;
+  }
+
+  // Apply moves and swaps while they reduce the traffic between workers.
+  double cost = communication_cost(schedule);
+  bool is_improved = true;
+  for (int round = 0; is_improved && round < kMaxImprovementRounds; ++round) {
+    is_improved = false;
+    for (const auto& fragment_name : movable_fragments) {
+      for (const auto& worker_id : workers) {
+        std::string current_worker_id = schedule[fragment_name];
+        if (worker_id == current_worker_id || !placement.can_host(worker_id, fragment_name)) {
+          continue;
+        }
+        schedule[fragment_name] = worker_id;
+        double new_cost = communication_cost(schedule);
+        if (new_cost + kMinCostReduction < cost) {
+          cost = new_cost;
+          is_improved = true;
+        } else {
+          schedule[fragment_name] = current_worker_id;
+        }
+      }
+    }
+    for (size_t i = 0; i < movable_fragments.size(); ++i) {
+      for (size_t j = i + 1; j < movable_fragments.size(); ++j) {
+        const auto& a = movable_fragments[i];
+        const auto& b = movable_fragments[j];
+        std::string a_worker_id = schedule[a];
+        std::string b_worker_id = schedule[b];
+        if (a_worker_id == b_worker_id || !placement.can_host(b_worker_id, a, b) ||
+            !placement.can_host(a_worker_id, b, a)) {
+          continue;
+        }
+        schedule[a] = b_worker_id;
+        schedule[b] = a_worker_id;
+        double new_cost = communication_cost(schedule);
+        if (new_cost + kMinCostReduction < cost) {
+          cost = new_cost;
+          is_improved = true;
+        } else {
+          schedule[a] = a_worker_id;
+          schedule[b] = b_worker_id;
+        }
+      }
+    }
+  }
+
+  if (greedy_result) {
+    double greedy_cost = communication_cost(greedy_result.value());
+    HOLOSCAN_LOG_DEBUG("Traffic between app workers: {} B/s (greedy allocation: {} B/s)",
+                       cost,
+                       greedy_cost);
+    if (greedy_cost <= cost) { return greedy_result; }
+  }
+
+  for (const auto& [fragment_name, app_worker_id] : schedule) {
+    HOLOSCAN_LOG_DEBUG(
+        "fragment '{}' is scheduled on app worker '{}'", fragment_name, app_worker_id);
+  }
+  return schedule;
+}
+
+}  // namespace holoscan
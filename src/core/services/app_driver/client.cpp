@@ -25,6 +25,8 @@
 
 #include "../generated/error_code.pb.h"
 #include "holoscan/core/app_worker.hpp"
+#include "holoscan/core/codec_registry.hpp"
+#include "holoscan/core/payload_compression.hpp"
 #include "holoscan/core/fragment.hpp"
 #include "holoscan/logger/logger.hpp"
 
@@ -46,6 +48,16 @@ bool AppDriverClient::fragment_allocation(const std::string& worker_port,
   // Adding fragment names
   for (const auto& fragment : target_fragments) { request.add_fragment_names(fragment->name()); }
 
+  // Adding codec names (used by the driver to build the codec table)
+  for (const auto& codec_name : CodecRegistry::get_instance().codec_names()) {
+    request.add_codec_names(codec_name);
+  }
+
+  // Adding the compression algorithms (negotiated by the driver, none unless requested)
+  for (const auto& algorithm : PayloadCompression::requested_algorithms()) {
+    request.add_compression_algorithms(algorithm);
+  }
+
   // Creating AvailableSystemResource and adding it to the request
 
   float cpu_memory = cpuinfo.memory_total / 1024 / 1024 / 1024;         /// convert to GiB
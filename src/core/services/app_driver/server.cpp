@@ -18,6 +18,7 @@
 #include "holoscan/core/services/app_driver/server.hpp"
 
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -109,6 +110,9 @@ void AppDriverServer::notify() {
 
 std::unique_ptr<AppWorkerClient>& AppDriverServer::connect_to_worker(
     const std::string& worker_address) {
+  // The returned reference stays valid after the lock is released: elements of an unordered_map
+  // are not moved by a rehash.
+  std::lock_guard<std::mutex> lock(worker_clients_mutex_);
   auto it = worker_clients_.find(worker_address);
   if (it == worker_clients_.end()) {
     auto client = std::make_unique<AppWorkerClient>(
@@ -122,7 +126,11 @@ std::unique_ptr<AppWorkerClient>& AppDriverServer::connect_to_worker(
 
 bool AppDriverServer::close_worker_connection(const std::string& worker_address) {
   // Close the connection by removing the client
-  std::size_t num_erased = worker_clients_.erase(worker_address);
+  std::size_t num_erased = 0;
+  {
+    std::lock_guard<std::mutex> lock(worker_clients_mutex_);
+    num_erased = worker_clients_.erase(worker_address);
+  }
   if (num_erased > 0) {
     HOLOSCAN_LOG_INFO("Closed connection to worker {}", worker_address);
     return true;
@@ -134,6 +142,7 @@ bool AppDriverServer::close_worker_connection(const std::string& worker_address)
 
 std::vector<std::string> AppDriverServer::get_worker_addresses() const {
   std::vector<std::string> worker_addresses;
+  std::lock_guard<std::mutex> lock(worker_clients_mutex_);
   for (const auto& [worker_address, _] : worker_clients_) {
     worker_addresses.emplace_back(worker_address);
   }
@@ -141,6 +150,7 @@ std::vector<std::string> AppDriverServer::get_worker_addresses() const {
 }
 
 std::size_t AppDriverServer::num_worker_connections() const {
+  std::lock_guard<std::mutex> lock(worker_clients_mutex_);
   return worker_clients_.size();
 }
 
@@ -19,6 +19,7 @@
 
 #include <cstdint>
 #include <string>
+#include <vector>
 
 #include "holoscan/core/app_driver.hpp"
 #include "holoscan/logger/logger.hpp"
@@ -98,6 +99,13 @@ grpc::Status AppDriverServiceImpl::AllocateFragments(
 
   // Store the worker address, the fragment names, and resources in the app_driver_.
   store_worker_info(worker_address, fragment_names, resource);
+  app_driver_->store_worker_codec_names(
+      worker_address,
+      std::vector<std::string>(request->codec_names().begin(), request->codec_names().end()));
+  app_driver_->store_worker_compression_algorithms(
+      worker_address,
+      std::vector<std::string>(request->compression_algorithms().begin(),
+                               request->compression_algorithms().end()));
 
   // Construct a response.
   holoscan::service::Result* result = new holoscan::service::Result();
@@ -78,9 +78,16 @@ bool AppWorkerClient::fragment_execution(
     const std::vector<std::shared_ptr<Fragment>>& fragments,
     const std::unordered_map<std::shared_ptr<Fragment>,
                              std::vector<std::shared_ptr<holoscan::ConnectionItem>>>&
-        connection_map) {
+        connection_map,
+    const std::vector<std::string>& codec_table,
+    const std::vector<std::string>& compression_algorithms) {
   holoscan::service::FragmentExecutionRequest request;
 
+  for (const auto& codec_name : codec_table) { request.add_codec_table(codec_name); }
+  for (const auto& algorithm : compression_algorithms) {
+    request.add_compression_algorithms(algorithm);
+  }
+
   for (const auto& fragment : fragments) {
     if (connection_map.find(fragment) != connection_map.end()) {
       auto& connections = connection_map.at(fragment);
@@ -108,9 +115,19 @@ bool AppWorkerClient::fragment_execution(
           case IOSpec::ConnectorType::kUCX:
             connection_item->set_connector_type(holoscan::service::ConnectorType::UCX);
             break;
+          case IOSpec::ConnectorType::kRingBuffer:
+            connection_item->set_connector_type(holoscan::service::ConnectorType::RING_BUFFER);
+            break;
+          case IOSpec::ConnectorType::kConflating:
+            connection_item->set_connector_type(holoscan::service::ConnectorType::CONFLATING);
+            break;
+          case IOSpec::ConnectorType::kSharedMemory:
+            connection_item->set_connector_type(holoscan::service::ConnectorType::SHARED_MEMORY);
+            break;
         }
 
-        // Currently supporting only arguments for UCX connector (rx_address, address, port)
+        // Currently supporting only arguments for UCX connector (rx_address, address, port) and
+        // shared memory connector (segment_name)
         for (auto& arg : connection->args) {
           holoscan::service::ConnectorArg* connector_arg = connection_item->add_args();
 
@@ -49,7 +49,9 @@ class AppWorkerClient {
       const std::vector<std::shared_ptr<Fragment>>& fragments,
       const std::unordered_map<std::shared_ptr<Fragment>,
                                std::vector<std::shared_ptr<holoscan::ConnectionItem>>>&
-          connection_map);
+          connection_map,
+      const std::vector<std::string>& codec_table = {},
+      const std::vector<std::string>& compression_algorithms = {});
 
   bool terminate_worker(AppWorkerTerminationCode code);
 
@@ -23,6 +23,8 @@
 #include <vector>
 
 #include "holoscan/core/app_driver.hpp"
+#include "holoscan/core/codec_registry.hpp"
+#include "holoscan/core/payload_compression.hpp"
 #include "holoscan/core/system/network_utils.hpp"
 #include "holoscan/logger/logger.hpp"
 
@@ -99,6 +101,15 @@ grpc::Status AppWorkerServiceImpl::ExecuteFragments(
         case holoscan::service::ConnectorType::UCX:
           connector_type = IOSpec::ConnectorType::kUCX;
           break;
+        case holoscan::service::ConnectorType::RING_BUFFER:
+          connector_type = IOSpec::ConnectorType::kRingBuffer;
+          break;
+        case holoscan::service::ConnectorType::CONFLATING:
+          connector_type = IOSpec::ConnectorType::kConflating;
+          break;
+        case holoscan::service::ConnectorType::SHARED_MEMORY:
+          connector_type = IOSpec::ConnectorType::kSharedMemory;
+          break;
         default:
           HOLOSCAN_LOG_ERROR("Unsupported connector type: {}", connection_item.connector_type());
           return grpc::Status::CANCELLED;
@@ -135,6 +146,18 @@ grpc::Status AppWorkerServiceImpl::ExecuteFragments(
     HOLOSCAN_LOG_DEBUG("");
   }
 
+  // Setting the codec table (messages with a codec in the table are sent with the codec id)
+  std::vector<std::string> codec_table(request->codec_table().begin(),
+                                       request->codec_table().end());
+  HOLOSCAN_LOG_DEBUG("Codec table: {} codecs", codec_table.size());
+  CodecRegistry::get_instance().set_codec_table(codec_table);
+
+  // Setting the payload compression algorithms that the other workers can decompress
+  std::vector<std::string> compression_algorithms(request->compression_algorithms().begin(),
+                                                  request->compression_algorithms().end());
+  HOLOSCAN_LOG_DEBUG("Compression algorithms: [{}]", fmt::join(compression_algorithms, ", "));
+  PayloadCompression::set_negotiated_algorithms(compression_algorithms);
+
   // Setting a response
   auto result = response->mutable_result();
   result->set_code(holoscan::service::ErrorCode::SUCCESS);
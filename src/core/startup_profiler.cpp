@@ -0,0 +1,109 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "holoscan/core/startup_profiler.hpp"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "holoscan/core/system/env_utils.hpp"
+#include "holoscan/logger/logger.hpp"
+
+namespace holoscan {
+
+StartupProfiler::ScopedPhase::ScopedPhase(StartupProfiler& profiler, const char* phase,
+                                          std::string component)
+    : profiler_(profiler), phase_(phase), component_(std::move(component)), start_(Clock::now()) {}
+
+StartupProfiler::ScopedPhase::~ScopedPhase() {
+  profiler_.record(
+      phase_,
+      std::chrono::duration<double, std::milli>(Clock::now() - start_).count(),
+      component_);
+}
+
+bool StartupProfiler::is_report_enabled() {
+  return get_bool_env_var("HOLOSCAN_STARTUP_PROFILE");
+}
+
+void StartupProfiler::record(const std::string& phase, double duration_ms,
+                             const std::string& component) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  records_.push_back(PhaseRecord{phase, component, duration_ms});
+  if (phase == kOperatorStart) { ++operator_starts_; }
+}
+
+std::vector<StartupProfiler::PhaseRecord> StartupProfiler::records() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return records_;
+}
+
+double StartupProfiler::total_duration_ms(const std::string& phase) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  double total = 0.0;
+  for (const auto& record : records_) {
+    if (record.phase == phase) { total += record.duration_ms; }
+  }
+  return total;
+}
+
+void StartupProfiler::expect_operator_starts(size_t count) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  expected_operator_starts_ = count;
+}
+
+bool StartupProfiler::is_startup_complete() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return operator_starts_ >= expected_operator_starts_;
+}
+
+void StartupProfiler::log_report(const std::string& name) {
+  if (!is_report_enabled()) { return; }
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (is_reported_) { return; }
+    is_reported_ = true;
+  }
+  HOLOSCAN_LOG_INFO(report(name));
+}
+
+std::string StartupProfiler::report(const std::string& name) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  std::string result = fmt::format("Startup profile of {} '{}':", subject_, name);
+  for (const auto& record : records_) {
+    if (record.component.empty()) {
+      result += fmt::format("\n  {:<26} {:>12.3f} ms", record.phase, record.duration_ms);
+    } else {
+      result += fmt::format("\n  {:<26} {:>12.3f} ms ({})",
+                            record.phase,
+                            record.duration_ms,
+                            record.component);
+    }
+  }
+  return result;
+}
+
+void StartupProfiler::clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  records_.clear();
+  expected_operator_starts_ = 0;
+  operator_starts_ = 0;
+  is_reported_ = false;
+}
+
+}  // namespace holoscan
@@ -17,6 +17,9 @@
 #include "holoscan/core/system/topology.hpp"
 
 #include <hwloc.h>
+#include <sched.h>
+
+#include <vector>
 
 #include "holoscan/logger/logger.hpp"
 
@@ -35,6 +38,57 @@ void* Topology::context() const {
   return context_;
 }
 
+std::vector<int> Topology::numa_nodes() const {
+  auto topology = static_cast<hwloc_topology_t>(context_);
+  std::vector<int> nodes;
+  hwloc_obj_t node = nullptr;
+  while ((node = hwloc_get_next_obj_by_type(topology, HWLOC_OBJ_NUMANODE, node)) != nullptr) {
+    nodes.push_back(static_cast<int>(node->os_index));
+  }
+  return nodes;
+}
+
+std::vector<int> Topology::numa_node_by_cpu() const {
+  auto topology = static_cast<hwloc_topology_t>(context_);
+  std::vector<int> nodes_by_cpu;
+  hwloc_obj_t node = nullptr;
+  while ((node = hwloc_get_next_obj_by_type(topology, HWLOC_OBJ_NUMANODE, node)) != nullptr) {
+    if (node->cpuset == nullptr) { continue; }
+    unsigned int cpu = 0;
+    hwloc_bitmap_foreach_begin(cpu, node->cpuset) {
+      if (cpu >= nodes_by_cpu.size()) { nodes_by_cpu.resize(cpu + 1, -1); }
+      nodes_by_cpu[cpu] = static_cast<int>(node->os_index);
+    }
+    hwloc_bitmap_foreach_end();
+  }
+  return nodes_by_cpu;
+}
+
+int Topology::current_numa_node() const {
+  const int cpu = sched_getcpu();
+  if (cpu < 0) { return -1; }
+  auto nodes_by_cpu = numa_node_by_cpu();
+  return static_cast<size_t>(cpu) < nodes_by_cpu.size() ? nodes_by_cpu[cpu] : -1;
+}
+
+void* Topology::allocate_on_numa_node(size_t size, int numa_node) const {
+  auto topology = static_cast<hwloc_topology_t>(context_);
+  if (numa_node < 0) { return nullptr; }
+  hwloc_obj_t node =
+      hwloc_get_numanode_obj_by_os_index(topology, static_cast<unsigned int>(numa_node));
+  if (node == nullptr) { return nullptr; }
+  return hwloc_alloc_membind(
+      topology, size, node->nodeset, HWLOC_MEMBIND_BIND, HWLOC_MEMBIND_BYNODESET);
+}
+
+void* Topology::allocate_memory(size_t size) const {
+  return hwloc_alloc(static_cast<hwloc_topology_t>(context_), size);
+}
+
+void Topology::free_memory(void* pointer, size_t size) const {
+  hwloc_free(static_cast<hwloc_topology_t>(context_), pointer, size);
+}
+
 Topology::~Topology() {
   // Destroy the hwloc topology object
   hwloc_topology_destroy(static_cast<hwloc_topology_t>(context_));
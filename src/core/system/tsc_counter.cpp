@@ -0,0 +1,196 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "holoscan/core/system/tsc_counter.hpp"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#include <x86intrin.h>
+#endif
+
+#include <cmath>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <thread>
+
+#include "holoscan/core/system/env_utils.hpp"
+#include "holoscan/logger/logger.hpp"
+
+namespace holoscan {
+
+namespace {
+
+/// Number of attempts to read a (counter, CLOCK_MONOTONIC) pair, keeping the tightest one.
+constexpr int kSampleAttempts = 8;
+
+/// Read the counter around CLOCK_MONOTONIC and attribute the midpoint to the monotonic time.
+template <typename ReadCounterT>
+void sample_counter(ReadCounterT read_counter, uint64_t& ticks, int64_t& ns) {
+  uint64_t best_window = std::numeric_limits<uint64_t>::max();
+  for (int attempt = 0; attempt < kSampleAttempts; ++attempt) {
+    const uint64_t before = read_counter();
+    const int64_t monotonic = TscCounter::monotonic_ns();
+    const uint64_t after = read_counter();
+    if (after >= before && after - before < best_window) {
+      best_window = after - before;
+      ticks = before + (after - before) / 2;
+      ns = monotonic;
+    }
+  }
+}
+
+}  // namespace
+
+TscCounter::TscCounter(std::chrono::nanoseconds calibration_period, bool allow_counter) {
+  if (allow_counter && has_invariant_counter()) {
+#if defined(__x86_64__) || defined(__i386__)
+    source_ = Source::kTsc;
+#elif defined(__aarch64__)
+    source_ = Source::kCntvct;
+#endif
+    calibrate(calibration_period);
+  }
+
+  timespec realtime{};
+  const int64_t monotonic = monotonic_ns();
+  clock_gettime(CLOCK_REALTIME, &realtime);
+  epoch_offset_ns_ =
+      static_cast<int64_t>(realtime.tv_sec) * 1000000000LL + realtime.tv_nsec - monotonic;
+}
+
+const TscCounter& TscCounter::instance() {
+  static const TscCounter counter = []() {
+    TscCounter calibrated;
+    HOLOSCAN_LOG_DEBUG("TscCounter: using '{}' ({:.3f} MHz)",
+                       calibrated.source_name(),
+                       calibrated.frequency_hz() / 1e6);
+    return calibrated;
+  }();
+  return counter;
+}
+
+bool TscCounter::has_invariant_counter() {
+#if defined(__x86_64__) || defined(__i386__)
+  unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+  if (__get_cpuid(0x80000000, &eax, &ebx, &ecx, &edx) == 0 || eax < 0x80000007) { return false; }
+  if (__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx) == 0) { return false; }
+  const bool invariant = (edx & (1U << 8)) != 0;
+  if (!invariant) { return false; }
+
+  // The kernel drops 'tsc' from the clock sources when it finds it unstable (e.g., not
+  // synchronized between sockets or on some virtual machines)
+  std::ifstream clocksources("/sys/devices/system/clocksource/clocksource0/available_clocksource");
+  std::string clocksource;
+  if (!clocksources) { return true; }
+  while (clocksources >> clocksource) {
+    if (clocksource == "tsc") { return true; }
+  }
+  return false;
+#elif defined(__aarch64__)
+  // The generic timer runs at a constant frequency by definition
+  return true;
+#else
+  return false;
+#endif
+}
+
+bool TscCounter::is_timestamp_source_enabled() {
+  static const bool enabled = get_bool_env_var("HOLOSCAN_TSC_TIMESTAMPS", false);
+  return enabled;
+}
+
+int64_t TscCounter::now_ns() const {
+  if (source_ == Source::kMonotonic) { return monotonic_ns(); }
+  return ticks_to_ns(read_counter());
+}
+
+uint64_t TscCounter::ticks() const {
+  if (source_ == Source::kMonotonic) { return static_cast<uint64_t>(monotonic_ns()); }
+  return read_counter();
+}
+
+int64_t TscCounter::ticks_to_ns(uint64_t ticks) const {
+  if (source_ == Source::kMonotonic) { return static_cast<int64_t>(ticks); }
+  // Signed so that a counter read slightly behind the base (on another core) stays close to it
+  const auto delta = static_cast<__int128>(static_cast<int64_t>(ticks - base_ticks_));
+  return base_ns_ + static_cast<int64_t>((delta * ns_per_tick_fixed_) >> kFixedPointShift);
+}
+
+uint64_t TscCounter::read_counter() {
+#if defined(__x86_64__) || defined(__i386__)
+  return __rdtsc();
+#elif defined(__aarch64__)
+  uint64_t value;
+  asm volatile("mrs %0, cntvct_el0" : "=r"(value));
+  return value;
+#else
+  return static_cast<uint64_t>(monotonic_ns());
+#endif
+}
+
+const char* TscCounter::source_name() const {
+  switch (source_) {
+    case Source::kTsc:
+      return "tsc";
+    case Source::kCntvct:
+      return "cntvct";
+    case Source::kMonotonic:
+    default:
+      return "clock_monotonic";
+  }
+}
+
+void TscCounter::calibrate(std::chrono::nanoseconds calibration_period) {
+  uint64_t start_ticks = 0;
+  int64_t start_ns = 0;
+  uint64_t end_ticks = 0;
+  int64_t end_ns = 0;
+  sample_counter(read_counter, start_ticks, start_ns);
+
+#if defined(__aarch64__)
+  // The frequency is known, only the time base needs to be aligned
+  (void)calibration_period;
+  uint64_t frequency = 0;
+  asm volatile("mrs %0, cntfrq_el0" : "=r"(frequency));
+  end_ticks = start_ticks;
+  end_ns = start_ns;
+  frequency_hz_ = static_cast<double>(frequency);
+#else
+  std::this_thread::sleep_for(calibration_period);
+  sample_counter(read_counter, end_ticks, end_ns);
+  if (end_ticks > start_ticks && end_ns > start_ns) {
+    frequency_hz_ = static_cast<double>(end_ticks - start_ticks) * 1e9 /
+                    static_cast<double>(end_ns - start_ns);
+  } else {
+    frequency_hz_ = 0.0;
+  }
+#endif
+
+  if (!(frequency_hz_ > 0.0)) {
+    HOLOSCAN_LOG_WARN("TscCounter: calibration failed, falling back to CLOCK_MONOTONIC");
+    source_ = Source::kMonotonic;
+    frequency_hz_ = 1e9;
+    return;
+  }
+  base_ticks_ = end_ticks;
+  base_ns_ = end_ns;
+  ns_per_tick_fixed_ = static_cast<int64_t>(
+      std::llround(std::ldexp(1e9 / frequency_hz_, kFixedPointShift)));
+}
+
+}  // namespace holoscan
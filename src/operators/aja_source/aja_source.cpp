@@ -39,6 +39,9 @@ constexpr uint32_t kNumBuffers = 2;
 AJASourceOp::AJASourceOp() {}
 
 void AJASourceOp::setup(OperatorSpec& spec) {
+  // Captured frames are emitted as video buffers
+  spec.require_gxf_extension("libgxf_multimedia.so");
+
   auto& video_buffer_output = spec.output<gxf::Entity>("video_buffer_output");
   auto& overlay_buffer_input =
       spec.input<gxf::Entity>("overlay_buffer_input").condition(ConditionType::kNone);
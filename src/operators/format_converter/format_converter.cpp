@@ -245,7 +245,7 @@ void FormatConverterOp::compute(InputContext& op_input, OutputContext& op_output
 
   // get Handle to underlying nvidia::gxf::Allocator from std::shared_ptr<holoscan::Allocator>
   auto pool = nvidia::gxf::Handle<nvidia::gxf::Allocator>::Create(context.context(),
-                                                                  pool_->gxf_cid());
+                                                                  pool_->gxf_handle_cid());
 
   // Get either the Tensor or VideoBuffer attached to the message
   bool is_video_buffer;
@@ -484,7 +484,7 @@ nvidia::gxf::Expected<void*> FormatConverterOp::resizeImage(
 
     // get Handle to underlying nvidia::gxf::Allocator from std::shared_ptr<holoscan::Allocator>
     auto pool = nvidia::gxf::Handle<nvidia::gxf::Allocator>::Create(frag->executor().context(),
-                                                                    pool_->gxf_cid());
+                                                                    pool_->gxf_handle_cid());
 
     uint64_t buffer_size = resize_width * resize_height * channels;
     resize_buffer_->resize(pool.value(), buffer_size, nvidia::gxf::MemoryStorageType::kDevice);
@@ -661,7 +661,7 @@ void FormatConverterOp::convertTensorFormat(const void* in_tensor_data, void* ou
 
         // get Handle to underlying nvidia::gxf::Allocator from std::shared_ptr<holoscan::Allocator>
         auto pool = nvidia::gxf::Handle<nvidia::gxf::Allocator>::Create(frag->executor().context(),
-                                                                        pool_->gxf_cid());
+                                                                        pool_->gxf_handle_cid());
 
         uint64_t buffer_size = rows * columns * 3;  // 4 channels -> 3 channels
         channel_buffer_->resize(pool.value(), buffer_size, nvidia::gxf::MemoryStorageType::kDevice);
@@ -871,6 +871,9 @@ void FormatConverterOp::convertTensorFormat(const void* in_tensor_data, void* ou
 }
 
 void FormatConverterOp::setup(OperatorSpec& spec) {
+  // Video buffers are read from the input
+  spec.require_gxf_extension("libgxf_multimedia.so");
+
   auto& in_tensor = spec.input<gxf::Entity>("source_video");
   auto& out_tensor = spec.output<gxf::Entity>("tensor");
 
@@ -469,6 +469,9 @@ HolovizOp::InputSpec::InputSpec(const std::string& tensor_name, const std::strin
 }
 
 void HolovizOp::setup(OperatorSpec& spec) {
+  // Video buffers are read from the inputs and written to the render buffer output
+  spec.require_gxf_extension("libgxf_multimedia.so");
+
   constexpr uint32_t DEFAULT_WIDTH = 1920;
   constexpr uint32_t DEFAULT_HEIGHT = 1080;
   constexpr float DEFAULT_FRAMERATE = 60.f;
@@ -660,8 +663,8 @@ void HolovizOp::read_frame_buffer(InputContext& op_input, OutputContext& op_outp
     }
 
     // get Handle to underlying nvidia::gxf::Allocator from std::shared_ptr<holoscan::Allocator>
-    auto allocator = nvidia::gxf::Handle<nvidia::gxf::Allocator>::Create(context.context(),
-                                                                         allocator_->gxf_cid());
+    auto allocator = nvidia::gxf::Handle<nvidia::gxf::Allocator>::Create(
+        context.context(), allocator_->gxf_handle_cid());
 
     video_buffer.value()->resize<nvidia::gxf::VideoFormat::GXF_VIDEO_FORMAT_RGBA>(
         width_,
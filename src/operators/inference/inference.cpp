@@ -226,8 +226,8 @@ void InferenceOp::stop() {
 void InferenceOp::compute(InputContext& op_input, OutputContext& op_output,
                           ExecutionContext& context) {
   // get Handle to underlying nvidia::gxf::Allocator from std::shared_ptr<holoscan::Allocator>
-  auto allocator =
-      nvidia::gxf::Handle<nvidia::gxf::Allocator>::Create(context.context(), allocator_->gxf_cid());
+  auto allocator = nvidia::gxf::Handle<nvidia::gxf::Allocator>::Create(
+      context.context(), allocator_->gxf_handle_cid());
   auto cont = context.context();
   try {
     // Extract relevant data from input GXF Receivers, and update inference specifications
@@ -50,6 +50,9 @@ bool pixel_format_supported(int fd, unsigned int pixel_format_fourcc) {
 namespace holoscan::ops {
 
 void V4L2VideoCaptureOp::setup(OperatorSpec& spec) {
+  // Captured frames are emitted as video buffers
+  spec.require_gxf_extension("libgxf_multimedia.so");
+
   auto& signal = spec.output<gxf::Entity>("signal");
 
   spec.param(signal_, "signal", "Output", "Output channel", &signal);
@@ -112,8 +115,8 @@ void V4L2VideoCaptureOp::compute(InputContext& op_input, OutputContext& op_outpu
   }
 
   // Get Handle to underlying nvidia::gxf::Allocator from std::shared_ptr<holoscan::Allocator>
-  auto allocator =
-      nvidia::gxf::Handle<nvidia::gxf::Allocator>::Create(context.context(), allocator_->gxf_cid());
+  auto allocator = nvidia::gxf::Handle<nvidia::gxf::Allocator>::Create(
+      context.context(), allocator_->gxf_handle_cid());
   // Allocate output buffer
   video_buffer.value()->resize<nvidia::gxf::VideoFormat::GXF_VIDEO_FORMAT_RGBA>(
       width_use_,
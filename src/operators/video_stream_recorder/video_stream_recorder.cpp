@@ -36,6 +36,9 @@
 namespace holoscan::ops {
 
 void VideoStreamRecorderOp::setup(OperatorSpec& spec) {
+  // The default entity serializer is created by initialize()
+  spec.require_gxf_extension("libgxf_stream_playback.so");
+
   auto& input = spec.input<gxf::Entity>("input");
 
   spec.param(receiver_, "receiver", "Entity receiver", "Receiver channel to log", &input);
@@ -38,6 +38,9 @@
 namespace holoscan::ops {
 
 void VideoStreamReplayerOp::setup(OperatorSpec& spec) {
+  // The default entity serializer is created by initialize()
+  spec.require_gxf_extension("libgxf_stream_playback.so");
+
   auto& output = spec.output<gxf::Entity>("output");
 
   spec.param(transmitter_,
@@ -0,0 +1,137 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TESTS_BENCHMARK_BENCHMARK_UTILS_HPP
+#define TESTS_BENCHMARK_BENCHMARK_UTILS_HPP
+
+// Helpers shared by the standalone benchmarks: latency statistics, command line options and the
+// JSON report.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <CLI/CLI.hpp>
+#include <holoscan/holoscan.hpp>
+
+namespace holoscan::benchmark {
+
+inline int64_t steady_now_ns() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+/// Latencies recorded by a sink operator.
+struct LatencyStats {
+  std::mutex mutex;  ///< only needed if the sink can run on several threads at once
+  int64_t first_emit_ns = 0;
+  int64_t last_receive_ns = 0;
+  std::vector<int64_t> latencies_ns;
+};
+
+/// Returns the p-th percentile (0-100) of values sorted in ascending order.
+template <typename T>
+T percentile(const std::vector<T>& sorted_values, double p) {
+  if (sorted_values.empty()) { return T{}; }
+  size_t index = static_cast<size_t>(p / 100.0 * (sorted_values.size() - 1) + 0.5);
+  return sorted_values[std::min(index, sorted_values.size() - 1)];
+}
+
+template <typename T>
+double mean(const std::vector<T>& values) {
+  if (values.empty()) { return 0.0; }
+  double sum = 0.0;
+  for (auto v : values) { sum += static_cast<double>(v); }
+  return sum / values.size();
+}
+
+/// Returns the `"latency_ns": {...}` JSON member for latencies sorted in ascending order.
+inline std::string latency_json(const std::vector<int64_t>& sorted_latencies_ns) {
+  return fmt::format(
+      R"("latency_ns": {{"mean": {:.1f}, "p50": {}, "p90": {}, "p99": {}, "p999": {}, "max": {}}})",
+      mean(sorted_latencies_ns),
+      percentile(sorted_latencies_ns, 50.0),
+      percentile(sorted_latencies_ns, 90.0),
+      percentile(sorted_latencies_ns, 99.0),
+      percentile(sorted_latencies_ns, 99.9),
+      sorted_latencies_ns.empty() ? 0 : sorted_latencies_ns.back());
+}
+
+/// Command line options common to the benchmarks.
+struct CommonOptions {
+  int repetitions = 1;      ///< number of repetitions per configuration
+  std::string output_path;  ///< output JSON file (stdout if empty)
+};
+
+/// Adds the --output option (and --repetitions if `with_repetitions` is true) to `cli`.
+inline void add_common_options(CLI::App& cli, CommonOptions& options,
+                               bool with_repetitions = true) {
+  if (with_repetitions) {
+    cli.add_option("--repetitions", options.repetitions, "Number of repetitions per configuration");
+  }
+  cli.add_option("--output", options.output_path, "Output JSON file (default: stdout)");
+}
+
+/// Keeps the benchmark output clean unless the user asked for a specific log level.
+inline void set_default_log_level() {
+  if (std::getenv("HOLOSCAN_LOG_LEVEL") == nullptr) {
+    holoscan::set_log_level(holoscan::LogLevel::WARN);
+  }
+}
+
+/**
+ * @brief Write the JSON report of a benchmark to the output file (or stdout).
+ *
+ * @param name The name of the benchmark.
+ * @param results The JSON object of each run.
+ * @param options The common options.
+ * @param fields Additional members of the report (name and JSON value).
+ */
+inline void write_report(const std::string& name, const std::vector<std::string>& results,
+                         const CommonOptions& options,
+                         const std::vector<std::pair<std::string, std::string>>& fields = {}) {
+  std::ostringstream json;
+  json << fmt::format("{{\n  \"benchmark\": \"{}\",\n", name);
+  for (const auto& [field_name, value] : fields) {
+    json << fmt::format("  \"{}\": {},\n", field_name, value);
+  }
+  json << "  \"results\": [\n";
+  for (size_t i = 0; i < results.size(); ++i) {
+    json << "    " << results[i] << (i + 1 < results.size() ? ",\n" : "\n");
+  }
+  json << "  ]\n}\n";
+
+  if (options.output_path.empty()) {
+    std::cout << json.str();
+  } else {
+    std::ofstream file(options.output_path);
+    file << json.str();
+  }
+}
+
+}  // namespace holoscan::benchmark
+
+#endif /* TESTS_BENCHMARK_BENCHMARK_UTILS_HPP */
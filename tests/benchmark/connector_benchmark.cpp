@@ -0,0 +1,280 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Connector latency benchmark.
+//
+// Sends messages through a chain of operators and measures the end-to-end and per-hop latency for
+// each connector type used on the intra-fragment edges (DoubleBufferReceiver/Transmitter versus
+// the lock-free RingBufferReceiver/Transmitter). The source stamps each message with the
+// steady_clock time at which it is emitted; the sink records the latency when it is received.
+//
+// Results are reported as JSON.
+//
+// Example:
+//   ./connector_benchmark --connector double_buffer,ring_buffer --ops 4 --messages 100000
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <CLI/CLI.hpp>
+#include <holoscan/holoscan.hpp>
+
+#include "./benchmark_utils.hpp"
+
+namespace holoscan::benchmark {
+
+/// Message passed along the chain.
+struct StampedMessage {
+  int64_t emit_time_ns = 0;  ///< steady_clock time at which the source emitted the message
+};
+
+}  // namespace holoscan::benchmark
+
+namespace holoscan::ops {
+
+using benchmark::LatencyStats;
+using benchmark::StampedMessage;
+
+class StampSourceOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(StampSourceOp)
+
+  StampSourceOp() = default;
+
+  void setup(OperatorSpec& spec) override { spec.output<std::shared_ptr<StampedMessage>>("out"); }
+
+  void compute(InputContext&, OutputContext& op_output, ExecutionContext&) override {
+    auto message = std::make_shared<StampedMessage>();
+    message->emit_time_ns = benchmark::steady_now_ns();
+    op_output.emit(message, "out");
+  }
+};
+
+class ForwardOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(ForwardOp)
+
+  ForwardOp() = default;
+
+  void setup(OperatorSpec& spec) override {
+    spec.input<std::shared_ptr<StampedMessage>>("in");
+    spec.output<std::shared_ptr<StampedMessage>>("out");
+  }
+
+  void compute(InputContext& op_input, OutputContext& op_output, ExecutionContext&) override {
+    auto message = op_input.receive<std::shared_ptr<StampedMessage>>("in").value();
+    op_output.emit(message, "out");
+  }
+};
+
+class StampSinkOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(StampSinkOp)
+
+  StampSinkOp() = default;
+
+  void setup(OperatorSpec& spec) override { spec.input<std::shared_ptr<StampedMessage>>("in"); }
+
+  void compute(InputContext& op_input, OutputContext&, ExecutionContext&) override {
+    auto message = op_input.receive<std::shared_ptr<StampedMessage>>("in").value();
+    int64_t now_ns = benchmark::steady_now_ns();
+    if (stats_->first_emit_ns == 0) { stats_->first_emit_ns = message->emit_time_ns; }
+    stats_->last_receive_ns = now_ns;
+    stats_->latencies_ns.push_back(now_ns - message->emit_time_ns);
+  }
+
+  void stats(LatencyStats* stats) { stats_ = stats; }
+
+ private:
+  LatencyStats* stats_ = nullptr;
+};
+
+}  // namespace holoscan::ops
+
+namespace holoscan::benchmark {
+
+enum class SchedulerKind { kGreedy, kMultiThread };
+
+struct BenchConfig {
+  IOSpec::ConnectorType connector_type = IOSpec::ConnectorType::kDoubleBuffer;
+  SchedulerKind scheduler = SchedulerKind::kMultiThread;
+  int64_t num_ops = 4;            ///< number of forwarding operators between source and sink
+  int64_t num_messages = 10000;   ///< number of messages emitted by the source
+  uint64_t capacity = 1;          ///< capacity of every receiver and transmitter
+  int64_t worker_threads = 4;     ///< worker threads of the MultiThreadScheduler
+};
+
+static const char* to_string(IOSpec::ConnectorType connector_type) {
+  switch (connector_type) {
+    case IOSpec::ConnectorType::kDoubleBuffer:
+      return "double_buffer";
+    case IOSpec::ConnectorType::kRingBuffer:
+      return "ring_buffer";
+    default:
+      return "unknown";
+  }
+}
+
+static const char* to_string(SchedulerKind scheduler) {
+  switch (scheduler) {
+    case SchedulerKind::kGreedy:
+      return "greedy";
+    case SchedulerKind::kMultiThread:
+      return "multithread";
+  }
+  return "unknown";
+}
+
+class ConnectorBenchmarkApp : public holoscan::Application {
+ public:
+  ConnectorBenchmarkApp(const BenchConfig& config, LatencyStats* stats)
+      : config_(config), stats_(stats) {}
+
+  void compose() override {
+    using namespace holoscan;
+
+    auto source = make_operator<ops::StampSourceOp>(
+        "source", make_condition<CountCondition>("count", config_.num_messages));
+    set_connector(source->spec()->outputs()["out"].get());
+
+    std::shared_ptr<Operator> prev = source;
+    for (int64_t i = 0; i < std::max<int64_t>(config_.num_ops, 0); ++i) {
+      auto forward = make_operator<ops::ForwardOp>(fmt::format("forward{}", i));
+      set_connector(forward->spec()->inputs()["in"].get());
+      set_connector(forward->spec()->outputs()["out"].get());
+      add_flow(prev, forward);
+      prev = forward;
+    }
+
+    auto sink = make_operator<ops::StampSinkOp>("sink");
+    sink->stats(stats_);
+    set_connector(sink->spec()->inputs()["in"].get());
+    add_flow(prev, sink);
+  }
+
+ private:
+  void set_connector(IOSpec* io_spec) {
+    io_spec->connector(config_.connector_type,
+                       Arg("capacity", config_.capacity),
+                       Arg("policy", static_cast<uint64_t>(2)));  // fault
+  }
+
+  BenchConfig config_;
+  LatencyStats* stats_ = nullptr;
+};
+
+static std::string run_benchmark(const BenchConfig& config) {
+  LatencyStats stats;
+  stats.latencies_ns.reserve(config.num_messages);
+
+  auto app = holoscan::make_application<ConnectorBenchmarkApp>(config, &stats);
+  if (config.scheduler == SchedulerKind::kGreedy) {
+    app->scheduler(app->make_scheduler<GreedyScheduler>("greedy_scheduler",
+                                                        Arg("stop_on_deadlock", true)));
+  } else {
+    app->scheduler(app->make_scheduler<MultiThreadScheduler>(
+        "multithread_scheduler",
+        Arg("worker_thread_number", config.worker_threads),
+        Arg("check_recession_period_ms", 0.0),
+        Arg("stop_on_deadlock", true),
+        Arg("stop_on_deadlock_timeout", 100L)));
+  }
+  app->run();
+
+  std::sort(stats.latencies_ns.begin(), stats.latencies_ns.end());
+  const size_t received = stats.latencies_ns.size();
+  const int64_t hops = std::max<int64_t>(config.num_ops, 0) + 1;
+  const double elapsed_s = stats.last_receive_ns > stats.first_emit_ns
+                               ? (stats.last_receive_ns - stats.first_emit_ns) / 1e9
+                               : 0.0;
+
+  std::ostringstream out;
+  out << "{";
+  out << fmt::format(R"("connector": "{}", )", to_string(config.connector_type));
+  out << fmt::format(R"("scheduler": "{}", )", to_string(config.scheduler));
+  out << fmt::format(R"("num_ops": {}, )", config.num_ops);
+  out << fmt::format(R"("num_messages": {}, )", config.num_messages);
+  out << fmt::format(R"("capacity": {}, )", config.capacity);
+  out << fmt::format(R"("worker_threads": {}, )",
+                     config.scheduler == SchedulerKind::kMultiThread ? config.worker_threads : 1);
+  out << fmt::format(R"("messages_received": {}, )", received);
+  out << fmt::format(R"("messages_per_s": {:.1f}, )", elapsed_s > 0 ? received / elapsed_s : 0.0);
+  out << fmt::format(R"("per_hop_latency_ns": {{"mean": {:.1f}, "p50": {}, "p99": {}}}, )",
+                     mean(stats.latencies_ns) / hops,
+                     percentile(stats.latencies_ns, 50.0) / hops,
+                     percentile(stats.latencies_ns, 99.0) / hops);
+  out << latency_json(stats.latencies_ns);
+  out << "}";
+  return out.str();
+}
+
+}  // namespace holoscan::benchmark
+
+int main(int argc, char** argv) {
+  using namespace holoscan::benchmark;
+
+  CLI::App cli{"Holoscan connector latency benchmark"};
+
+  std::vector<std::string> connectors{"double_buffer", "ring_buffer"};
+  std::vector<std::string> schedulers{"greedy", "multithread"};
+  BenchConfig base_config;
+  CommonOptions options;
+
+  cli.add_option("--connector", connectors, "Connector types (double_buffer, ring_buffer)")
+      ->delimiter(',');
+  cli.add_option("--scheduler", schedulers, "Schedulers (greedy, multithread)")->delimiter(',');
+  cli.add_option("--ops", base_config.num_ops, "Number of forwarding operators");
+  cli.add_option("--messages", base_config.num_messages, "Number of messages emitted");
+  cli.add_option("--capacity", base_config.capacity, "Capacity of the receivers/transmitters");
+  cli.add_option("--threads", base_config.worker_threads, "MultiThreadScheduler worker threads");
+  add_common_options(cli, options);
+  CLI11_PARSE(cli, argc, argv);
+
+  set_default_log_level();
+
+  std::vector<std::string> results;
+  for (const auto& connector_name : connectors) {
+    for (const auto& scheduler_name : schedulers) {
+      BenchConfig config = base_config;
+      if (connector_name == "double_buffer") {
+        config.connector_type = holoscan::IOSpec::ConnectorType::kDoubleBuffer;
+      } else if (connector_name == "ring_buffer") {
+        config.connector_type = holoscan::IOSpec::ConnectorType::kRingBuffer;
+      } else {
+        std::cerr << "Unknown connector: " << connector_name << std::endl;
+        return 1;
+      }
+      if (scheduler_name == "greedy") {
+        config.scheduler = SchedulerKind::kGreedy;
+      } else if (scheduler_name == "multithread") {
+        config.scheduler = SchedulerKind::kMultiThread;
+      } else {
+        std::cerr << "Unknown scheduler: " << scheduler_name << std::endl;
+        return 1;
+      }
+      for (int i = 0; i < options.repetitions; ++i) { results.push_back(run_benchmark(config)); }
+    }
+  }
+
+  write_report("connector", results, options);
+  return 0;
+}
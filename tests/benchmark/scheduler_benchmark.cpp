@@ -0,0 +1,491 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Scheduler benchmark harness.
+//
+// Builds synthetic operator graphs (chain, fan-out/fan-in, diamond) and runs them under each
+// scheduler (GreedyScheduler, MultiThreadScheduler) with a ManualClock, a RealtimeClock or a
+// TscClock. The number of messages is fixed by a CountCondition on the source operator, so the
+// amount of work done per run is deterministic. With the ManualClock, periodic waits are compressed
+// so the measured numbers only reflect the framework overhead and the configured compute cost.
+//
+// Results (ticks/s, per-hop overhead and latency percentiles) are reported as JSON.
+//
+// Example:
+//   ./scheduler_benchmark --topology chain,diamond --ops 8 --messages 10000 --output out.json
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <CLI/CLI.hpp>
+#include <holoscan/holoscan.hpp>
+
+#include "./benchmark_utils.hpp"
+
+namespace holoscan::benchmark {
+
+/// Message passed along the synthetic graph.
+struct BenchMessage {
+  int64_t emit_time_ns = 0;  ///< steady_clock time at which the source emitted the message
+  int64_t compute_ns = 0;    ///< compute time accumulated along the (critical) path
+  int32_t hops = 0;          ///< number of edges traversed along the (critical) path
+};
+
+/// Statistics shared between the operators of a benchmark run and the driver.
+struct BenchStats {
+  std::atomic<uint64_t> ticks{0};
+  std::atomic<int64_t> first_emit_ns{0};
+  std::mutex mutex;
+  int64_t last_receive_ns = 0;
+  std::vector<int64_t> latencies_ns;
+  std::vector<int64_t> overheads_ns;  ///< (latency - compute) / hops for each message
+  int64_t total_hops = 0;
+
+  void reset(size_t expected_messages) {
+    ticks = 0;
+    first_emit_ns = 0;
+    last_receive_ns = 0;
+    latencies_ns.clear();
+    latencies_ns.reserve(expected_messages);
+    overheads_ns.clear();
+    overheads_ns.reserve(expected_messages);
+    total_hops = 0;
+  }
+};
+
+/// Spin for the given number of iterations to emulate a fixed compute cost.
+static inline int64_t spin(int64_t iterations) {
+  volatile int64_t sink = 0;
+  for (int64_t i = 0; i < iterations; ++i) { sink = sink + i; }
+  return sink;
+}
+
+}  // namespace holoscan::benchmark
+
+namespace holoscan::ops {
+
+using benchmark::BenchMessage;
+using benchmark::BenchStats;
+
+class BenchSourceOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(BenchSourceOp)
+
+  BenchSourceOp() = default;
+
+  void setup(OperatorSpec& spec) override { spec.output<std::shared_ptr<BenchMessage>>("out"); }
+
+  void compute(InputContext&, OutputContext& op_output, ExecutionContext&) override {
+    auto message = std::make_shared<BenchMessage>();
+    message->emit_time_ns = benchmark::steady_now_ns();
+    int64_t expected = 0;
+    stats_->first_emit_ns.compare_exchange_strong(expected, message->emit_time_ns);
+    stats_->ticks.fetch_add(1, std::memory_order_relaxed);
+    op_output.emit(message, "out");
+  }
+
+  void stats(BenchStats* stats) { stats_ = stats; }
+
+ private:
+  BenchStats* stats_ = nullptr;
+};
+
+class BenchWorkOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(BenchWorkOp)
+
+  BenchWorkOp() = default;
+
+  void setup(OperatorSpec& spec) override {
+    spec.input<std::shared_ptr<BenchMessage>>("in");
+    spec.output<std::shared_ptr<BenchMessage>>("out");
+    spec.param(compute_cost_,
+               "compute_cost",
+               "Compute cost",
+               "Number of busy-loop iterations executed per compute() call.",
+               0L);
+  }
+
+  void compute(InputContext& op_input, OutputContext& op_output, ExecutionContext&) override {
+    auto in_message = op_input.receive<std::shared_ptr<BenchMessage>>("in").value();
+
+    int64_t start_ns = benchmark::steady_now_ns();
+    benchmark::spin(compute_cost_.get());
+    int64_t compute_ns = benchmark::steady_now_ns() - start_ns;
+
+    // Fan-out edges share the same message object, so emit a copy instead of mutating it.
+    auto out_message = std::make_shared<BenchMessage>(*in_message);
+    out_message->compute_ns += compute_ns;
+    out_message->hops += 1;
+    stats_->ticks.fetch_add(1, std::memory_order_relaxed);
+    op_output.emit(out_message, "out");
+  }
+
+  void stats(BenchStats* stats) { stats_ = stats; }
+
+ private:
+  Parameter<int64_t> compute_cost_;
+  BenchStats* stats_ = nullptr;
+};
+
+class BenchJoinOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(BenchJoinOp)
+
+  BenchJoinOp() = default;
+
+  void setup(OperatorSpec& spec) override {
+    spec.param(receivers_, "receivers", "Input Receivers", "List of input receivers.", {});
+    spec.output<std::shared_ptr<BenchMessage>>("out");
+  }
+
+  void compute(InputContext& op_input, OutputContext& op_output, ExecutionContext&) override {
+    auto messages =
+        op_input.receive<std::vector<std::shared_ptr<BenchMessage>>>("receivers").value();
+
+    // Keep the critical path: the branch with the most hops (then the largest compute time).
+    auto out_message = std::make_shared<BenchMessage>();
+    for (const auto& message : messages) {
+      if (!message) { continue; }
+      if (out_message->emit_time_ns == 0 || message->emit_time_ns < out_message->emit_time_ns) {
+        out_message->emit_time_ns = message->emit_time_ns;
+      }
+      if (message->hops > out_message->hops ||
+          (message->hops == out_message->hops && message->compute_ns > out_message->compute_ns)) {
+        out_message->hops = message->hops;
+        out_message->compute_ns = message->compute_ns;
+      }
+    }
+    out_message->hops += 1;
+    stats_->ticks.fetch_add(1, std::memory_order_relaxed);
+    op_output.emit(out_message, "out");
+  }
+
+  void stats(BenchStats* stats) { stats_ = stats; }
+
+ private:
+  Parameter<std::vector<IOSpec*>> receivers_;
+  BenchStats* stats_ = nullptr;
+};
+
+class BenchSinkOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(BenchSinkOp)
+
+  BenchSinkOp() = default;
+
+  void setup(OperatorSpec& spec) override { spec.input<std::shared_ptr<BenchMessage>>("in"); }
+
+  void compute(InputContext& op_input, OutputContext&, ExecutionContext&) override {
+    auto message = op_input.receive<std::shared_ptr<BenchMessage>>("in").value();
+    int64_t now_ns = benchmark::steady_now_ns();
+    int64_t hops = message->hops + 1;  // the edge into the sink
+    int64_t latency_ns = now_ns - message->emit_time_ns;
+
+    stats_->ticks.fetch_add(1, std::memory_order_relaxed);
+    std::scoped_lock lock(stats_->mutex);
+    stats_->last_receive_ns = now_ns;
+    stats_->latencies_ns.push_back(latency_ns);
+    stats_->overheads_ns.push_back((latency_ns - message->compute_ns) / hops);
+    stats_->total_hops += hops;
+  }
+
+  void stats(BenchStats* stats) { stats_ = stats; }
+
+ private:
+  BenchStats* stats_ = nullptr;
+};
+
+}  // namespace holoscan::ops
+
+namespace holoscan::benchmark {
+
+enum class Topology { kChain, kFanOutFanIn, kDiamond };
+enum class SchedulerKind { kGreedy, kMultiThread };
+enum class ClockKind { kManual, kRealtime, kTsc };
+
+static const char* to_string(Topology topology) {
+  switch (topology) {
+    case Topology::kChain:
+      return "chain";
+    case Topology::kFanOutFanIn:
+      return "fanout";
+    case Topology::kDiamond:
+      return "diamond";
+  }
+  return "unknown";
+}
+
+static const char* to_string(SchedulerKind scheduler) {
+  switch (scheduler) {
+    case SchedulerKind::kGreedy:
+      return "greedy";
+    case SchedulerKind::kMultiThread:
+      return "multithread";
+  }
+  return "unknown";
+}
+
+static const char* to_string(ClockKind clock) {
+  switch (clock) {
+    case ClockKind::kManual:
+      return "manual";
+    case ClockKind::kRealtime:
+      return "realtime";
+    case ClockKind::kTsc:
+      return "tsc";
+  }
+  return "unknown";
+}
+
+struct BenchConfig {
+  Topology topology = Topology::kChain;
+  SchedulerKind scheduler = SchedulerKind::kGreedy;
+  ClockKind clock = ClockKind::kManual;
+  int64_t num_ops = 4;          ///< number of intermediate (work) operators
+  int64_t num_messages = 1000;  ///< number of messages emitted by the source
+  int64_t compute_cost = 0;     ///< busy-loop iterations per work operator tick
+  int64_t period_ns = 0;        ///< source period (0: emit as fast as possible)
+  int64_t worker_threads = 4;   ///< worker threads of the MultiThreadScheduler
+};
+
+class SchedulerBenchmarkApp : public holoscan::Application {
+ public:
+  SchedulerBenchmarkApp(const BenchConfig& config, BenchStats* stats)
+      : config_(config), stats_(stats) {}
+
+  void compose() override {
+    using namespace holoscan;
+
+    std::shared_ptr<ops::BenchSourceOp> source;
+    if (config_.period_ns > 0) {
+      source = make_operator<ops::BenchSourceOp>(
+          "source",
+          make_condition<CountCondition>("count", config_.num_messages),
+          make_condition<PeriodicCondition>("periodic", config_.period_ns));
+    } else {
+      source = make_operator<ops::BenchSourceOp>(
+          "source", make_condition<CountCondition>("count", config_.num_messages));
+    }
+    source->stats(stats_);
+    auto sink = make_operator<ops::BenchSinkOp>("sink");
+    sink->stats(stats_);
+
+    const int64_t num_ops = std::max<int64_t>(config_.num_ops, 1);
+    switch (config_.topology) {
+      case Topology::kChain: {
+        std::shared_ptr<Operator> prev = source;
+        for (int64_t i = 0; i < num_ops; ++i) {
+          auto work = make_work_op(fmt::format("work{}", i));
+          add_flow(prev, work);
+          prev = work;
+        }
+        add_flow(prev, sink);
+      } break;
+      case Topology::kFanOutFanIn: {
+        auto join = make_join_op("join");
+        for (int64_t i = 0; i < num_ops; ++i) {
+          auto work = make_work_op(fmt::format("work{}", i));
+          add_flow(source, work);
+          add_flow(work, join, {{"out", "receivers"}});
+        }
+        add_flow(join, sink);
+      } break;
+      case Topology::kDiamond: {
+        // Each diamond is made of a head, two branches and a join operator.
+        const int64_t num_diamonds = std::max<int64_t>(num_ops / 3, 1);
+        std::shared_ptr<Operator> prev = source;
+        for (int64_t i = 0; i < num_diamonds; ++i) {
+          auto head = make_work_op(fmt::format("head{}", i));
+          auto left = make_work_op(fmt::format("left{}", i));
+          auto right = make_work_op(fmt::format("right{}", i));
+          auto join = make_join_op(fmt::format("join{}", i));
+          add_flow(prev, head);
+          add_flow(head, left);
+          add_flow(head, right);
+          add_flow(left, join, {{"out", "receivers"}});
+          add_flow(right, join, {{"out", "receivers"}});
+          prev = join;
+        }
+        add_flow(prev, sink);
+      } break;
+    }
+  }
+
+ private:
+  std::shared_ptr<ops::BenchWorkOp> make_work_op(const std::string& name) {
+    auto op = make_operator<ops::BenchWorkOp>(name, Arg("compute_cost", config_.compute_cost));
+    op->stats(stats_);
+    return op;
+  }
+
+  std::shared_ptr<ops::BenchJoinOp> make_join_op(const std::string& name) {
+    auto op = make_operator<ops::BenchJoinOp>(name);
+    op->stats(stats_);
+    return op;
+  }
+
+  BenchConfig config_;
+  BenchStats* stats_ = nullptr;
+};
+
+static std::string run_benchmark(const BenchConfig& config) {
+  BenchStats stats;
+  stats.reset(config.num_messages);
+
+  auto app = holoscan::make_application<SchedulerBenchmarkApp>(config, &stats);
+
+  std::shared_ptr<Clock> clock;
+  if (config.clock == ClockKind::kManual) {
+    clock = app->make_resource<ManualClock>("manual_clock");
+  } else if (config.clock == ClockKind::kRealtime) {
+    clock = app->make_resource<RealtimeClock>("realtime_clock");
+  } else {
+    clock = app->make_resource<TscClock>("tsc_clock");
+  }
+
+  if (config.scheduler == SchedulerKind::kGreedy) {
+    app->scheduler(app->make_scheduler<GreedyScheduler>(
+        "greedy_scheduler", Arg("clock", clock), Arg("stop_on_deadlock", true)));
+  } else {
+    app->scheduler(app->make_scheduler<MultiThreadScheduler>(
+        "multithread_scheduler",
+        Arg("clock", clock),
+        Arg("worker_thread_number", config.worker_threads),
+        Arg("check_recession_period_ms", 0.0),
+        Arg("stop_on_deadlock", true),
+        Arg("stop_on_deadlock_timeout", 100L)));
+  }
+
+  int64_t run_start_ns = steady_now_ns();
+  app->run();
+  int64_t run_end_ns = steady_now_ns();
+
+  std::sort(stats.latencies_ns.begin(), stats.latencies_ns.end());
+  std::sort(stats.overheads_ns.begin(), stats.overheads_ns.end());
+
+  const int64_t elapsed_ns =
+      (stats.first_emit_ns > 0 && stats.last_receive_ns > stats.first_emit_ns)
+          ? stats.last_receive_ns - stats.first_emit_ns
+          : run_end_ns - run_start_ns;
+  const double elapsed_s = static_cast<double>(elapsed_ns) / 1e9;
+  const uint64_t ticks = stats.ticks.load();
+  const size_t received = stats.latencies_ns.size();
+
+  std::ostringstream out;
+  out << "{";
+  out << fmt::format(R"("topology": "{}", )", to_string(config.topology));
+  out << fmt::format(R"("scheduler": "{}", )", to_string(config.scheduler));
+  out << fmt::format(R"("clock": "{}", )", to_string(config.clock));
+  out << fmt::format(R"("num_ops": {}, )", config.num_ops);
+  out << fmt::format(R"("num_messages": {}, )", config.num_messages);
+  out << fmt::format(R"("compute_cost": {}, )", config.compute_cost);
+  out << fmt::format(R"("period_ns": {}, )", config.period_ns);
+  out << fmt::format(R"("worker_threads": {}, )",
+                     config.scheduler == SchedulerKind::kMultiThread ? config.worker_threads : 1);
+  out << fmt::format(R"("messages_received": {}, )", received);
+  out << fmt::format(R"("ticks": {}, )", ticks);
+  out << fmt::format(R"("elapsed_s": {:.6f}, )", elapsed_s);
+  out << fmt::format(R"("run_wall_s": {:.6f}, )", (run_end_ns - run_start_ns) / 1e9);
+  out << fmt::format(R"("ticks_per_s": {:.1f}, )", elapsed_s > 0 ? ticks / elapsed_s : 0.0);
+  out << fmt::format(R"("messages_per_s": {:.1f}, )", elapsed_s > 0 ? received / elapsed_s : 0.0);
+  out << fmt::format(R"("hops_per_message": {:.2f}, )",
+                     received > 0 ? static_cast<double>(stats.total_hops) / received : 0.0);
+  out << fmt::format(R"("per_hop_overhead_ns": {{"mean": {:.1f}, "p50": {}, "p99": {}}}, )",
+                     mean(stats.overheads_ns),
+                     percentile(stats.overheads_ns, 50.0),
+                     percentile(stats.overheads_ns, 99.0));
+  out << latency_json(stats.latencies_ns);
+  out << "}";
+  return out.str();
+}
+
+}  // namespace holoscan::benchmark
+
+int main(int argc, char** argv) {
+  using namespace holoscan::benchmark;
+
+  CLI::App cli{"Holoscan scheduler benchmark"};
+
+  std::vector<std::string> topologies{"chain", "fanout", "diamond"};
+  std::vector<std::string> schedulers{"greedy", "multithread"};
+  std::vector<std::string> clocks{"manual", "realtime"};
+  BenchConfig base_config;
+  CommonOptions options;
+
+  cli.add_option("--topology", topologies, "Graph topologies (chain, fanout, diamond)")
+      ->delimiter(',');
+  cli.add_option("--scheduler", schedulers, "Schedulers (greedy, multithread)")->delimiter(',');
+  cli.add_option("--clock", clocks, "Clocks (manual, realtime, tsc)")->delimiter(',');
+  cli.add_option("--ops", base_config.num_ops, "Number of intermediate operators");
+  cli.add_option("--messages", base_config.num_messages, "Number of messages emitted");
+  cli.add_option("--compute-cost", base_config.compute_cost, "Busy-loop iterations per tick");
+  cli.add_option("--period-ns", base_config.period_ns, "Source period in ns (0: unthrottled)");
+  cli.add_option("--threads", base_config.worker_threads, "MultiThreadScheduler worker threads");
+  add_common_options(cli, options);
+  CLI11_PARSE(cli, argc, argv);
+
+  set_default_log_level();
+
+  std::vector<std::string> results;
+  for (const auto& topology_name : topologies) {
+    for (const auto& scheduler_name : schedulers) {
+      for (const auto& clock_name : clocks) {
+        BenchConfig config = base_config;
+        if (topology_name == "chain") {
+          config.topology = Topology::kChain;
+        } else if (topology_name == "fanout") {
+          config.topology = Topology::kFanOutFanIn;
+        } else if (topology_name == "diamond") {
+          config.topology = Topology::kDiamond;
+        } else {
+          std::cerr << "Unknown topology: " << topology_name << std::endl;
+          return 1;
+        }
+        if (scheduler_name == "greedy") {
+          config.scheduler = SchedulerKind::kGreedy;
+        } else if (scheduler_name == "multithread") {
+          config.scheduler = SchedulerKind::kMultiThread;
+        } else {
+          std::cerr << "Unknown scheduler: " << scheduler_name << std::endl;
+          return 1;
+        }
+        if (clock_name == "manual") {
+          config.clock = ClockKind::kManual;
+        } else if (clock_name == "realtime") {
+          config.clock = ClockKind::kRealtime;
+        } else if (clock_name == "tsc") {
+          config.clock = ClockKind::kTsc;
+        } else {
+          std::cerr << "Unknown clock: " << clock_name << std::endl;
+          return 1;
+        }
+        for (int i = 0; i < options.repetitions; ++i) { results.push_back(run_benchmark(config)); }
+      }
+    }
+  }
+
+  write_report("scheduler", results, options);
+  return 0;
+}
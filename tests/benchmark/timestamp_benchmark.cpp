@@ -0,0 +1,220 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Timestamp cost benchmark.
+//
+// Measures the cost of a call to each timestamp source used by the SDK: the CPU cycle counter
+// (TscCounter), clock_gettime(CLOCK_MONOTONIC), the std::chrono clocks, the data flow tracking
+// timestamps (get_current_time_us()) and the timestamp() of the RealtimeClock and TscClock
+// resources, read from an operator while the scheduler runs with that clock.
+//
+// Each source is called `--calls` times per batch. The per-call cost of each batch (mean, p50, p99
+// over the batches) and the smallest non-zero difference between two consecutive timestamps
+// (resolution) are reported as JSON.
+//
+// Example:
+//   ./timestamp_benchmark --calls 1000 --batches 1000 --output out.json
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <CLI/CLI.hpp>
+#include <holoscan/holoscan.hpp>
+#include <holoscan/core/messagelabel.hpp>
+#include <holoscan/core/system/tsc_counter.hpp>
+
+#include "./benchmark_utils.hpp"
+
+namespace holoscan::benchmark {
+
+struct BenchConfig {
+  int64_t calls = 1000;    ///< timestamp calls per batch
+  int64_t batches = 1000;  ///< number of measured batches
+};
+
+/// Per-call cost and resolution of a timestamp source.
+struct SourceStats {
+  std::vector<double> per_call_ns;  ///< mean cost of a call in each batch
+  int64_t resolution = std::numeric_limits<int64_t>::max();
+};
+
+template <typename ReadT>
+static SourceStats measure(const BenchConfig& config, ReadT read) {
+  SourceStats stats;
+  stats.per_call_ns.reserve(config.batches);
+  volatile int64_t sink = 0;
+  for (int64_t batch = 0; batch < config.batches; ++batch) {
+    int64_t previous = read();
+    const auto start = std::chrono::steady_clock::now();
+    for (int64_t i = 0; i < config.calls; ++i) {
+      const int64_t value = read();
+      const int64_t delta = value - previous;
+      if (delta > 0 && delta < stats.resolution) { stats.resolution = delta; }
+      previous = value;
+    }
+    const auto end = std::chrono::steady_clock::now();
+    sink = previous;
+    stats.per_call_ns.push_back(std::chrono::duration<double, std::nano>(end - start).count() /
+                                static_cast<double>(config.calls));
+  }
+  (void)sink;
+  return stats;
+}
+
+static std::string to_json(const std::string& source, const std::string& unit,
+                           const SourceStats& stats) {
+  const bool has_resolution = stats.resolution != std::numeric_limits<int64_t>::max();
+  std::vector<double> per_call_ns = stats.per_call_ns;
+  std::sort(per_call_ns.begin(), per_call_ns.end());
+  return fmt::format(
+      R"({{"source": "{}", "per_call_ns": {{"mean": {:.2f}, "p50": {:.2f}, "p99": {:.2f}}}, )"
+      R"("resolution": {}, "unit": "{}"}})",
+      source,
+      mean(per_call_ns),
+      percentile(per_call_ns, 50.0),
+      percentile(per_call_ns, 99.0),
+      has_resolution ? stats.resolution : 0,
+      unit);
+}
+
+}  // namespace holoscan::benchmark
+
+namespace holoscan::ops {
+
+/// Operator measuring the timestamp() cost of the clock used by the scheduler.
+class ClockProbeOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(ClockProbeOp)
+
+  ClockProbeOp() = default;
+
+  void setup(OperatorSpec&) override {}
+
+  void compute(InputContext&, OutputContext&, ExecutionContext&) override {
+    *stats_ = benchmark::measure(*config_, [this]() { return clock_->timestamp(); });
+  }
+
+  void probe(std::shared_ptr<Clock> clock, const benchmark::BenchConfig* config,
+             benchmark::SourceStats* stats) {
+    clock_ = std::move(clock);
+    config_ = config;
+    stats_ = stats;
+  }
+
+ private:
+  std::shared_ptr<Clock> clock_;
+  const benchmark::BenchConfig* config_ = nullptr;
+  benchmark::SourceStats* stats_ = nullptr;
+};
+
+}  // namespace holoscan::ops
+
+namespace holoscan::benchmark {
+
+class ClockProbeApp : public holoscan::Application {
+ public:
+  ClockProbeApp(const std::string& clock_name, const BenchConfig& config, SourceStats* stats)
+      : clock_name_(clock_name), config_(config), stats_(stats) {}
+
+  void compose() override {
+    using namespace holoscan;
+
+    std::shared_ptr<Clock> clock;
+    if (clock_name_ == "tsc") {
+      clock = make_resource<TscClock>("tsc_clock");
+    } else {
+      clock = make_resource<RealtimeClock>("realtime_clock");
+    }
+    scheduler(make_scheduler<GreedyScheduler>("greedy_scheduler", Arg("clock", clock)));
+
+    auto probe =
+        make_operator<ops::ClockProbeOp>("probe", make_condition<CountCondition>("count", 1L));
+    probe->probe(clock, &config_, stats_);
+    add_operator(probe);
+  }
+
+ private:
+  std::string clock_name_;
+  BenchConfig config_;
+  SourceStats* stats_ = nullptr;
+};
+
+static SourceStats measure_clock_resource(const std::string& clock_name,
+                                          const BenchConfig& config) {
+  SourceStats stats;
+  auto app = holoscan::make_application<ClockProbeApp>(clock_name, config, &stats);
+  app->run();
+  return stats;
+}
+
+}  // namespace holoscan::benchmark
+
+int main(int argc, char** argv) {
+  using namespace holoscan::benchmark;
+  using holoscan::TscCounter;
+
+  CLI::App cli{"Holoscan timestamp cost benchmark"};
+
+  BenchConfig config;
+  CommonOptions options;
+
+  cli.add_option("--calls", config.calls, "Number of timestamp calls per batch");
+  cli.add_option("--batches", config.batches, "Number of measured batches");
+  add_common_options(cli, options, false);
+  CLI11_PARSE(cli, argc, argv);
+
+  set_default_log_level();
+
+  const TscCounter& counter = TscCounter::instance();
+
+  std::vector<std::string> results;
+  results.push_back(to_json(
+      "tsc_counter_now_ns", "ns", measure(config, [&counter]() { return counter.now_ns(); })));
+  results.push_back(to_json("tsc_counter_ticks", "ticks", measure(config, [&counter]() {
+                              return static_cast<int64_t>(counter.ticks());
+                            })));
+  results.push_back(to_json("clock_gettime_monotonic", "ns", measure(config, []() {
+                              return TscCounter::monotonic_ns();
+                            })));
+  results.push_back(to_json("steady_clock", "ns", measure(config, []() {
+                              return static_cast<int64_t>(
+                                  std::chrono::steady_clock::now().time_since_epoch().count());
+                            })));
+  results.push_back(to_json("system_clock", "ns", measure(config, []() {
+                              return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                         std::chrono::system_clock::now().time_since_epoch())
+                                  .count();
+                            })));
+  results.push_back(to_json(
+      "dfft_timestamp", "us", measure(config, []() { return holoscan::get_current_time_us(); })));
+  results.push_back(
+      to_json("realtime_clock_resource", "ns", measure_clock_resource("realtime", config)));
+  results.push_back(to_json("tsc_clock_resource", "ns", measure_clock_resource("tsc", config)));
+
+  write_report("timestamp",
+               results,
+               options,
+               {{"tsc_source", fmt::format("\"{}\"", counter.source_name())},
+                {"tsc_frequency_hz", fmt::format("{:.0f}", counter.frequency_hz())}});
+  return 0;
+}
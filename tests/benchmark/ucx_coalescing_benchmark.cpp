@@ -0,0 +1,214 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// UCX message coalescing benchmark.
+//
+// Sends small messages from a source fragment to a sink fragment over a UCX connection on
+// localhost, for several coalescing windows (HOLOSCAN_UCX_COALESCING_WINDOW_US, 0 disables
+// coalescing). The source stamps each message with the steady_clock time at which it is emitted;
+// the sink records the latency when it is received. The throughput and the latency added by the
+// coalescing window can be compared between the runs.
+//
+// Both fragments run in this process (shared memory transport disabled). Results are reported as
+// JSON.
+//
+// Example:
+//   ./ucx_coalescing_benchmark --window 0,20,100 --messages 100000 --payload-bytes 64
+
+#include <stdlib.h>  // POSIX setenv
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <CLI/CLI.hpp>
+#include <holoscan/holoscan.hpp>
+
+#include "./benchmark_utils.hpp"
+
+namespace holoscan::ops {
+
+using benchmark::LatencyStats;
+
+// The first element of each message is the emit time, the remaining ones are the payload.
+class StampedVectorSourceOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(StampedVectorSourceOp)
+
+  StampedVectorSourceOp() = default;
+
+  void setup(OperatorSpec& spec) override {
+    spec.output<std::vector<int64_t>>("out");
+    spec.param(payload_bytes_, "payload_bytes", "Payload size", "Payload size in bytes", 0L);
+  }
+
+  void compute(InputContext&, OutputContext& op_output, ExecutionContext&) override {
+    std::vector<int64_t> message(1 + payload_bytes_.get() / sizeof(int64_t), 0);
+    message[0] = benchmark::steady_now_ns();
+    op_output.emit(message, "out");
+  }
+
+ private:
+  Parameter<int64_t> payload_bytes_;
+};
+
+class StampedVectorSinkOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(StampedVectorSinkOp)
+
+  StampedVectorSinkOp() = default;
+
+  void setup(OperatorSpec& spec) override { spec.input<std::vector<int64_t>>("in"); }
+
+  void compute(InputContext& op_input, OutputContext&, ExecutionContext&) override {
+    auto message = op_input.receive<std::vector<int64_t>>("in").value();
+    int64_t now_ns = benchmark::steady_now_ns();
+    std::lock_guard<std::mutex> lock(stats_->mutex);
+    if (stats_->first_emit_ns == 0) { stats_->first_emit_ns = message[0]; }
+    stats_->last_receive_ns = now_ns;
+    stats_->latencies_ns.push_back(now_ns - message[0]);
+  }
+
+  void stats(LatencyStats* stats) { stats_ = stats; }
+
+ private:
+  LatencyStats* stats_ = nullptr;
+};
+
+}  // namespace holoscan::ops
+
+namespace holoscan::benchmark {
+
+struct BenchConfig {
+  int64_t coalescing_window_us = 0;  ///< 0 disables coalescing
+  int64_t num_messages = 10000;      ///< number of messages emitted by the source
+  int64_t payload_bytes = 8;         ///< payload size of each message
+};
+
+class SourceFragment : public holoscan::Fragment {
+ public:
+  explicit SourceFragment(const BenchConfig& config) : config_(config) {}
+
+  void compose() override {
+    auto source = make_operator<ops::StampedVectorSourceOp>(
+        "source",
+        make_condition<CountCondition>("count", config_.num_messages),
+        Arg("payload_bytes", config_.payload_bytes));
+    add_operator(source);
+  }
+
+ private:
+  BenchConfig config_;
+};
+
+class SinkFragment : public holoscan::Fragment {
+ public:
+  explicit SinkFragment(LatencyStats* stats) : stats_(stats) {}
+
+  void compose() override {
+    auto sink = make_operator<ops::StampedVectorSinkOp>("sink");
+    sink->stats(stats_);
+    add_operator(sink);
+  }
+
+ private:
+  LatencyStats* stats_ = nullptr;
+};
+
+class UcxCoalescingBenchmarkApp : public holoscan::Application {
+ public:
+  UcxCoalescingBenchmarkApp(const BenchConfig& config, LatencyStats* stats)
+      : config_(config), stats_(stats) {}
+
+  void compose() override {
+    using namespace holoscan;
+
+    auto source_fragment = make_fragment<SourceFragment>("source_fragment", config_);
+    auto sink_fragment = make_fragment<SinkFragment>("sink_fragment", stats_);
+    add_flow(source_fragment, sink_fragment, {{"source.out", "sink.in"}});
+  }
+
+ private:
+  BenchConfig config_;
+  LatencyStats* stats_ = nullptr;
+};
+
+static std::string run_benchmark(const BenchConfig& config) {
+  LatencyStats stats;
+  stats.latencies_ns.reserve(config.num_messages);
+
+  setenv("HOLOSCAN_UCX_COALESCING_WINDOW_US",
+         std::to_string(config.coalescing_window_us).c_str(),
+         1);
+  auto app = holoscan::make_application<UcxCoalescingBenchmarkApp>(config, &stats);
+  app->run();
+
+  std::sort(stats.latencies_ns.begin(), stats.latencies_ns.end());
+  const size_t received = stats.latencies_ns.size();
+  const double elapsed_s = stats.last_receive_ns > stats.first_emit_ns
+                               ? (stats.last_receive_ns - stats.first_emit_ns) / 1e9
+                               : 0.0;
+
+  std::ostringstream out;
+  out << "{";
+  out << fmt::format(R"("coalescing_window_us": {}, )", config.coalescing_window_us);
+  out << fmt::format(R"("num_messages": {}, )", config.num_messages);
+  out << fmt::format(R"("payload_bytes": {}, )", config.payload_bytes);
+  out << fmt::format(R"("messages_received": {}, )", received);
+  out << fmt::format(R"("messages_per_s": {:.1f}, )", elapsed_s > 0 ? received / elapsed_s : 0.0);
+  out << latency_json(stats.latencies_ns);
+  out << "}";
+  return out.str();
+}
+
+}  // namespace holoscan::benchmark
+
+int main(int argc, char** argv) {
+  using namespace holoscan::benchmark;
+
+  CLI::App cli{"Holoscan UCX message coalescing benchmark"};
+
+  std::vector<int64_t> windows{0, 20, 100};
+  BenchConfig base_config;
+  CommonOptions options;
+
+  cli.add_option("--window", windows, "Coalescing windows in microseconds (0: no coalescing)")
+      ->delimiter(',');
+  cli.add_option("--messages", base_config.num_messages, "Number of messages emitted");
+  cli.add_option("--payload-bytes", base_config.payload_bytes, "Payload size of each message");
+  add_common_options(cli, options);
+  CLI11_PARSE(cli, argc, argv);
+
+  set_default_log_level();
+  // Force the UCX connection between the two fragments of this process.
+  setenv("HOLOSCAN_ENABLE_SHARED_MEMORY_TRANSPORT", "false", 1);
+
+  std::vector<std::string> results;
+  for (auto window : windows) {
+    BenchConfig config = base_config;
+    config.coalescing_window_us = window;
+    for (int i = 0; i < options.repetitions; ++i) { results.push_back(run_benchmark(config)); }
+  }
+
+  write_report("ucx_coalescing", results, options);
+  return 0;
+}
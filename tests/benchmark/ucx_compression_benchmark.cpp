@@ -0,0 +1,249 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// UCX payload compression benchmark.
+//
+// Sends mask-like (highly compressible) messages from a source fragment to a sink fragment over a
+// UCX connection on localhost, for several compression algorithms (HOLOSCAN_UCX_COMPRESSION). The
+// throughput in messages and in (uncompressed) bytes per second can be compared between the runs.
+//
+// Both fragments run in this process (shared memory transport disabled). The serialization buffer
+// is sized so that the compressed payloads fit inline. Results are reported as JSON.
+//
+// Example:
+//   ./ucx_compression_benchmark --compression none,lz4,zstd --messages 1000 --payload-bytes 4194304
+
+#include <stdlib.h>  // POSIX setenv
+
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <CLI/CLI.hpp>
+#include <holoscan/holoscan.hpp>
+#include <holoscan/core/payload_compression.hpp>
+
+#include "./benchmark_utils.hpp"
+
+namespace holoscan::benchmark {
+
+/// Throughput recorded by the sink.
+struct ThroughputStats {
+  std::mutex mutex;
+  int64_t first_receive_ns = 0;
+  int64_t last_receive_ns = 0;
+  int64_t messages_received = 0;
+  int64_t bytes_received = 0;
+  int64_t corrupted_messages = 0;
+};
+
+}  // namespace holoscan::benchmark
+
+namespace holoscan::ops {
+
+using benchmark::ThroughputStats;
+
+// Emits a mask-like message: runs of a few distinct labels, similar to a segmentation output.
+class MaskSourceOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(MaskSourceOp)
+
+  MaskSourceOp() = default;
+
+  void setup(OperatorSpec& spec) override {
+    spec.output<std::vector<uint8_t>>("out");
+    spec.param(payload_bytes_, "payload_bytes", "Payload size", "Payload size in bytes", 0L);
+  }
+
+  void initialize() override {
+    Operator::initialize();
+    mask_.resize(payload_bytes_.get());
+    for (size_t i = 0; i < mask_.size(); ++i) { mask_[i] = static_cast<uint8_t>((i / 997) % 4); }
+  }
+
+  void compute(InputContext&, OutputContext& op_output, ExecutionContext&) override {
+    op_output.emit(mask_, "out");
+  }
+
+ private:
+  Parameter<int64_t> payload_bytes_;
+  std::vector<uint8_t> mask_;
+};
+
+class MaskSinkOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(MaskSinkOp)
+
+  MaskSinkOp() = default;
+
+  void setup(OperatorSpec& spec) override { spec.input<std::vector<uint8_t>>("in"); }
+
+  void compute(InputContext& op_input, OutputContext&, ExecutionContext&) override {
+    auto message = op_input.receive<std::vector<uint8_t>>("in").value();
+    int64_t now_ns = benchmark::steady_now_ns();
+    // Spot-check the payload so that a broken round trip doesn't go unnoticed.
+    bool corrupted = !message.empty() && message.back() != ((message.size() - 1) / 997) % 4;
+    std::lock_guard<std::mutex> lock(stats_->mutex);
+    if (stats_->first_receive_ns == 0) { stats_->first_receive_ns = now_ns; }
+    stats_->last_receive_ns = now_ns;
+    stats_->messages_received++;
+    stats_->bytes_received += message.size();
+    if (corrupted) { stats_->corrupted_messages++; }
+  }
+
+  void stats(ThroughputStats* stats) { stats_ = stats; }
+
+ private:
+  ThroughputStats* stats_ = nullptr;
+};
+
+}  // namespace holoscan::ops
+
+namespace holoscan::benchmark {
+
+struct BenchConfig {
+  std::string compression = "none";   ///< compression algorithm ('none', 'lz4' or 'zstd')
+  int32_t compression_level = 0;      ///< 0 uses the default level of the algorithm
+  int64_t num_messages = 1000;        ///< number of messages emitted by the source
+  int64_t payload_bytes = 4 << 20;    ///< payload size of each message
+};
+
+class SourceFragment : public holoscan::Fragment {
+ public:
+  explicit SourceFragment(const BenchConfig& config) : config_(config) {}
+
+  void compose() override {
+    auto source = make_operator<ops::MaskSourceOp>(
+        "source",
+        make_condition<CountCondition>("count", config_.num_messages),
+        Arg("payload_bytes", config_.payload_bytes));
+    add_operator(source);
+  }
+
+ private:
+  BenchConfig config_;
+};
+
+class SinkFragment : public holoscan::Fragment {
+ public:
+  explicit SinkFragment(ThroughputStats* stats) : stats_(stats) {}
+
+  void compose() override {
+    auto sink = make_operator<ops::MaskSinkOp>("sink");
+    sink->stats(stats_);
+    add_operator(sink);
+  }
+
+ private:
+  ThroughputStats* stats_ = nullptr;
+};
+
+class UcxCompressionBenchmarkApp : public holoscan::Application {
+ public:
+  UcxCompressionBenchmarkApp(const BenchConfig& config, ThroughputStats* stats)
+      : config_(config), stats_(stats) {}
+
+  void compose() override {
+    using namespace holoscan;
+
+    auto source_fragment = make_fragment<SourceFragment>("source_fragment", config_);
+    auto sink_fragment = make_fragment<SinkFragment>("sink_fragment", stats_);
+    add_flow(source_fragment, sink_fragment, {{"source.out", "sink.in"}});
+  }
+
+ private:
+  BenchConfig config_;
+  ThroughputStats* stats_ = nullptr;
+};
+
+static std::string run_benchmark(const BenchConfig& config) {
+  ThroughputStats stats;
+
+  setenv("HOLOSCAN_UCX_COMPRESSION", config.compression.c_str(), 1);
+  setenv("HOLOSCAN_UCX_COMPRESSION_LEVEL", std::to_string(config.compression_level).c_str(), 1);
+  auto app = holoscan::make_application<UcxCompressionBenchmarkApp>(config, &stats);
+  app->run();
+
+  // The first message is excluded from the measurement (it starts the clock).
+  const int64_t measured = stats.messages_received > 1 ? stats.messages_received - 1 : 0;
+  const double elapsed_s = stats.last_receive_ns > stats.first_receive_ns
+                               ? (stats.last_receive_ns - stats.first_receive_ns) / 1e9
+                               : 0.0;
+
+  std::ostringstream out;
+  out << "{";
+  out << fmt::format(R"("compression": "{}", )", config.compression);
+  out << fmt::format(R"("compression_level": {}, )", config.compression_level);
+  out << fmt::format(R"("num_messages": {}, )", config.num_messages);
+  out << fmt::format(R"("payload_bytes": {}, )", config.payload_bytes);
+  out << fmt::format(R"("messages_received": {}, )", stats.messages_received);
+  out << fmt::format(R"("corrupted_messages": {}, )", stats.corrupted_messages);
+  out << fmt::format(R"("messages_per_s": {:.1f}, )", elapsed_s > 0 ? measured / elapsed_s : 0.0);
+  out << fmt::format(R"("megabytes_per_s": {:.1f})",
+                     elapsed_s > 0 ? measured * config.payload_bytes / elapsed_s / 1e6 : 0.0);
+  out << "}";
+  return out.str();
+}
+
+}  // namespace holoscan::benchmark
+
+int main(int argc, char** argv) {
+  using namespace holoscan::benchmark;
+
+  CLI::App cli{"Holoscan UCX payload compression benchmark"};
+
+  std::vector<std::string> algorithms{"none", "lz4", "zstd"};
+  BenchConfig base_config;
+  CommonOptions options;
+
+  cli.add_option("--compression", algorithms, "Compression algorithms ('none', 'lz4' or 'zstd')")
+      ->delimiter(',');
+  cli.add_option("--level", base_config.compression_level, "Compression level (0: default)");
+  cli.add_option("--messages", base_config.num_messages, "Number of messages emitted");
+  cli.add_option("--payload-bytes", base_config.payload_bytes, "Payload size of each message");
+  add_common_options(cli, options);
+  CLI11_PARSE(cli, argc, argv);
+
+  set_default_log_level();
+  // Force the UCX connection between the two fragments of this process.
+  setenv("HOLOSCAN_ENABLE_SHARED_MEMORY_TRANSPORT", "false", 1);
+  // Leave room for the (uncompressed) payload in the serialization buffer.
+  if (std::getenv("HOLOSCAN_UCX_SERIALIZATION_BUFFER_SIZE") == nullptr) {
+    setenv("HOLOSCAN_UCX_SERIALIZATION_BUFFER_SIZE",
+           std::to_string(base_config.payload_bytes + (1 << 20)).c_str(),
+           1);
+  }
+
+  std::vector<std::string> results;
+  for (const auto& algorithm : algorithms) {
+    auto parsed = holoscan::PayloadCompression::from_string(algorithm);
+    if (!parsed || !holoscan::PayloadCompression::is_available(parsed.value())) {
+      HOLOSCAN_LOG_WARN("Skipping unavailable compression algorithm '{}'", algorithm);
+      continue;
+    }
+    BenchConfig config = base_config;
+    config.compression = algorithm;
+    for (int i = 0; i < options.repetitions; ++i) { results.push_back(run_benchmark(config)); }
+  }
+
+  write_report("ucx_compression", results, options);
+  return 0;
+}
@@ -16,11 +16,13 @@
  */
 #include <gtest/gtest.h>
 
+#include <atomic>
 #include <complex>
 #include <cstdint>
 #include <memory>
 #include <set>
 #include <string>
+#include <thread>
 #include <typeindex>
 #include <vector>
 
@@ -60,6 +62,18 @@ TEST(CodecRegistry, TestAddCodec2) {
   codec_registry.add_codec(std::type_index(typeid(IntPair)), CodecRegistry::none_codec, "none-2");
 }
 
+TEST(CodecRegistry, TestCodecFieldsRegistration) {
+  auto codec_registry = CodecRegistry::get_instance();
+
+  // HOLOSCAN_CODEC_FIELDS (used in codecs.hpp) registers the codec during static initialization
+  auto maybe_index = codec_registry.name_to_index("holoscan::Detection"s);
+  ASSERT_TRUE(maybe_index);
+  EXPECT_EQ(maybe_index.value(), std::type_index(typeid(Detection)));
+  auto maybe_name = codec_registry.index_to_name(std::type_index(typeid(Detection)));
+  ASSERT_TRUE(maybe_name);
+  EXPECT_EQ(maybe_name.value(), "holoscan::Detection"s);
+}
+
 TEST(CodecRegistry, TestNameToTypeIndex) {
   auto codec_registry = CodecRegistry::get_instance();
   double d = 5.0;
@@ -141,4 +155,97 @@ TEST(CodecRegistry, TestGetCodecFromTypeIndex) {
   EXPECT_EQ(typeid(d), typeid(holoscan::CodecRegistry::none_deserialize));
 }
 
+TEST(CodecRegistry, TestCodecNames) {
+  auto codec_registry = CodecRegistry::get_instance();
+  auto& codec_names = codec_registry.codec_names();
+  ASSERT_FALSE(codec_names.empty());
+  // codec names are listed in registration order
+  EXPECT_EQ(codec_names[0], "bool"s);
+  EXPECT_EQ(std::set<std::string>(codec_names.begin(), codec_names.end()).size(),
+            codec_names.size());
+}
+
+TEST(CodecRegistry, TestCommonCodecTable) {
+  std::vector<std::vector<std::string>> codec_name_lists{
+      {"float"s, "double"s, "std::string"s, "int32_t"s},
+      {"int32_t"s, "std::string"s, "float"s},
+      {"std::string"s, "custom"s, "float"s, "int32_t"s}};
+  // the order of the first list is kept
+  auto codec_table = CodecRegistry::common_codec_table(codec_name_lists);
+  EXPECT_EQ(codec_table, std::vector<std::string>({"float"s, "std::string"s, "int32_t"s}));
+
+  EXPECT_TRUE(CodecRegistry::common_codec_table({}).empty());
+}
+
+TEST(CodecRegistry, TestCodecTable) {
+  auto codec_registry = CodecRegistry::get_instance();
+  EXPECT_EQ(codec_registry.codec_id(std::type_index(typeid(float))),
+            CodecRegistry::kInvalidCodecId);
+
+  codec_registry.set_codec_table({"unknown"s, "float"s, "std::string"s});
+  CodecRegistry::CodecId float_id = codec_registry.codec_id(std::type_index(typeid(float)));
+  CodecRegistry::CodecId string_id =
+      codec_registry.codec_id(std::type_index(typeid(std::string)));
+  EXPECT_EQ(float_id, 1);
+  EXPECT_EQ(string_id, 2);
+  EXPECT_EQ(codec_registry.codec_id(std::type_index(typeid(double))),
+            CodecRegistry::kInvalidCodecId);
+
+  // codecs added after the table is set get their id
+  codec_registry.add_codec<Coordinate>("unknown"s);
+  EXPECT_EQ(codec_registry.codec_id(std::type_index(typeid(Coordinate))), 0);
+
+  CodecRegistry::CodecId invalid_id = 3;
+  auto d = codec_registry.get_deserializer(invalid_id);
+  EXPECT_EQ(typeid(d), typeid(holoscan::CodecRegistry::none_deserialize));
+
+  // an empty table sends all codecs by name
+  codec_registry.set_codec_table({});
+  EXPECT_EQ(codec_registry.codec_id(std::type_index(typeid(float))),
+            CodecRegistry::kInvalidCodecId);
+}
+
+TEST(CodecRegistry, TestCodecTableSnapshot) {
+  auto codec_registry = CodecRegistry::get_instance();
+  codec_registry.set_codec_table({"unknown"s, "float"s});
+  auto codec_table = codec_registry.codec_table();
+  auto [float_id, serializer] = codec_table->find_serializer(std::type_index(typeid(float)));
+  EXPECT_EQ(float_id, 1);
+
+  // the snapshot is not affected by a new codec table
+  codec_registry.set_codec_table({});
+  EXPECT_EQ(codec_registry.codec_id(std::type_index(typeid(float))),
+            CodecRegistry::kInvalidCodecId);
+  EXPECT_EQ(codec_table->find_serializer(std::type_index(typeid(float))).first, 1);
+  EXPECT_TRUE(static_cast<bool>(serializer));
+  EXPECT_TRUE(static_cast<bool>(codec_table->find_deserializer(float_id)));
+  EXPECT_EQ(codec_table->find_serializer(std::type_index(typeid(double))).first,
+            CodecRegistry::kInvalidCodecId);
+}
+
+TEST(CodecRegistry, TestCodecTableConcurrentAccess) {
+  auto codec_registry = CodecRegistry::get_instance();
+  const auto float_index = std::type_index(typeid(float));
+
+  // look codecs up while the codec table is replaced
+  std::atomic<bool> done{false};
+  std::vector<std::thread> readers;
+  for (int i = 0; i < 4; ++i) {
+    readers.emplace_back([&]() {
+      while (!done.load()) {
+        auto codec_table = codec_registry.codec_table();
+        auto [id, serializer] = codec_table->find_serializer(float_index);
+        EXPECT_TRUE(id == 1 || id == CodecRegistry::kInvalidCodecId);
+        EXPECT_TRUE(static_cast<bool>(serializer));
+      }
+    });
+  }
+  for (int i = 0; i < 1000; ++i) {
+    codec_registry.set_codec_table({"unknown"s, "float"s});
+    codec_registry.set_codec_table({});
+  }
+  done = true;
+  for (auto& reader : readers) { reader.join(); }
+}
+
 }  // namespace holoscan
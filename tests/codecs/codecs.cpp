@@ -19,6 +19,7 @@
 #include <gtest/gtest.h>
 
 #include <cstdint>
+#include <cstring>
 #include <memory>
 #include <string>
 #include <vector>
@@ -331,6 +332,58 @@ TEST(Codecs, TestVectorFloat) {
   codec_vector_compare<std::vector<float>>(value);
 }
 
+TEST(Codecs, TestVectorFloatBorrowedSegment) {
+  // large enough to be registered as a borrowed segment instead of being copied
+  std::vector<float> value(Endpoint::kBorrowedSegmentMinSize);
+  for (size_t i = 0; i < value.size(); i++) { value[i] = static_cast<float>(i); }
+  auto endpoint = std::make_shared<MockUcxSerializationBuffer>(
+      4096, holoscan::Endpoint::MemoryStorageType::kSystem);
+
+  auto maybe_size = codec<std::vector<float>>::serialize(value, endpoint.get(), true);
+  ASSERT_TRUE(maybe_size);
+  EXPECT_EQ(maybe_size.value(),
+            sizeof(holoscan::ContiguousDataHeader) + value.size() * sizeof(float));
+  // only the header is copied to the buffer
+  EXPECT_EQ(endpoint->size(), sizeof(holoscan::ContiguousDataHeader));
+  EXPECT_EQ(endpoint->data_buffer_count(), 1);
+
+  auto maybe_value = codec<std::vector<float>>::deserialize(endpoint.get(), true);
+  ASSERT_TRUE(maybe_value);
+  EXPECT_EQ(maybe_value.value(), value);
+}
+
+TEST(Codecs, TestVectorFloatCopiedByDefault) {
+  // nested values (e.g. a member serialized by a user codec) may not outlive the send
+  std::vector<float> value(Endpoint::kBorrowedSegmentMinSize);
+  for (size_t i = 0; i < value.size(); i++) { value[i] = static_cast<float>(i); }
+  auto endpoint = std::make_shared<MockUcxSerializationBuffer>(
+      sizeof(holoscan::ContiguousDataHeader) + value.size() * sizeof(float),
+      holoscan::Endpoint::MemoryStorageType::kSystem);
+
+  auto maybe_size = codec<std::vector<float>>::serialize(value, endpoint.get());
+  ASSERT_TRUE(maybe_size);
+  EXPECT_EQ(endpoint->size(), maybe_size.value());
+  EXPECT_EQ(endpoint->data_buffer_count(), 0);
+
+  auto maybe_value = codec<std::vector<float>>::deserialize(endpoint.get());
+  ASSERT_TRUE(maybe_value);
+  EXPECT_EQ(maybe_value.value(), value);
+}
+
+TEST(Codecs, TestVectorStringBorrowedSegment) {
+  std::vector<std::string> value{std::string(Endpoint::kBorrowedSegmentMinSize, 'a'), "bc"s};
+  auto endpoint = std::make_shared<MockUcxSerializationBuffer>(
+      4096, holoscan::Endpoint::MemoryStorageType::kSystem);
+
+  auto maybe_size = codec<std::vector<std::string>>::serialize(value, endpoint.get(), true);
+  ASSERT_TRUE(maybe_size);
+  EXPECT_EQ(endpoint->data_buffer_count(), 1);
+
+  auto maybe_value = codec<std::vector<std::string>>::deserialize(endpoint.get(), true);
+  ASSERT_TRUE(maybe_value);
+  EXPECT_EQ(maybe_value.value(), value);
+}
+
 TEST(Codecs, TestVectorComplexFloat) {
   std::vector<std::complex<float>> value{{1.0, 1.5}, {2.0, 0.0}, {0.0, 3.0}};
   codec_vector_compare<std::vector<std::complex<float>>>(value);
@@ -357,6 +410,74 @@ TEST(Codecs, TestVectorVectorString) {
   codec_vector_vector_compare<std::vector<std::vector<std::string>>>(value, 4096);
 }
 
+TEST(Codecs, TestVectorStringContiguous) {
+  std::vector<std::string> value;
+  size_t num_chars = 0;
+  for (int i = 0; i < 1000; i++) {
+    value.push_back("label_"s + std::to_string(i));
+    num_chars += value.back().size();
+  }
+  value.push_back(""s);
+  auto endpoint = std::make_shared<MockUcxSerializationBuffer>(
+      32768, holoscan::Endpoint::MemoryStorageType::kSystem);
+
+  // one header, one offsets table and one data blob
+  auto maybe_size = codec<std::vector<std::string>>::serialize(value, endpoint.get());
+  ASSERT_TRUE(maybe_size);
+  EXPECT_EQ(maybe_size.value(),
+            sizeof(ContiguousVectorsHeader) + value.size() * sizeof(size_t) + num_chars);
+  EXPECT_EQ(endpoint->data_buffer_count(), 0);
+
+  auto maybe_value = codec<std::vector<std::string>>::deserialize(endpoint.get());
+  ASSERT_TRUE(maybe_value);
+  EXPECT_EQ(maybe_value.value(), value);
+}
+
+TEST(Codecs, TestVectorStringEmpty) {
+  std::vector<std::string> value;
+  auto endpoint = std::make_shared<MockUcxSerializationBuffer>(
+      512, holoscan::Endpoint::MemoryStorageType::kSystem);
+
+  auto maybe_size = codec<std::vector<std::string>>::serialize(value, endpoint.get());
+  ASSERT_TRUE(maybe_size);
+  EXPECT_EQ(maybe_size.value(), sizeof(ContiguousVectorsHeader));
+
+  auto maybe_value = codec<std::vector<std::string>>::deserialize(endpoint.get());
+  ASSERT_TRUE(maybe_value);
+  EXPECT_TRUE(maybe_value.value().empty());
+}
+
+TEST(Codecs, TestVectorStringPerElementEncoding) {
+  // data sent with the per-element encoding can still be deserialized
+  std::vector<std::string> value{"abcd"s, ""s, "g"s, "hijklm"s};
+  auto endpoint = std::make_shared<MockUcxSerializationBuffer>(
+      4096, holoscan::Endpoint::MemoryStorageType::kSystem);
+
+  auto maybe_size = serialize_vector_of_vectors<std::vector<std::string>>(value, endpoint.get());
+  ASSERT_TRUE(maybe_size);
+
+  auto maybe_value = codec<std::vector<std::string>>::deserialize(endpoint.get());
+  ASSERT_TRUE(maybe_value);
+  EXPECT_EQ(maybe_value.value(), value);
+}
+
+TEST(Codecs, TestVectorVectorFloatBorrowedSegment) {
+  // the large vector is sent as a borrowed segment between the gathered small vectors
+  std::vector<std::vector<float>> value{
+      {1.0, 2.0}, {}, std::vector<float>(Endpoint::kBorrowedSegmentMinSize, 3.5), {4.0}, {5.0}};
+  auto endpoint = std::make_shared<MockUcxSerializationBuffer>(
+      4096, holoscan::Endpoint::MemoryStorageType::kSystem);
+
+  auto maybe_size =
+      codec<std::vector<std::vector<float>>>::serialize(value, endpoint.get(), true);
+  ASSERT_TRUE(maybe_size);
+  EXPECT_EQ(endpoint->data_buffer_count(), 1);
+
+  auto maybe_value = codec<std::vector<std::vector<float>>>::deserialize(endpoint.get(), true);
+  ASSERT_TRUE(maybe_value);
+  EXPECT_EQ(maybe_value.value(), value);
+}
+
 TEST(Codecs, TestCustomTrivialSerializer) {
   // codecs.hpp defines a custom serializer for a Coordinate type
   // We verify proper roundtrip serialization and deserialization of that type
@@ -401,6 +522,37 @@ TEST(Codecs, TestCustomTrivialSerializer2) {
   EXPECT_EQ(result.d, value.d);
 }
 
+TEST(Codecs, TestCodecFields) {
+  // codecs.hpp defines the codec of Detection with HOLOSCAN_CODEC_FIELDS
+  Detection value{1.0, 2.5, 7, "person"s, 3, 0.75};
+  auto endpoint = std::make_shared<MockUcxSerializationBuffer>(
+      512, holoscan::Endpoint::MemoryStorageType::kSystem);
+
+  auto maybe_size = codec<Detection>::serialize(value, endpoint.get());
+  ASSERT_TRUE(maybe_size);
+  // the trivially copyable fields are packed without padding
+  size_t expected_size = sizeof(float) * 2 + sizeof(int32_t) + sizeof(ContiguousDataHeader) +
+                         value.text.size() + sizeof(uint8_t) + sizeof(double);
+  EXPECT_EQ(maybe_size.value(), expected_size);
+  EXPECT_EQ(endpoint->size(), expected_size);
+
+  // same wire format as one write per field
+  auto reference = std::make_shared<MockUcxSerializationBuffer>(
+      512, holoscan::Endpoint::MemoryStorageType::kSystem);
+  reference->write_trivial_type(&value.x);
+  reference->write_trivial_type(&value.y);
+  reference->write_trivial_type(&value.label);
+  codec<std::string>::serialize(value.text, reference.get());
+  reference->write_trivial_type(&value.flags);
+  reference->write_trivial_type(&value.score);
+  ASSERT_EQ(reference->size(), endpoint->size());
+  EXPECT_EQ(std::memcmp(reference->data(), endpoint->data(), endpoint->size()), 0);
+
+  auto maybe_value = codec<Detection>::deserialize(endpoint.get());
+  ASSERT_TRUE(maybe_value);
+  EXPECT_EQ(maybe_value.value(), value);
+}
+
 TEST(Codecs, TestViewSerializer) {
   ops::HolovizOp::InputSpec::View v1;
   v1.offset_x_ = 0.1;
@@ -453,6 +605,21 @@ TEST(Codecs, TestViewSerializerNoMatrix) {
   ASSERT_FALSE(result.matrix_.has_value());
 }
 
+TEST(Codecs, TestViewSerializerBufferTooSmall) {
+  ops::HolovizOp::InputSpec::View v1;
+  v1.matrix_ = std::array<float, 16>{1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1};
+
+  // the buffer only holds the offsets: the errors of the following writes must be returned
+  auto endpoint = std::make_shared<MockUcxSerializationBuffer>(
+      2 * sizeof(float), holoscan::Endpoint::MemoryStorageType::kSystem);
+
+  auto maybe_size = codec<ops::HolovizOp::InputSpec::View>::serialize(v1, endpoint.get());
+  EXPECT_FALSE(maybe_size);
+
+  auto maybe_value = codec<ops::HolovizOp::InputSpec::View>::deserialize(endpoint.get());
+  EXPECT_FALSE(maybe_value);
+}
+
 TEST(Codecs, TestVectorViewSerializer) {
   ops::HolovizOp::InputSpec::View v1{0.2, 0.1, 0.6, 0.8};
   ops::HolovizOp::InputSpec::View v2{0.1, 0.1, 0.7, 0.8};
@@ -513,6 +680,20 @@ TEST(Codecs, TestInputSpec) {
   EXPECT_EQ(result.type_, ops::HolovizOp::InputType::COLOR);
 }
 
+TEST(Codecs, TestInputSpecBufferTooSmall) {
+  ops::HolovizOp::InputSpec spec{"video", ops::HolovizOp::InputType::COLOR};
+
+  // the buffer only holds the tensor name
+  auto endpoint = std::make_shared<MockUcxSerializationBuffer>(
+      16, holoscan::Endpoint::MemoryStorageType::kSystem);
+
+  auto maybe_size = codec<ops::HolovizOp::InputSpec>::serialize(spec, endpoint.get());
+  EXPECT_FALSE(maybe_size);
+
+  auto maybe_spec = codec<ops::HolovizOp::InputSpec>::deserialize(endpoint.get());
+  EXPECT_FALSE(maybe_spec);
+}
+
 TEST(Codecs, TestVectorInputSpec) {
   std::string tensor_name1{"video1"};
   ops::HolovizOp::InputSpec spec1{tensor_name1, ops::HolovizOp::InputType::COLOR};
@@ -15,7 +15,9 @@
  * limitations under the License.
  */
 #include <cstdint>
+#include <string>
 
+#include "holoscan/core/codec_fields.hpp"
 #include "holoscan/core/codec_registry.hpp"
 #include "holoscan/core/codecs.hpp"
 #include "holoscan/core/errors.hpp"
@@ -44,4 +46,21 @@ struct MixedType {
 
 // note: don't have to explicitly define codec<MixedType> for this POD type
 
+// Non-trivially copyable type whose codec is generated by HOLOSCAN_CODEC_FIELDS below
+struct Detection {
+  float x;
+  float y;
+  int32_t label;
+  std::string text;
+  uint8_t flags;
+  double score;
+
+  bool operator==(const Detection& other) const {
+    return x == other.x && y == other.y && label == other.label && text == other.text &&
+           flags == other.flags && score == other.score;
+  }
+};
+
 }  // namespace holoscan
+
+HOLOSCAN_CODEC_FIELDS(holoscan::Detection, x, y, label, text, flags, score)
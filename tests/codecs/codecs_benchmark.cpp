@@ -0,0 +1,192 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Nested container codecs benchmark.
+//
+// Serializes and deserializes std::vector<std::string> and std::vector<std::vector<float>> values
+// with the per-element encoding (a header and a payload write per inner vector) and with the
+// contiguous encoding (one header, one offsets table and one data blob) used by their codecs.
+// The mock UCX serialization buffer is used as endpoint, so that the cost of each endpoint call is
+// included without requiring a UCX connection.
+//
+// Results are reported as JSON.
+//
+// Example:
+//   ./codecs_benchmark --vectors 10,1000,100000 --elements 16 --iterations 1000
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <CLI/CLI.hpp>
+
+#include "./mock_serialization_buffer.hpp"
+#include "holoscan/core/codecs.hpp"
+
+namespace holoscan::benchmark {
+
+struct BenchConfig {
+  std::string type = "string";  ///< "string" or "vector_float"
+  bool contiguous = true;       ///< contiguous or per-element encoding
+  size_t num_vectors = 1000;    ///< number of inner vectors (or strings)
+  size_t num_elements = 16;     ///< number of elements of each inner vector (or string)
+  int64_t iterations = 1000;    ///< number of serialize/deserialize round trips
+};
+
+template <typename typeT>
+static typeT make_value(const BenchConfig& config) {
+  typeT value(config.num_vectors);
+  using elementT = typename typeT::value_type::value_type;
+  for (size_t i = 0; i < value.size(); i++) {
+    value[i].assign(config.num_elements, static_cast<elementT>('a' + i % 26));
+  }
+  return value;
+}
+
+template <typename typeT>
+static std::string run_benchmark(const BenchConfig& config) {
+  const typeT value = make_value<typeT>(config);
+
+  // large enough for the per-element encoding of the value
+  const size_t buffer_size =
+      config.num_vectors * (config.num_elements * sizeof(typename typeT::value_type::value_type) +
+                            sizeof(ContiguousDataHeader)) +
+      sizeof(ContiguousVectorsHeader) + 1024;
+  MockUcxSerializationBuffer endpoint(buffer_size);
+
+  std::vector<int64_t> serialize_ns;
+  std::vector<int64_t> deserialize_ns;
+  serialize_ns.reserve(config.iterations);
+  deserialize_ns.reserve(config.iterations);
+  size_t serialized_size = 0;
+  for (int64_t i = 0; i < config.iterations; i++) {
+    endpoint.reset();
+
+    auto start = std::chrono::steady_clock::now();
+    auto maybe_size = config.contiguous ? serialize_contiguous_vectors<typeT>(value, &endpoint)
+                                        : serialize_vector_of_vectors<typeT>(value, &endpoint);
+    auto serialized = std::chrono::steady_clock::now();
+    // both encodings are accepted by the contiguous deserializer
+    auto maybe_value = deserialize_contiguous_vectors<typeT>(&endpoint);
+    auto deserialized = std::chrono::steady_clock::now();
+
+    if (!maybe_size || !maybe_value || maybe_value.value().size() != value.size()) {
+      std::cerr << "Round trip failed" << std::endl;
+      std::exit(1);
+    }
+    serialized_size = maybe_size.value();
+    serialize_ns.push_back(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(serialized - start).count());
+    deserialize_ns.push_back(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(deserialized - serialized).count());
+  }
+  std::sort(serialize_ns.begin(), serialize_ns.end());
+  std::sort(deserialize_ns.begin(), deserialize_ns.end());
+
+  std::ostringstream out;
+  out << "{";
+  out << fmt::format(R"("type": "{}", )", config.type);
+  out << fmt::format(R"("encoding": "{}", )", config.contiguous ? "contiguous" : "per_element");
+  out << fmt::format(R"("num_vectors": {}, )", config.num_vectors);
+  out << fmt::format(R"("num_elements": {}, )", config.num_elements);
+  out << fmt::format(R"("serialized_bytes": {}, )", serialized_size);
+  out << fmt::format(R"("serialize_ns": {{"p50": {}, "min": {}}}, )",
+                     serialize_ns[serialize_ns.size() / 2],
+                     serialize_ns.front());
+  out << fmt::format(R"("deserialize_ns": {{"p50": {}, "min": {}}})",
+                     deserialize_ns[deserialize_ns.size() / 2],
+                     deserialize_ns.front());
+  out << "}";
+  return out.str();
+}
+
+}  // namespace holoscan::benchmark
+
+int main(int argc, char** argv) {
+  using namespace holoscan::benchmark;
+
+  CLI::App cli{"Holoscan nested container codecs benchmark"};
+
+  std::vector<std::string> types{"string", "vector_float"};
+  std::vector<std::string> encodings{"per_element", "contiguous"};
+  std::vector<size_t> num_vectors{10, 1000, 100000};
+  BenchConfig base_config;
+  std::string output_path;
+
+  cli.add_option("--type", types, "Value types (string, vector_float)")->delimiter(',');
+  cli.add_option("--encoding", encodings, "Encodings (per_element, contiguous)")->delimiter(',');
+  cli.add_option("--vectors", num_vectors, "Numbers of inner vectors")->delimiter(',');
+  cli.add_option("--elements", base_config.num_elements, "Number of elements per inner vector");
+  cli.add_option("--iterations", base_config.iterations, "Number of round trips");
+  cli.add_option("--output", output_path, "Output JSON file (default: stdout)");
+  CLI11_PARSE(cli, argc, argv);
+
+  if (base_config.iterations < 1) {
+    std::cerr << "--iterations must be at least 1" << std::endl;
+    return 1;
+  }
+
+  std::vector<std::string> results;
+  for (const auto& type : types) {
+    for (const auto& encoding : encodings) {
+      for (size_t vectors : num_vectors) {
+        BenchConfig config = base_config;
+        config.type = type;
+        config.num_vectors = vectors;
+        if (encoding == "contiguous") {
+          config.contiguous = true;
+        } else if (encoding == "per_element") {
+          config.contiguous = false;
+        } else {
+          std::cerr << "Unknown encoding: " << encoding << std::endl;
+          return 1;
+        }
+        if (type == "string") {
+          results.push_back(run_benchmark<std::vector<std::string>>(config));
+        } else if (type == "vector_float") {
+          results.push_back(run_benchmark<std::vector<std::vector<float>>>(config));
+        } else {
+          std::cerr << "Unknown type: " << type << std::endl;
+          return 1;
+        }
+      }
+    }
+  }
+
+  std::ostringstream json;
+  json << "{\n  \"benchmark\": \"codecs\",\n";
+  json << "  \"results\": [\n";
+  for (size_t i = 0; i < results.size(); ++i) {
+    json << "    " << results[i] << (i + 1 < results.size() ? ",\n" : "\n");
+  }
+  json << "  ]\n}\n";
+
+  if (output_path.empty()) {
+    std::cout << json.str();
+  } else {
+    std::ofstream file(output_path);
+    file << json.str();
+  }
+  return 0;
+}
@@ -74,12 +74,43 @@ expected<void, RuntimeError> MockUcxSerializationBuffer::write_ptr(const void* p
   return expected<void, RuntimeError>();
 }
 
+// based on Endpoint::write_borrowed (large buffers are registered instead of being copied)
+expected<size_t, RuntimeError> MockUcxSerializationBuffer::write_borrowed(const void* data,
+                                                                          size_t size,
+                                                                          MemoryStorageType type) {
+  if (size < kBorrowedSegmentMinSize) { return write(data, size); }
+  auto result = write_ptr(data, size, type);
+  if (!result) { return forward_error(result); }
+  return size;
+}
+
+// Emulates the transfer of a registered data buffer to the destination buffer
+expected<size_t, RuntimeError> MockUcxSerializationBuffer::read_borrowed(void* data, size_t size,
+                                                                         MemoryStorageType type) {
+  (void)type;
+  if (size < kBorrowedSegmentMinSize) { return read(data, size); }
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (data_buffer_read_index_ >= data_buffers_.size()) {
+    return make_unexpected<RuntimeError>(
+        RuntimeError(ErrorCode::kCodecError, "no registered data buffer left"));
+  }
+  auto& data_buffer = data_buffers_[data_buffer_read_index_++];
+  if (data_buffer.length != size) {
+    return make_unexpected<RuntimeError>(
+        RuntimeError(ErrorCode::kCodecError, "size does not match the registered data buffer"));
+  }
+  std::memcpy(data, data_buffer.buffer, size);
+  return size;
+}
+
 // Resizes the buffer
 expected<void, RuntimeError> MockUcxSerializationBuffer::resize(size_t size,
                                                                 MemoryStorageType storage_type) {
   std::unique_lock<std::mutex> lock(mutex_);
   write_offset_ = 0;
   read_offset_ = 0;
+  data_buffers_.clear();
+  data_buffer_read_index_ = 0;
   auto result = buffer_.resize(allocator_, size, storage_type);
   if (!result) {
     return make_unexpected<RuntimeError>(
@@ -94,10 +125,18 @@ size_t MockUcxSerializationBuffer::size() const {
   return write_offset_;
 }
 
+// Returns the number of data buffers registered by write_ptr
+size_t MockUcxSerializationBuffer::data_buffer_count() const {
+  std::unique_lock<std::mutex> lock(mutex_);
+  return data_buffers_.size();
+}
+
 // Resets buffer for sequential access
 void MockUcxSerializationBuffer::reset() {
   std::unique_lock<std::mutex> lock(mutex_);
   write_offset_ = 0;
   read_offset_ = 0;
+  data_buffers_.clear();
+  data_buffer_read_index_ = 0;
 }
 }  // namespace holoscan
@@ -69,6 +69,10 @@ class MockUcxSerializationBuffer : public Endpoint {
   expected<size_t, RuntimeError> read(void* data, size_t size) override;
   expected<void, RuntimeError> write_ptr(const void* pointer, size_t size,
                                          MemoryStorageType type) override;
+  expected<size_t, RuntimeError> write_borrowed(const void* data, size_t size,
+                                                MemoryStorageType type) override;
+  expected<size_t, RuntimeError> read_borrowed(void* data, size_t size,
+                                               MemoryStorageType type) override;
 
   // Resizes the buffer
   expected<void, RuntimeError> resize(size_t size, MemoryStorageType storage_type);
@@ -81,6 +85,8 @@ class MockUcxSerializationBuffer : public Endpoint {
   size_t capacity() const { return buffer_.size(); }
   // Returns the number of bytes written to the buffer
   size_t size() const;
+  // Returns the number of data buffers registered by write_ptr
+  size_t data_buffer_count() const;
   // Resets buffer for sequential access
   void reset();
 
@@ -91,6 +97,8 @@ class MockUcxSerializationBuffer : public Endpoint {
 
   // Data buffers used by write_ptr
   std::vector<DataBuffer> data_buffers_;
+  // Index of the next data buffer consumed by read_borrowed
+  size_t data_buffer_read_index_ = 0;
 
   // Data buffer used by read/write
   MemoryBuffer buffer_;
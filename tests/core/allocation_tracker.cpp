@@ -0,0 +1,108 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "holoscan/core/resources/gxf/allocation_tracker.hpp"
+
+namespace holoscan {
+
+using std::chrono::microseconds;
+
+TEST(AllocationTracker, TestUsageAndPeak) {
+  AllocationTracker tracker;
+  int buffers[3];
+
+  tracker.record_allocation(&buffers[0], 100, microseconds(1));
+  tracker.record_allocation(&buffers[1], 200, microseconds(1));
+  EXPECT_TRUE(tracker.record_free(&buffers[0]));
+  tracker.record_allocation(&buffers[2], 50, microseconds(1));
+  tracker.record_failure(1000, microseconds(1));
+
+  auto stats = tracker.stats();
+  EXPECT_EQ(stats.allocations, 3);
+  EXPECT_EQ(stats.frees, 1);
+  EXPECT_EQ(stats.failures, 1);
+  EXPECT_EQ(stats.in_use_bytes, 250);
+  EXPECT_EQ(stats.peak_bytes, 300);
+
+  // Unknown and already freed buffers are ignored
+  int other = 0;
+  EXPECT_FALSE(tracker.record_free(&other));
+  EXPECT_FALSE(tracker.record_free(&buffers[0]));
+  EXPECT_EQ(tracker.stats().frees, 1);
+}
+
+TEST(AllocationTracker, TestLatencyPercentile) {
+  AllocationTracker tracker;
+  EXPECT_EQ(tracker.stats().p99_allocate_latency_us, 0.0);
+
+  std::vector<int> buffers(100);
+  for (int i = 0; i < 100; ++i) { tracker.record_allocation(&buffers[i], 1, microseconds(i + 1)); }
+  EXPECT_DOUBLE_EQ(tracker.stats().p99_allocate_latency_us, 99.0);
+
+  // Only the most recent latencies are kept
+  std::vector<int> more_buffers(AllocationTracker::kLatencyWindow);
+  for (auto& buffer : more_buffers) { tracker.record_allocation(&buffer, 1, microseconds(2)); }
+  EXPECT_DOUBLE_EQ(tracker.stats().p99_allocate_latency_us, 2.0);
+}
+
+TEST(AllocationTracker, TestHolders) {
+  AllocationTracker tracker;
+  int buffers[4];
+
+  {
+    const std::string source = "source";
+    AllocationTracker::ScopedOwner owner(source);
+    // The owner is set for the current thread only
+    std::thread([&tracker, &buffers]() {
+      tracker.record_allocation(&buffers[0], 10, microseconds(1));
+    }).join();
+    tracker.record_allocation(&buffers[1], 100, microseconds(1));
+    tracker.record_allocation(&buffers[2], 100, microseconds(1));
+    {
+      const std::string sink = "sink";
+      AllocationTracker::ScopedOwner nested_owner(sink);
+      tracker.record_allocation(&buffers[3], 50, microseconds(1));
+    }
+  }
+  auto holders = tracker.stats().holders;
+  ASSERT_EQ(holders.size(), 3);
+  EXPECT_EQ(holders[0].name, "source");
+  EXPECT_EQ(holders[0].buffers, 2);
+  EXPECT_EQ(holders[0].bytes, 200);
+  EXPECT_EQ(holders[1].name, "sink");
+  EXPECT_EQ(holders[1].bytes, 50);
+  EXPECT_EQ(holders[2].name, "(unknown)");
+  EXPECT_EQ(holders[2].bytes, 10);
+
+  // Freed buffers are no longer held, regardless of the freeing thread
+  std::thread([&tracker, &buffers]() { tracker.record_free(&buffers[3]); }).join();
+  EXPECT_EQ(tracker.stats().holders.size(), 2);
+
+  auto report = tracker.report("pool");
+  EXPECT_NE(report.find("Allocator 'pool'"), std::string::npos);
+  EXPECT_NE(report.find("held by source: 2 buffers, 200 bytes"), std::string::npos);
+}
+
+}  // namespace holoscan
@@ -112,4 +112,30 @@ TEST(AppDriver, TestExcludeCudaIpcTransportOnIgpu) {
   }
 }
 
+TEST(AppDriver, TestGetBoolEnvVar) {
+  const char* name = "HOLOSCAN_TEST_BOOL_ENV_VAR";
+
+  // unset: the default value is returned
+  unsetenv(name);
+  EXPECT_FALSE(AppDriver::get_bool_env_var(name));
+  EXPECT_TRUE(AppDriver::get_bool_env_var(name, true));
+
+  // true and false values are recognized (case-insensitive) whatever the default value is
+  for (const char* value : {"true", "1", "on", "TRUE", "On"}) {
+    setenv(name, value, 1);
+    EXPECT_TRUE(AppDriver::get_bool_env_var(name, false)) << value;
+  }
+  for (const char* value : {"false", "0", "off", "FALSE", "Off"}) {
+    setenv(name, value, 1);
+    EXPECT_FALSE(AppDriver::get_bool_env_var(name, true)) << value;
+  }
+
+  // unrecognized values fall back to the default value
+  setenv(name, "maybe", 1);
+  EXPECT_TRUE(AppDriver::get_bool_env_var(name, true));
+  EXPECT_FALSE(AppDriver::get_bool_env_var(name, false));
+
+  unsetenv(name);
+}
+
 }  // namespace holoscan
@@ -0,0 +1,148 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "holoscan/core/resources/gxf/buffer_cache.hpp"
+
+namespace holoscan {
+
+namespace {
+
+constexpr int32_t kHost = 0;
+constexpr int32_t kDevice = 1;
+
+// Fake buffer addresses (the cache never dereferences them)
+void* buffer(uintptr_t index) {
+  return reinterpret_cast<void*>(index * 64);
+}
+
+}  // namespace
+
+TEST(BufferCache, TestMissThenHit) {
+  BufferCache cache(4, 1 << 20);
+  EXPECT_EQ(cache.acquire(1024, kHost), nullptr);
+  cache.track(buffer(1), 1024, kHost);
+  EXPECT_EQ(cache.release(buffer(1)), BufferCache::ReleaseResult::kCached);
+
+  EXPECT_EQ(cache.acquire(1024, kHost), buffer(1));
+  auto stats = cache.stats();
+  EXPECT_EQ(stats.hits, 1UL);
+  EXPECT_EQ(stats.misses, 1UL);
+  EXPECT_EQ(stats.recycled, 1UL);
+  EXPECT_EQ(stats.in_use_buffers, 1UL);
+  EXPECT_EQ(stats.cached_buffers, 0UL);
+}
+
+TEST(BufferCache, TestKeyedBySizeAndType) {
+  BufferCache cache(4, 1 << 20);
+  cache.track(buffer(1), 1024, kHost);
+  cache.release(buffer(1));
+
+  EXPECT_EQ(cache.acquire(2048, kHost), nullptr);
+  EXPECT_EQ(cache.acquire(1024, kDevice), nullptr);
+  EXPECT_EQ(cache.acquire(1024, kHost), buffer(1));
+}
+
+TEST(BufferCache, TestEvictSize) {
+  BufferCache cache(4, 1 << 20);
+  cache.track(buffer(1), 1024, kHost);
+  cache.track(buffer(2), 1024, kDevice);
+  cache.track(buffer(3), 2048, kHost);
+  for (uintptr_t i = 1; i <= 3; ++i) { cache.release(buffer(i)); }
+
+  EXPECT_EQ(cache.evict(1024).size(), 2UL);
+  EXPECT_TRUE(cache.evict(1024).empty());
+  EXPECT_EQ(cache.acquire(1024, kHost), nullptr);
+  EXPECT_EQ(cache.acquire(2048, kHost), buffer(3));
+
+  auto stats = cache.stats();
+  EXPECT_EQ(stats.evicted, 2UL);
+  EXPECT_EQ(stats.cached_buffers, 0UL);
+  EXPECT_EQ(stats.cached_bytes, 0UL);
+}
+
+TEST(BufferCache, TestLimits) {
+  BufferCache cache(2, 3072);
+  for (uintptr_t i = 1; i <= 3; ++i) { cache.track(buffer(i), 1024, kHost); }
+  EXPECT_EQ(cache.release(buffer(1)), BufferCache::ReleaseResult::kCached);
+  EXPECT_EQ(cache.release(buffer(2)), BufferCache::ReleaseResult::kCached);
+  // At most two buffers of a given size
+  EXPECT_EQ(cache.release(buffer(3)), BufferCache::ReleaseResult::kEvict);
+
+  // At most 3072 bytes in total
+  cache.track(buffer(4), 2048, kHost);
+  cache.track(buffer(5), 1024, kDevice);
+  EXPECT_EQ(cache.release(buffer(4)), BufferCache::ReleaseResult::kEvict);
+  EXPECT_EQ(cache.release(buffer(5)), BufferCache::ReleaseResult::kCached);
+
+  auto stats = cache.stats();
+  EXPECT_EQ(stats.evicted, 2UL);
+  EXPECT_EQ(stats.cached_buffers, 3UL);
+  EXPECT_EQ(stats.cached_bytes, 3072UL);
+}
+
+TEST(BufferCache, TestUnknownBuffer) {
+  BufferCache cache(4, 1 << 20);
+  EXPECT_EQ(cache.release(buffer(1)), BufferCache::ReleaseResult::kUnknown);
+}
+
+TEST(BufferCache, TestClose) {
+  BufferCache cache(4, 1 << 20);
+  cache.track(buffer(1), 1024, kHost);
+  cache.track(buffer(2), 1024, kHost);
+  cache.release(buffer(1));
+
+  auto buffers = cache.close();
+  ASSERT_EQ(buffers.size(), 1UL);
+  EXPECT_EQ(buffers[0], buffer(1));
+  EXPECT_EQ(cache.stats().cached_bytes, 0UL);
+
+  // Buffers released after closing are not cached anymore
+  EXPECT_EQ(cache.release(buffer(2)), BufferCache::ReleaseResult::kEvict);
+  EXPECT_EQ(cache.acquire(1024, kHost), nullptr);
+}
+
+TEST(BufferCache, TestConcurrentAccess) {
+  BufferCache cache(8, 1 << 20);
+  constexpr int kIterations = 10000;
+  std::vector<std::thread> threads;
+  for (uintptr_t t = 0; t < 4; ++t) {
+    threads.emplace_back([&cache, t]() {
+      for (int i = 0; i < kIterations; ++i) {
+        void* pointer = cache.acquire(256, kHost);
+        if (pointer == nullptr) {
+          pointer = buffer(1 + t * kIterations + i);
+          cache.track(pointer, 256, kHost);
+        }
+        EXPECT_NE(cache.release(pointer), BufferCache::ReleaseResult::kUnknown);
+      }
+    });
+  }
+  for (auto& thread : threads) { thread.join(); }
+
+  auto stats = cache.stats();
+  EXPECT_EQ(stats.hits + stats.misses, 4UL * kIterations);
+  EXPECT_EQ(stats.in_use_buffers, 0UL);
+  EXPECT_LE(stats.cached_buffers, 8UL);
+}
+
+}  // namespace holoscan
@@ -33,11 +33,13 @@
 #include "holoscan/core/conditions/gxf/boolean.hpp"
 #include "holoscan/core/conditions/gxf/count.hpp"
 #include "holoscan/core/conditions/gxf/downstream_affordable.hpp"
+#include "holoscan/core/conditions/gxf/memory_available.hpp"
 #include "holoscan/core/conditions/gxf/periodic.hpp"
 #include "holoscan/core/conditions/gxf/message_available.hpp"
 #include "holoscan/core/config.hpp"
 #include "holoscan/core/executor.hpp"
 #include "holoscan/core/graph.hpp"
+#include "holoscan/core/resources/gxf/unbounded_allocator.hpp"
 #include "../utils.hpp"
 
 using namespace std::string_literals;
@@ -192,6 +194,34 @@ TEST(ConditionClasses, TestDownstreamMessageAffordableConditionSizeMethod) {
   EXPECT_EQ(condition->min_size(), 16);
 }
 
+TEST(ConditionClasses, TestMemoryAvailableCondition) {
+  Fragment F;
+  const std::string name{"memory-available-condition"};
+  ArgList arglist{
+      Arg{"allocator", F.make_resource<UnboundedAllocator>("unbounded_alloc")},
+      Arg{"min_bytes", 1024UL},
+      Arg{"poll_period_ns", 5'000'000L},
+  };
+  auto condition = F.make_condition<MemoryAvailableCondition>(name, arglist);
+  EXPECT_EQ(condition->name(), name);
+  EXPECT_EQ(typeid(condition), typeid(std::make_shared<MemoryAvailableCondition>(arglist)));
+  EXPECT_EQ(std::string(condition->gxf_typename()), "holoscan::MemoryAvailableSchedulingTerm"s);
+}
+
+TEST(ConditionClasses, TestMemoryAvailableConditionDefaultConstructor) {
+  Fragment F;
+  auto condition = F.make_condition<MemoryAvailableCondition>();
+}
+
+TEST(ConditionClasses, TestMemoryAvailableConditionSizeMethod) {
+  Fragment F;
+  auto condition = F.make_condition<MemoryAvailableCondition>("memory-available-condition");
+  condition->min_bytes(4096);
+  EXPECT_EQ(condition->min_bytes(), 4096UL);
+  condition->poll_period_ns(5'000'000);
+  EXPECT_EQ(condition->poll_period_ns(), 5'000'000L);
+}
+
 TEST(ConditionClasses, TestMessageAvailableCondition) {
   Fragment F;
   const std::string name{"message-available-condition"};
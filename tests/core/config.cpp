@@ -22,6 +22,10 @@
 
 #include <string>
 
+#include "../config.hpp"
+
+static HoloscanTestConfig test_config;
+
 namespace holoscan {
 
 TEST(Config, TestDefault) {
@@ -49,4 +53,26 @@ TEST(Config, TestNonexistentFile) {
   EXPECT_TRUE(log_output.find("Config file 'nonexistent.yaml' doesn't exist") != std::string::npos);
 }
 
+
+TEST(Config, TestKeyIndex) {
+  const std::string config_file = test_config.get_test_data_file("app_config.yaml");
+  Config C = Config(config_file);
+
+  // a scalar value is indexed as a single argument named after the last key part
+  const ArgList* args = C.find_args("aja.width");
+  ASSERT_NE(args, nullptr);
+  ArgList width_args = *args;
+  ASSERT_EQ(width_args.size(), 1);
+  EXPECT_EQ(width_args.args()[0].name(), "width");
+  EXPECT_EQ(width_args.as<int>(), 1920);
+
+  // a map is indexed as one argument per item
+  args = C.find_args("aja");
+  ASSERT_NE(args, nullptr);
+  EXPECT_EQ(args->size(), 5);
+
+  EXPECT_EQ(C.find_args("non-existent"), nullptr);
+  EXPECT_EQ(C.find_args("aja.non-existent"), nullptr);
+}
+
 }  // namespace holoscan
@@ -231,6 +231,30 @@ TEST(Fragment, TestAddFlow) {
   EXPECT_EQ(*(input_port_set.begin()), "in");
 }
 
+TEST(Fragment, TestAddFlowWithConnectorType) {
+  Fragment F;
+
+  auto tx = F.make_operator<ops::PingTxOp>("tx");
+  auto rx = F.make_operator<ops::PingRxOp>("rx");
+
+  F.add_flow(tx, rx, {{"out", "in"}}, IOSpec::ConnectorType::kConflating);
+
+  EXPECT_EQ(tx->spec()->outputs()["out"]->connector_type(), IOSpec::ConnectorType::kConflating);
+  EXPECT_EQ(rx->spec()->inputs()["in"]->connector_type(), IOSpec::ConnectorType::kConflating);
+
+  // the connector type can also be given as an argument (e.g. from the YAML configuration)
+  auto rx2 = F.make_operator<ops::PingRxOp>("rx2");
+  F.add_flow(tx, rx2, {{"out", "in"}}, ArgList{Arg("type", "ring_buffer"s), Arg("capacity", 4UL)});
+  EXPECT_EQ(rx2->spec()->inputs()["in"]->connector_type(), IOSpec::ConnectorType::kRingBuffer);
+
+  // the output port keeps the first connector type given
+  EXPECT_EQ(tx->spec()->outputs()["out"]->connector_type(), IOSpec::ConnectorType::kConflating);
+  auto transmitter =
+      std::dynamic_pointer_cast<DoubleBufferTransmitter>(tx->spec()->outputs()["out"]->connector());
+  ASSERT_TRUE(transmitter);
+  EXPECT_EQ(rx->spec()->inputs()["in"]->connector_type(), IOSpec::ConnectorType::kConflating);
+}
+
 TEST(Fragment, TestOperatorOrder) {
   Fragment F;
 
@@ -18,8 +18,12 @@
 #include <gtest/gtest.h>
 #include <yaml-cpp/yaml.h>
 
+#include <memory>
 #include <string>
+#include <utility>
 
+#include "holoscan/core/fragment_scheduler.hpp"
+#include "holoscan/core/schedulers/communication_aware_fragment_allocation.hpp"
 #include "holoscan/core/schedulers/greedy_fragment_allocation.hpp"
 
 namespace holoscan {
@@ -170,4 +174,168 @@ TEST(FragmentAllocation, GreedyAllocationRedundantWorker2) {
   ASSERT_EQ(schedule["fragment_3"], "app_worker_4");
 }
 
+TEST(FragmentAllocation, CommunicationAwareAllocationSameHost) {
+  CommunicationAwareFragmentAllocationStrategy strategy;
+
+  // Two hosts with two app workers each
+  strategy.add_available_resource(AvailableSystemResource{"10.0.0.1:10000", {}, 1, 1, 1, 1, 1});
+  strategy.add_available_resource(AvailableSystemResource{"10.0.0.1:10001", {}, 1, 1, 1, 1, 1});
+  strategy.add_available_resource(AvailableSystemResource{"10.0.0.2:10000", {}, 1, 1, 1, 1, 1});
+  strategy.add_available_resource(AvailableSystemResource{"10.0.0.2:10001", {}, 1, 1, 1, 1, 1});
+
+  for (const auto& fragment_name : {"fragment_1", "fragment_2", "fragment_3", "fragment_4"}) {
+    strategy.add_resource_requirement(
+        SystemResourceRequirement{fragment_name, 1, -1, 1, -1, 1, 0, 1, 0, 1, 0});
+  }
+  strategy.add_connection_requirement({"fragment_1", "fragment_3", 1000});
+  strategy.add_connection_requirement({"fragment_4", "fragment_2", 1000});
+  strategy.add_connection_requirement({"fragment_1", "fragment_2", 10});
+
+  auto schedule_result = strategy.schedule();
+  ASSERT_TRUE(static_cast<bool>(schedule_result));
+  auto& schedule = schedule_result.value();
+  ASSERT_EQ(schedule.size(), 4);
+  // Chatty fragments are placed on the same host (but on different workers)
+  auto host = [&schedule](const std::string& fragment_name) {
+    return schedule[fragment_name].substr(0, schedule[fragment_name].rfind(':'));
+  };
+  EXPECT_EQ(host("fragment_1"), host("fragment_3"));
+  EXPECT_EQ(host("fragment_2"), host("fragment_4"));
+  EXPECT_NE(host("fragment_1"), host("fragment_2"));
+  EXPECT_NE(schedule["fragment_1"], schedule["fragment_3"]);
+  EXPECT_DOUBLE_EQ(strategy.communication_cost(schedule),
+                   10 + 2000 * CommunicationAwareFragmentAllocationStrategy::kSameHostCostFactor);
+}
+
+TEST(FragmentAllocation, CommunicationAwareAllocationColocation) {
+  CommunicationAwareFragmentAllocationStrategy strategy(2);
+
+  strategy.add_available_resource(AvailableSystemResource{"10.0.0.1:10000", {}, 2, 1, 2, 0, 0});
+  strategy.add_available_resource(AvailableSystemResource{"10.0.0.2:10000", {}, 2, 1, 2, 0, 0});
+
+  for (const auto& fragment_name : {"fragment_1", "fragment_2", "fragment_3", "fragment_4"}) {
+    strategy.add_resource_requirement(
+        SystemResourceRequirement{fragment_name, 1, -1, -1, -1, 1, 0, 0, 0, 0, 0});
+  }
+  strategy.add_connection_requirement({"fragment_1", "fragment_4", 1000});
+  strategy.add_connection_requirement({"fragment_2", "fragment_3", 1000});
+
+  auto schedule_result = strategy.schedule();
+  ASSERT_TRUE(static_cast<bool>(schedule_result));
+  auto& schedule = schedule_result.value();
+  // Each pair of chatty fragments runs on a single worker
+  ASSERT_EQ(schedule.size(), 4);
+  EXPECT_EQ(schedule["fragment_1"], schedule["fragment_4"]);
+  EXPECT_EQ(schedule["fragment_2"], schedule["fragment_3"]);
+  EXPECT_NE(schedule["fragment_1"], schedule["fragment_2"]);
+  EXPECT_DOUBLE_EQ(strategy.communication_cost(schedule), 0.0);
+}
+
+TEST(FragmentAllocation, CommunicationAwareAllocationColocationResources) {
+  CommunicationAwareFragmentAllocationStrategy strategy(2);
+
+  // app_worker_1 cannot run two fragments requiring 2 GiB of memory each
+  strategy.add_available_resource(AvailableSystemResource{"10.0.0.1:10000", {}, 4, 1, 3, 0, 0});
+  strategy.add_available_resource(AvailableSystemResource{"10.0.0.2:10000", {}, 4, 1, 3, 0, 0});
+
+  strategy.add_resource_requirement(
+      SystemResourceRequirement{"fragment_1", 1, -1, -1, -1, 2, 0, 0, 0, 0, 0});
+  strategy.add_resource_requirement(
+      SystemResourceRequirement{"fragment_2", 1, -1, -1, -1, 2, 0, 0, 0, 0, 0});
+  strategy.add_connection_requirement({"fragment_1", "fragment_2", 1000});
+
+  auto schedule_result = strategy.schedule();
+  ASSERT_TRUE(static_cast<bool>(schedule_result));
+  auto& schedule = schedule_result.value();
+  ASSERT_EQ(schedule.size(), 2);
+  EXPECT_NE(schedule["fragment_1"], schedule["fragment_2"]);
+}
+
+TEST(FragmentAllocation, CommunicationAwareAllocationTargetFragments) {
+  CommunicationAwareFragmentAllocationStrategy strategy;
+
+  strategy.add_available_resource(
+      AvailableSystemResource{"10.0.0.1:10000", {"fragment_1"}, 0, 0, 0, 0, 0});
+  strategy.add_available_resource(AvailableSystemResource{"10.0.0.1:10001", {}, 0, 0, 0, 0, 0});
+  strategy.add_available_resource(AvailableSystemResource{"10.0.0.2:10000", {}, 0, 0, 0, 0, 0});
+
+  for (const auto& fragment_name : {"fragment_1", "fragment_2", "fragment_3"}) {
+    strategy.add_resource_requirement(
+        SystemResourceRequirement{fragment_name, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0});
+  }
+  strategy.add_connection_requirement({"fragment_3", "fragment_1", 1000});
+
+  auto schedule_result = strategy.schedule();
+  ASSERT_TRUE(static_cast<bool>(schedule_result));
+  auto& schedule = schedule_result.value();
+  // fragment_1 stays on its target worker and fragment_3 joins its host
+  ASSERT_EQ(schedule.size(), 3);
+  EXPECT_EQ(schedule["fragment_1"], "10.0.0.1:10000");
+  EXPECT_EQ(schedule["fragment_3"], "10.0.0.1:10001");
+  EXPECT_EQ(schedule["fragment_2"], "10.0.0.2:10000");
+}
+
+TEST(FragmentAllocation, CommunicationAwareAllocationWithoutConnections) {
+  CommunicationAwareFragmentAllocationStrategy strategy;
+
+  strategy.add_available_resource(AvailableSystemResource{"app_worker_2", {}, 1, 1, 1, 1, 1});
+  strategy.add_available_resource(AvailableSystemResource{"app_worker_1", {}, 1, 1, 1, 1, 1});
+
+  strategy.add_resource_requirement(
+      SystemResourceRequirement{"fragment_2", 1, 1, 1, 1, 1, 1, 1, 1, 1, 1});
+  strategy.add_resource_requirement(
+      SystemResourceRequirement{"fragment_1", 1, 1, 1, 1, 1, 1, 1, 1, 1, 1});
+
+  auto schedule_result = strategy.schedule();
+  ASSERT_TRUE(static_cast<bool>(schedule_result));
+  auto& schedule = schedule_result.value();
+  // Same as the greedy allocation
+  ASSERT_EQ(schedule["fragment_1"], "app_worker_1");
+  ASSERT_EQ(schedule["fragment_2"], "app_worker_2");
+}
+
+TEST(FragmentAllocation, CommunicationAwareAllocationMissingWorker) {
+  CommunicationAwareFragmentAllocationStrategy strategy;
+
+  strategy.add_available_resource(AvailableSystemResource{"10.0.0.1:10000", {}, 1, 1, 1, 1, 1});
+
+  strategy.add_resource_requirement(
+      SystemResourceRequirement{"fragment_1", 1, -1, -1, -1, 0, 0, 0, 0, 0, 0});
+  strategy.add_resource_requirement(
+      SystemResourceRequirement{"fragment_2", 1, -1, -1, -1, 0, 0, 0, 0, 0, 0});
+  strategy.add_connection_requirement({"fragment_1", "fragment_2", 1000});
+
+  // Only one fragment per worker by default
+  auto schedule_result = strategy.schedule();
+  EXPECT_FALSE(static_cast<bool>(schedule_result));
+}
+
+TEST(FragmentAllocation, MakeFragmentAllocationStrategy) {
+  auto greedy = make_fragment_allocation_strategy("greedy");
+  ASSERT_TRUE(static_cast<bool>(greedy));
+  EXPECT_NE(dynamic_cast<GreedyFragmentAllocationStrategy*>(greedy.value().get()), nullptr);
+
+  auto communication_aware = make_fragment_allocation_strategy("communication_aware", 3);
+  ASSERT_TRUE(static_cast<bool>(communication_aware));
+  auto* strategy = dynamic_cast<CommunicationAwareFragmentAllocationStrategy*>(
+      communication_aware.value().get());
+  ASSERT_NE(strategy, nullptr);
+  EXPECT_EQ(strategy->max_fragments_per_worker(), 3);
+
+  EXPECT_FALSE(static_cast<bool>(make_fragment_allocation_strategy("unknown")));
+
+  // The scheduler forwards the connection requirements to the strategy
+  FragmentScheduler scheduler(std::move(communication_aware.value()));
+  scheduler.add_available_resource(AvailableSystemResource{"10.0.0.1:10000", {}, 2, 0, 0, 0, 0});
+  scheduler.add_available_resource(AvailableSystemResource{"10.0.0.2:10000", {}, 2, 0, 0, 0, 0});
+  scheduler.add_resource_requirement(
+      SystemResourceRequirement{"fragment_1", 1, -1, -1, -1, 0, 0, 0, 0, 0, 0});
+  scheduler.add_resource_requirement(
+      SystemResourceRequirement{"fragment_2", 1, -1, -1, -1, 0, 0, 0, 0, 0, 0});
+  scheduler.add_connection_requirement({"fragment_1", "fragment_2", 1000});
+  auto schedule_result = scheduler.schedule();
+  ASSERT_TRUE(static_cast<bool>(schedule_result));
+  EXPECT_EQ(schedule_result.value()["fragment_1"], schedule_result.value()["fragment_2"]);
+}
+
 }  // namespace holoscan
@@ -0,0 +1,98 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "holoscan/core/resources/gxf/huge_page_pool.hpp"
+
+namespace holoscan {
+
+TEST(HugePagePool, TestAllocateAndFree) {
+  HugePagePool pool(1000, 4, false, false);
+  ASSERT_NE(pool.data(), nullptr);
+  EXPECT_EQ(pool.backing(), HugePagePool::Backing::kRegularPages);
+  EXPECT_EQ(pool.block_size(), 1024UL);
+  EXPECT_GE(pool.size(), 4 * 1024UL);
+
+  std::vector<void*> blocks;
+  for (int i = 0; i < 4; ++i) {
+    void* block = pool.allocate(1000);
+    ASSERT_NE(block, nullptr);
+    std::memset(block, 0xff, 1000);
+    blocks.push_back(block);
+  }
+  // Blocks are handed out in address order
+  EXPECT_EQ(blocks[0], pool.data());
+  EXPECT_EQ(static_cast<uint8_t*>(blocks[1]) - static_cast<uint8_t*>(blocks[0]), 1024);
+
+  EXPECT_FALSE(pool.is_available(1));
+  EXPECT_EQ(pool.allocate(1), nullptr);
+  EXPECT_EQ(pool.allocate(2000), nullptr);
+
+  EXPECT_TRUE(pool.free(blocks[2]));
+  EXPECT_FALSE(pool.free(blocks[2]));
+  EXPECT_FALSE(pool.free(static_cast<uint8_t*>(blocks[1]) + 1));
+  int outside = 0;
+  EXPECT_FALSE(pool.free(&outside));
+  EXPECT_TRUE(pool.is_available(1024));
+  EXPECT_EQ(pool.allocate(10), blocks[2]);
+
+  auto stats = pool.stats();
+  EXPECT_EQ(stats.allocations, 5UL);
+  EXPECT_EQ(stats.failed_allocations, 2UL);
+  EXPECT_EQ(stats.in_use_blocks, 4UL);
+  EXPECT_EQ(stats.reserved_bytes, pool.size());
+}
+
+TEST(HugePagePool, TestHugePagesFallback) {
+  // Explicit huge pages are usually not reserved on test machines: any backing is acceptable as
+  // long as the pool is usable and the region is made of whole pages.
+  HugePagePool pool(3 * 1024 * 1024, 2, true, true);
+  ASSERT_NE(pool.data(), nullptr);
+  EXPECT_NE(pool.backing(), HugePagePool::Backing::kNone);
+  if (pool.backing() == HugePagePool::Backing::kHugeTLB) {
+    EXPECT_EQ(pool.stats().page_size, HugePagePool::default_huge_page_size());
+  }
+  EXPECT_EQ(pool.size() % pool.stats().page_size, 0UL);
+
+  void* block = pool.allocate(3 * 1024 * 1024);
+  ASSERT_NE(block, nullptr);
+  std::memset(block, 0, 3 * 1024 * 1024);
+  EXPECT_TRUE(pool.free(block));
+}
+
+TEST(HugePagePool, TestConcurrentAllocations) {
+  HugePagePool pool(256, 64, false, false);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([&pool]() {
+      for (int i = 0; i < 1000; ++i) {
+        void* block = pool.allocate(256);
+        if (block != nullptr) { EXPECT_TRUE(pool.free(block)); }
+      }
+    });
+  }
+  for (auto& thread : threads) { thread.join(); }
+  EXPECT_EQ(pool.stats().in_use_blocks, 0UL);
+}
+
+}  // namespace holoscan
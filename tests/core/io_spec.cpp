@@ -291,4 +291,124 @@ TEST(IOSpec, TestIOSpecConnectorUcxTransmitter) {
   EXPECT_EQ(std::string(transmitter->gxf_typename()), std::string("nvidia::gxf::UcxTransmitter"));
 }
 
+
+TEST(IOSpec, TestIOSpecConnectorRingBufferReceiver) {
+  OperatorSpec op_spec = OperatorSpec();
+  IOSpec spec =
+      IOSpec(&op_spec, std::string("a"), IOSpec::IOType::kInput, &typeid(holoscan::gxf::Entity));
+
+  // no arguments
+  spec.connector(IOSpec::ConnectorType::kRingBuffer);
+  EXPECT_EQ(spec.connector_type(), IOSpec::ConnectorType::kRingBuffer);
+  ASSERT_TRUE(spec.connector() != nullptr);
+  auto receiver = std::dynamic_pointer_cast<RingBufferReceiver>(spec.connector());
+  ASSERT_TRUE(receiver != nullptr);
+  EXPECT_EQ(std::string(receiver->gxf_typename()),
+            std::string("holoscan::SpscRingBufferReceiver"));
+
+  // arglist
+  spec.connector(IOSpec::ConnectorType::kRingBuffer,
+                 ArgList{Arg("capacity", 2UL), Arg("policy", 0UL)});
+  EXPECT_EQ(spec.connector_type(), IOSpec::ConnectorType::kRingBuffer);
+  receiver = std::dynamic_pointer_cast<RingBufferReceiver>(spec.connector());
+  ASSERT_TRUE(receiver != nullptr);
+  EXPECT_EQ(receiver->args().size(), 2);
+}
+
+TEST(IOSpec, TestIOSpecConnectorRingBufferTransmitter) {
+  OperatorSpec op_spec = OperatorSpec();
+  IOSpec spec =
+      IOSpec(&op_spec, std::string("a"), IOSpec::IOType::kOutput, &typeid(holoscan::gxf::Entity));
+
+  // no arguments
+  spec.connector(IOSpec::ConnectorType::kRingBuffer);
+  EXPECT_EQ(spec.connector_type(), IOSpec::ConnectorType::kRingBuffer);
+  ASSERT_TRUE(spec.connector() != nullptr);
+  auto transmitter = std::dynamic_pointer_cast<RingBufferTransmitter>(spec.connector());
+  ASSERT_TRUE(transmitter != nullptr);
+  EXPECT_EQ(std::string(transmitter->gxf_typename()),
+            std::string("holoscan::SpscRingBufferTransmitter"));
+
+  // arglist
+  spec.connector(IOSpec::ConnectorType::kRingBuffer,
+                 ArgList{Arg("capacity", 2UL), Arg("policy", 0UL)});
+  EXPECT_EQ(spec.connector_type(), IOSpec::ConnectorType::kRingBuffer);
+  transmitter = std::dynamic_pointer_cast<RingBufferTransmitter>(spec.connector());
+  ASSERT_TRUE(transmitter != nullptr);
+  EXPECT_EQ(transmitter->args().size(), 2);
+}
+
+TEST(IOSpec, TestIOSpecConnectorConflatingReceiver) {
+  OperatorSpec op_spec = OperatorSpec();
+  IOSpec spec =
+      IOSpec(&op_spec, std::string("a"), IOSpec::IOType::kInput, &typeid(holoscan::gxf::Entity));
+
+  // no arguments
+  spec.connector(IOSpec::ConnectorType::kConflating);
+  EXPECT_EQ(spec.connector_type(), IOSpec::ConnectorType::kConflating);
+  auto receiver = std::dynamic_pointer_cast<ConflatingReceiver>(spec.connector());
+  ASSERT_TRUE(receiver != nullptr);
+  EXPECT_EQ(std::string(receiver->gxf_typename()),
+            std::string("holoscan::ConflatingMailboxReceiver"));
+
+  // arglist
+  spec.connector(IOSpec::ConnectorType::kConflating, ArgList{Arg("key_by_tensor_name", true)});
+  EXPECT_EQ(spec.connector_type(), IOSpec::ConnectorType::kConflating);
+  receiver = std::dynamic_pointer_cast<ConflatingReceiver>(spec.connector());
+  ASSERT_TRUE(receiver != nullptr);
+  EXPECT_EQ(receiver->args().size(), 1);
+}
+
+TEST(IOSpec, TestIOSpecConnectorConflatingTransmitter) {
+  OperatorSpec op_spec = OperatorSpec();
+  IOSpec spec =
+      IOSpec(&op_spec, std::string("a"), IOSpec::IOType::kOutput, &typeid(holoscan::gxf::Entity));
+
+  // the sending side is a capacity-1 double buffer transmitter that replaces the pending message
+  spec.connector(IOSpec::ConnectorType::kConflating);
+  EXPECT_EQ(spec.connector_type(), IOSpec::ConnectorType::kConflating);
+  auto transmitter = std::dynamic_pointer_cast<DoubleBufferTransmitter>(spec.connector());
+  ASSERT_TRUE(transmitter != nullptr);
+  EXPECT_EQ(std::string(transmitter->gxf_typename()),
+            std::string("nvidia::gxf::DoubleBufferTransmitter"));
+  EXPECT_EQ(transmitter->args().size(), 2);
+
+  // the arguments are added after the default capacity and policy (and override them)
+  spec.connector(IOSpec::ConnectorType::kConflating, ArgList{Arg("capacity", 4UL)});
+  transmitter = std::dynamic_pointer_cast<DoubleBufferTransmitter>(spec.connector());
+  ASSERT_TRUE(transmitter != nullptr);
+  ASSERT_EQ(transmitter->args().size(), 3);
+  EXPECT_EQ(transmitter->args().back().name(), "capacity");
+}
+
+TEST(IOSpec, TestIOSpecConnectorSharedMemoryReceiver) {
+  OperatorSpec op_spec = OperatorSpec();
+  IOSpec spec =
+      IOSpec(&op_spec, std::string("a"), IOSpec::IOType::kInput, &typeid(holoscan::gxf::Entity));
+
+  spec.connector(IOSpec::ConnectorType::kSharedMemory,
+                 ArgList{Arg("segment_name", std::string("/holoscan_test_0"))});
+  EXPECT_EQ(spec.connector_type(), IOSpec::ConnectorType::kSharedMemory);
+  auto receiver = std::dynamic_pointer_cast<SharedMemoryReceiver>(spec.connector());
+  ASSERT_TRUE(receiver != nullptr);
+  EXPECT_EQ(std::string(receiver->gxf_typename()),
+            std::string("holoscan::SharedMemoryChannelReceiver"));
+  EXPECT_EQ(receiver->args().size(), 1);
+}
+
+TEST(IOSpec, TestIOSpecConnectorSharedMemoryTransmitter) {
+  OperatorSpec op_spec = OperatorSpec();
+  IOSpec spec =
+      IOSpec(&op_spec, std::string("a"), IOSpec::IOType::kOutput, &typeid(holoscan::gxf::Entity));
+
+  spec.connector(IOSpec::ConnectorType::kSharedMemory,
+                 ArgList{Arg("segment_name", std::string("/holoscan_test_0"))});
+  EXPECT_EQ(spec.connector_type(), IOSpec::ConnectorType::kSharedMemory);
+  auto transmitter = std::dynamic_pointer_cast<SharedMemoryTransmitter>(spec.connector());
+  ASSERT_TRUE(transmitter != nullptr);
+  EXPECT_EQ(std::string(transmitter->gxf_typename()),
+            std::string("holoscan::SharedMemoryChannelTransmitter"));
+  EXPECT_EQ(transmitter->args().size(), 1);
+}
+
 }  // namespace holoscan
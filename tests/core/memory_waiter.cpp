@@ -0,0 +1,118 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "holoscan/core/resources/gxf/memory_waiter.hpp"
+
+namespace holoscan {
+
+using namespace std::chrono_literals;
+
+TEST(MemoryWaiter, TestNoWait) {
+  MemoryWaiter waiter(0ms);
+  int buffer = 0;
+  EXPECT_EQ(waiter.allocate([&buffer](void** pointer) {
+    *pointer = &buffer;
+    return true;
+  }),
+            &buffer);
+  EXPECT_EQ(waiter.allocate([](void** pointer) {
+    *pointer = nullptr;
+    return true;
+  }),
+            nullptr);
+
+  auto stats = waiter.stats();
+  EXPECT_EQ(stats.allocations, 1UL);
+  EXPECT_EQ(stats.waits, 0UL);
+  EXPECT_EQ(stats.timeouts, 1UL);
+}
+
+TEST(MemoryWaiter, TestTimeout) {
+  MemoryWaiter waiter(20ms);
+  const auto start = std::chrono::steady_clock::now();
+  EXPECT_EQ(waiter.allocate([](void** pointer) {
+    *pointer = nullptr;
+    return true;
+  }),
+            nullptr);
+  EXPECT_GE(std::chrono::steady_clock::now() - start, 20ms);
+
+  auto stats = waiter.stats();
+  EXPECT_EQ(stats.waits, 1UL);
+  EXPECT_EQ(stats.timeouts, 1UL);
+  EXPECT_GE(stats.max_wait_ms, 20.0);
+}
+
+TEST(MemoryWaiter, TestWakeUpOnFree) {
+  MemoryWaiter waiter(10s);
+  int buffer = 0;
+  std::atomic<bool> is_free{false};
+  auto try_allocate = [&](void** pointer) {
+    *pointer = is_free.load() ? &buffer : nullptr;
+    return true;
+  };
+
+  std::thread releaser([&]() {
+    std::this_thread::sleep_for(10ms);
+    is_free = true;
+    waiter.notify_free();
+  });
+  EXPECT_EQ(waiter.allocate(try_allocate), &buffer);
+  releaser.join();
+
+  auto stats = waiter.stats();
+  EXPECT_EQ(stats.allocations, 1UL);
+  EXPECT_EQ(stats.waits, 1UL);
+  EXPECT_EQ(stats.timeouts, 0UL);
+  EXPECT_LT(stats.max_wait_ms, 10000.0);
+}
+
+TEST(MemoryWaiter, TestPolling) {
+  // Memory released without notification is picked up by the periodic attempts
+  MemoryWaiter waiter(10s);
+  int attempts = 0;
+  int buffer = 0;
+  EXPECT_EQ(waiter.allocate([&](void** pointer) {
+    *pointer = ++attempts == 5 ? &buffer : nullptr;
+    return true;
+  }),
+            &buffer);
+  EXPECT_EQ(attempts, 5);
+}
+
+TEST(MemoryWaiter, TestInvalidRequest) {
+  // Requests that can't succeed by waiting fail immediately
+  MemoryWaiter waiter(10s);
+  int attempts = 0;
+  EXPECT_EQ(waiter.allocate([&](void** pointer) {
+    attempts++;
+    *pointer = nullptr;
+    return false;
+  }),
+            nullptr);
+  EXPECT_EQ(attempts, 1);
+  EXPECT_EQ(waiter.stats().timeouts, 0UL);
+  EXPECT_EQ(waiter.stats().errors, 1UL);
+}
+
+}  // namespace holoscan
@@ -0,0 +1,88 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "holoscan/core/resources/gxf/numa_host_memory.hpp"
+
+namespace holoscan {
+
+TEST(NumaHostMemory, TestCallingThreadNode) {
+  NumaHostMemory memory;
+  ASSERT_FALSE(memory.numa_nodes().empty());
+
+  void* pointer = memory.allocate(1024 * 1024);
+  ASSERT_NE(pointer, nullptr);
+  std::memset(pointer, 0, 1024 * 1024);
+
+  auto stats = memory.stats();
+  EXPECT_EQ(stats.allocations, 1UL);
+  EXPECT_EQ(stats.in_use_bytes, 1024 * 1024UL);
+  ASSERT_EQ(stats.in_use_bytes_per_node.size(), 1UL);
+  if (memory.current_numa_node() >= 0) {
+    EXPECT_EQ(stats.local_allocations, 1UL);
+    EXPECT_EQ(stats.in_use_bytes_per_node.begin()->first, memory.current_numa_node());
+  } else {
+    // Unbound allocation when the node of the calling thread is unknown
+    EXPECT_EQ(stats.remote_allocations, 1UL);
+    EXPECT_EQ(stats.in_use_bytes_per_node.begin()->first, NumaHostMemory::kUnboundNode);
+  }
+
+  EXPECT_TRUE(memory.free(pointer));
+  EXPECT_FALSE(memory.free(pointer));
+  stats = memory.stats();
+  EXPECT_EQ(stats.in_use_bytes, 0UL);
+  EXPECT_TRUE(stats.in_use_bytes_per_node.empty());
+}
+
+TEST(NumaHostMemory, TestFixedNode) {
+  NumaHostMemory probe;
+  const int numa_node = probe.numa_nodes().back();
+  NumaHostMemory memory(numa_node);
+
+  std::vector<void*> pointers;
+  std::vector<std::thread> threads;
+  std::mutex mutex;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([&]() {
+      void* pointer = memory.allocate(4096);
+      std::lock_guard<std::mutex> lock(mutex);
+      pointers.push_back(pointer);
+    });
+  }
+  for (auto& thread : threads) { thread.join(); }
+
+  auto stats = memory.stats();
+  EXPECT_EQ(stats.allocations, 4UL);
+  EXPECT_EQ(stats.local_allocations + stats.remote_allocations, 4UL);
+  EXPECT_EQ(stats.in_use_bytes_per_node.at(numa_node), 4 * 4096UL);
+  for (void* pointer : pointers) { EXPECT_TRUE(memory.free(pointer)); }
+}
+
+TEST(NumaHostMemory, TestInvalidNode) {
+  NumaHostMemory memory(1 << 20);
+  EXPECT_EQ(memory.allocate(4096), nullptr);
+  EXPECT_EQ(memory.stats().failed_allocations, 1UL);
+}
+
+}  // namespace holoscan
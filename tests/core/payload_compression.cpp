@@ -0,0 +1,147 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "holoscan/core/payload_compression.hpp"
+
+namespace holoscan {
+
+namespace {
+
+// Data compressing well (like a segmentation mask)
+std::vector<uint8_t> make_mask(size_t size) {
+  std::vector<uint8_t> data(size);
+  for (size_t i = 0; i < size; ++i) { data[i] = static_cast<uint8_t>((i / 1000) % 3); }
+  return data;
+}
+
+}  // namespace
+
+TEST(PayloadCompression, TestFromString) {
+  EXPECT_EQ(PayloadCompression::from_string("none").value(), CompressionAlgorithm::kNone);
+  EXPECT_EQ(PayloadCompression::from_string("").value(), CompressionAlgorithm::kNone);
+  EXPECT_EQ(PayloadCompression::from_string("lz4").value(), CompressionAlgorithm::kLz4);
+  EXPECT_EQ(PayloadCompression::from_string("zstd").value(), CompressionAlgorithm::kZstd);
+
+  auto algorithm = PayloadCompression::from_string("gzip");
+  ASSERT_FALSE(algorithm);
+
+  for (auto value :
+       {CompressionAlgorithm::kNone, CompressionAlgorithm::kLz4, CompressionAlgorithm::kZstd}) {
+    EXPECT_EQ(PayloadCompression::from_string(PayloadCompression::to_string(value)).value(),
+              value);
+  }
+}
+
+TEST(PayloadCompression, TestAvailableAlgorithms) {
+  EXPECT_TRUE(PayloadCompression::is_available(CompressionAlgorithm::kNone));
+  for (const auto& name : PayloadCompression::available_algorithms()) {
+    EXPECT_TRUE(PayloadCompression::is_available(PayloadCompression::from_string(name).value()));
+  }
+}
+
+TEST(PayloadCompression, TestRoundTrip) {
+  const auto data = make_mask(1 << 20);
+  for (auto algorithm : {CompressionAlgorithm::kLz4, CompressionAlgorithm::kZstd}) {
+    if (!PayloadCompression::is_available(algorithm)) { continue; }
+
+    for (int32_t level : {0, 3}) {
+      std::vector<uint8_t> compressed(
+          PayloadCompression::max_compressed_size(algorithm, data.size()));
+      auto compressed_size = PayloadCompression::compress(
+          algorithm, level, data.data(), data.size(), compressed.data(), compressed.size());
+      ASSERT_TRUE(compressed_size) << PayloadCompression::to_string(algorithm);
+      EXPECT_LT(compressed_size.value(), data.size() / 10);
+
+      std::vector<uint8_t> decompressed(data.size());
+      auto size = PayloadCompression::decompress(algorithm,
+                                                 compressed.data(),
+                                                 compressed_size.value(),
+                                                 decompressed.data(),
+                                                 decompressed.size());
+      ASSERT_TRUE(size) << PayloadCompression::to_string(algorithm);
+      EXPECT_EQ(size.value(), data.size());
+      EXPECT_EQ(decompressed, data);
+    }
+  }
+}
+
+TEST(PayloadCompression, TestCorruptedPayload) {
+  const auto data = make_mask(64 * 1024);
+  for (auto algorithm : {CompressionAlgorithm::kLz4, CompressionAlgorithm::kZstd}) {
+    if (!PayloadCompression::is_available(algorithm)) { continue; }
+
+    std::vector<uint8_t> compressed(
+        PayloadCompression::max_compressed_size(algorithm, data.size()));
+    auto compressed_size = PayloadCompression::compress(
+        algorithm, 0, data.data(), data.size(), compressed.data(), compressed.size());
+    ASSERT_TRUE(compressed_size);
+
+    // the destination size doesn't match the payload
+    std::vector<uint8_t> decompressed(data.size() / 2);
+    EXPECT_FALSE(PayloadCompression::decompress(algorithm,
+                                                compressed.data(),
+                                                compressed_size.value(),
+                                                decompressed.data(),
+                                                decompressed.size()));
+  }
+}
+
+TEST(PayloadCompression, TestUnavailableAlgorithm) {
+  std::vector<uint8_t> data(16);
+  std::vector<uint8_t> output(64);
+  EXPECT_FALSE(PayloadCompression::compress(
+      CompressionAlgorithm::kNone, 0, data.data(), data.size(), output.data(), output.size()));
+  EXPECT_FALSE(PayloadCompression::decompress(
+      CompressionAlgorithm::kNone, data.data(), data.size(), output.data(), output.size()));
+}
+
+TEST(PayloadCompression, TestNegotiatedAlgorithms) {
+  PayloadCompression::set_negotiated_algorithms({});
+  EXPECT_FALSE(PayloadCompression::is_enabled());
+  EXPECT_TRUE(PayloadCompression::is_negotiated(CompressionAlgorithm::kNone));
+  EXPECT_FALSE(PayloadCompression::is_negotiated(CompressionAlgorithm::kLz4));
+  EXPECT_FALSE(PayloadCompression::is_negotiated(CompressionAlgorithm::kZstd));
+
+  PayloadCompression::set_negotiated_algorithms({"lz4"});
+  EXPECT_EQ(PayloadCompression::is_negotiated(CompressionAlgorithm::kLz4),
+            PayloadCompression::is_available(CompressionAlgorithm::kLz4));
+  EXPECT_FALSE(PayloadCompression::is_negotiated(CompressionAlgorithm::kZstd));
+
+  EXPECT_EQ(PayloadCompression::is_enabled(),
+            PayloadCompression::is_available(CompressionAlgorithm::kLz4));
+
+  PayloadCompression::set_negotiated_algorithms(PayloadCompression::available_algorithms());
+}
+
+TEST(PayloadCompression, TestRequestedAlgorithms) {
+  unsetenv("HOLOSCAN_UCX_COMPRESSION");
+  EXPECT_TRUE(PayloadCompression::requested_algorithms().empty());
+  setenv("HOLOSCAN_UCX_COMPRESSION", "none", 1);
+  EXPECT_TRUE(PayloadCompression::requested_algorithms().empty());
+  setenv("HOLOSCAN_UCX_COMPRESSION", "lz4", 1);
+  EXPECT_EQ(PayloadCompression::requested_algorithms(), PayloadCompression::available_algorithms());
+  unsetenv("HOLOSCAN_UCX_COMPRESSION");
+}
+
+}  // namespace holoscan
@@ -17,7 +17,9 @@
 
 #include <gtest/gtest.h>
 #include <gxf/core/gxf.h>
+#include <stdlib.h>  // POSIX setenv
 
+#include <cstdlib>
 #include <memory>
 #include <string>
 #include <vector>
@@ -32,13 +34,23 @@
 #include "holoscan/core/graph.hpp"
 #include "holoscan/core/resource.hpp"
 #include "holoscan/core/resources/gxf/block_memory_pool.hpp"
+#include "holoscan/core/resources/gxf/blocking_allocator.hpp"
+#include "holoscan/core/resources/gxf/conflating_receiver.hpp"
 #include "holoscan/core/resources/gxf/cuda_stream_pool.hpp"
 #include "holoscan/core/resources/gxf/double_buffer_receiver.hpp"
 #include "holoscan/core/resources/gxf/double_buffer_transmitter.hpp"
+#include "holoscan/core/resources/gxf/huge_page_memory_pool.hpp"
 #include "holoscan/core/resources/gxf/manual_clock.hpp"
+#include "holoscan/core/resources/gxf/multi_subscriber_transmitter.hpp"
+#include "holoscan/core/resources/gxf/numa_allocator.hpp"
 #include "holoscan/core/resources/gxf/realtime_clock.hpp"
+#include "holoscan/core/resources/gxf/recycling_allocator.hpp"
+#include "holoscan/core/resources/gxf/ring_buffer_receiver.hpp"
+#include "holoscan/core/resources/gxf/ring_buffer_transmitter.hpp"
 #include "holoscan/core/resources/gxf/serialization_buffer.hpp"
+#include "holoscan/core/resources/gxf/slab_memory_pool.hpp"
 #include "holoscan/core/resources/gxf/std_component_serializer.hpp"
+#include "holoscan/core/resources/gxf/tsc_clock.hpp"
 #include "holoscan/core/resources/gxf/ucx_component_serializer.hpp"
 #include "holoscan/core/resources/gxf/ucx_entity_serializer.hpp"
 #include "holoscan/core/resources/gxf/ucx_holoscan_component_serializer.hpp"
@@ -47,6 +59,7 @@
 #include "holoscan/core/resources/gxf/ucx_transmitter.hpp"
 #include "holoscan/core/resources/gxf/unbounded_allocator.hpp"
 #include "holoscan/core/resources/gxf/video_stream_serializer.hpp"
+#include "holoscan/core/system/tsc_counter.hpp"
 #include "common/assert.hpp"
 
 using namespace std::string_literals;
@@ -123,6 +136,280 @@ TEST_F(ResourceClassesWithGXFContext, TestDoubleBufferTransmitterDefaultConstruc
   auto resource = F.make_resource<DoubleBufferTransmitter>();
 }
 
+TEST_F(ResourceClassesWithGXFContext, TestMultiSubscriberTransmitter) {
+  const std::string name{"transmitter"};
+  ArgList arglist{
+      Arg{"policy", 1UL},
+  };
+  auto resource = F.make_resource<MultiSubscriberTransmitter>(name, arglist);
+  EXPECT_EQ(resource->name(), name);
+  EXPECT_EQ(typeid(resource), typeid(std::make_shared<MultiSubscriberTransmitter>(arglist)));
+  EXPECT_EQ(std::string(resource->gxf_typename()), "holoscan::FanOutTransmitter"s);
+}
+
+TEST_F(ResourceClassesWithGXFContext, TestMultiSubscriberTransmitterDefaultConstructor) {
+  auto resource = F.make_resource<MultiSubscriberTransmitter>();
+}
+
+// Allocators wrapping the native GXF allocator components of Holoscan
+template <typename AllocatorT>
+struct AllocatorWrapperTraits;
+
+template <>
+struct AllocatorWrapperTraits<RecyclingAllocator> {
+  static constexpr const char* kGxfTypename = "holoscan::BufferRecyclingAllocator";
+  static ArgList args(Fragment& F) {
+    return ArgList{Arg{"allocator", F.make_resource<UnboundedAllocator>("unbounded_alloc")},
+                   Arg{"max_buffers_per_size", 2UL}};
+  }
+};
+
+template <>
+struct AllocatorWrapperTraits<SlabMemoryPool> {
+  static constexpr const char* kGxfTypename = "holoscan::SlabAllocator";
+  static ArgList args(Fragment&) {
+    return ArgList{Arg{"storage_type", static_cast<int32_t>(MemoryStorageType::kSystem)},
+                   Arg{"size_classes", std::vector<uint64_t>{1024, 64 * 1024, 1024 * 1024}},
+                   Arg{"thread_cache_size", 8UL}};
+  }
+};
+
+template <>
+struct AllocatorWrapperTraits<HugePageMemoryPool> {
+  static constexpr const char* kGxfTypename = "holoscan::HugePageAllocator";
+  static ArgList args(Fragment&) {
+    return ArgList{Arg{"storage_type", static_cast<int32_t>(MemoryStorageType::kSystem)},
+                   Arg{"block_size", 4UL * 1024 * 1024},
+                   Arg{"num_blocks", 2UL}};
+  }
+};
+
+template <>
+struct AllocatorWrapperTraits<NumaAllocator> {
+  static constexpr const char* kGxfTypename = "holoscan::NumaBindingAllocator";
+  static ArgList args(Fragment&) {
+    return ArgList{Arg{"storage_type", static_cast<int32_t>(MemoryStorageType::kSystem)},
+                   Arg{"numa_node", -1}};
+  }
+};
+
+template <>
+struct AllocatorWrapperTraits<BlockingAllocator> {
+  static constexpr const char* kGxfTypename = "holoscan::BackpressureAllocator";
+  static ArgList args(Fragment& F) {
+    return ArgList{Arg{"allocator", F.make_resource<UnboundedAllocator>("unbounded_alloc")},
+                   Arg{"timeout_ms", 50UL}};
+  }
+};
+
+template <typename AllocatorT>
+class AllocatorWrapperClassesWithGXFContext : public TestWithGXFContext {};
+
+using AllocatorWrapperTypes = ::testing::
+    Types<RecyclingAllocator, SlabMemoryPool, HugePageMemoryPool, NumaAllocator, BlockingAllocator>;
+TYPED_TEST_SUITE(AllocatorWrapperClassesWithGXFContext, AllocatorWrapperTypes);
+
+TYPED_TEST(AllocatorWrapperClassesWithGXFContext, TestAllocatorWrapper) {
+  using Traits = AllocatorWrapperTraits<TypeParam>;
+  const std::string name{"allocator"};
+  ArgList arglist = Traits::args(this->F);
+  auto resource = this->F.template make_resource<TypeParam>(name, arglist);
+  EXPECT_EQ(resource->name(), name);
+  EXPECT_EQ(typeid(resource), typeid(std::make_shared<TypeParam>(arglist)));
+  EXPECT_EQ(std::string(resource->gxf_typename()), std::string(Traits::kGxfTypename));
+}
+
+TYPED_TEST(AllocatorWrapperClassesWithGXFContext, TestAllocatorWrapperDefaultConstructor) {
+  auto resource = this->F.template make_resource<TypeParam>();
+}
+
+TEST_F(ResourceClassesWithGXFContext, TestRecyclingAllocatorAllocation) {
+  auto resource = F.make_resource<RecyclingAllocator>("recycling");
+  resource->initialize();
+
+  int nbytes = 1024 * 1024;
+  EXPECT_TRUE(resource->is_available(nbytes));
+  auto ptr = resource->allocate(nbytes, MemoryStorageType::kHost);
+  ASSERT_NE(ptr, nullptr);
+  resource->free(ptr);
+
+  // A buffer of the same size and type is handed back
+  auto recycled_ptr = resource->allocate(nbytes, MemoryStorageType::kHost);
+  EXPECT_EQ(recycled_ptr, ptr);
+  resource->free(recycled_ptr);
+
+  auto stats = resource->stats();
+  EXPECT_EQ(stats.hits, 1UL);
+  EXPECT_EQ(stats.misses, 1UL);
+  EXPECT_EQ(stats.cached_buffers, 1UL);
+  EXPECT_EQ(stats.cached_bytes, static_cast<uint64_t>(nbytes));
+}
+
+TEST_F(ResourceClassesWithGXFContext, TestSlabMemoryPoolAllocation) {
+  auto resource = F.make_resource<SlabMemoryPool>(
+      "slab_pool",
+      Arg{"storage_type", static_cast<int32_t>(MemoryStorageType::kSystem)},
+      Arg{"slab_size", 1024UL * 1024});
+  resource->initialize();
+
+  // Requests of different sizes are served by different size classes
+  auto small_ptr = resource->allocate(1000, MemoryStorageType::kSystem);
+  auto large_ptr = resource->allocate(100000, MemoryStorageType::kSystem);
+  ASSERT_NE(small_ptr, nullptr);
+  ASSERT_NE(large_ptr, nullptr);
+  resource->free(small_ptr);
+  EXPECT_EQ(resource->allocate(900, MemoryStorageType::kSystem), small_ptr);
+
+  auto stats = resource->stats();
+  EXPECT_EQ(stats.allocations, 3UL);
+  EXPECT_EQ(stats.slabs, 2UL);
+  EXPECT_EQ(stats.in_use_blocks, 2UL);
+}
+
+TEST_F(ResourceClassesWithGXFContext, TestHugePageMemoryPoolAllocation) {
+  auto resource = F.make_resource<HugePageMemoryPool>(
+      "huge_page_pool",
+      Arg{"storage_type", static_cast<int32_t>(MemoryStorageType::kSystem)},
+      Arg{"block_size", 4UL * 1024 * 1024},
+      Arg{"num_blocks", 2UL});
+  resource->initialize();
+
+  // The whole pool is reserved on initialization (falling back to regular pages if needed)
+  auto stats = resource->stats();
+  EXPECT_GE(stats.reserved_bytes, 8UL * 1024 * 1024);
+  EXPECT_GT(stats.page_size, 0UL);
+
+  auto first_ptr = resource->allocate(4UL * 1024 * 1024, MemoryStorageType::kSystem);
+  auto second_ptr = resource->allocate(1024, MemoryStorageType::kSystem);
+  ASSERT_NE(first_ptr, nullptr);
+  ASSERT_NE(second_ptr, nullptr);
+  EXPECT_FALSE(resource->is_available(1));
+  resource->free(first_ptr);
+  EXPECT_TRUE(resource->is_available(1));
+  EXPECT_EQ(resource->stats().in_use_blocks, 1UL);
+}
+
+TEST_F(ResourceClassesWithGXFContext, TestNumaAllocatorAllocation) {
+  auto resource = F.make_resource<NumaAllocator>(
+      "numa_allocator", Arg{"storage_type", static_cast<int32_t>(MemoryStorageType::kSystem)});
+  resource->initialize();
+
+  auto pointer = resource->allocate(1024 * 1024, MemoryStorageType::kSystem);
+  ASSERT_NE(pointer, nullptr);
+  auto stats = resource->stats();
+  EXPECT_EQ(stats.allocations, 1UL);
+  EXPECT_EQ(stats.in_use_bytes, 1024 * 1024UL);
+  EXPECT_EQ(stats.in_use_bytes_per_node.size(), 1UL);
+  resource->free(pointer);
+  EXPECT_EQ(resource->stats().in_use_bytes, 0UL);
+}
+
+TEST_F(ResourceClassesWithGXFContext, TestBlockingAllocatorAllocation) {
+  auto pool = F.make_resource<HugePageMemoryPool>(
+      "pool",
+      Arg{"storage_type", static_cast<int32_t>(MemoryStorageType::kSystem)},
+      Arg{"block_size", 1024UL * 1024},
+      Arg{"num_blocks", 1UL},
+      Arg{"huge_pages", false});
+  auto resource = F.make_resource<BlockingAllocator>(
+      "blocking_allocator", Arg{"allocator", pool}, Arg{"timeout_ms", 10UL});
+  resource->initialize();
+
+  auto pointer = resource->allocate(1024, MemoryStorageType::kSystem);
+  ASSERT_NE(pointer, nullptr);
+  EXPECT_FALSE(resource->is_available(1024));
+
+  // The pool is exhausted: the allocation waits for the timeout before failing
+  EXPECT_EQ(resource->allocate(1024, MemoryStorageType::kSystem), nullptr);
+  auto stats = resource->stats();
+  EXPECT_EQ(stats.allocations, 1UL);
+  EXPECT_EQ(stats.waits, 1UL);
+  EXPECT_EQ(stats.timeouts, 1UL);
+  EXPECT_GE(stats.max_wait_ms, 10.0);
+
+  resource->free(pointer);
+  EXPECT_TRUE(resource->is_available(1024));
+}
+
+TEST_F(ResourceClassesWithGXFContext, TestAllocatorStats) {
+  auto untracked = F.make_resource<SlabMemoryPool>(
+      "untracked_pool", Arg{"storage_type", static_cast<int32_t>(MemoryStorageType::kSystem)});
+  untracked->initialize();
+
+  setenv("HOLOSCAN_ALLOCATOR_STATS", "true", 1);
+  auto resource = F.make_resource<SlabMemoryPool>(
+      "tracked_pool", Arg{"storage_type", static_cast<int32_t>(MemoryStorageType::kSystem)});
+  resource->initialize();
+  unsetenv("HOLOSCAN_ALLOCATOR_STATS");
+
+  auto first_ptr = resource->allocate(1000, MemoryStorageType::kSystem);
+  auto second_ptr = resource->allocate(3000, MemoryStorageType::kSystem);
+  ASSERT_NE(first_ptr, nullptr);
+  ASSERT_NE(second_ptr, nullptr);
+  resource->free(first_ptr);
+
+  auto stats = resource->allocation_stats();
+  EXPECT_EQ(stats.allocations, 2UL);
+  EXPECT_EQ(stats.frees, 1UL);
+  EXPECT_EQ(stats.in_use_bytes, 3000UL);
+  EXPECT_EQ(stats.peak_bytes, 4000UL);
+  ASSERT_EQ(stats.holders.size(), 1UL);
+  EXPECT_EQ(stats.holders[0].name, "(unknown)");
+
+  // The wrapped allocator still serves the requests, and only the handles refer to the tracker
+  EXPECT_EQ(resource->stats().in_use_blocks, 1UL);
+  EXPECT_NE(resource->gxf_handle_cid(), resource->gxf_cid());
+  EXPECT_EQ(untracked->gxf_handle_cid(), untracked->gxf_cid());
+  EXPECT_EQ(untracked->allocation_stats().allocations, 0UL);
+}
+
+TEST_F(ResourceClassesWithGXFContext, TestRingBufferReceiver) {
+  const std::string name{"receiver"};
+  ArgList arglist{
+      Arg{"capacity", 4UL},
+      Arg{"policy", 0UL},
+  };
+  auto resource = F.make_resource<RingBufferReceiver>(name, arglist);
+  EXPECT_EQ(resource->name(), name);
+  EXPECT_EQ(typeid(resource), typeid(std::make_shared<RingBufferReceiver>(arglist)));
+  EXPECT_EQ(std::string(resource->gxf_typename()), "holoscan::SpscRingBufferReceiver"s);
+}
+
+TEST_F(ResourceClassesWithGXFContext, TestRingBufferReceiverDefaultConstructor) {
+  auto resource = F.make_resource<RingBufferReceiver>();
+}
+
+TEST_F(ResourceClassesWithGXFContext, TestRingBufferTransmitter) {
+  const std::string name{"transmitter"};
+  ArgList arglist{
+      Arg{"capacity", 4UL},
+      Arg{"policy", 0UL},
+  };
+  auto resource = F.make_resource<RingBufferTransmitter>(name, arglist);
+  EXPECT_EQ(resource->name(), name);
+  EXPECT_EQ(typeid(resource), typeid(std::make_shared<RingBufferTransmitter>(arglist)));
+  EXPECT_EQ(std::string(resource->gxf_typename()), "holoscan::SpscRingBufferTransmitter"s);
+}
+
+TEST_F(ResourceClassesWithGXFContext, TestRingBufferTransmitterDefaultConstructor) {
+  auto resource = F.make_resource<RingBufferTransmitter>();
+}
+
+TEST_F(ResourceClassesWithGXFContext, TestConflatingReceiver) {
+  const std::string name{"receiver"};
+  ArgList arglist{
+      Arg{"key_by_tensor_name", true},
+  };
+  auto resource = F.make_resource<ConflatingReceiver>(name, arglist);
+  EXPECT_EQ(resource->name(), name);
+  EXPECT_EQ(typeid(resource), typeid(std::make_shared<ConflatingReceiver>(arglist)));
+  EXPECT_EQ(std::string(resource->gxf_typename()), "holoscan::ConflatingMailboxReceiver"s);
+}
+
+TEST_F(ResourceClassesWithGXFContext, TestConflatingReceiverDefaultConstructor) {
+  auto resource = F.make_resource<ConflatingReceiver>();
+}
+
 TEST_F(ResourceClassesWithGXFContext, TestStdComponentSerializer) {
   const std::string name{"std-component-serializer"};
   auto resource = F.make_resource<StdComponentSerializer>(name);
@@ -261,6 +548,33 @@ TEST_F(ResourceClassesWithGXFContext, TestManualClockDefaultConstructor) {
   auto resource = F.make_resource<ManualClock>();
 }
 
+TEST_F(ResourceClassesWithGXFContext, TestTscClock) {
+  const std::string name{"tsc"};
+  auto resource = F.make_resource<TscClock>(name);
+  EXPECT_EQ(resource->name(), name);
+  EXPECT_EQ(typeid(resource), typeid(std::make_shared<TscClock>()));
+  EXPECT_EQ(std::string(resource->gxf_typename()), "holoscan::TimestampCounterClock"s);
+}
+
+TEST_F(ResourceClassesWithGXFContext, TestTscClockTimestamps) {
+  auto resource = F.make_resource<TscClock>("tsc");
+  resource->initialize();
+  EXPECT_GT(resource->frequency_hz(), 0.0);
+  EXPECT_FALSE(resource->source().empty());
+
+  // Timestamps are in the CLOCK_MONOTONIC time base
+  const int64_t start = resource->timestamp();
+  EXPECT_LT(std::llabs(start - TscCounter::monotonic_ns()), 1000000LL);
+  resource->sleep_for(2000000);
+  EXPECT_GE(resource->timestamp() - start, 2000000);
+  resource->sleep_until(resource->timestamp() + 1000000);
+  EXPECT_GE(resource->timestamp() - start, 3000000);
+}
+
+TEST_F(ResourceClassesWithGXFContext, TestTscClockDefaultConstructor) {
+  auto resource = F.make_resource<TscClock>();
+}
+
 TEST_F(ResourceClassesWithGXFContext, TestSerializationBuffer) {
   const std::string name{"serialization_buffer"};
   ArgList arglist{
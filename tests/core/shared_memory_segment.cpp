@@ -0,0 +1,204 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#include "holoscan/core/resources/gxf/shared_memory_segment.hpp"
+
+namespace holoscan {
+
+namespace {
+
+std::string test_segment_name(const char* suffix) {
+  return "/holoscan_test_" + std::to_string(getpid()) + "_" + suffix;
+}
+
+}  // namespace
+
+TEST(SharedMemorySegment, TestSegmentName) {
+  EXPECT_EQ(SharedMemorySegment::segment_name("abc"), "/abc");
+  EXPECT_EQ(SharedMemorySegment::segment_name("/abc"), "/abc");
+  EXPECT_EQ(SharedMemorySegment::segment_name("/a/b"), "/a_b");
+  EXPECT_EQ(SharedMemorySegment::segment_name(std::string(300, 'x')).size(), 255);
+}
+
+TEST(SharedMemorySegment, TestOpenBeforeCreate) {
+  EXPECT_EQ(SharedMemorySegment::open(test_segment_name("missing")), nullptr);
+}
+
+TEST(SharedMemorySegment, TestWriteRead) {
+  const std::string name = test_segment_name("write_read");
+  auto consumer = SharedMemorySegment::create(name, 2, 1000);
+  ASSERT_NE(consumer, nullptr);
+  // the slot size is rounded up to a page
+  EXPECT_EQ(consumer->slot_count(), 2);
+  EXPECT_EQ(consumer->slot_size(), 4096);
+
+  auto producer = SharedMemorySegment::open(name);
+  ASSERT_NE(producer, nullptr);
+  EXPECT_EQ(producer->slot_count(), 2);
+  EXPECT_EQ(producer->slot_size(), 4096);
+  EXPECT_TRUE(producer->is_consumer_open());
+
+  size_t inline_size = 0;
+  size_t payload_size = 0;
+  EXPECT_EQ(consumer->begin_read(&inline_size, &payload_size), nullptr);
+
+  for (uint8_t value = 1; value <= 2; ++value) {
+    uint8_t* slot = producer->begin_write();
+    ASSERT_NE(slot, nullptr);
+    std::memset(slot, value, 16);
+    producer->commit_write(16, value * 256);
+  }
+  // all the slots are in use
+  EXPECT_EQ(producer->begin_write(), nullptr);
+  EXPECT_EQ(consumer->size(), 2);
+
+  const uint8_t* slot = consumer->begin_read(&inline_size, &payload_size);
+  ASSERT_NE(slot, nullptr);
+  EXPECT_EQ(slot[15], 1);
+  EXPECT_EQ(inline_size, 16);
+  EXPECT_EQ(payload_size, 256);
+  consumer->end_read();
+  EXPECT_EQ(producer->size(), 1);
+  EXPECT_NE(producer->begin_write(), nullptr);
+
+  slot = consumer->begin_read(&inline_size, &payload_size);
+  ASSERT_NE(slot, nullptr);
+  EXPECT_EQ(slot[0], 2);
+  EXPECT_EQ(payload_size, 512);
+  consumer->end_read();
+  EXPECT_EQ(consumer->size(), 0);
+
+  // the segment is removed with the consumer
+  consumer.reset();
+  EXPECT_FALSE(producer->is_consumer_open());
+  EXPECT_EQ(SharedMemorySegment::open(name), nullptr);
+}
+
+TEST(SharedMemorySegment, TestConsumerAlive) {
+  const std::string name = test_segment_name("consumer_alive");
+  auto consumer = SharedMemorySegment::create(name, 2, 4096);
+  ASSERT_NE(consumer, nullptr);
+  auto producer = SharedMemorySegment::open(name);
+  ASSERT_NE(producer, nullptr);
+  EXPECT_TRUE(consumer->is_consumer_alive());
+  EXPECT_TRUE(producer->is_consumer_alive());
+
+  consumer.reset();
+  EXPECT_FALSE(producer->is_consumer_alive());
+}
+
+TEST(SharedMemorySegment, TestConsumerCrash) {
+  const std::string name = test_segment_name("consumer_crash");
+  int ready_pipe[2];
+  int done_pipe[2];
+  ASSERT_EQ(pipe(ready_pipe), 0);
+  ASSERT_EQ(pipe(done_pipe), 0);
+
+  pid_t pid = fork();
+  ASSERT_GE(pid, 0);
+  if (pid == 0) {
+    // consumer process exiting without closing the segment
+    auto consumer = SharedMemorySegment::create(name, 2, 4096);
+    char ready = consumer ? 1 : 0;
+    if (write(ready_pipe[1], &ready, 1) != 1) { _exit(1); }
+    char done = 0;
+    if (read(done_pipe[0], &done, 1) != 1) { _exit(1); }
+    _exit(0);
+  }
+
+  char ready = 0;
+  ASSERT_EQ(read(ready_pipe[0], &ready, 1), 1);
+  ASSERT_EQ(ready, 1);
+  auto producer = SharedMemorySegment::open(name);
+  ASSERT_NE(producer, nullptr);
+  EXPECT_TRUE(producer->is_consumer_alive());
+
+  char done = 1;
+  ASSERT_EQ(write(done_pipe[1], &done, 1), 1);
+  int status = 0;
+  waitpid(pid, &status, 0);
+  EXPECT_TRUE(WIFEXITED(status));
+
+  // the open flag was never cleared, but the consumer process is gone
+  EXPECT_TRUE(producer->is_consumer_open());
+  EXPECT_FALSE(producer->is_consumer_alive());
+
+  for (int fd : {ready_pipe[0], ready_pipe[1], done_pipe[0], done_pipe[1]}) { close(fd); }
+  shm_unlink(SharedMemorySegment::segment_name(name).c_str());
+}
+
+TEST(SharedMemorySegment, TestPayloadOffset) {
+  constexpr size_t kSlotSize = 4096;
+  constexpr size_t kAlignment = SharedMemorySegment::kPayloadAlignment;
+  // payloads are stacked from the end of the slot
+  size_t offset = shared_memory_payload_offset(kSlotSize, 0, 100);
+  EXPECT_EQ(offset % kAlignment, 0);
+  EXPECT_EQ(offset, kSlotSize - kAlignment);
+  offset = shared_memory_payload_offset(kSlotSize, kSlotSize - offset, 1000);
+  EXPECT_EQ(offset, kSlotSize - 5 * kAlignment);
+  // a payload that does not fit
+  EXPECT_EQ(shared_memory_payload_offset(kSlotSize, kAlignment, kSlotSize), kSlotSize);
+}
+
+TEST(SharedMemorySegment, TestCrossProcess) {
+  const std::string name = test_segment_name("cross_process");
+  constexpr int kMessageCount = 100;
+  auto consumer = SharedMemorySegment::create(name, 4, 4096);
+  ASSERT_NE(consumer, nullptr);
+
+  pid_t pid = fork();
+  ASSERT_GE(pid, 0);
+  if (pid == 0) {
+    // producer process
+    auto producer = SharedMemorySegment::open(name);
+    if (!producer) { _exit(1); }
+    for (int32_t i = 0; i < kMessageCount; ++i) {
+      uint8_t* slot = nullptr;
+      while ((slot = producer->begin_write()) == nullptr) { usleep(10); }
+      std::memcpy(slot, &i, sizeof(i));
+      producer->commit_write(sizeof(i), 0);
+    }
+    _exit(0);
+  }
+
+  for (int32_t expected = 0; expected < kMessageCount; ++expected) {
+    const uint8_t* slot = nullptr;
+    size_t inline_size = 0;
+    while ((slot = consumer->begin_read(&inline_size, nullptr)) == nullptr) { usleep(10); }
+    int32_t value = -1;
+    std::memcpy(&value, slot, sizeof(value));
+    EXPECT_EQ(value, expected);
+    EXPECT_EQ(inline_size, sizeof(value));
+    consumer->end_read();
+  }
+
+  int status = 0;
+  waitpid(pid, &status, 0);
+  EXPECT_TRUE(WIFEXITED(status));
+  EXPECT_EQ(WEXITSTATUS(status), 0);
+}
+
+}  // namespace holoscan
@@ -0,0 +1,210 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "holoscan/core/resources/gxf/slab_pool.hpp"
+
+namespace holoscan {
+
+namespace {
+
+// Slab pool backed by the system allocator, counting the live slabs and large allocations
+class SlabPoolTest : public ::testing::Test {
+ protected:
+  std::unique_ptr<SlabPool> make_pool(std::vector<uint64_t> size_classes, uint64_t slab_size,
+                                      uint64_t max_bytes = 0, uint64_t thread_cache_size = 0) {
+    return std::make_unique<SlabPool>(
+        std::move(size_classes),
+        slab_size,
+        max_bytes,
+        thread_cache_size,
+        [this](uint64_t size) {
+          live_chunks_++;
+          return std::aligned_alloc(SlabPool::kBlockAlignment,
+                                    (size + SlabPool::kBlockAlignment - 1) /
+                                        SlabPool::kBlockAlignment * SlabPool::kBlockAlignment);
+        },
+        [this](void* pointer, uint64_t) {
+          live_chunks_--;
+          std::free(pointer);
+        });
+  }
+
+  std::atomic<int> live_chunks_{0};
+};
+
+}  // namespace
+
+TEST(SlabPool, TestPowerOfTwoSizeClasses) {
+  auto size_classes = SlabPool::power_of_two_size_classes(300, 4096);
+  EXPECT_EQ(size_classes, (std::vector<uint64_t>{512, 1024, 2048, 4096}));
+  EXPECT_TRUE(SlabPool::power_of_two_size_classes(8192, 4096).empty());
+}
+
+TEST_F(SlabPoolTest, TestSizeClasses) {
+  // Sizes are rounded up to the block alignment, sorted and deduplicated
+  auto pool = make_pool({1000, 100, 256}, 4096);
+  EXPECT_EQ(pool->size_classes(), (std::vector<uint64_t>{256, 1024}));
+}
+
+TEST_F(SlabPoolTest, TestAllocateFree) {
+  auto pool = make_pool({256, 1024}, 4096);
+
+  // Blocks of a size class are handed out in address order from the same slab
+  void* first = pool->allocate(100);
+  void* second = pool->allocate(256);
+  ASSERT_NE(first, nullptr);
+  EXPECT_EQ(static_cast<uint8_t*>(second) - static_cast<uint8_t*>(first), 256);
+  void* medium = pool->allocate(1000);
+  ASSERT_NE(medium, nullptr);
+
+  auto stats = pool->stats();
+  EXPECT_EQ(stats.allocations, 3UL);
+  EXPECT_EQ(stats.slabs, 2UL);
+  EXPECT_EQ(stats.reserved_bytes, 8192UL);
+  EXPECT_EQ(stats.in_use_blocks, 3UL);
+  EXPECT_EQ(stats.in_use_bytes, 256UL + 256UL + 1024UL);
+
+  // A freed block is reused by the next allocation of its size class
+  EXPECT_TRUE(pool->free(first));
+  EXPECT_EQ(pool->allocate(10), first);
+
+  // Pointers not handed out by the pool are rejected
+  EXPECT_FALSE(pool->free(static_cast<uint8_t*>(medium) + 1));
+  int value = 0;
+  EXPECT_FALSE(pool->free(&value));
+  EXPECT_FALSE(pool->free(nullptr));
+
+  EXPECT_TRUE(pool->free(first));
+  EXPECT_TRUE(pool->free(second));
+  EXPECT_TRUE(pool->free(medium));
+  EXPECT_EQ(pool->stats().in_use_blocks, 0UL);
+
+  pool.reset();
+  EXPECT_EQ(live_chunks_, 0);
+}
+
+TEST_F(SlabPoolTest, TestLargeAllocation) {
+  auto pool = make_pool({256}, 4096);
+  void* large = pool->allocate(10000);
+  ASSERT_NE(large, nullptr);
+  EXPECT_EQ(pool->stats().large_allocations, 1UL);
+  EXPECT_EQ(live_chunks_, 1);
+
+  // Large allocations are released when they are freed
+  EXPECT_TRUE(pool->free(large));
+  EXPECT_EQ(live_chunks_, 0);
+  EXPECT_EQ(pool->stats().reserved_bytes, 0UL);
+}
+
+TEST_F(SlabPoolTest, TestMaxBytes) {
+  auto pool = make_pool({1024}, 4096, 4096);
+  EXPECT_TRUE(pool->is_available(1024));
+  std::vector<void*> blocks;
+  for (int i = 0; i < 4; ++i) { blocks.push_back(pool->allocate(1024)); }
+  EXPECT_NE(blocks.back(), nullptr);
+
+  // The next slab would exceed the limit
+  EXPECT_FALSE(pool->is_available(1024));
+  EXPECT_EQ(pool->allocate(1024), nullptr);
+  EXPECT_EQ(pool->allocate(8192), nullptr);
+  EXPECT_EQ(pool->stats().failed_allocations, 2UL);
+
+  EXPECT_TRUE(pool->free(blocks.back()));
+  EXPECT_TRUE(pool->is_available(1024));
+}
+
+TEST_F(SlabPoolTest, TestThreadCache) {
+  auto pool = make_pool({256, 1024}, 64 * 1024, 0, 16);
+
+  std::vector<std::thread> threads;
+  for (int thread_index = 0; thread_index < 4; ++thread_index) {
+    threads.emplace_back([&pool]() {
+      for (int iteration = 0; iteration < 1000; ++iteration) {
+        std::vector<void*> blocks;
+        for (int i = 0; i < 8; ++i) {
+          void* block = pool->allocate(i % 2 ? 1000 : 200);
+          ASSERT_NE(block, nullptr);
+          blocks.push_back(block);
+        }
+        for (void* block : blocks) { ASSERT_TRUE(pool->free(block)); }
+      }
+    });
+  }
+  for (auto& thread : threads) { thread.join(); }
+
+  auto stats = pool->stats();
+  EXPECT_EQ(stats.allocations, 4UL * 1000 * 8);
+  // Most allocations are served by the thread-local caches
+  EXPECT_GT(stats.thread_cache_hits, stats.allocations / 2);
+  EXPECT_EQ(stats.in_use_blocks, 0UL);
+
+  pool.reset();
+  EXPECT_EQ(live_chunks_, 0);
+}
+
+TEST_F(SlabPoolTest, TestCachedBlocksAreAvailable) {
+  auto pool = make_pool({1024}, 4096, 4096, 16);
+  std::vector<void*> blocks;
+  for (int i = 0; i < 4; ++i) { blocks.push_back(pool->allocate(1024)); }
+  EXPECT_FALSE(pool->is_available(1024));
+
+  // The freed block is kept in the cache of this thread and handed out again
+  EXPECT_TRUE(pool->free(blocks.back()));
+  EXPECT_TRUE(pool->is_available(1024));
+  EXPECT_EQ(pool->allocate(1024), blocks.back());
+}
+
+TEST_F(SlabPoolTest, TestThreadCacheReleasedOnThreadExit) {
+  auto pool = make_pool({1024}, 4096, 4096, 16);
+
+  // The blocks freed by the thread are cached by it until it exits
+  std::thread thread([&pool]() {
+    std::vector<void*> blocks;
+    for (int i = 0; i < 4; ++i) { blocks.push_back(pool->allocate(1024)); }
+    for (void* block : blocks) { ASSERT_TRUE(pool->free(block)); }
+  });
+  thread.join();
+
+  EXPECT_TRUE(pool->is_available(1024));
+  for (int i = 0; i < 4; ++i) { EXPECT_NE(pool->allocate(1024), nullptr); }
+  EXPECT_EQ(pool->stats().slabs, 1UL);
+}
+
+TEST_F(SlabPoolTest, TestDoubleFree) {
+  auto pool = make_pool({256}, 4096, 0, 16);
+  void* block = pool->allocate(256);
+  ASSERT_NE(block, nullptr);
+  EXPECT_TRUE(pool->free(block));
+  EXPECT_FALSE(pool->free(block));
+  EXPECT_EQ(pool->stats().in_use_blocks, 0UL);
+
+  // The block is handed out only once
+  EXPECT_EQ(pool->allocate(256), block);
+  EXPECT_NE(pool->allocate(256), block);
+}
+
+}  // namespace holoscan
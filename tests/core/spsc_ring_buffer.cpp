@@ -0,0 +1,131 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "holoscan/core/resources/gxf/spsc_ring_buffer.hpp"
+
+namespace holoscan {
+
+TEST(SpscRingBuffer, TestPushPop) {
+  SpscRingBuffer<int64_t> buffer(3);
+  EXPECT_EQ(buffer.capacity(), 3);
+  EXPECT_TRUE(buffer.empty());
+
+  EXPECT_TRUE(buffer.push(1));
+  EXPECT_TRUE(buffer.push(2));
+  EXPECT_TRUE(buffer.push(3));
+  // the capacity is not rounded up to the number of slots
+  EXPECT_FALSE(buffer.push(4));
+  EXPECT_EQ(buffer.size(), 3);
+
+  int64_t value = 0;
+  EXPECT_TRUE(buffer.peek(2, value));
+  EXPECT_EQ(value, 3);
+  EXPECT_FALSE(buffer.peek(3, value));
+
+  EXPECT_TRUE(buffer.pop(value));
+  EXPECT_EQ(value, 1);
+  EXPECT_TRUE(buffer.push(4));
+  for (int64_t expected = 2; expected <= 4; ++expected) {
+    EXPECT_TRUE(buffer.pop(value));
+    EXPECT_EQ(value, expected);
+  }
+  EXPECT_FALSE(buffer.pop(value));
+  EXPECT_TRUE(buffer.empty());
+}
+
+TEST(SpscRingBuffer, TestEvict) {
+  SpscRingBuffer<int64_t> buffer(2);
+  int64_t value = 0;
+  EXPECT_FALSE(buffer.evict(value));
+
+  EXPECT_TRUE(buffer.push(1));
+  EXPECT_TRUE(buffer.push(2));
+  EXPECT_TRUE(buffer.evict(value));
+  EXPECT_EQ(value, 1);
+  EXPECT_TRUE(buffer.push(3));
+
+  EXPECT_TRUE(buffer.pop(value));
+  EXPECT_EQ(value, 2);
+  EXPECT_TRUE(buffer.pop(value));
+  EXPECT_EQ(value, 3);
+}
+
+TEST(SpscRingBuffer, TestConcurrentProducerConsumer) {
+  constexpr int64_t kCount = 200000;
+  SpscRingBuffer<int64_t> buffer(16);
+
+  std::thread producer([&buffer]() {
+    for (int64_t i = 0; i < kCount; ++i) {
+      while (!buffer.push(i)) { std::this_thread::yield(); }
+    }
+  });
+
+  int64_t expected = 0;
+  int64_t value = 0;
+  while (expected < kCount) {
+    if (!buffer.pop(value)) {
+      std::this_thread::yield();
+      continue;
+    }
+    ASSERT_EQ(value, expected);
+    ++expected;
+  }
+  producer.join();
+  EXPECT_TRUE(buffer.empty());
+}
+
+TEST(SpscRingBuffer, TestConcurrentEviction) {
+  // Each element must be either received by the consumer or evicted by the producer, once.
+  constexpr int64_t kCount = 200000;
+  SpscRingBuffer<int64_t> buffer(4);
+  std::vector<int64_t> evicted;
+
+  std::thread producer([&buffer, &evicted]() {
+    int64_t oldest = 0;
+    // Push all the elements followed by an end marker, dropping the oldest one when full
+    for (int64_t i = 0; i <= kCount; ++i) {
+      int64_t element = i < kCount ? i : -1;
+      if (!buffer.push(element)) {
+        if (buffer.evict(oldest)) { evicted.push_back(oldest); }
+        ASSERT_TRUE(buffer.push(element));
+      }
+    }
+  });
+
+  std::vector<int64_t> received;
+  int64_t value = 0;
+  while (true) {
+    if (!buffer.pop(value)) {
+      std::this_thread::yield();
+      continue;
+    }
+    if (value < 0) { break; }
+    received.push_back(value);
+  }
+  producer.join();
+
+  EXPECT_EQ(received.size() + evicted.size(), static_cast<size_t>(kCount));
+  for (size_t i = 1; i < received.size(); ++i) { ASSERT_LT(received[i - 1], received[i]); }
+}
+
+}  // namespace holoscan
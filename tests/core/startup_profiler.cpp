@@ -0,0 +1,88 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "holoscan/core/fragment.hpp"
+#include "holoscan/core/startup_profiler.hpp"
+
+namespace holoscan {
+
+TEST(StartupProfiler, TestRecord) {
+  StartupProfiler profiler;
+  EXPECT_TRUE(profiler.records().empty());
+
+  profiler.record(StartupProfiler::kCompose, 2.0);
+  profiler.record(StartupProfiler::kOperatorInitialize, 1.0, "tx");
+  profiler.record(StartupProfiler::kOperatorInitialize, 0.5, "rx");
+
+  auto records = profiler.records();
+  ASSERT_EQ(records.size(), 3);
+  EXPECT_EQ(records[0].phase, StartupProfiler::kCompose);
+  EXPECT_TRUE(records[0].component.empty());
+  EXPECT_EQ(records[2].component, "rx");
+  EXPECT_DOUBLE_EQ(profiler.total_duration_ms(StartupProfiler::kOperatorInitialize), 1.5);
+  EXPECT_DOUBLE_EQ(profiler.total_duration_ms(StartupProfiler::kOperatorStart), 0.0);
+
+  std::string report = profiler.report("fragment1");
+  EXPECT_TRUE(report.find("Startup profile of fragment 'fragment1':") != std::string::npos);
+  EXPECT_TRUE(report.find("operator_initialize") != std::string::npos);
+  EXPECT_TRUE(report.find("(rx)") != std::string::npos);
+
+  profiler.clear();
+  EXPECT_TRUE(profiler.records().empty());
+}
+
+TEST(StartupProfiler, TestScopedPhase) {
+  StartupProfiler profiler;
+  { StartupProfiler::ScopedPhase phase(profiler, StartupProfiler::kActivateGXFGraph); }
+  auto records = profiler.records();
+  ASSERT_EQ(records.size(), 1);
+  EXPECT_EQ(records[0].phase, StartupProfiler::kActivateGXFGraph);
+  EXPECT_GE(records[0].duration_ms, 0.0);
+}
+
+TEST(StartupProfiler, TestDriverReport) {
+  StartupProfiler profiler("driver");
+  profiler.record(StartupProfiler::kSchedule, 0.2);
+  profiler.record(StartupProfiler::kLaunch, 3.0, "2 workers");
+
+  std::string report = profiler.report("my_app");
+  EXPECT_TRUE(report.find("Startup profile of driver 'my_app':") != std::string::npos);
+  EXPECT_TRUE(report.find("ms (2 workers)") != std::string::npos);
+}
+
+TEST(StartupProfiler, TestStartupComplete) {
+  StartupProfiler profiler;
+  profiler.expect_operator_starts(2);
+  EXPECT_FALSE(profiler.is_startup_complete());
+  profiler.record(StartupProfiler::kOperatorStart, 0.1, "tx");
+  EXPECT_FALSE(profiler.is_startup_complete());
+  profiler.record(StartupProfiler::kOperatorStart, 0.1, "rx");
+  EXPECT_TRUE(profiler.is_startup_complete());
+}
+
+TEST(StartupProfiler, TestFragmentComposePhase) {
+  Fragment fragment;
+  fragment.compose_graph();
+  EXPECT_EQ(fragment.startup_profiler().records().size(), 1);
+  EXPECT_EQ(fragment.startup_profiler().records()[0].phase, StartupProfiler::kCompose);
+}
+
+}  // namespace holoscan
@@ -0,0 +1,88 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <thread>
+
+#include "holoscan/core/system/tsc_counter.hpp"
+
+namespace holoscan {
+
+using namespace std::chrono_literals;
+
+TEST(TscCounter, TestSource) {
+  TscCounter counter(10ms);
+  if (TscCounter::has_invariant_counter()) {
+    EXPECT_NE(counter.source(), TscCounter::Source::kMonotonic);
+  } else {
+    EXPECT_EQ(counter.source(), TscCounter::Source::kMonotonic);
+  }
+  EXPECT_GT(counter.frequency_hz(), 0.0);
+}
+
+TEST(TscCounter, TestMatchesMonotonicClock) {
+  TscCounter counter(10ms);
+  EXPECT_LT(std::llabs(counter.now_ns() - TscCounter::monotonic_ns()), 1000000LL);
+
+  const int64_t start_ns = counter.now_ns();
+  const int64_t start_monotonic_ns = TscCounter::monotonic_ns();
+  std::this_thread::sleep_for(50ms);
+  const int64_t elapsed_ns = counter.now_ns() - start_ns;
+  const int64_t elapsed_monotonic_ns = TscCounter::monotonic_ns() - start_monotonic_ns;
+  // Calibration error (a 10 ms calibration is accurate to well within 1%)
+  EXPECT_LT(std::llabs(elapsed_ns - elapsed_monotonic_ns), elapsed_monotonic_ns / 100);
+}
+
+TEST(TscCounter, TestNonDecreasing) {
+  TscCounter counter(10ms);
+  int64_t previous_ns = counter.now_ns();
+  for (int i = 0; i < 100000; ++i) {
+    const int64_t now_ns = counter.now_ns();
+    ASSERT_GE(now_ns, previous_ns);
+    previous_ns = now_ns;
+  }
+
+  // ticks_to_ns(ticks()) is in the time base of now_ns(): successive reads stay ordered
+  const int64_t before_ns = counter.now_ns();
+  const int64_t ticks_ns = counter.ticks_to_ns(counter.ticks());
+  const int64_t after_ns = counter.now_ns();
+  EXPECT_LE(before_ns, ticks_ns);
+  EXPECT_LE(ticks_ns, after_ns);
+}
+
+TEST(TscCounter, TestFallback) {
+  TscCounter counter(10ms, false);
+  EXPECT_EQ(counter.source(), TscCounter::Source::kMonotonic);
+  EXPECT_STREQ(counter.source_name(), "clock_monotonic");
+  EXPECT_EQ(counter.frequency_hz(), 1e9);
+  EXPECT_LT(std::llabs(counter.now_ns() - TscCounter::monotonic_ns()), 1000000LL);
+}
+
+TEST(TscCounter, TestEpoch) {
+  const auto& counter = TscCounter::instance();
+  EXPECT_EQ(&counter, &TscCounter::instance());
+  const int64_t system_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                std::chrono::system_clock::now().time_since_epoch())
+                                .count();
+  EXPECT_LT(std::llabs(counter.epoch_ns() - system_ns), 10000000LL);
+}
+
+}  // namespace holoscan
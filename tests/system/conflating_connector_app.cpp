@@ -0,0 +1,183 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <gxf/std/tensor.hpp>
+#include <holoscan/holoscan.hpp>
+
+namespace holoscan {
+
+// Do not pollute holoscan namespace with utility classes
+namespace {
+
+constexpr int64_t kMessageCount = 50;
+
+///////////////////////////////////////////////////////////////////////////////
+// Utility Operators
+///////////////////////////////////////////////////////////////////////////////
+
+/// Emit messages made of two empty tensors: the first one is named after the key (the keys are
+/// used in turn) and the second one after the index of the message (starting at 1).
+class KeyedTxOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(KeyedTxOp)
+
+  KeyedTxOp() = default;
+
+  void setup(OperatorSpec& spec) override { spec.output<gxf::Entity>("out"); }
+
+  void compute(InputContext&, OutputContext& op_output, ExecutionContext& context) override {
+    auto out_message = gxf::Entity::New(&context);
+    auto& entity = static_cast<nvidia::gxf::Entity&>(out_message);
+    const auto& key = keys_[(index_ - 1) % keys_.size()];
+    if (!entity.add<nvidia::gxf::Tensor>(key.c_str()) ||
+        !entity.add<nvidia::gxf::Tensor>(std::to_string(index_).c_str())) {
+      HOLOSCAN_LOG_ERROR("Failed to add the tensors of message {}", index_);
+    }
+    index_++;
+
+    op_output.emit(out_message, "out");
+  }
+
+  void keys(std::vector<std::string> keys) { keys_ = std::move(keys); }
+
+ private:
+  std::vector<std::string> keys_{"value"};
+  size_t index_ = 1;
+};
+
+/// Record the (key, index) of the received messages, taking longer than the producer.
+class SlowRxOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(SlowRxOp)
+
+  SlowRxOp() = default;
+
+  void setup(OperatorSpec& spec) override { spec.input<gxf::Entity>("in"); }
+
+  void compute(InputContext& op_input, OutputContext&, ExecutionContext&) override {
+    auto in_message = op_input.receive<gxf::Entity>("in").value();
+    auto tensors = static_cast<nvidia::gxf::Entity&>(in_message).findAll<nvidia::gxf::Tensor>();
+    if (tensors && tensors->size() == 2) {
+      received_.emplace_back(tensors->at(0).value().name(),
+                             std::stoll(tensors->at(1).value().name()));
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  }
+
+  const std::vector<std::pair<std::string, int64_t>>& received() const { return received_; }
+
+ private:
+  std::vector<std::pair<std::string, int64_t>> received_;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Utility Applications
+///////////////////////////////////////////////////////////////////////////////
+
+class ConflatingConnectorApp : public holoscan::Application {
+ public:
+  explicit ConflatingConnectorApp(std::vector<std::string> keys) : keys_(std::move(keys)) {}
+
+  void compose() override {
+    using namespace holoscan;
+    auto tx = make_operator<KeyedTxOp>("tx", make_condition<CountCondition>(kMessageCount));
+    tx->keys(keys_);
+    rx_ = make_operator<SlowRxOp>("rx");
+
+    ArgList connector_args;
+    if (keys_.size() > 1) { connector_args.add(Arg("key_by_tensor_name", true)); }
+    add_flow(tx, rx_, {{"out", "in"}}, IOSpec::ConnectorType::kConflating, connector_args);
+
+    // The producer and the consumer must run concurrently for messages to be replaced.
+    scheduler(make_scheduler<MultiThreadScheduler>("multithread_scheduler",
+                                                   Arg("worker_thread_number", 2L),
+                                                   Arg("stop_on_deadlock", true),
+                                                   Arg("stop_on_deadlock_timeout", 100L)));
+  }
+
+  std::shared_ptr<SlowRxOp> rx() const { return rx_; }
+
+  uint64_t dropped_count() const {
+    auto receiver =
+        std::dynamic_pointer_cast<ConflatingReceiver>(rx_->spec()->inputs()["in"]->connector());
+    return receiver ? receiver->dropped_count() : 0;
+  }
+
+ private:
+  std::vector<std::string> keys_;
+  std::shared_ptr<SlowRxOp> rx_;
+};
+
+}  // namespace
+
+///////////////////////////////////////////////////////////////////////////////
+// Tests
+///////////////////////////////////////////////////////////////////////////////
+
+TEST(ConflatingConnectorApp, TestLatestValueWins) {
+  auto app = make_application<ConflatingConnectorApp>(std::vector<std::string>{"value"});
+  app->run();
+
+  const auto& received = app->rx()->received();
+  ASSERT_FALSE(received.empty());
+
+  // Messages are received in order and the last one sent is never dropped.
+  for (size_t i = 1; i < received.size(); ++i) {
+    EXPECT_GT(received[i].second, received[i - 1].second);
+  }
+  EXPECT_EQ(received.back().second, kMessageCount);
+
+  // Every message sent is either received or counted as dropped.
+  uint64_t dropped = app->dropped_count();
+  EXPECT_GT(dropped, 0UL);
+  EXPECT_EQ(received.size() + dropped, static_cast<uint64_t>(kMessageCount));
+}
+
+TEST(ConflatingConnectorApp, TestKeyByTensorName) {
+  auto app = make_application<ConflatingConnectorApp>(std::vector<std::string>{"a", "b"});
+  app->run();
+
+  const auto& received = app->rx()->received();
+  ASSERT_FALSE(received.empty());
+
+  // The latest message of each key is kept: 'a' has odd indices and 'b' even ones.
+  std::map<std::string, int64_t> last_index;
+  for (const auto& [key, index] : received) {
+    EXPECT_EQ(key, index % 2 == 1 ? "a" : "b");
+    auto it = last_index.find(key);
+    if (it != last_index.end()) { EXPECT_GT(index, it->second); }
+    last_index[key] = index;
+  }
+  EXPECT_EQ(last_index["a"], kMessageCount - 1);
+  EXPECT_EQ(last_index["b"], kMessageCount);
+
+  uint64_t dropped = app->dropped_count();
+  EXPECT_GT(dropped, 0UL);
+  EXPECT_EQ(received.size() + dropped, static_cast<uint64_t>(kMessageCount));
+}
+
+}  // namespace holoscan
@@ -16,9 +16,14 @@
  */
 
 #include <gtest/gtest.h>
+#include <spawn.h>     // POSIX posix_spawn
+#include <sys/wait.h>  // POSIX waitpid
+#include <unistd.h>    // POSIX environ
 
+#include <cstdlib>
 #include <string>
 #include <thread>
+#include <utility>
 #include <vector>
 
 #include <holoscan/holoscan.hpp>
@@ -198,6 +203,47 @@ class BroadcastOp : public Operator {
   };
 };
 
+// Emits its tick index by value (so that the messages can be coalesced).
+class IndexTxOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(IndexTxOp)
+
+  IndexTxOp() = default;
+
+  void setup(OperatorSpec& spec) override { spec.output<int64_t>("out"); }
+
+  void compute(InputContext&, OutputContext& op_output, ExecutionContext&) override {
+    op_output.emit(index_++, "out");
+  };
+
+ private:
+  int64_t index_ = 0;
+};
+
+// Checks that the indices sent by IndexTxOp are received in order.
+class IndexRxOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(IndexRxOp)
+
+  IndexRxOp() = default;
+
+  void setup(OperatorSpec& spec) override { spec.input<int64_t>("in"); }
+
+  void compute(InputContext& op_input, OutputContext&, ExecutionContext&) override {
+    auto index = op_input.receive<int64_t>("in").value();
+    if (index != expected_index_) {
+      HOLOSCAN_LOG_ERROR("Rx {}.{} expected index {}, got {}",
+                         fragment()->name(), name(), expected_index_, index);
+    } else {
+      HOLOSCAN_LOG_INFO("Rx {}.{} in-order count: {}", fragment()->name(), name(), index + 1);
+    }
+    expected_index_ = index + 1;
+  };
+
+ private:
+  int64_t expected_index_ = 0;
+};
+
 ///////////////////////////////////////////////////////////////////////////////
 // Utility Fragments
 ///////////////////////////////////////////////////////////////////////////////
@@ -264,6 +310,24 @@ class BroadcastFragment : public holoscan::Fragment {
   }
 };
 
+class IndexTxFragment : public holoscan::Fragment {
+ public:
+  void compose() override {
+    using namespace holoscan;
+    auto tx = make_operator<IndexTxOp>("tx", make_condition<CountCondition>(100));
+    add_operator(tx);
+  }
+};
+
+class IndexRxFragment : public holoscan::Fragment {
+ public:
+  void compose() override {
+    using namespace holoscan;
+    auto rx = make_operator<IndexRxOp>("rx", make_condition<CountCondition>(100));
+    add_operator(rx);
+  }
+};
+
 class OneRxFragment : public holoscan::Fragment {
  public:
   void compose() override {
@@ -680,13 +744,68 @@ class UCXBroadCastMultiReceiverApp : public holoscan::Application {
   }
 };
 
+/**
+ * @brief Application class for testing the order of the messages sent by value over UCX.
+ *
+ * fragment1.tx emits 100 indices, which are received by fragment2.rx.
+ *
+ * - fragment1.tx -> fragment2.rx
+ */
+class UCXIndexApp : public holoscan::Application {
+ public:
+  // Inherit the constructor
+  using Application::Application;
+
+  void compose() override {
+    using namespace holoscan;
+    auto fragment1 = make_fragment<IndexTxFragment>("fragment1");
+    auto fragment2 = make_fragment<IndexRxFragment>("fragment2");
+
+    add_flow(fragment1, fragment2, {{"tx", "rx"}});
+  }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Test Fixtures
+///////////////////////////////////////////////////////////////////////////////
+
+/// Run the tests with HOLOSCAN_ENABLE_SHARED_MEMORY_TRANSPORT set to `kSharedMemory`, so that the
+/// fragments (all running in the test process) are connected through UCX or shared memory.
+template <bool kSharedMemory>
+class TransportTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    const char* env_value = std::getenv("HOLOSCAN_ENABLE_SHARED_MEMORY_TRANSPORT");
+    if (env_value) { env_orig_ = env_value; }
+    has_env_orig_ = env_value != nullptr;
+    setenv("HOLOSCAN_ENABLE_SHARED_MEMORY_TRANSPORT", kSharedMemory ? "true" : "false", 1);
+  }
+
+  void TearDown() override {
+    if (has_env_orig_) {
+      setenv("HOLOSCAN_ENABLE_SHARED_MEMORY_TRANSPORT", env_orig_.c_str(), 1);
+    } else {
+      unsetenv("HOLOSCAN_ENABLE_SHARED_MEMORY_TRANSPORT");
+    }
+  }
+
+ private:
+  std::string env_orig_;
+  bool has_env_orig_ = false;
+};
+
+constexpr const char* kSharedMemoryConnectionLog = "through shared memory segment";
+
 }  // namespace
 
+using DistributedApp = TransportTest<false>;
+using SharedMemoryDistributedApp = TransportTest<true>;
+
 ///////////////////////////////////////////////////////////////////////////////
 // Tests
 ///////////////////////////////////////////////////////////////////////////////
 
-TEST(DistributedApp, TestTwoParallelFragmentsApp) {
+TEST_F(DistributedApp, TestTwoParallelFragmentsApp) {
   auto app = make_application<TwoParallelFragmentsApp>();
 
   // capture output so that we can check that the expected value is present
@@ -701,7 +820,7 @@ TEST(DistributedApp, TestTwoParallelFragmentsApp) {
 
 // Currently, the following tests are disabled because they are not working with the current
 // implementation of UCXTransmitter/UCXReceiver. The tests are kept here for future reference.
-TEST(DistributedApp, TestTwoMultiInputsOutputsFragmentsApp) {
+TEST_F(DistributedApp, TestTwoMultiInputsOutputsFragmentsApp) {
   auto app = make_application<TwoMultiInputsOutputsFragmentsApp>();
 
   // // capture output so that we can check that the expected value is present
@@ -714,7 +833,7 @@ TEST(DistributedApp, TestTwoMultiInputsOutputsFragmentsApp) {
 }
 
 // Following test is a workaround solution for TwoMultiInputsOutputsFragmentsApp test.
-TEST(DistributedApp, TestForwardedTwoMultiInputsOutputsFragmentsApp) {
+TEST_F(DistributedApp, TestForwardedTwoMultiInputsOutputsFragmentsApp) {
   auto app = make_application<ForwardedTwoMultiInputsOutputsFragmentsApp>();
 
   // capture output so that we can check that the expected value is present
@@ -728,7 +847,7 @@ TEST(DistributedApp, TestForwardedTwoMultiInputsOutputsFragmentsApp) {
 
 // Currently, the following tests are disabled because they are not working with the current
 // implementation of UCXTransmitter/UCXReceiver. The tests are kept here for future reference.
-TEST(DistributedApp, TestTwoMultiInputsOutputsFragmentsApp2) {
+TEST_F(DistributedApp, TestTwoMultiInputsOutputsFragmentsApp2) {
   auto app = make_application<TwoMultiInputsOutputsFragmentsApp2>();
 
   // // capture output so that we can check that the expected value is present
@@ -742,7 +861,7 @@ TEST(DistributedApp, TestTwoMultiInputsOutputsFragmentsApp2) {
 
 // Currently, the following tests are disabled because they are not working with the current
 // implementation of UCXTransmitter/UCXReceiver. The tests are kept here for future reference.
-TEST(DistributedApp, TestForwardedTwoMultiInputsOutputsFragmentsApp2) {
+TEST_F(DistributedApp, TestForwardedTwoMultiInputsOutputsFragmentsApp2) {
   // auto app = make_application<ForwardedTwoMultiInputsOutputsFragmentsApp2>();
 
   // capture output so that we can check that the expected value is present
@@ -754,7 +873,26 @@ TEST(DistributedApp, TestForwardedTwoMultiInputsOutputsFragmentsApp2) {
   // EXPECT_TRUE(log_output.find("received count: 10") != std::string::npos);
 }
 
-TEST(DistributedApp, TestUCXConnectionApp) {
+TEST_F(DistributedApp, TestUCXConnectionApp) {
+  auto app = make_application<UCXConnectionApp>();
+
+  // capture output so that we can check that the expected value is present
+  testing::internal::CaptureStderr();
+
+  app->run();
+
+  std::string log_output = testing::internal::GetCapturedStderr();
+  EXPECT_TRUE(log_output.find("received count: 10") != std::string::npos);
+  // the shared memory transport is opt-in
+  EXPECT_TRUE(log_output.find(kSharedMemoryConnectionLog) == std::string::npos);
+}
+
+TEST_F(DistributedApp, TestUCXConnectionAppWithCoalescing) {
+  const char* window_env_orig = std::getenv("HOLOSCAN_UCX_COALESCING_WINDOW_US");
+
+  // Use a coalescing window of 100 us
+  setenv("HOLOSCAN_UCX_COALESCING_WINDOW_US", "100", 1);
+
   auto app = make_application<UCXConnectionApp>();
 
   // capture output so that we can check that the expected value is present
@@ -764,9 +902,42 @@ TEST(DistributedApp, TestUCXConnectionApp) {
 
   std::string log_output = testing::internal::GetCapturedStderr();
   EXPECT_TRUE(log_output.find("received count: 10") != std::string::npos);
+
+  // restore the original environment variable
+  if (window_env_orig) {
+    setenv("HOLOSCAN_UCX_COALESCING_WINDOW_US", window_env_orig, 1);
+  } else {
+    unsetenv("HOLOSCAN_UCX_COALESCING_WINDOW_US");
+  }
+}
+
+TEST_F(DistributedApp, TestUCXCoalescingOrderAndFinalFlush) {
+  const char* window_env_orig = std::getenv("HOLOSCAN_UCX_COALESCING_WINDOW_US");
+
+  // With a 1 s window, the indices are sent in batches of at most 64 (the default maximum batch
+  // size) while tx ticks, and the last ones are only sent when the transmitter is deinitialized.
+  setenv("HOLOSCAN_UCX_COALESCING_WINDOW_US", "1000000", 1);
+
+  auto app = make_application<UCXIndexApp>();
+
+  // capture output so that we can check that the expected value is present
+  testing::internal::CaptureStderr();
+
+  app->run();
+
+  std::string log_output = testing::internal::GetCapturedStderr();
+  EXPECT_TRUE(log_output.find("in-order count: 100") != std::string::npos);
+  EXPECT_TRUE(log_output.find("expected index") == std::string::npos);
+
+  // restore the original environment variable
+  if (window_env_orig) {
+    setenv("HOLOSCAN_UCX_COALESCING_WINDOW_US", window_env_orig, 1);
+  } else {
+    unsetenv("HOLOSCAN_UCX_COALESCING_WINDOW_US");
+  }
 }
 
-TEST(DistributedApp, TestUCXLinearPipelineApp) {
+TEST_F(DistributedApp, TestUCXLinearPipelineApp) {
   auto app = make_application<UCXLinearPipelineApp>();
 
   // capture output so that we can check that the expected value is present
@@ -778,7 +949,7 @@ TEST(DistributedApp, TestUCXLinearPipelineApp) {
   EXPECT_TRUE(log_output.find("received count: 10") != std::string::npos);
 }
 
-TEST(DistributedApp, TestUCXBroadcastApp) {
+TEST_F(DistributedApp, TestUCXBroadcastApp) {
   auto app = make_application<UCXBroadcastApp>();
 
   // capture output so that we can check that the expected value is present
@@ -791,7 +962,7 @@ TEST(DistributedApp, TestUCXBroadcastApp) {
   EXPECT_TRUE(log_output.find("Rx fragment4.rx message received count: 10") != std::string::npos);
 }
 
-TEST(DistributedApp, TestUCXBroadCastMultiReceiverApp) {
+TEST_F(DistributedApp, TestUCXBroadCastMultiReceiverApp) {
   auto app = make_application<UCXBroadCastMultiReceiverApp>();
 
   // capture output so that we can check that the expected value is present
@@ -805,7 +976,156 @@ TEST(DistributedApp, TestUCXBroadCastMultiReceiverApp) {
   EXPECT_TRUE(log_output.find("Rx fragment4.rx message received count: 10") != std::string::npos);
 }
 
-TEST(DistributedApp, TestDriverTerminationWithConnectionFailure) {
+TEST_F(DistributedApp, TestDriverStartupPhases) {
+  const char* env_orig = std::getenv("HOLOSCAN_STARTUP_PROFILE");
+
+  // Log the startup breakdown of the driver and of the fragments
+  setenv("HOLOSCAN_STARTUP_PROFILE", "true", 1);
+
+  auto app = make_application<UCXBroadcastApp>();
+
+  // capture output so that we can check that the expected value is present
+  testing::internal::CaptureStderr();
+
+  app->run();
+
+  std::string log_output = testing::internal::GetCapturedStderr();
+  EXPECT_TRUE(log_output.find("Startup profile of driver") != std::string::npos);
+  EXPECT_TRUE(log_output.find("ms (1 workers)") != std::string::npos);
+  EXPECT_TRUE(log_output.find("Startup profile of fragment 'fragment3'") != std::string::npos);
+  EXPECT_TRUE(log_output.find("Rx fragment3.rx message received count: 10") != std::string::npos);
+  EXPECT_TRUE(log_output.find("Rx fragment4.rx message received count: 10") != std::string::npos);
+
+  // restore the original environment variable
+  if (env_orig) {
+    setenv("HOLOSCAN_STARTUP_PROFILE", env_orig, 1);
+  } else {
+    unsetenv("HOLOSCAN_STARTUP_PROFILE");
+  }
+}
+
+TEST_F(DistributedApp, TestDriverStartupPhasesWithSerialWorkerRequests) {
+  const char* env_orig = std::getenv("HOLOSCAN_PARALLEL_WORKER_REQUESTS");
+  const char* profile_env_orig = std::getenv("HOLOSCAN_STARTUP_PROFILE");
+
+  // Send the requests to the workers one after another
+  setenv("HOLOSCAN_PARALLEL_WORKER_REQUESTS", "false", 1);
+  setenv("HOLOSCAN_STARTUP_PROFILE", "true", 1);
+
+  auto app = make_application<UCXBroadcastApp>();
+
+  // capture output so that we can check that the expected value is present
+  testing::internal::CaptureStderr();
+
+  app->run();
+
+  std::string log_output = testing::internal::GetCapturedStderr();
+  EXPECT_TRUE(log_output.find("Startup profile of driver") != std::string::npos);
+  EXPECT_TRUE(log_output.find("ms (1 workers)") != std::string::npos);
+  EXPECT_TRUE(log_output.find("Rx fragment3.rx message received count: 10") != std::string::npos);
+  EXPECT_TRUE(log_output.find("Rx fragment4.rx message received count: 10") != std::string::npos);
+
+  // restore the original environment variables
+  if (env_orig) {
+    setenv("HOLOSCAN_PARALLEL_WORKER_REQUESTS", env_orig, 1);
+  } else {
+    unsetenv("HOLOSCAN_PARALLEL_WORKER_REQUESTS");
+  }
+  if (profile_env_orig) {
+    setenv("HOLOSCAN_STARTUP_PROFILE", profile_env_orig, 1);
+  } else {
+    unsetenv("HOLOSCAN_STARTUP_PROFILE");
+  }
+}
+
+TEST_F(DistributedApp, TestDriverStartupPhasesWithMultipleWorkers) {
+  // The driver (with a worker for fragment1 and fragment2) runs in this process, and fragment3 and
+  // fragment4 run in two worker processes. The workers listen on different loopback addresses so
+  // that the driver sends its requests to them concurrently.
+  //
+  // The worker processes run TestDriverStartupPhasesWorker from a new instance of this test binary
+  // (forking this multithreaded process could deadlock on the locks held by the other threads).
+  const std::string driver_address = "127.0.0.1:18765";
+  const std::vector<std::pair<std::string, std::string>> workers{
+      {"127.0.0.2:18766", "fragment3"}, {"127.0.0.3:18767", "fragment4"}};
+
+  // Log the startup breakdown (the worker processes inherit the environment)
+  const char* env_orig = std::getenv("HOLOSCAN_STARTUP_PROFILE");
+  setenv("HOLOSCAN_STARTUP_PROFILE", "true", 1);
+
+  // capture output (of the worker processes too) so that we can check the expected values
+  testing::internal::CaptureStderr();
+
+  std::vector<pid_t> worker_pids;
+  for (const auto& [worker_address, fragment_name] : workers) {
+    std::vector<std::string> env_vars{"HOLOSCAN_TEST_DRIVER_ADDRESS=" + driver_address,
+                                      "HOLOSCAN_TEST_WORKER_ADDRESS=" + worker_address,
+                                      "HOLOSCAN_TEST_WORKER_FRAGMENTS=" + fragment_name};
+    std::vector<char*> envp;
+    for (char** env = environ; *env != nullptr; ++env) { envp.push_back(*env); }
+    for (auto& env_var : env_vars) { envp.push_back(env_var.data()); }
+    envp.push_back(nullptr);
+    std::string exe_path = "/proc/self/exe";
+    std::string filter = "--gtest_filter=DistributedApp.TestDriverStartupPhasesWorker";
+    char* argv[] = {exe_path.data(), filter.data(), nullptr};
+
+    pid_t pid = 0;
+    ASSERT_EQ(posix_spawn(&pid, exe_path.c_str(), nullptr, nullptr, argv, envp.data()), 0);
+    worker_pids.push_back(pid);
+  }
+
+  const std::vector<std::string> args{"test_app",
+                                      "--driver",
+                                      "--worker",
+                                      "--address",
+                                      driver_address,
+                                      "--fragments",
+                                      "fragment1,fragment2"};
+  auto app = make_application<UCXBroadcastApp>(args);
+  app->run();
+
+  for (pid_t pid : worker_pids) {
+    int status = 0;
+    EXPECT_EQ(waitpid(pid, &status, 0), pid);
+    EXPECT_TRUE(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+  }
+
+  std::string log_output = testing::internal::GetCapturedStderr();
+  EXPECT_TRUE(log_output.find("ms (3 workers)") != std::string::npos);
+  EXPECT_TRUE(log_output.find("Startup profile of fragment 'fragment4'") != std::string::npos);
+  EXPECT_TRUE(log_output.find("Rx fragment3.rx message received count: 10") != std::string::npos);
+  EXPECT_TRUE(log_output.find("Rx fragment4.rx message received count: 10") != std::string::npos);
+
+  // restore the original environment variable
+  if (env_orig) {
+    setenv("HOLOSCAN_STARTUP_PROFILE", env_orig, 1);
+  } else {
+    unsetenv("HOLOSCAN_STARTUP_PROFILE");
+  }
+}
+
+TEST_F(DistributedApp, TestDriverStartupPhasesWorker) {
+  // Worker process of TestDriverStartupPhasesWithMultipleWorkers (skipped when run directly)
+  const char* driver_address = std::getenv("HOLOSCAN_TEST_DRIVER_ADDRESS");
+  const char* worker_address = std::getenv("HOLOSCAN_TEST_WORKER_ADDRESS");
+  const char* fragment_names = std::getenv("HOLOSCAN_TEST_WORKER_FRAGMENTS");
+  if (driver_address == nullptr || worker_address == nullptr || fragment_names == nullptr) {
+    GTEST_SKIP() << "Only run as a worker process of TestDriverStartupPhasesWithMultipleWorkers";
+  }
+
+  const std::vector<std::string> args{"test_app",
+                                      "--worker",
+                                      "--address",
+                                      driver_address,
+                                      "--worker-address",
+                                      worker_address,
+                                      "--fragments",
+                                      fragment_names};
+  auto app = make_application<UCXBroadcastApp>(args);
+  app->run();
+}
+
+TEST_F(DistributedApp, TestDriverTerminationWithConnectionFailure) {
   const char* env_orig = std::getenv("HOLOSCAN_MAX_CONNECTION_RETRY_COUNT");
 
   // Set retry count to 1 to save time
@@ -839,4 +1159,44 @@ TEST(DistributedApp, TestDriverTerminationWithConnectionFailure) {
   }
 }
 
+TEST_F(SharedMemoryDistributedApp, TestConnectionApp) {
+  auto app = make_application<UCXConnectionApp>();
+
+  // capture output so that we can check that the expected value is present
+  testing::internal::CaptureStderr();
+
+  app->run();
+
+  std::string log_output = testing::internal::GetCapturedStderr();
+  EXPECT_TRUE(log_output.find(kSharedMemoryConnectionLog) != std::string::npos);
+  EXPECT_TRUE(log_output.find("received count: 10") != std::string::npos);
+}
+
+TEST_F(SharedMemoryDistributedApp, TestLinearPipelineApp) {
+  auto app = make_application<UCXLinearPipelineApp>();
+
+  // capture output so that we can check that the expected value is present
+  testing::internal::CaptureStderr();
+
+  app->run();
+
+  std::string log_output = testing::internal::GetCapturedStderr();
+  EXPECT_TRUE(log_output.find(kSharedMemoryConnectionLog) != std::string::npos);
+  EXPECT_TRUE(log_output.find("received count: 10") != std::string::npos);
+}
+
+TEST_F(SharedMemoryDistributedApp, TestBroadcastApp) {
+  auto app = make_application<UCXBroadcastApp>();
+
+  // capture output so that we can check that the expected value is present
+  testing::internal::CaptureStderr();
+
+  app->run();
+
+  std::string log_output = testing::internal::GetCapturedStderr();
+  EXPECT_TRUE(log_output.find(kSharedMemoryConnectionLog) != std::string::npos);
+  EXPECT_TRUE(log_output.find("Rx fragment3.rx message received count: 10") != std::string::npos);
+  EXPECT_TRUE(log_output.find("Rx fragment4.rx message received count: 10") != std::string::npos);
+}
+
 }  // namespace holoscan
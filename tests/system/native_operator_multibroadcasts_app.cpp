@@ -18,6 +18,8 @@
 #include <gtest/gtest.h>
 #include <gxf/core/gxf.h>
 
+#include <chrono>
+#include <cstdlib>
 #include <string>
 
 #include <holoscan/holoscan.hpp>
@@ -35,9 +37,11 @@ namespace holoscan {
 
 class NativeMultiBroadcastsApp : public holoscan::Application {
  public:
+  explicit NativeMultiBroadcastsApp(int64_t count = 10) : count_(count) {}
+
   void compose() override {
     using namespace holoscan;
-    auto tx = make_operator<ops::PingMultiTxOp>("tx", make_condition<CountCondition>(10));
+    auto tx = make_operator<ops::PingMultiTxOp>("tx", make_condition<CountCondition>(count_));
     auto rx11 = make_operator<ops::PingMultiRxOp>("rx11");
     auto rx12 = make_operator<ops::PingMultiRxOp>("rx12");
     auto rx21 = make_operator<ops::PingMultiRxOp>("rx21");
@@ -49,8 +53,45 @@ class NativeMultiBroadcastsApp : public holoscan::Application {
     add_flow(tx, rx21, {{"out2", "receivers"}});
     add_flow(tx, rx22, {{"out2", "receivers"}});
   }
+
+ private:
+  int64_t count_ = 10;
 };
 
+/// Run the app with the native fan-out (MultiSubscriberTransmitter) enabled or disabled and
+/// return the wall-clock duration of `run()` in milliseconds.
+static double run_multi_broadcasts_app(bool native_broadcast, int64_t count) {
+  const char* env_orig = std::getenv("HOLOSCAN_ENABLE_NATIVE_BROADCAST");
+  setenv("HOLOSCAN_ENABLE_NATIVE_BROADCAST", native_broadcast ? "true" : "false", 1);
+
+  auto app = make_application<NativeMultiBroadcastsApp>(count);
+  const std::string config_file = test_config.get_test_data_file("minimal.yaml");
+  app->config(config_file);
+
+  auto start = std::chrono::steady_clock::now();
+  app->run();
+  auto end = std::chrono::steady_clock::now();
+
+  if (env_orig) {
+    setenv("HOLOSCAN_ENABLE_NATIVE_BROADCAST", env_orig, 1);
+  } else {
+    unsetenv("HOLOSCAN_ENABLE_NATIVE_BROADCAST");
+  }
+  return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+/// Count the occurrences of 'Rx message received (count: <count>, size: 1)' in `log_output`.
+static int count_received_messages(const std::string& log_output, int64_t count) {
+  int occurrences = 0;
+  std::string recv_string = fmt::format("Rx message received (count: {}, size: 1)", count);
+  auto pos = log_output.find(recv_string);
+  while (pos != std::string::npos) {
+    occurrences++;
+    pos = log_output.find(recv_string, pos + recv_string.size());
+  }
+  return occurrences;
+}
+
 TEST(NativeOperatorMultiBroadcastsApp, TestNativeOperatorMultiBroadcastsApp) {
   auto app = make_application<NativeMultiBroadcastsApp>();
 
@@ -76,4 +117,38 @@ TEST(NativeOperatorMultiBroadcastsApp, TestNativeOperatorMultiBroadcastsApp) {
   EXPECT_EQ(count, 4);
 }
 
+TEST(NativeOperatorMultiBroadcastsApp, TestBroadcastEntityFallback) {
+  // capture output so that we can check that the expected value is present
+  testing::internal::CaptureStderr();
+
+  run_multi_broadcasts_app(false, 10);
+
+  std::string log_output = testing::internal::GetCapturedStderr();
+  EXPECT_EQ(count_received_messages(log_output, 10), 4);
+}
+
+TEST(NativeOperatorMultiBroadcastsApp, BenchmarkNativeBroadcast) {
+  // Compare the native fan-out with the Broadcast entity. Timings are only reported, not checked,
+  // as they depend on the machine.
+  constexpr int64_t kCount = 1000;
+
+  // Both modes must deliver every message to each of the four receivers.
+  testing::internal::CaptureStderr();
+  double broadcast_entity_ms = run_multi_broadcasts_app(false, kCount);
+  std::string broadcast_entity_log = testing::internal::GetCapturedStderr();
+  EXPECT_EQ(count_received_messages(broadcast_entity_log, kCount), 4);
+
+  testing::internal::CaptureStderr();
+  double native_ms = run_multi_broadcasts_app(true, kCount);
+  std::string native_log = testing::internal::GetCapturedStderr();
+  EXPECT_EQ(count_received_messages(native_log, kCount), 4);
+
+  HOLOSCAN_LOG_INFO("{} messages to 4 receivers: Broadcast entity {:.2f} ms, native {:.2f} ms",
+                    kCount,
+                    broadcast_entity_ms,
+                    native_ms);
+  RecordProperty("broadcast_entity_ms", std::to_string(broadcast_entity_ms));
+  RecordProperty("native_broadcast_ms", std::to_string(native_ms));
+}
+
 }  // namespace holoscan
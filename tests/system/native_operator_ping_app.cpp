@@ -18,6 +18,8 @@
 #include <gtest/gtest.h>
 #include <gxf/core/gxf.h>
 
+#include <cstdlib>
+#include <stdexcept>
 #include <string>
 
 #include <holoscan/holoscan.hpp>
@@ -45,6 +47,48 @@ class NativeOpApp : public holoscan::Application {
   }
 };
 
+// Counts the calls to start() and stop() of the operators of NativeOpStartFailureApp.
+static int started_operator_count = 0;
+static int stopped_operator_count = 0;
+
+class CountingStartStopOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(CountingStartStopOp)
+
+  CountingStartStopOp() = default;
+
+  void setup(OperatorSpec& spec) override { spec.output<int>("out"); }
+  void start() override { ++started_operator_count; }
+  void stop() override { ++stopped_operator_count; }
+  void compute(InputContext&, OutputContext& op_output, ExecutionContext&) override {
+    op_output.emit(1, "out");
+  }
+};
+
+class FailingStartOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(FailingStartOp)
+
+  FailingStartOp() = default;
+
+  void setup(OperatorSpec& spec) override { spec.input<int>("in"); }
+  void start() override { throw std::runtime_error("FailingStartOp cannot start"); }
+  void compute(InputContext& op_input, OutputContext&, ExecutionContext&) override {
+    op_input.receive<int>("in");
+  }
+};
+
+class NativeOpStartFailureApp : public holoscan::Application {
+ public:
+  void compose() override {
+    using namespace holoscan;
+    auto tx = make_operator<CountingStartStopOp>("tx", make_condition<CountCondition>(10));
+    auto rx = make_operator<FailingStartOp>("rx");
+
+    add_flow(tx, rx);
+  }
+};
+
 TEST(NativeOperatorPingApp, TestNativeOperatorPingApp) {
   auto app = make_application<NativeOpApp>();
 
@@ -61,4 +105,99 @@ TEST(NativeOperatorPingApp, TestNativeOperatorPingApp) {
   EXPECT_TRUE(log_output.find("value2: 100") != std::string::npos);
 }
 
+TEST(NativeOperatorPingApp, TestNativeOperatorPingAppWithLazyGXFExtensions) {
+  const char* env_orig = std::getenv("HOLOSCAN_LAZY_GXF_EXTENSIONS");
+
+  // Load only the GXF extensions required by the graph
+  setenv("HOLOSCAN_LAZY_GXF_EXTENSIONS", "true", 1);
+
+  auto app = make_application<NativeOpApp>();
+
+  const std::string config_file = test_config.get_test_data_file("minimal.yaml");
+  app->config(config_file);
+
+  // capture output so that we can check that the expected value is present
+  testing::internal::CaptureStderr();
+
+  app->run();
+
+  std::string log_output = testing::internal::GetCapturedStderr();
+  EXPECT_TRUE(log_output.find("value1: 1") != std::string::npos);
+  EXPECT_TRUE(log_output.find("value2: 100") != std::string::npos);
+  // The ping operators only use types of the standard extension
+  EXPECT_TRUE(log_output.find("(0 extensions: [])") != std::string::npos);
+
+  // restore the original environment variable
+  if (env_orig) {
+    setenv("HOLOSCAN_LAZY_GXF_EXTENSIONS", env_orig, 1);
+  } else {
+    unsetenv("HOLOSCAN_LAZY_GXF_EXTENSIONS");
+  }
+}
+
+
+TEST(NativeOperatorPingApp, TestNativeOperatorPingAppWithParallelOperatorStart) {
+  const char* env_orig = std::getenv("HOLOSCAN_PARALLEL_OPERATOR_START");
+
+  // Start the operators from the executor instead of from GXF
+  setenv("HOLOSCAN_PARALLEL_OPERATOR_START", "true", 1);
+
+  auto app = make_application<NativeOpApp>();
+
+  const std::string config_file = test_config.get_test_data_file("minimal.yaml");
+  app->config(config_file);
+
+  // capture output so that we can check that the expected value is present
+  testing::internal::CaptureStderr();
+
+  app->run();
+
+  std::string log_output = testing::internal::GetCapturedStderr();
+  EXPECT_TRUE(log_output.find("value1: 1") != std::string::npos);
+  EXPECT_TRUE(log_output.find("value2: 100") != std::string::npos);
+
+  // Each operator is started exactly once
+  size_t start_count = 0;
+  for (const auto& record : app->startup_profiler().records()) {
+    if (record.phase == StartupProfiler::kOperatorStart) { ++start_count; }
+  }
+  EXPECT_EQ(start_count, 2);
+
+  // restore the original environment variable
+  if (env_orig) {
+    setenv("HOLOSCAN_PARALLEL_OPERATOR_START", env_orig, 1);
+  } else {
+    unsetenv("HOLOSCAN_PARALLEL_OPERATOR_START");
+  }
+}
+
+TEST(NativeOperatorPingApp, TestParallelOperatorStartFailureStopsStartedOperators) {
+  const char* env_orig = std::getenv("HOLOSCAN_PARALLEL_OPERATOR_START");
+
+  // Start the operators from the executor instead of from GXF
+  setenv("HOLOSCAN_PARALLEL_OPERATOR_START", "true", 1);
+
+  started_operator_count = 0;
+  stopped_operator_count = 0;
+  auto app = make_application<NativeOpStartFailureApp>();
+
+  testing::internal::CaptureStderr();
+
+  EXPECT_THROW(app->run(), std::runtime_error);
+
+  std::string log_output = testing::internal::GetCapturedStderr();
+  EXPECT_TRUE(log_output.find("Operator 'rx' is not started") != std::string::npos);
+
+  // The upstream operator was started before the failure and must be stopped
+  EXPECT_EQ(started_operator_count, 1);
+  EXPECT_EQ(stopped_operator_count, 1);
+
+  // restore the original environment variable
+  if (env_orig) {
+    setenv("HOLOSCAN_PARALLEL_OPERATOR_START", env_orig, 1);
+  } else {
+    unsetenv("HOLOSCAN_PARALLEL_OPERATOR_START");
+  }
+}
+
 }  // namespace holoscan
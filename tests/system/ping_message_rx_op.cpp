@@ -51,6 +51,7 @@ void PingMessageRxOp::setup(OperatorSpec& spec) {
       spec.input<uint32_t>("in");
       break;
     case MessageType::STRING:
+    case MessageType::STRING_LARGE:
       spec.input<std::string>("in");
       break;
     case MessageType::VEC_BOOL:
@@ -75,6 +76,7 @@ void PingMessageRxOp::setup(OperatorSpec& spec) {
       spec.input<std::vector<std::vector<std::string>>>("in");
       break;
     case MessageType::VEC_INPUTSPEC:
+    case MessageType::VEC_INPUTSPEC_LARGE:
       spec.input<std::vector<HolovizOp::InputSpec>>("in");
       break;
     case MessageType::VEC_DOUBLE_LARGE:
@@ -237,6 +239,32 @@ void PingMessageRxOp::compute(InputContext& op_input, OutputContext&, ExecutionC
       }
       break;
     }
+    case MessageType::STRING_LARGE: {
+      auto value = op_input.receive<std::string>("in");
+      if (value) {
+        std::string expected(100'000, 'a');
+        for (size_t i = 0; i < expected.size(); i++) {
+          expected[i] = static_cast<char>('a' + i % 26);
+        }
+        valid_value = value.value() == expected;
+      }
+      break;
+    }
+    case MessageType::VEC_INPUTSPEC_LARGE: {
+      auto value = op_input.receive<std::vector<HolovizOp::InputSpec>>("in");
+      if (value) {
+        std::vector<HolovizOp::InputSpec> result = value.value();
+        valid_value = result.size() == 1;
+        if (valid_value) {
+          const HolovizOp::InputSpec& res0 = result[0];
+          valid_value &= res0.tensor_name_ == std::string(20'000, 't');
+          valid_value &= res0.type_ == HolovizOp::InputType::TEXT;
+          valid_value &= res0.color_ == std::vector<float>(8'192, 0.5f);
+          valid_value &= res0.text_ == std::vector<std::string>{std::string(20'000, 'x'), "y"};
+        }
+      }
+      break;
+    }
     case MessageType::VEC_DOUBLE_LARGE: {
       auto value = op_input.receive<std::vector<double>>("in");
       if (value) {
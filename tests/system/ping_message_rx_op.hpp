@@ -32,6 +32,7 @@ enum class MessageType {
   INT32,
   UINT32,
   STRING,
+  STRING_LARGE,
   VEC_BOOL,
   VEC_FLOAT,
   VEC_DOUBLE_LARGE,
@@ -41,6 +42,7 @@ enum class MessageType {
   VEC_VEC_FLOAT,
   VEC_VEC_STRING,
   VEC_INPUTSPEC,
+  VEC_INPUTSPEC_LARGE,
 };
 
 static const std::unordered_map<MessageType, std::string> message_type_name_map{
@@ -58,6 +60,9 @@ static const std::unordered_map<MessageType, std::string> message_type_name_map{
     {MessageType::VEC_VEC_STRING, "std::vector<std::vector<std::string>>"},
     {MessageType::VEC_INPUTSPEC, "std::vector<holoscan::ops::HolovizOp::InputSpec>"},
     {MessageType::VEC_DOUBLE_LARGE, "std::vector<double> (large buffer size)"},
+    {MessageType::STRING_LARGE, "std::string (large)"},
+    {MessageType::VEC_INPUTSPEC_LARGE,
+     "std::vector<holoscan::ops::HolovizOp::InputSpec> (large buffer size)"},
 };
 
 namespace ops {
@@ -51,6 +51,7 @@ void PingMessageTxOp::setup(OperatorSpec& spec) {
       spec.output<uint32_t>("out");
       break;
     case MessageType::STRING:
+    case MessageType::STRING_LARGE:
       spec.output<std::string>("out");
       break;
     case MessageType::VEC_BOOL:
@@ -75,6 +76,7 @@ void PingMessageTxOp::setup(OperatorSpec& spec) {
       spec.output<std::vector<std::vector<std::string>>>("out");
       break;
     case MessageType::VEC_INPUTSPEC:
+    case MessageType::VEC_INPUTSPEC_LARGE:
       spec.output<std::vector<HolovizOp::InputSpec>>("out");
       break;
     case MessageType::VEC_DOUBLE_LARGE:
@@ -168,6 +170,22 @@ void PingMessageTxOp::compute(InputContext&, OutputContext& op_output, Execution
       op_output.emit(specs, "out");
       break;
     }
+    case MessageType::STRING_LARGE: {
+      // large enough to be sent as a borrowed segment (Endpoint::kBorrowedSegmentMinSize)
+      std::string value(100'000, 'a');
+      for (size_t i = 0; i < value.size(); i++) { value[i] = static_cast<char>('a' + i % 26); }
+      op_output.emit(value, "out");
+      break;
+    }
+    case MessageType::VEC_INPUTSPEC_LARGE: {
+      // the large members are serialized by the nested codecs of HolovizOp::InputSpec
+      HolovizOp::InputSpec spec{std::string(20'000, 't'), HolovizOp::InputType::TEXT};
+      spec.color_ = std::vector<float>(8'192, 0.5f);
+      spec.text_ = std::vector<std::string>{std::string(20'000, 'x'), "y"};
+      std::vector<HolovizOp::InputSpec> specs{spec};
+      op_output.emit(specs, "out");
+      break;
+    }
     case MessageType::VEC_DOUBLE_LARGE: {
       // setting size large enough to exceed kDefaultUcxSerializationBufferSize
       std::vector<double> value(1'000'000);
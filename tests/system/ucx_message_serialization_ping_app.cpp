@@ -143,11 +143,14 @@ TEST_P(UcxMessageTypeParmeterizedTestFixture, TestUcxMessageSerializationApp) {
 
   const char* env_orig = std::getenv("HOLOSCAN_UCX_SERIALIZATION_BUFFER_SIZE");
 
-  if (message_type == MessageType::VEC_DOUBLE_LARGE) {
+  // STRING_LARGE is sent as a borrowed segment, so it does not need a larger buffer
+  const bool large_buffer = message_type == MessageType::VEC_DOUBLE_LARGE ||
+                            message_type == MessageType::VEC_INPUTSPEC_LARGE;
+  if (large_buffer) {
     // message is larger than kDefaultUcxSerializationBufferSize
     // set HOLOSCAN_UCX_SERIALIZATION_BUFFER_SIZE to a value large enough to hold the data
-    const char* buffer_size = std::to_string(10 * 1024 * 1024).c_str();
-    setenv("HOLOSCAN_UCX_SERIALIZATION_BUFFER_SIZE", buffer_size, 1);
+    const std::string buffer_size = std::to_string(10 * 1024 * 1024);
+    setenv("HOLOSCAN_UCX_SERIALIZATION_BUFFER_SIZE", buffer_size.c_str(), 1);
   }
 
   HOLOSCAN_LOG_INFO("Creating UcxMessageSerializationApp for type: {}",
@@ -166,7 +169,7 @@ TEST_P(UcxMessageTypeParmeterizedTestFixture, TestUcxMessageSerializationApp) {
               std::string::npos);
 
   // restore the original log level
-  if (message_type == MessageType::VEC_DOUBLE_LARGE) {
+  if (large_buffer) {
     if (env_orig) {
       setenv("HOLOSCAN_UCX_SERIALIZATION_BUFFER_SIZE", env_orig, 1);
     } else {
@@ -183,6 +186,7 @@ INSTANTIATE_TEST_CASE_P(UcxMessageSerializationAppTests, UcxMessageTypeParmeteri
                                           MessageType::SHARED_VEC_STRING, MessageType::VEC_VEC_BOOL,
                                           MessageType::VEC_VEC_FLOAT, MessageType::VEC_VEC_STRING,
                                           MessageType::VEC_INPUTSPEC,
-                                          MessageType::VEC_DOUBLE_LARGE));
+                                          MessageType::VEC_DOUBLE_LARGE, MessageType::STRING_LARGE,
+                                          MessageType::VEC_INPUTSPEC_LARGE));
 
 }  // namespace holoscan